@@ -13,6 +13,14 @@
  * Strings, along with converting a managed string array to its heap-allocated
  * equivalent for use by native code.
  *
+ * When the culture changes, we probe how it treats ASCII text, so that the
+ * native string functions know whether they can handle pure ASCII input one
+ * byte at a time without changing any results, and whether the native case
+ * folding should use the Turkic mappings for the letter I. We also record the
+ * primary sort order of the ASCII letters and digits, so that the 'utf[_i]'
+ * collations can tell which of two strings comes first without leaving native
+ * code when they first differ by a letter or digit.
+ *
  * The two static Encoding variables are not assigned to the static default
  * Encoding.UTF8 and Encoding.Unicode objects, because those may have been
  * monkeyed with by other managed applications running on the host machine.
@@ -30,21 +38,27 @@ using namespace System::Runtime::InteropServices;
 using namespace System::Text::RegularExpressions;
 using namespace System::Threading;
 
+/* Primary sort ranks of the ASCII letters and digits; see Common::AsciiRank */
+static u8 asciiRank[128];
+
 namespace UtilityExtensions {
 
+  const u8 *Common::AsciiRank::get(void) {
+    return asciiRank;
+  }
+
   String^ Common::GetString(DbStr *pInput) {
     assert(pInput);
     String^ result = String::Empty;
     int cbIn = pInput->cb;
     if (cbIn > 0) {
-      array<u8>^ arr = gcnew array<u8>(cbIn);
-      pin_ptr<u8> pIn = &arr[0];
-      memcpy(pIn, pInput->pText, (size_t)cbIn);
+      // decode straight from the native buffer, without a managed copy
       if (pInput->isWide) {
-        result = _encoding16->GetString(arr);
+        result = gcnew String((wchar_t*)pInput->pText, 0, cbIn / 2);
       }
       else {
-        result = _encoding8->GetString(arr);
+        result = gcnew String((char*)pInput->pText, 0, cbIn,
+                              _encoding8);
       }
     }
     return result;
@@ -75,6 +89,8 @@ namespace UtilityExtensions {
       if (culture != nullptr) {
         *prev = _culture->LCID;
         _culture = culture;
+        _cultureVersion++;
+        probeAscii();
       }
       return RESULT_OK;
     }
@@ -83,6 +99,67 @@ namespace UtilityExtensions {
     }
   }
 
+  void Common::probeAscii(void) {
+    // This runs once per culture change, so it can afford to be thorough.
+    String^ lower = "abcdefghijklmnopqrstuvwxyz";
+    String^ upper = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    String^ letters = lower + upper;
+    CompareInfo^ ci = _culture->CompareInfo;
+    TextInfo^ ti = _culture->TextInfo;
+    bool casing = String::Equals(ti->ToUpper(lower), upper) &&
+                  String::Equals(ti->ToLower(upper), lower);
+    for (int i = 0; casing && i < 26; i++) {
+      casing = ci->Compare(lower, i, 1, upper, i, 1,
+                           CompareOptions::IgnoreCase) == 0;
+    }
+    bool ordinal = ci->IndexOf("co-op", "coop") < 0 &&
+                   ci->IndexOf("it's", "its") < 0;
+    for (int i = 0; ordinal && i < letters->Length; i++) {
+      String^ first = letters->Substring(i, 1);
+      for (int j = 0; ordinal && j < letters->Length; j++) {
+        // a contraction like "ch" or "aa" won't match its own first letter
+        String^ pair = String::Concat(first, letters->Substring(j, 1));
+        ordinal = ci->IsPrefix(pair, first) &&
+                  ci->IndexOf(pair, letters[j]) == 1;
+      }
+    }
+    String^ lang = _culture->TwoLetterISOLanguageName;
+    _asciiCasing = casing;
+    _asciiOrdinal = ordinal;
+    _turkicCasing = String::Equals(lang, "tr") || String::Equals(lang, "az");
+    probeRanks();
+  }
+
+  void Common::probeRanks(void) {
+    // Sort the letters and digits, then walk the sorted list to see which
+    // neighbors differ in their primary weights: if they do, the difference
+    // decides a comparison no matter what follows, so "xz" sorts before "ya".
+    memset(asciiRank, 0, sizeof(asciiRank));
+    if (!_asciiOrdinal) return;
+    String^ chars = "0123456789abcdefghijklmnopqrstuvwxyz";
+    array<String^>^ sorted = gcnew array<String^>(chars->Length);
+    for (int i = 0; i < chars->Length; i++) {
+      sorted[i] = chars->Substring(i, 1);
+    }
+    CompareInfo^ ci = _culture->CompareInfo;
+    Array::Sort(sorted, StringComparer::Create(_culture, true));
+    String^ first = sorted[0];
+    String^ last = sorted[sorted->Length - 1];
+    u8 rank = 1;
+    for (int i = 0; i < sorted->Length; i++) {
+      if (i > 0 && ci->Compare(String::Concat(sorted[i - 1], last),
+                               String::Concat(sorted[i], first),
+                               CompareOptions::IgnoreCase) < 0)
+      {
+        rank++;
+      }
+      wchar_t c = sorted[i][0];
+      asciiRank[c] = rank;
+      // upper case letters only weigh the same if the culture says they do
+      if (c >= 'a' && _asciiCasing) asciiRank[c - 0x20] = rank;
+    }
+  }
+
   int Common::SetErrorString(String^ output, char **pzResult) {
     assert(output != nullptr);
     assert(output->Length > 0);
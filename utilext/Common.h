@@ -34,6 +34,60 @@ namespace UtilityExtensions {
       }
     };
 
+    /// <summary>
+    /// Gets whether the current culture maps the ASCII letters to upper- and
+    /// lower-case the same way the invariant culture does, so that ASCII text
+    /// can be case-mapped or compared without case one byte at a time.
+    /// </summary>
+    static property bool AsciiCasing {
+      bool get(void) {
+        return _asciiCasing;
+      }
+    };
+
+    /// <summary>
+    /// Gets whether a culture-sensitive search of printable ASCII text gives
+    /// the same result as an ordinal search. This is not the case for cultures
+    /// that contract pairs of ASCII letters into a single sort element, or
+    /// that let hyphens and apostrophes be passed over.
+    /// </summary>
+    static property bool AsciiOrdinal {
+      bool get(void) {
+        return _asciiOrdinal;
+      }
+    };
+
+    /// <summary>
+    /// Gets a table of the primary sort weights of the ASCII letters and
+    /// digits under the current culture, as small ranks indexed by the code
+    /// point. Letters and digits that the culture weighs the same get the same
+    /// rank, and all of the other ASCII characters get zero. The table is all
+    /// zeros unless <see cref="AsciiOrdinal"/> is true.
+    /// </summary>
+    static property const u8 *AsciiRank {
+      const u8 *get(void);
+    };
+
+    /// <summary>
+    /// Gets a number that changes every time the culture is set, so that
+    /// anything derived from the previous culture can be discarded.
+    /// </summary>
+    static property int CultureVersion {
+      int get(void) {
+        return _cultureVersion;
+      }
+    };
+
+    /// <summary>
+    /// Gets whether the current culture uses the Turkic case mappings for
+    /// dotted and dotless I when case is ignored.
+    /// </summary>
+    static property bool TurkicCasing {
+      bool get(void) {
+        return _turkicCasing;
+      }
+    };
+
     /// <summary>
     /// Converts a native pointer into a managed string, using the specified
     /// encoding.
@@ -96,10 +150,17 @@ namespace UtilityExtensions {
     static CultureInfo^ _culture;
     static Encoding^ _encoding8;
     static Encoding^ _encoding16;
+    static bool _asciiCasing;
+    static bool _asciiOrdinal;
+    static bool _turkicCasing;
+    static int _cultureVersion;
+    static void probeAscii(void);
+    static void probeRanks(void);
     static Common() {
       _encoding8 = gcnew UTF8Encoding;
       _encoding16 = gcnew UnicodeEncoding;
       _culture = CultureInfo::CurrentCulture;
+      probeAscii();
     }
   };
 }
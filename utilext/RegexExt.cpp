@@ -8,8 +8,9 @@
  *
  * RegexExt class implementation.
  *
- * We are wrapping only 3 Regex functions: Regex.Match(), Regex.Replace(), and
- * Regex.Split(). 
+ * We are wrapping only 4 Regex functions: Regex.Match(), Regex.Replace(),
+ * Regex.Split(), and Regex.Matches(), which regmatch(), regexp_count(), and
+ * regexp_extract() share.
  *
  *============================================================================*/
 
@@ -129,6 +130,174 @@ namespace UtilityExtensions {
       return ERR_REGEX_TIMEOUT;
     }
   }
+
+  int REX::Regmatch(DbStr *pSource,
+                    DbStr *pPattern,
+                    int ms,
+                    char **zError,
+                    int *pnGroup,
+                    int *pnMatch,
+                    int **paSpan)
+  {
+    assert(pSource);
+    assert(pPattern);
+    assert(!pSource->isWide);
+    int rc = RESULT_OK;
+    TimeSpan ts = (ms <= 0) ? Regex::InfiniteMatchTimeout
+                            : TimeSpan(ms * TimeSpan::TicksPerMillisecond);
+
+    // table-valued function text arguments are always retrieved as UTF-8.
+    String^ source = Common::GetString(pSource);
+    String^ pattern = Common::GetString(pPattern);
+    try {
+      Regex^ regex = gcnew Regex(pattern, RegexOptions::None, ts);
+      MatchCollection^ matches = regex->Matches(source);
+      int nMatch = matches->Count;
+      int nGroup = 0;
+      for each (int n in regex->GetGroupNumbers()) {
+        if (n >= nGroup) nGroup = n + 1;
+      }
+      // byte offset of each char index, since the spans are slices of the
+      // UTF-8 input; the low half of a surrogate pair gets the offset of the
+      // pair
+      array<int>^ offsets = gcnew array<int>(source->Length + 1);
+      int cb = 0;
+      for (int i = 0; i < source->Length; i++) {
+        wchar_t c = source[i];
+        offsets[i] = cb;
+        if (c < 0x80) {
+          cb += 1;
+        }
+        else if (c < 0x800) {
+          cb += 2;
+        }
+        else if (Char::IsSurrogatePair(source, i)) {
+          offsets[++i] = cb;
+          cb += 4;
+        }
+        else {
+          cb += 3;
+        }
+      }
+      offsets[source->Length] = cb;
+      // malloc(0) may return NULL, so always ask for at least one byte
+      size_t cbSpan = (size_t)nMatch * nGroup * 2 * sizeof(int);
+      int *aSpan = (int*)malloc(cbSpan > 0 ? cbSpan : 1);
+      if (aSpan == nullptr) return ERR_NOMEM;
+      int *pSpan = aSpan;
+      for each (Match^ match in matches) {
+        for (int g = 0; g < nGroup; g++) {
+          Group^ group = match->Groups[g];
+          if (group->Success) {
+            *pSpan++ = offsets[group->Index];
+            *pSpan++ = offsets[group->Index + group->Length];
+          }
+          else {
+            *pSpan++ = -1;
+            *pSpan++ = -1;
+          }
+        }
+      }
+      *pnGroup = nGroup;
+      *pnMatch = nMatch;
+      *paSpan = aSpan;
+      return RESULT_OK;
+    }
+    catch (ArgumentException^ ex) {
+      rc = Common::SetErrorString(ex->Message, zError);
+      if (rc == RESULT_OK) {
+        return ERR_REGEX_PARSE;
+      }
+      else {
+        return rc;
+      }
+    }
+    catch (RegexMatchTimeoutException^) {
+      return ERR_REGEX_TIMEOUT;
+    }
+  }
+
+  int REX::Regcount(DbStr *pSource,
+                    DbStr *pPattern,
+                    int ms,
+                    char **zError,
+                    int *pResult)
+  {
+    assert(pSource);
+    assert(pPattern);
+    assert(pResult);
+    int rc = RESULT_OK;
+    TimeSpan ts = (ms <= 0) ? Regex::InfiniteMatchTimeout
+                            : TimeSpan(ms * TimeSpan::TicksPerMillisecond);
+
+    String^ source = Common::GetString(pSource);
+    String^ pattern = Common::GetString(pPattern);
+    try {
+      *pResult = Regex::Matches(source, pattern, RegexOptions::None,
+                                ts)->Count;
+      return RESULT_OK;
+    }
+    catch (ArgumentException^ ex) {
+      rc = Common::SetErrorString(ex->Message, zError);
+      if (rc == RESULT_OK) {
+        return ERR_REGEX_PARSE;
+      }
+      else {
+        return rc;
+      }
+    }
+    catch (RegexMatchTimeoutException^) {
+      return ERR_REGEX_TIMEOUT;
+    }
+  }
+
+  int REX::Regextract(DbStr *pSource,
+                      DbStr *pPattern,
+                      int group,
+                      int occurrence,
+                      int ms,
+                      char **zError,
+                      DbStr *pResult)
+  {
+    assert(pSource);
+    assert(pPattern);
+    assert(pResult);
+    assert(occurrence > 0);
+    int rc = RESULT_OK;
+    TimeSpan ts = (ms <= 0) ? Regex::InfiniteMatchTimeout
+                            : TimeSpan(ms * TimeSpan::TicksPerMillisecond);
+
+    String^ source = Common::GetString(pSource);
+    String^ pattern = Common::GetString(pPattern);
+    try {
+      Regex^ regex = gcnew Regex(pattern, RegexOptions::None, ts);
+      // the name of a group number that isn't in the pattern is empty
+      if (group < 0 || regex->GroupNameFromNumber(group)->Length == 0) {
+        return ERR_INDEX;
+      }
+      Match^ match = regex->Match(source);
+      while (match->Success && --occurrence > 0) {
+        match = match->NextMatch();
+      }
+      if (!match->Success || !match->Groups[group]->Success) {
+        return RESULT_NULL;
+      }
+      return Common::SetString(match->Groups[group]->Value, pSource->isWide,
+                               pResult);
+    }
+    catch (ArgumentException^ ex) {
+      rc = Common::SetErrorString(ex->Message, zError);
+      if (rc == RESULT_OK) {
+        return ERR_REGEX_PARSE;
+      }
+      else {
+        return rc;
+      }
+    }
+    catch (RegexMatchTimeoutException^) {
+      return ERR_REGEX_TIMEOUT;
+    }
+  }
 }
 
 #endif // !UTILEXT_OMIT_REGEX
@@ -87,5 +87,81 @@ namespace UtilityExtensions {
       char **zError,
       DbStrArr *pResult
     );
+
+    /// <summary>
+    /// Finds all of the matches of the specified regular expression pattern
+    /// in the source string, along with the capture groups of each one.
+    /// </summary>
+    /// <param name="pSource">Pointer to a native UTF-8 string</param>
+    /// <param name="pPattern">Pointer to a native pattern string</param>
+    /// <param name="ms">Timeout interval in milliseconds</param>
+    /// <param name="zError">Pointer to hold any error message</param>
+    /// <param name="pnGroup">Pointer to hold the count of groups, including
+    /// group 0</param>
+    /// <param name="pnMatch">Pointer to hold the count of matches</param>
+    /// <param name="paSpan">Pointer to hold the spans</param>
+    /// <returns>
+    /// An integer result code. If successful, an integer array is allocated
+    /// and assigned to <paramref name="paSpan"/>. It holds the start and end
+    /// byte offsets in <paramref name="pSource"/> of each group of each
+    /// match, or -1 for a group that didn't take part in the match.
+    /// </returns>
+    static int Regmatch(
+      DbStr *pSource,
+      DbStr *pPattern,
+      int ms,
+      char **zError,
+      int *pnGroup,
+      int *pnMatch,
+      int **paSpan
+    );
+
+    /// <summary>
+    /// Counts the matches of the specified regular expression pattern in the
+    /// source string.
+    /// </summary>
+    /// <param name="pSource">Pointer to a native string</param>
+    /// <param name="pPattern">Pointer to a native pattern string</param>
+    /// <param name="ms">Timeout interval in milliseconds</param>
+    /// <param name="zError">Pointer to hold any error message</param>
+    /// <param name="pResult">Pointer to hold the result</param>
+    /// <returns>
+    /// An integer result code. If successful, the count of matches is written
+    /// to <paramref name="pResult"/>.
+    /// </returns>
+    static int Regcount(
+      DbStr *pSource,
+      DbStr *pPattern,
+      int ms,
+      char **zError,
+      int *pResult
+    );
+
+    /// <summary>
+    /// Gets the text of a capture group of one of the matches of the
+    /// specified regular expression pattern in the source string.
+    /// </summary>
+    /// <param name="pSource">Pointer to a native string</param>
+    /// <param name="pPattern">Pointer to a native pattern string</param>
+    /// <param name="group">The group number, or 0 for the whole match</param>
+    /// <param name="occurrence">The match number, counting from 1</param>
+    /// <param name="ms">Timeout interval in milliseconds</param>
+    /// <param name="zError">Pointer to hold any error message</param>
+    /// <param name="pResult">Pointer to hold the result</param>
+    /// <returns>
+    /// An integer result code. If successful, a string is allocated and
+    /// assigned to <paramref name="pResult"/>. RESULT_NULL is returned if
+    /// there aren't that many matches, or the group didn't take part in the
+    /// match, and ERR_INDEX if the pattern has no such group.
+    /// </returns>
+    static int Regextract(
+      DbStr *pSource,
+      DbStr *pPattern,
+      int group,
+      int occurrence,
+      int ms,
+      char **zError,
+      DbStr *pResult
+    );
   };
 }
\ No newline at end of file
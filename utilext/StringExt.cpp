@@ -16,6 +16,12 @@
  * omitted. For matching character sequences 'glob-fashion', we use the REGEXP
  * function. The GLOB function in the sqlite core is unaffected.
  *
+ * Anywhere a "character" means a user-perceived character, we use the native
+ * grapheme cluster routines in "unicode.c" rather than the StringInfo class,
+ * since the .NET Framework version of StringInfo predates the extended
+ * grapheme cluster rules of UAX #29. For a managed String, that means pinning
+ * the chars and walking them as UTF-16 text.
+ *
  * Note: if we ever wanted to port this library to .NET 5 or later, we would
  * have to make sure that the switch from NLS to ICU is both compatible with
  * existing code, and produces the same results.
@@ -25,7 +31,9 @@
 #ifndef UTILEXT_OMIT_STRING
 
 #include <assert.h>
+#include <stdlib.h>
 #include <string.h>
+#include <vcclr.h>
 #include "StringExt.h"
 
 using namespace System;
@@ -39,296 +47,22 @@ namespace UtilityExtensions {
 
   int EXT::CharIndex(DbStr *pIn,
                      DbStr *pPattern,
-                     int index,
                      bool noCase,
                      int *pResult)
   {
-    int result = -1;
-    assert(index > 0); // should start out greater than zero
-
-    index--; // adjust back to zero-based index
     String^ source = Common::GetString(pIn);
     String^ pattern = Common::GetString(pPattern);
-    StringInfo^ srcInfo = gcnew StringInfo(source);
     CompareOptions opt = noCase ? CompareOptions::IgnoreCase :
                                   CompareOptions::None;
-    CompareInfo^ ci = Common::Culture->CompareInfo;
-    int lte = srcInfo->LengthInTextElements;
-    if (lte == source->Length) {
-      // grapheme indexes are the same as char indexes, so do it the easy way
-      if (index > 0 && index >= source->Length) {
-        return ERR_INDEX;
-      }
-      result = ci->IndexOf(source, pattern, index, opt);
-    }
-    else {
-      if (index > 0 && index >= lte) {
-        return ERR_INDEX;
-      }
-      array<int>^ indices = StringInfo::ParseCombiningCharacters(source);
-      int idx = ci->IndexOf(source, pattern, index, opt);
-      if (idx > 0) {
-        for (int i = 0; i < indices->Length - 1; i++) {
-          if (idx == indices[i]) {
-            result = i;
-            break;
-          }
-        }
-      }
-      else {
-        result = idx;
-      }
-    }
-    *pResult = result + 1;
+    int idx = Common::Culture->CompareInfo->IndexOf(source, pattern, opt);
+    // only count the characters in front of the match
+    *pResult = (idx > 0) ? graphemeIndex(source, idx) : idx;
     return RESULT_OK;
   }
-    
-  int EXT::ExFilter(DbStr *pIn, DbStr *pMatch, bool noCase, DbStr *pResult) {
-    StringBuilder^ sb = nullptr;
-    String^ result = nullptr;
-    String^ input = Common::GetString(pIn);
-    String^ match = Common::GetString(pMatch);
-    if (input->Length == 0) {
-      return Common::SetString("", pIn->isWide, pResult);
-    }
-    if (match->Length == 0) {
-      return Common::SetString(input, pIn->isWide, pResult);
-    }
-    sb = gcnew StringBuilder(input->Length);
-    StringInfo^ srcInfo = gcnew StringInfo(input);
-    StringInfo^ mchInfo = gcnew StringInfo(match);
-    if (srcInfo->LengthInTextElements == input->Length &&
-        mchInfo->LengthInTextElements == match->Length)
-    {
-      CompareOptions cmpOpt = noCase ? CompareOptions::IgnoreCase :
-                                       CompareOptions::None;
-      array<wchar_t>^ source = input->ToCharArray();
-      CompareInfo^ ci = Common::Culture->CompareInfo;
-      for (int i = 0; i != source->Length; i++) {
-        if (ci->IndexOf(match, source[i], cmpOpt) < 0) {
-          sb->Append(source[i]);
-        }
-      }
-    }
-    else {
-      array<String^>^ srcChars = nullptr;
-      array<String^>^ ptChars = nullptr;
-      if (noCase) {
-        srcChars = parseGraphemes(input->ToLower(Common::Culture));
-        ptChars = parseGraphemes(match->ToLower(Common::Culture));
-      }
-      else {
-        srcChars = parseGraphemes(input);
-        ptChars = parseGraphemes(match);
-      }
-      for (int i = 0; i < srcChars->Length; i++) {
-        if (Array::IndexOf<String^>(ptChars, srcChars[i]) < 0) {
-          sb->Append(srcChars[i]);
-        }
-      }
-    }
-    result = sb->ToString();
-    return Common::SetString(result, pIn->isWide, pResult);
-  }
 
-  int EXT::InFilter(DbStr *pIn, DbStr *pMatch, bool noCase, DbStr *pResult) {
-    StringBuilder^ sb = nullptr;
-    String^ result = nullptr;
-    String^ input = Common::GetString(pIn);
-    String^ match = Common::GetString(pMatch);
-    if ((input->Length == 0) || (match->Length == 0)) {
-      return Common::SetString("", pIn->isWide, pResult);
-    }
-    sb = gcnew StringBuilder(input->Length);
-    StringInfo^ srcInfo = gcnew StringInfo(input);
-    StringInfo^ mchInfo = gcnew StringInfo(match);
-    if (srcInfo->LengthInTextElements == input->Length &&
-        mchInfo->LengthInTextElements == match->Length)
-    {
-      CompareOptions cmpOpt = noCase ? CompareOptions::IgnoreCase :
-                                       CompareOptions::None;
-      array<wchar_t>^ source = input->ToCharArray();
-      CompareInfo^ ci = Common::Culture->CompareInfo;
-      for (int i = 0; i != source->Length; i++) {
-        if (ci->IndexOf(match, source[i], cmpOpt) >= 0) {
-          sb->Append(source[i]);
-        }
-      }
-    }
-    else {
-      array<String^>^ srcChars = nullptr;
-      array<String^>^ ptChars = nullptr;
-      if (noCase) {
-        srcChars = parseGraphemes(input->ToLower(Common::Culture));
-        ptChars = parseGraphemes(match->ToLower(Common::Culture));
-      }
-      else {
-        srcChars = parseGraphemes(input);
-        ptChars = parseGraphemes(match);
-      }
-      for (int i = 0; i < srcChars->Length; i++) {
-        if (Array::IndexOf<String^>(ptChars, srcChars[i]) >= 0) {
-          sb->Append(srcChars[i]);
-        }
-      }
-    }
-
-    result = sb->ToString();
-    return Common::SetString(result, pIn->isWide, pResult);
-  }
-
-  int EXT::Join(int argc, DbStr *aValues, DbStr *pResult) {
-    assert(argc >= 3);
-    // first element in aValues is the separator
-    assert(aValues && aValues[0].pText);
-    String^ sep = Common::GetString(aValues);
-    int len = argc - 1;
-    array<String^>^ inputs = gcnew array<String^>(len);
-    for (int i = 0, j = 1; i < len; i++, j++) {
-      assert(aValues[j].pText);
-      inputs[i] = Common::GetString(aValues + j);
-    }
-    return Common::SetString(String::Join(sep, inputs), aValues->isWide, pResult);
-  }
-
-  int EXT::LeftString(DbStr *pIn, int count, DbStr *pResult) {
-    assert(count >= 0);
-    String^ input = Common::GetString(pIn);
-    StringInfo^ si = gcnew StringInfo(input);
-    if (count >= si->LengthInTextElements) {
-      return Common::SetString(input, pIn->isWide, pResult);
-    }
-    else {
-      String^ result = si->SubstringByTextElements(0, count);
-      return Common::SetString(result, pIn->isWide, pResult);
-    }
-  }
-
-  int EXT::Like(DbStr *pIn,
-                DbStr *pPattern,
-                DbStr *pEscape,
-                bool noCase,
-                int *result)
-  {
-    String^ esc = nullptr;
-    if (pEscape) {
-      esc = Common::GetString(pEscape);
-      StringInfo^ si = gcnew StringInfo(esc);
-      if (si->LengthInTextElements != 1) return ERR_ESC_LENGTH;
-    }
-    String^ pattern = Common::GetString(pPattern);
-    array<String^>^ aPattern = parseGraphemes(pattern);
-    String^ input = Common::GetString(pIn);
-    array<String^>^ aInput = parseGraphemes(input);
-    CmpState^ state = gcnew CmpState(aInput->Length, aPattern->Length, noCase);
-    *result = likeCompare(aInput, aPattern, esc, state) ? 1 : 0;
-    return RESULT_OK;
-  }
-
-  int EXT::PadCenter(DbStr *pIn, int len, DbStr *pResult) {
-    String^ result = nullptr;
-    assert(len >= 0);
-
-    String^ input = Common::GetString(pIn);
-    StringInfo^ si = gcnew StringInfo(input);
-    int cLen = si->LengthInTextElements;
-    if (cLen >= len) {
-      result = input;
-    }
-    else {
-      int lenAdj = input->Length - cLen;
-      int totalPad = len + lenAdj - input->Length;
-      result = input->PadLeft(input->Length + (totalPad / 2))->PadRight(input->Length + totalPad);
-    }
-    return Common::SetString(result, pIn->isWide, pResult);
-  }
-
-  int EXT::PadLeft(DbStr *pIn, int len, DbStr *pResult) {
-    String^ result = nullptr;
-    assert(len >= 0);
-
-    String^ input = Common::GetString(pIn);
-    StringInfo^ si = gcnew StringInfo(input);
-    int cLen = si->LengthInTextElements;
-    if (cLen >= len) {
-      return Common::SetString(input, pIn->isWide, pResult);
-    }
-    else {
-      len += input->Length - cLen;
-      result = input->PadLeft(len);
-      return Common::SetString(result, pIn->isWide, pResult);
-    }
-  }
-
-  int EXT::PadRight(DbStr *pIn, int len, DbStr *pResult) {
-    String^ result = nullptr;
-    assert(len >= 0);
-
-    String^ input = Common::GetString(pIn);
-    StringInfo^ si = gcnew StringInfo(input);
-    int cLen = si->LengthInTextElements;
-    if (cLen >= len) {
-      return Common::SetString(input, pIn->isWide, pResult);
-    }
-    else {
-      len += input->Length - cLen;
-      result = input->PadRight(len);
-      return Common::SetString(result, pIn->isWide, pResult);
-    }
-  }
-
-  int EXT::Replicate(DbStr *pIn, int count, DbStr *pResult) {
-    String^ result = nullptr;
-    int destCursor = 0;
-    assert(count >= 0);
-
-    if (count == 0) {
-      return Common::SetString("", pIn->isWide, pResult);
-    }
-    String^ input = Common::GetString(pIn);
-    int len = input->Length;
-    array<wchar_t>^ resultchars = gcnew array<wchar_t>(len * count);
-    for (int i = 0; i < count; i++) {
-      input->CopyTo(0, resultchars, destCursor, len);
-      destCursor += len;
-    }
-    result = gcnew String(resultchars);
-    return Common::SetString(result, pIn->isWide, pResult);
-  }
-
-  int EXT::Reverse(DbStr *pIn, DbStr *pResult) {
-    String^ result = nullptr;
-    String^ input = Common::GetString(pIn);
-    StringInfo^ si = gcnew StringInfo(input);
-    if (si->LengthInTextElements == input->Length) {
-      array<wchar_t>^ chars = input->ToCharArray();
-      Array::Reverse(chars);
-      result = gcnew String(chars);
-    }
-    else {
-      array<String^>^ gchars = parseGraphemes(input);
-      StringBuilder^ sb = gcnew StringBuilder(input->Length);
-      for (int i = gchars->Length - 1; i >= 0; i--) {
-        sb->Append(gchars[i]);
-      }
-      result = sb->ToString();
-    }
-
-    return Common::SetString(result, pIn->isWide, pResult);
-  }
-
-  int EXT::RightString(DbStr *pIn, int count, DbStr *pResult) {
-    assert(count >= 0);
-    String^ input = Common::GetString(pIn);
-    StringInfo^ si = gcnew StringInfo(input);
-    if (count >= si->LengthInTextElements) {
-      return Common::SetString(input, pIn->isWide, pResult);
-    }
-    else {
-      String^ result = si->SubstringByTextElements(si->LengthInTextElements -
-                                                   count);
-      return Common::SetString(result, pIn->isWide, pResult);
-    }
+  bool EXT::GraphemeEquals(DbStr *pLeft, DbStr *pRight, bool noCase) {
+    return areEqual(Common::GetString(pLeft), Common::GetString(pRight),
+                    noCase);
   }
 
   int EXT::UpperLower(DbStr *pIn, bool upper, DbStr *pResult) {
@@ -358,6 +92,22 @@ namespace UtilityExtensions {
     return rc;
   }
 
+  int EXT::SortKey(DbStr *pIn, bool noCase, void **ppKey, int *pcbKey) {
+    CompareOptions opt = CompareOptions::None;
+    if (noCase) opt = CompareOptions::IgnoreCase;
+    CompareInfo^ ci = Common::Culture->CompareInfo;
+    array<u8>^ key = ci->GetSortKey(Common::GetString(pIn), opt)->KeyData;
+    // malloc(0) may return NULL, so always ask for at least one byte
+    *ppKey = malloc((size_t)(key->Length > 0 ? key->Length : 1));
+    if (!*ppKey) return ERR_NOMEM;
+    if (key->Length > 0) {
+      pin_ptr<u8> pKey = &key[0];
+      memcpy(*ppKey, pKey, (size_t)key->Length);
+    }
+    *pcbKey = key->Length;
+    return RESULT_OK;
+  }
+
   int EXT::UtfCollate(DbStr *pLeft, DbStr *pRight, bool noCase) {
     String^ sLeft = Common::GetString(pLeft);
     String^ sRight = Common::GetString(pRight);
@@ -371,16 +121,15 @@ namespace UtilityExtensions {
     }
   }
 
-  array<String^>^ EXT::parseGraphemes(String^ input) {
-    assert(input != nullptr);
-    array<int>^ indices = StringInfo::ParseCombiningCharacters(input);
-    array<String^>^ result = gcnew array<String^>(indices->Length);
-    int end = input->Length;
-    for (int i = input->Length - 1; i >= 0; i--) {
-      int start = indices[i];
-      int len = end - start;
-      result[i] = input->Substring(start, len);
-      end = start;
+  int EXT::graphemeIndex(String^ input, int charIndex) {
+    // index of the cluster that contains the char at charIndex
+    pin_ptr<const wchar_t> pChars = PtrToStringChars(input);
+    DbStr str = { pChars, input->Length * 2, true };
+    GraphemeIter iter;
+    int result = 0;
+    uni_iterInit(&iter, &str);
+    while (uni_nextGrapheme(&iter) && iter.iEnd <= charIndex * 2) {
+      result++;
     }
     return result;
   }
@@ -390,67 +139,6 @@ namespace UtilityExtensions {
     if (noCase) opt = CompareOptions::IgnoreCase;
     return Common::Culture->CompareInfo->Compare(left, right, opt) == 0;
   }
-
-  bool EXT::likeCompare(array<String^>^ input,
-                        array<String^>^ pattern,
-                        String^ escape,
-                        CmpState^ state)
-  {
-    // Here we are reproducing the likeCompare() implementation from func.c
-    // in the SQLite core; we leave out the GLOB handling, since we handle
-    // character sequences with REGEXP. This routine is a touch slower than
-    // the core, since we are dealing with graphemes as strings in all cases.
-    String^ cp = nullptr;
-    String^ cs = nullptr;
-    String^ ct = nullptr;
-    int escIdx = 0;
-    while ((cp = readPtrn(pattern, state)) != nullptr) {
-      if (cp == "%") {
-        // SQLite ticket [c0aeea67d58ae0fd] does not apply; we are not using
-        // the "matchOne" variable (for globbing), so we don't have to test for
-        // that variable being non-zero in the second boolean clause
-        while ((cp = readPtrn(pattern, state)) == "%" || cp == "_") {
-          if (cp == "_" && (ct = readSrc(input, state)) == nullptr) {
-            return false;
-          }
-        }
-        if (cp == nullptr) {
-          return true; // % at end of pattern is a match
-        }
-        else if (areEqual(cp, escape, state->NoCase)) {
-          cp = readPtrn(pattern, state);
-          if (cp == nullptr) {
-            return false;
-          }
-        }
-        while ((cs = readSrc(input, state)) != nullptr) {
-          if (!areEqual(cs, cp, state->NoCase)) {
-            continue;
-          }
-          if (likeCompare(input, pattern, escape, state)) {
-            return true;
-          }
-        }
-        return false;
-      }
-      if (areEqual(cp, escape, state->NoCase)) {
-        cp = readPtrn(pattern, state);
-        if (cp == nullptr) {
-          return false;
-        }
-        escIdx = state->PtrnIdx;
-      }
-      cs = readSrc(input, state);
-      if (areEqual(cs, cp, state->NoCase)) {
-        continue;
-      }
-      if (cp == "_" && escIdx != state->PtrnIdx && cs != nullptr) {
-        continue;
-      }
-      return false;
-    }
-    return state->SrcIdx >= state->SrcLen ? true : false;
-  }
 }
 
 #endif /* !UTILEXT_OMIT_STRING */
@@ -13,6 +13,13 @@
  * don't deal with interaction with a date/time value or strings are handled
  * completely in native code.
  *
+ * Values in INTEGER (Unix time) and REAL (Julian day) format are always UTC, so
+ * they never need any time zone conversion. Values in TEXT format are parsed
+ * according to the .NET Framework rules, unless an explicit time zone is given,
+ * in which case a string without offset information is a local time in that
+ * zone. The offset transitions for each zone are cached in a ZoneTable for the
+ * life of the process, so per-row conversions don't query the zone rules.
+ *
  *============================================================================*/
 
 #ifndef UTILEXT_OMIT_TIME
@@ -21,12 +28,157 @@
 #include "TimeExt.h"
 
 using namespace System;
+using namespace System::Collections::Generic;
+using namespace System::Globalization;
 
 namespace UtilityExtensions {
 
-  int TimeExt::TimespanAddTo(i64 time, DbDate *pDate, DbDate *pResult) {
+  ZoneTable::ZoneTable(TimeZoneInfo^ zone) {
+    _zone = zone;
+    _base = zone->BaseUtcOffset.Ticks;
+    _min = DateTime(MIN_YEAR, 1, 1).Ticks;
+    _max = DateTime(MAX_YEAR + 1, 1, 1).Ticks;
+
+    // Each adjustment rule has its own standard offset, which takes effect on
+    // the first day of the rule, and a transition into and out of daylight
+    // time for every year that it covers. The start time of a rule is
+    // expressed in standard time, and the end time is expressed in daylight
+    // time. When no rule follows directly, the base offset comes back after
+    // the last day of a rule.
+    List<i64>^ utc = gcnew List<i64>();
+    List<i64>^ offset = gcnew List<i64>();
+    DateTime first = DateTime(MIN_YEAR, 1, 1);
+    array<TimeZoneInfo::AdjustmentRule^>^ rules = zone->GetAdjustmentRules();
+    for (int k = 0; k < rules->Length; k++) {
+      TimeZoneInfo::AdjustmentRule^ rule = rules[k];
+      i64 standard = _base + rule->BaseUtcOffsetDelta.Ticks;
+      i64 delta = rule->DaylightDelta.Ticks;
+      DateTime from = (rule->DateStart > first) ? rule->DateStart : first;
+      if (from.Year <= MAX_YEAR) {
+        i64 at = inDaylight(rule, from) ? standard + delta : standard;
+        utc->Add(from.Ticks - at);
+        offset->Add(at);
+      }
+      if (rule->DateEnd.Year < MAX_YEAR) {
+        DateTime after = rule->DateEnd.Date.AddDays(1);
+        if (k + 1 == rules->Length || rules[k + 1]->DateStart > after) {
+          utc->Add(after.Ticks - _base);
+          offset->Add(_base);
+        }
+      }
+      if (delta == 0) continue;
+      int firstYear = Math::Max(rule->DateStart.Year, MIN_YEAR);
+      int lastYear = Math::Min(rule->DateEnd.Year, MAX_YEAR);
+      for (int year = firstYear; year <= lastYear; year++) {
+        DateTime start = transitionDate(rule->DaylightTransitionStart, year);
+        DateTime end = transitionDate(rule->DaylightTransitionEnd, year);
+        if (start.Date >= rule->DateStart && start.Date <= rule->DateEnd) {
+          utc->Add(start.Ticks - standard);
+          offset->Add(standard + delta);
+        }
+        if (end.Date >= rule->DateStart && end.Date <= rule->DateEnd) {
+          utc->Add(end.Ticks - (standard + delta));
+          offset->Add(standard);
+        }
+      }
+    }
+    array<i64>^ keys = utc->ToArray();
+    array<i64>^ items = offset->ToArray();
+    Array::Sort(keys, items);
+
+    // drop transitions that don't change the offset, like the end of one rule
+    // that runs into the start of the next
+    int n = 0;
+    i64 prev = _base;
+    for (int i = 0; i < keys->Length; i++) {
+      if (items[i] == prev) continue;
+      keys[n] = keys[i];
+      items[n] = items[i];
+      prev = items[i];
+      n++;
+    }
+    _utc = gcnew array<i64>(n);
+    _local = gcnew array<i64>(n);
+    _offset = gcnew array<i64>(n);
+    for (int i = 0; i < n; i++) {
+      _utc[i] = keys[i];
+      _offset[i] = items[i];
+      _local[i] = keys[i] + items[i];
+    }
+  }
+
+  i64 ZoneTable::ToLocal(i64 utcTicks) {
+    if (utcTicks < _min || utcTicks >= _max) {
+      DateTime dt = DateTime(utcTicks, DateTimeKind::Utc);
+      return utcTicks + _zone->GetUtcOffset(dt).Ticks;
+    }
+    int i = find(_utc, utcTicks);
+    return utcTicks + (i < 0 ? _base : _offset[i]);
+  }
+
+  i64 ZoneTable::ToUtc(i64 localTicks) {
+    if (localTicks < _min || localTicks >= _max) {
+      DateTime dt = DateTime(localTicks, DateTimeKind::Unspecified);
+      return localTicks - _zone->GetUtcOffset(dt).Ticks;
+    }
+    // The local time of each transition is expressed in the offset that
+    // starts there, so a local time in a gap falls before the transition, and
+    // a local time in an overlap falls after it.
+    int i = find(_local, localTicks);
+    return localTicks - (i < 0 ? _base : _offset[i]);
+  }
+
+  bool ZoneTable::inDaylight(TimeZoneInfo::AdjustmentRule^ rule, DateTime dt) {
+    if (rule->DaylightDelta.Ticks == 0) return false;
+    DateTime start = transitionDate(rule->DaylightTransitionStart, dt.Year);
+    DateTime end = transitionDate(rule->DaylightTransitionEnd, dt.Year);
+    // in the southern hemisphere, daylight time runs across the new year
+    return (start < end) ? (dt >= start && dt < end) :
+                           (dt >= start || dt < end);
+  }
+
+  DateTime ZoneTable::transitionDate(TimeZoneInfo::TransitionTime t, int year) {
+    int day;
+    if (t.IsFixedDateRule) {
+      day = Math::Min(t.Day, DateTime::DaysInMonth(year, t.Month));
+    }
+    else {
+      // 'Week' is 1-5, where 5 is the last occurrence of the day in the month
+      int dow = (int)DateTime(year, t.Month, 1).DayOfWeek;
+      day = 1 + ((int)t.DayOfWeek - dow + 7) % 7 + (t.Week - 1) * 7;
+      if (day > DateTime::DaysInMonth(year, t.Month)) day -= 7;
+    }
+    return DateTime(year, t.Month, day) + t.TimeOfDay.TimeOfDay;
+  }
+
+  int ZoneTable::find(array<i64>^ arr, i64 ticks) {
+    // index of the last element less than or equal to 'ticks', or -1
+    int lo = 0;
+    int hi = arr->Length;
+    while (lo < hi) {
+      int mid = lo + (hi - lo) / 2;
+      if (arr[mid] <= ticks) {
+        lo = mid + 1;
+      }
+      else {
+        hi = mid;
+      }
+    }
+    return lo - 1;
+  }
+
+  int TimeExt::TimespanAddTo(i64 time,
+                             DbDate *pDate,
+                             DbStr *pZone,
+                             DbDate *pResult)
+  {
     DateTime dt = DateTime::MinValue;
     TimeSpan ts = TimeSpan::MinValue;
+    ZoneTable^ zone = nullptr;
+    if (pZone) {
+      zone = GetZone(pZone);
+      if (zone == nullptr) return ERR_TIME_ZONE;
+    }
     switch (pDate->type)
     {
       case SQLITE_INTEGER:
@@ -62,8 +214,15 @@ namespace UtilityExtensions {
         try
         {
           String^ s = Common::GetString(&pDate->iso);
-          dt = DateTime::Parse(s);
           ts = TimeSpan(time);
+          if (zone != nullptr) {
+            i64 utc = (DateTime(ParseUtc(s, zone)) + ts).Ticks;
+            i64 local = zone->ToLocal(utc);
+            DateTimeOffset dto = DateTimeOffset(local, TimeSpan(local - utc));
+            return Common::SetString(dto.ToString(ZONE_FORMAT),
+                                     pDate->iso.isWide, &pResult->iso);
+          }
+          dt = DateTime::Parse(s);
           dt += ts;
           Common::SetString(dt.ToString(DATE_FORMAT),
                             pDate->iso.isWide, &pResult->iso);
@@ -155,10 +314,18 @@ namespace UtilityExtensions {
     }
   }
 
-  int TimeExt::TimespanDiff(DbDate *pLeft, DbDate *pRight, i64 *pResult)
+  int TimeExt::TimespanDiff(DbDate *pLeft,
+                            DbDate *pRight,
+                            DbStr *pZone,
+                            i64 *pResult)
   {
     DateTime dt1 = DateTime::MinValue;
     DateTime dt2 = DateTime::MinValue;
+    ZoneTable^ zone = nullptr;
+    if (pZone) {
+      zone = GetZone(pZone);
+      if (zone == nullptr) return ERR_TIME_ZONE;
+    }
 
     switch (pLeft->type) {
       case SQLITE_INTEGER:
@@ -179,7 +346,13 @@ namespace UtilityExtensions {
         break;
       case SQLITE_TEXT:
         try {
-          dt1 = DateTime::Parse(Common::GetString(&pLeft->iso));
+          String^ s = Common::GetString(&pLeft->iso);
+          if (zone != nullptr) {
+            dt1 = DateTime(ParseUtc(s, zone), DateTimeKind::Utc);
+          }
+          else {
+            dt1 = DateTime::Parse(s);
+          }
         }
         catch (Exception^) {
           return ERR_TIME_PARSE;
@@ -205,7 +378,13 @@ namespace UtilityExtensions {
         break;
       case SQLITE_TEXT:
         try {
-          dt2 = DateTime::Parse(Common::GetString(&pRight->iso));
+          String^ s = Common::GetString(&pRight->iso);
+          if (zone != nullptr) {
+            dt2 = DateTime(ParseUtc(s, zone), DateTimeKind::Utc);
+          }
+          else {
+            dt2 = DateTime::Parse(s);
+          }
         }
         catch (Exception^) {
           return ERR_TIME_PARSE;
@@ -216,15 +395,39 @@ namespace UtilityExtensions {
     return RESULT_OK;
   }
 
-  int TimeExt::TimespanStr(i64 time, bool isWide, DbStr *pResult)
-  {
-    TimeSpan ts = TimeSpan(time);
-    String^ str = ts.ToString(); // default "c" format
-    return Common::SetString(str, isWide, pResult);
+  ZoneTable^ TimeExt::GetZone(DbStr *pZone) {
+    String^ id = Common::GetString(pZone);
+    ZoneTable^ table = nullptr;
+    if (_zones->TryGetValue(id, table)) return table;
+    try {
+      TimeZoneInfo^ tzi = (id->Length == 0) ? TimeZoneInfo::Local :
+                          TimeZoneInfo::FindSystemTimeZoneById(id);
+      // if another thread got here first, use its table
+      return _zones->GetOrAdd(id, gcnew ZoneTable(tzi));
+    }
+    catch (Exception^) {
+      return nullptr;
+    }
+  }
+
+  i64 TimeExt::ParseUtc(String^ s, ZoneTable^ zone) {
+    // A string with no offset information is a local time in 'zone'; an
+    // explicit offset is honored as is.
+    DateTime dt = DateTime::Parse(s, nullptr, DateTimeStyles::RoundtripKind);
+    switch (dt.Kind) {
+      case DateTimeKind::Unspecified:
+        return zone->ToUtc(dt.Ticks);
+      case DateTimeKind::Utc:
+        return dt.Ticks;
+      default:
+        // RoundtripKind has converted to the local time of the host
+        return DateTimeOffset::Parse(s).UtcTicks;
+    }
   }
 
   i64 TimeExt::ToUnixTime(DateTime dt) {
-    i64 ticks = dt.ToUniversalTime().Ticks;
+    // 'dt' is always UTC, so there is no conversion to do
+    i64 ticks = dt.Ticks;
 
     // unix time deals in whole seconds, so strip the milliseconds
     ticks -= dt.Millisecond * TimeSpan::TicksPerMillisecond;
@@ -245,7 +448,7 @@ namespace UtilityExtensions {
       int h, m, s, ms;
       i64 iJD;
 
-      dt = dt.ToUniversalTime();
+      // 'dt' is always UTC, so there is no conversion to do
       Y = dt.Year;
       M = dt.Month;
       D = dt.Day;
@@ -15,9 +15,51 @@
 #include "Common.h"
 
 using namespace System;
+using namespace System::Collections::Concurrent;
 
 namespace UtilityExtensions {
 
+  /// <summary>
+  /// A table of the UTC offset transitions for a time zone. The table is built
+  /// once from the adjustment rules of the zone, so that converting between
+  /// local and UTC times is a binary search and an add, instead of a query
+  /// against the time zone rules for every row.
+  /// </summary>
+  ref class ZoneTable {
+  internal:
+    ZoneTable(TimeZoneInfo^ zone);
+
+    /// <summary>
+    /// Converts a tick count in UTC to the local time of the zone.
+    /// </summary>
+    i64 ToLocal(i64 utcTicks);
+
+    /// <summary>
+    /// Converts a tick count in the local time of the zone to UTC. Invalid
+    /// local times use the offset in effect before the transition, and
+    /// ambiguous local times use the offset in effect after it.
+    /// </summary>
+    i64 ToUtc(i64 localTicks);
+
+  private:
+    // The table covers the years in this range; anything outside of it is
+    // converted with the time zone rules directly.
+    static const int MIN_YEAR = 1900;
+    static const int MAX_YEAR = 2100;
+
+    TimeZoneInfo^ _zone;
+    i64 _base;             // base UTC offset in ticks
+    i64 _min;              // first tick covered by the table
+    i64 _max;              // first tick after the table
+    array<i64>^ _utc;      // UTC ticks of each transition, ascending
+    array<i64>^ _local;    // local ticks of each transition, ascending
+    array<i64>^ _offset;   // UTC offset in effect from each transition
+
+    static bool inDaylight(TimeZoneInfo::AdjustmentRule^ rule, DateTime dt);
+    static DateTime transitionDate(TimeZoneInfo::TransitionTime t, int year);
+    static int find(array<i64>^ arr, i64 ticks);
+  };
+
   ref class TimeExt abstract sealed {
 
   internal:
@@ -26,11 +68,18 @@ namespace UtilityExtensions {
     /// </summary>
     /// <param name="time">Tick count for a TimeSpan value</param>
     /// <param name="pDate">Pointer to an encapsulated SQLite date/time value</param>
+    /// <param name="pZone">Pointer to a native time zone identifier, or NULL</param>
+    /// <param name="pResult">Pointer to hold the result</param>
     /// <returns>
     /// An integer result code. If successful, the result is written into the
     /// appropriate member of <paramref name="pResult"/>.
     /// </returns>
-    static int TimespanAddTo(i64 time, DbDate *pDate, DbDate *pResult);
+    static int TimespanAddTo(
+      i64 time,
+      DbDate *pDate,
+      DbStr *pZone,
+      DbDate *pResult
+    );
 
     /// <summary>
     /// Creates a TimeSpan value from the specified date/time interval.
@@ -61,24 +110,18 @@ namespace UtilityExtensions {
     /// </summary>
     /// <param name="pLeft">Pointer to an encapsulated SQLite date/time value</param>
     /// <param name="pRight">Pointer to an encapsulated SQLite date/time value</param>
+    /// <param name="pZone">Pointer to a native time zone identifier, or NULL</param>
     /// <param name="pResult">Pointer to hold the resulting TimeSpan tick count</param>
     /// <returns>
     /// An integer result code. If successful, the result is written into
     /// <paramref name="pResult"/>.
     /// </returns>
-    static int TimespanDiff(DbDate *pLeft, DbDate *pRight, i64 *pResult);
-
-    /// <summary>
-    /// Converts a TimeSpan tick count into a formatted string.
-    /// </summary>
-    /// <param name="time">Tick count of a TimeSpan value</param>
-    /// <param name="isWide">True if the text is desired in UTF-16</param>
-    /// <param name="pResult">Pointer to hold the result</param>
-    /// <returns>
-    /// An integer result code. If successful, the formatted string is allocated
-    /// and written into <paramref name="pResult"/>.
-    /// </returns>
-    static int TimespanStr(i64 time, bool isWide, DbStr *pResult);
+    static int TimespanDiff(
+      DbDate *pLeft,
+      DbDate *pRight,
+      DbStr *pZone,
+      i64 *pResult
+    );
 
   private:
     // 100-nanosecond tick count for the Unix epoch
@@ -101,6 +144,18 @@ namespace UtilityExtensions {
     // ISO-8601 with optional ms and time zone info
     static String^ DATE_FORMAT = "yyyy-MM-ddTHH:mm:ss.FFFK";
 
+    // ISO-8601 with optional ms and the offset of an explicit time zone
+    static String^ ZONE_FORMAT = "yyyy-MM-ddTHH:mm:ss.FFFzzz";
+
+    // Transition tables for the time zones in use, keyed on the zone id; an
+    // empty id is the local time zone of the host.
+    static ConcurrentDictionary<String^, ZoneTable^>^ _zones =
+      gcnew ConcurrentDictionary<String^, ZoneTable^>();
+
+    static ZoneTable^ GetZone(DbStr *pZone);
+
+    static i64 ParseUtc(String^ s, ZoneTable^ zone);
+
     static i64 ToUnixTime(DateTime dt);
 
     static DateTime DateTimeFromUnix(i64 unixTime);
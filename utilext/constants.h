@@ -13,6 +13,8 @@
 #pragma once
 
 #define MIN_WINDOW_VERSION 3025000
+#define MIN_VTAB_RHS_VERSION 3038000
+#define MIN_VTAB_IN_VERSION 3038000
 
 #define	RESULT_OK           0
 #define	RESULT_NULL        -1
@@ -34,6 +36,8 @@
 #define	ERR_TIME_PARSE      SQLITE_FORMAT
 #define	ERR_TIME_UNIX_RANGE SQLITE_ERROR
 #define ERR_TIME_INVALID    SQLITE_RANGE
+#define ERR_TIME_ZONE       SQLITE_NOTFOUND
+#define ERR_TIME_FORMAT     SQLITE_NOTFOUND
 #define ERR_CULTURE         SQLITE_NOTFOUND
 #define ERR_BIGINT_PARSE    SQLITE_FORMAT
 #define ERR_BIGINT_OVFLOW   SQLITE_TOOBIG
@@ -0,0 +1,555 @@
+/*==============================================================================
+ *
+ * Written by: Mark Benningfield
+ *
+ * LICENSE: Public Domain -- see the file LICENSE.txt
+ *
+ *==============================================================================
+ *
+ * Code adapted from "splitvtab.c" in this project.
+ *
+ * A virtual table implementation to find all of the matches of a pattern,
+ * like Regex.Matches(), and return each one as a row, with its capture groups
+ * as columns. The matches are found by the native engine in "rxengine.c" when
+ * it supports the pattern, one match at a time as the cursor moves, and by the
+ * managed Regex class otherwise. The table schema is:
+ *
+ *  CREATE TABLE x(match TEXT,
+ *                 offset INTEGER,
+ *                 length INTEGER,
+ *                 group1 TEXT, ... group9 TEXT,
+ *                 input TEXT HIDDEN,
+ *                 pattern TEXT HIDDEN,
+ *                 timeout INTEGER HIDDEN
+ *  );
+ *
+ * Usage:
+ *  select match, group1, group2 from regmatch(input, pattern[, timeout]);
+ *
+ * Like regsplit(), the only thing that xBestIndex takes from the query besides
+ * the arguments is the LIMIT, so that the search can stop early.
+ *
+ *============================================================================*/
+
+#ifndef UTILEXT_OMIT_REGEX
+
+/* Notes in "utilext.c" */
+#pragma warning( disable : 4339 4514 )
+#ifdef NDEBUG
+#pragma warning( disable : 4100)
+#endif
+
+#pragma warning( disable : 4820 )
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+#include "sqlite3ext.h"
+#include "RegexExt.h"
+#include "rxengine.h"
+
+/* _INIT1 gets evaluated in functions.c */
+SQLITE_EXTENSION_INIT3
+
+typedef UtilityExtensions::RegexExt RegExt;
+typedef UtilityExtensions::Common Com;
+
+#pragma warning( push )
+#pragma warning( disable : 4820 ) /* struct padding added */
+
+/* Subclass the sqlite3_vtab_cursor base class. With the native engine, the
+** cursor keeps the compiled pattern and a position in its copy of the input,
+** and finds the next match in xNext. The managed Regex class finds all of the
+** matches at once, and they come back as an array of spans. Either way, each
+** group of the current match is a slice of the input. The buffers and the
+** compiled pattern are kept from one xFilter call to the next, for a join that
+** searches a column of each row with the same pattern. */
+typedef struct matchvtab_cursor matchvtab_cursor;
+struct matchvtab_cursor {
+  sqlite3_vtab_cursor base; /* Base class - must be first */
+  u8 *zInput;               /* copy of the input arg */
+  int cbInput;
+  int nInputAlloc;
+  u8 *zPattern;             /* copy of the pattern arg */
+  int cbPattern;
+  int nPatternAlloc;
+  int timeout;              /* timeout arg */
+  int index;                /* rowid of the current match */
+  sqlite3_int64 nLimit;     /* most matches that are needed, or -1 for all */
+  bool isEof;               /* there are no more matches */
+  bool hasPattern;          /* the pattern has been compiled */
+  bool isManaged;           /* the pattern needs the managed Regex class */
+  RxProg *pProg;            /* compiled pattern, or NULL for a managed search */
+  RxMatcher *pMatcher;
+  int *aCap;                /* groups of the current match */
+  int nGroup;               /* count of groups, including group 0 */
+  int iFind;                /* where the next search starts */
+  int *aSpan;               /* managed results: the groups of each match */
+  int nMatch;
+};
+
+#pragma warning ( pop ) /* 4820 */
+
+
+/* Copies an argument, with its terminator, into a buffer owned by the cursor,
+** which only grows when the argument doesn't fit. Returns RESULT_OK or
+** ERR_NOMEM. */
+static int matchCopyArg(sqlite3_value *pValue, u8 **pz, int *pcb,
+                        int *pnAlloc)
+{
+  const u8 *z = sqlite3_value_text(pValue);
+  int cb = sqlite3_value_bytes(pValue);
+  if (z == nullptr) return ERR_NOMEM;
+  if (cb + 1 > *pnAlloc) {
+    u8 *zNew = (u8*)sqlite3_realloc64(*pz, (sqlite3_uint64)cb + 1);
+    if (zNew == nullptr) return ERR_NOMEM;
+    *pz = zNew;
+    *pnAlloc = cb + 1;
+  }
+  memcpy(*pz, z, (size_t)cb + 1);
+  *pcb = cb;
+  return RESULT_OK;
+}
+
+/* Returns true if an argument is the same text as a copy of an earlier one */
+static bool matchSameArg(sqlite3_value *pValue, const u8 *z, int cb) {
+  const u8 *zValue = sqlite3_value_text(pValue);
+  return zValue && sqlite3_value_bytes(pValue) == cb &&
+         memcmp(zValue, z, (size_t)cb) == 0;
+}
+
+/* Compiles the pattern for a native search. Returns RX_UNSUPPORTED or
+** RX_INVALID if the pattern has to be left to the managed Regex class. */
+static int matchNativeBegin(matchvtab_cursor *pCur) {
+  DbStr pattern;
+  const char *zReason;
+  int rc;
+
+  pattern.pText = pCur->zPattern;
+  pattern.cb = pCur->cbPattern;
+  pattern.isWide = false;
+  rc = rx_cacheGet(&pattern, Com::TurkicCasing, &pCur->pProg, &zReason);
+  if (rc != RESULT_OK) return rc;
+  pCur->nGroup = rx_groupCount(pCur->pProg);
+  pCur->pMatcher = rx_matcherNew(pCur->pProg);
+  pCur->aCap = (int*)sqlite3_malloc64(pCur->nGroup * 2 * sizeof(int));
+  if (pCur->pMatcher == nullptr || pCur->aCap == nullptr) return ERR_NOMEM;
+  return RESULT_OK;
+}
+
+/* Moves a native search to its next match, following the rules of
+** Regex.Matches(): the search goes on from the end of the last match, or one
+** character after it if the match was empty. */
+static void matchNativeStep(matchvtab_cursor *pCur) {
+  const u8 *z = pCur->zInput;
+  int cb = pCur->cbInput;
+  int *aCap = pCur->aCap;
+  DbStr input;
+
+  input.pText = z;
+  input.cb = cb;
+  input.isWide = false;
+  if (pCur->iFind > cb ||
+      !rx_find(pCur->pMatcher, &input, pCur->iFind, aCap))
+  {
+    pCur->isEof = true;
+    return;
+  }
+  pCur->iFind = aCap[1];
+  if (aCap[0] == aCap[1]) {
+    /* step over one character after an empty match */
+    do {
+      pCur->iFind++;
+    } while (pCur->iFind < cb && (z[pCur->iFind] & 0xC0) == 0x80);
+  }
+}
+
+/* Gets the groups of the current match, as start and end offsets */
+static const int *matchGroups(matchvtab_cursor *pCur) {
+  if (pCur->pProg) return pCur->aCap;
+  return pCur->aSpan + (size_t)pCur->index * pCur->nGroup * 2;
+}
+
+/* Frees the results of a managed search */
+static void matchFreeSpans(matchvtab_cursor *pCur) {
+  free(pCur->aSpan);
+  pCur->aSpan = nullptr;
+  pCur->nMatch = 0;
+}
+
+/* Frees the compiled pattern and the results of the last search */
+static void matchReset(matchvtab_cursor *pCur) {
+  matchFreeSpans(pCur);
+  pCur->hasPattern = false;
+  pCur->isManaged = false;
+  pCur->nGroup = 0;
+  sqlite3_free(pCur->aCap);
+  pCur->aCap = nullptr;
+  rx_matcherFree(pCur->pMatcher);
+  pCur->pMatcher = nullptr;
+  rx_cacheRelease(pCur->pProg);
+  pCur->pProg = nullptr;
+}
+
+/* Count of capture group columns; a pattern may have more groups, but only
+** the first ones get a column */
+#define MATCH_GROUP_COLUMNS 9
+
+/* the constructor for matchvtab_vtab objects.
+**
+** All this routine needs to do is:
+**
+**    (1) Allocate the matchvtab_vtab object and initialize all fields.
+**
+**    (2) Tell SQLite (via the sqlite3_declare_vtab() interface) what the
+**        result set of queries against the virtual table will look like.
+*/
+static int matchvtabConnect(sqlite3 *db,
+                            void *pAux,
+                            int argc,
+                            const char *const*argv,
+                            sqlite3_vtab **ppVtab,
+                            char **pzErr)
+{
+  _CRT_UNUSED(pzErr);
+  _CRT_UNUSED(pAux);
+  _CRT_UNUSED(argc);
+  _CRT_UNUSED(argv);
+  sqlite3_vtab *pNew;
+  int rc = sqlite3_declare_vtab(db,
+                                "CREATE TABLE x("
+                                "  match   TEXT,"
+                                "  offset  INTEGER,"
+                                "  length  INTEGER,"
+                                "  group1  TEXT,"
+                                "  group2  TEXT,"
+                                "  group3  TEXT,"
+                                "  group4  TEXT,"
+                                "  group5  TEXT,"
+                                "  group6  TEXT,"
+                                "  group7  TEXT,"
+                                "  group8  TEXT,"
+                                "  group9  TEXT,"
+                                "  input   TEXT    HIDDEN,"
+                                "  pattern TEXT    HIDDEN,"
+                                "  timeout INTEGER HIDDEN"
+                                ")");
+  if (rc) return rc;
+  /* we don't need to subclass the base table object, since our cursor maintains
+  ** state for each function call
+  */
+  pNew = (sqlite3_vtab*)sqlite3_malloc(sizeof(*pNew));
+  *ppVtab = pNew;
+  if (pNew == nullptr) return SQLITE_NOMEM;
+  memset(pNew, 0, sizeof(*pNew));
+  return rc;
+}
+
+/* This method is the destructor for matchvtab_vtab objects. */
+static int matchvtabDisconnect(sqlite3_vtab *pVtab) {
+  sqlite3_free(pVtab);
+  return SQLITE_OK;
+}
+
+/* Constructor for a new matchvtab_cursor object. */
+static int matchvtabOpen(sqlite3_vtab *p, sqlite3_vtab_cursor **ppCursor) {
+  _CRT_UNUSED(p);
+  matchvtab_cursor *pCur = (matchvtab_cursor*)sqlite3_malloc(sizeof(*pCur));
+  if (pCur == nullptr) return SQLITE_NOMEM;
+  memset(pCur, 0, sizeof(*pCur));
+  pCur->isEof = true;
+  *ppCursor = &pCur->base;
+  return SQLITE_OK;
+}
+
+/* Destructor for a matchvtab_cursor. */
+static int matchvtabClose(sqlite3_vtab_cursor *cur) {
+  matchvtab_cursor *pCur = (matchvtab_cursor*)cur;
+  matchReset(pCur);
+  sqlite3_free(pCur->zInput);
+  sqlite3_free(pCur->zPattern);
+  sqlite3_free(pCur);
+  return SQLITE_OK;
+}
+
+/* Advance a matchvtab_cursor to its next row of output */
+static int matchvtabNext(sqlite3_vtab_cursor *cur) {
+  matchvtab_cursor *pCur = (matchvtab_cursor*)cur;
+  pCur->index++;
+  if (pCur->nLimit >= 0 && pCur->index >= pCur->nLimit) {
+    pCur->isEof = true;
+  }
+  else if (pCur->pProg) {
+    matchNativeStep(pCur);
+  }
+  else {
+    pCur->isEof = pCur->index >= pCur->nMatch;
+  }
+  return SQLITE_OK;
+}
+
+/* Indexes for the table columns */
+#define MATCH_COL_MATCH   0
+#define MATCH_COL_OFFSET  1
+#define MATCH_COL_LENGTH  2
+#define MATCH_COL_GROUP1  3
+#define MATCH_COL_INPUT   (MATCH_COL_GROUP1 + MATCH_GROUP_COLUMNS)
+#define MATCH_COL_PATTERN (MATCH_COL_INPUT + 1)
+#define MATCH_COL_TIMEOUT (MATCH_COL_INPUT + 2)
+
+/* Arguments that xBestIndex can pass to xFilter; idxNum has bit (1 << n) set
+** for each one that is passed */
+#define MATCH_ARG_INPUT   0
+#define MATCH_ARG_PATTERN 1
+#define MATCH_ARG_TIMEOUT 2
+#define MATCH_ARG_LIMIT   3
+#define MATCH_ARG_OFFSET  4
+#define MATCH_ARG_COUNT   5
+
+/* Return the column value for the specified column. The offset and length of
+** a match are counted in bytes of the UTF-8 input, and a group that didn't
+** take part in the match is NULL. */
+static int matchvtabColumn(sqlite3_vtab_cursor *cur,
+                           sqlite3_context *ctx,
+                           int i)
+{
+  matchvtab_cursor *pCur = (matchvtab_cursor*)cur;
+  const int *aGroup = matchGroups(pCur);
+  int g;
+  switch (i) {
+    case MATCH_COL_OFFSET:
+      sqlite3_result_int(ctx, aGroup[0]);
+      break;
+    case MATCH_COL_LENGTH:
+      sqlite3_result_int(ctx, aGroup[1] - aGroup[0]);
+      break;
+    case MATCH_COL_INPUT:
+      sqlite3_result_text(ctx, (const char*)pCur->zInput, pCur->cbInput,
+                          SQLITE_TRANSIENT);
+      break;
+    case MATCH_COL_PATTERN:
+      sqlite3_result_text(ctx, (const char*)pCur->zPattern, pCur->cbPattern,
+                          SQLITE_TRANSIENT);
+      break;
+    case MATCH_COL_TIMEOUT:
+      sqlite3_result_int(ctx, pCur->timeout);
+      break;
+    default:
+      /* the match is group 0; SQLite copies the slice into the result
+      ** register, which keeps its buffer from one row to the next */
+      g = (i == MATCH_COL_MATCH) ? 0 : i - MATCH_COL_GROUP1 + 1;
+      if (g < pCur->nGroup && aGroup[g * 2] >= 0) {
+        sqlite3_result_text(ctx, (const char*)pCur->zInput + aGroup[g * 2],
+                            aGroup[g * 2 + 1] - aGroup[g * 2],
+                            SQLITE_TRANSIENT);
+      }
+      break;
+  }
+  return SQLITE_OK;
+}
+
+/* Return the rowid for the current row. In this implementation, the rowid is
+** the index of the current match.
+*/
+static int matchvtabRowid(sqlite3_vtab_cursor *cur, sqlite_int64 *pRowid) {
+  *pRowid = ((matchvtab_cursor*)cur)->index;
+  return SQLITE_OK;
+}
+
+/* Return TRUE if the cursor has been moved off of the last row of output. */
+static int matchvtabEof(sqlite3_vtab_cursor *cur) {
+  return ((matchvtab_cursor*)cur)->isEof;
+}
+
+/* Set up the search of the input and move to the first row of the result set.
+** The native engine finds the matches one at a time as the cursor moves; the
+** managed Regex class finds all of them here. The pattern is only compiled
+** again if it isn't the one from the last call.
+*/
+static int matchvtabFilter(sqlite3_vtab_cursor *pVtabCursor,
+                           int idxNum,
+                           const char *idxStr,
+                           int argc,
+                           sqlite3_value **argv)
+{
+  _CRT_UNUSED(idxStr);
+  _CRT_UNUSED(argc);
+  assert((idxNum & 3) == 3);
+  char *zError;
+  int rc;
+  DbStr input = { 0 };
+  DbStr pattern = { 0 };
+  int ms = -1;
+  int iArg = 2;
+  bool samePattern;
+  matchvtab_cursor *pCur = (matchvtab_cursor*)pVtabCursor;
+  pCur->index = 0;
+  pCur->isEof = true;
+  pCur->nLimit = -1;
+  /* return no rows if the input, the pattern, or the timeout is null */
+  if (sqlite3_value_type(argv[0]) == SQLITE_NULL ||
+      sqlite3_value_type(argv[1]) == SQLITE_NULL)
+  {
+    return SQLITE_OK;
+  }
+  if (idxNum & (1 << MATCH_ARG_TIMEOUT)) {
+    if (sqlite3_value_type(argv[iArg]) == SQLITE_NULL) return SQLITE_OK;
+    ms = sqlite3_value_int(argv[iArg++]);
+  }
+  if (idxNum & (1 << MATCH_ARG_LIMIT)) {
+    /* SQLite applies LIMIT and OFFSET to the rows too; the search just stops
+    ** after the last row that they let through */
+    sqlite3_int64 nOffset = 0;
+    pCur->nLimit = sqlite3_value_int64(argv[iArg++]);
+    if (idxNum & (1 << MATCH_ARG_OFFSET)) {
+      nOffset = sqlite3_value_int64(argv[iArg]);
+    }
+    if (pCur->nLimit == 0) return SQLITE_OK;
+    if (pCur->nLimit < 0 || nOffset > LLONG_MAX - pCur->nLimit) {
+      pCur->nLimit = -1;
+    }
+    else if (nOffset > 0) {
+      pCur->nLimit += nOffset;
+    }
+  }
+  samePattern = pCur->hasPattern &&
+                matchSameArg(argv[1], pCur->zPattern, pCur->cbPattern);
+  rc = matchCopyArg(argv[0], &pCur->zInput, &pCur->cbInput,
+                    &pCur->nInputAlloc);
+  if (rc == RESULT_OK && !samePattern) {
+    matchReset(pCur);
+    rc = matchCopyArg(argv[1], &pCur->zPattern, &pCur->cbPattern,
+                      &pCur->nPatternAlloc);
+    if (rc == RESULT_OK) rc = matchNativeBegin(pCur);
+    if (rc == RX_UNSUPPORTED || rc == RX_INVALID) {
+      matchReset(pCur);
+      pCur->isManaged = true;
+      rc = RESULT_OK;
+    }
+    pCur->hasPattern = (rc == RESULT_OK);
+  }
+  if (rc == RESULT_OK && pCur->isManaged) {
+    matchFreeSpans(pCur);
+    input.pText = pCur->zInput;
+    input.cb = pCur->cbInput;
+    pattern.pText = pCur->zPattern;
+    pattern.cb = pCur->cbPattern;
+    rc = RegExt::Regmatch(&input, &pattern, ms, &zError, &pCur->nGroup,
+                          &pCur->nMatch, &pCur->aSpan);
+  }
+  switch (rc) {
+    case ERR_NOMEM:
+      matchReset(pCur);
+      return SQLITE_NOMEM;
+    case ERR_REGEX_PARSE:
+      pVtabCursor->pVtab->zErrMsg = sqlite3_mprintf("%s", zError);
+      free(zError);
+      return SQLITE_ERROR;
+    case ERR_REGEX_TIMEOUT:
+      return SQLITE_ABORT;
+  }
+  pCur->timeout = ms;
+  pCur->isEof = false;
+  if (pCur->isManaged) {
+    pCur->isEof = pCur->nMatch == 0;
+  }
+  else {
+    pCur->iFind = 0;
+    matchNativeStep(pCur);
+  }
+  return SQLITE_OK;
+}
+
+/* The LIMIT and OFFSET constraints are new in SQLite 3.38.0; older versions
+** never pass them to xBestIndex. */
+#ifndef SQLITE_INDEX_CONSTRAINT_LIMIT
+#define SQLITE_INDEX_CONSTRAINT_LIMIT  73
+#define SQLITE_INDEX_CONSTRAINT_OFFSET 74
+#endif
+
+/* Guess for the cost estimate: the count of matches, which can't be told from
+** the input without searching it */
+#define MATCH_DEFAULT_ROWS  25
+
+/* The arguments to xFilter are [0] input string, [1] pattern string, and the
+** ones that idxNum has a bit for, in order: timeout in ms, LIMIT, and OFFSET.
+** The search stops after the matches that LIMIT and OFFSET let through.
+*/
+static int matchvtabBestIndex(sqlite3_vtab *tab,
+                              sqlite3_index_info *pIdxInfo)
+{
+  _CRT_UNUSED(tab);
+  sqlite3_index_info::sqlite3_index_constraint *pConstraint;
+  int aArg[MATCH_ARG_COUNT]; /* constraint for each arg, or -1 */
+  int idxNum = 0; /* bitmask for arg values */
+  int nArg = 0; /* how many args are passed to xFilter */
+  sqlite3_int64 nRow = MATCH_DEFAULT_ROWS;
+  for (int k = 0; k < MATCH_ARG_COUNT; k++) aArg[k] = -1;
+  pConstraint = pIdxInfo->aConstraint;
+  for (int i = 0; i < pIdxInfo->nConstraint; i++, pConstraint++) {
+    if (pConstraint->op == SQLITE_INDEX_CONSTRAINT_LIMIT ||
+        pConstraint->op == SQLITE_INDEX_CONSTRAINT_OFFSET)
+    {
+      if (pConstraint->usable) {
+        aArg[pConstraint->op == SQLITE_INDEX_CONSTRAINT_LIMIT ?
+             MATCH_ARG_LIMIT : MATCH_ARG_OFFSET] = i;
+      }
+      continue;
+    }
+    if (pConstraint->iColumn < MATCH_COL_INPUT) continue;
+    if (!pConstraint->usable) return SQLITE_CONSTRAINT;
+    if (pConstraint->op == SQLITE_INDEX_CONSTRAINT_EQ) {
+      /* 0 input; 1 pattern; 2 timeout */
+      assert(pConstraint->iColumn - MATCH_COL_INPUT <= MATCH_ARG_TIMEOUT);
+      aArg[pConstraint->iColumn - MATCH_COL_INPUT] = i;
+    }
+  }
+  /* LIMIT and OFFSET are constraints too, so they can't be counted toward
+  ** the required arguments */
+  if (aArg[MATCH_ARG_INPUT] < 0 || aArg[MATCH_ARG_PATTERN] < 0) {
+    tab->zErrMsg = sqlite3_mprintf("not enough arguments on regmatch() - min 2");
+    return SQLITE_ERROR;
+  }
+  /* OFFSET is left to SQLite, which skips the rows itself; it only matters
+  ** here as part of the count of rows that LIMIT needs */
+  for (int k = 0; k < MATCH_ARG_COUNT; k++) {
+    if (aArg[k] < 0) continue;
+    idxNum |= 1 << k;
+    pIdxInfo->aConstraintUsage[aArg[k]].argvIndex = ++nArg;
+    pIdxInfo->aConstraintUsage[aArg[k]].omit = (k <= MATCH_ARG_TIMEOUT);
+  }
+  pIdxInfo->estimatedRows = nRow;
+  pIdxInfo->estimatedCost = (double)nRow * 10;
+  pIdxInfo->idxNum = idxNum;
+  return SQLITE_OK;
+}
+
+/* Virtual table structure */
+struct sqlite3_module matchvtabModule = {
+  /* iVersion    */ 0,
+  /* xCreate     */ 0,
+  /* xConnect    */ matchvtabConnect,
+  /* xBestIndex  */ matchvtabBestIndex,
+  /* xDisconnect */ matchvtabDisconnect,
+  /* xDestroy    */ 0,
+  /* xOpen       */ matchvtabOpen,
+  /* xClose      */ matchvtabClose,
+  /* xFilter     */ matchvtabFilter,
+  /* xNext       */ matchvtabNext,
+  /* xEof        */ matchvtabEof,
+  /* xColumn     */ matchvtabColumn,
+  /* xRowid      */ matchvtabRowid,
+  /* xUpdate     */ 0,
+  /* xBegin      */ 0,
+  /* xSync       */ 0,
+  /* xCommit     */ 0,
+  /* xRollback   */ 0,
+  /* xFindMethod */ 0,
+  /* xRename     */ 0,
+  /* xSavepoint  */ 0,
+  /* xRelease    */ 0,
+  /* xRollbackTo */ 0,
+  /* xShadowName */ 0
+};
+
+#endif /* !UTILEXT_OMIT_REGEX */
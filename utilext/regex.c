@@ -9,9 +9,13 @@
  * This file contains the C functions for the regex extension functions, except
  * for the regex_split() function, which is in "splitvtab.c".
  *
- * Most of these functions are very "boilerplate-ish", since they are really
- * just wrappers that fixup the data for consumption by their managed
- * counterparts, and return the result to SQLite.
+ * Each function first tries the native engine in "rxengine.c", which runs in
+ * linear time and never needs the timeout. If the pattern uses something that
+ * the native engine doesn't support, or doesn't parse, the function falls back
+ * to its managed counterpart, which runs the pattern with the .NET Regex class
+ * (and produces the .NET error message for a bad pattern). Those wrappers are
+ * very "boilerplate-ish", since they just fixup the data for consumption by
+ * the managed code, and return the result to SQLite.
  *
  * We could probably reduce the LOC count significantly with clever use of
  * macros, but we find that such things invariably result in more pain than
@@ -37,20 +41,177 @@
 #include <assert.h>
 #include <stdlib.h>
 #include "RegexExt.h"
+#include "rxengine.h"
 
 /* _INIT1 gets evaluated in functions.c */
 SQLITE_EXTENSION_INIT3
 
 typedef UtilityExtensions::RegexExt RegExt;
+typedef UtilityExtensions::Common Com;
+
+/* Compiled patterns for regexp() and regsub()
+**
+** The pattern is compiled the first time that a statement sees it, and kept
+** with sqlite3_set_auxdata() against the pattern argument, along with a
+** matcher (whose DFA cache keeps growing from row to row) and a copy of the
+** pattern text. The copy is compared with the pattern on every row, so a
+** bound parameter that gets rebound between steps is never matched with a
+** stale program. The verdict for a pattern the native engine can't run is
+** cached the same way, so those rows go straight to the managed Regex class.
+**
+** For regsub(), the compiled replacement pattern is kept in the same place,
+** and is only recompiled when the replacement argument changes.
+*/
+struct RegexCache {
+  int rc;               /* RESULT_OK, RX_UNSUPPORTED or RX_INVALID     */
+  bool isWide;          /* true if the pattern is UTF-16               */
+  bool turkic;          /* Turkic casing when the pattern was compiled */
+  RxProg *pProg;        /* compiled pattern, if rc is RESULT_OK        */
+  RxMatcher *pMatcher;  /* matcher for pProg                           */
+  RxSub *pSub;          /* compiled replacement, or NULL               */
+  u8 *zSub;             /* copy of the replacement pattern             */
+  int cbSub;            /* count of bytes in zSub                      */
+  int cbPattern;        /* count of bytes in zPattern                  */
+  u8 *zPattern;         /* copy of the pattern; follows the struct     */
+};
+
+/* Destructor for the auxdata */
+static void regexCacheFree(void *p) {
+  RegexCache *pCache = (RegexCache*)p;
+  if (pCache) {
+    rx_subFree(pCache->pSub);
+    sqlite3_free(pCache->zSub);
+    rx_matcherFree(pCache->pMatcher);
+    rx_cacheRelease(pCache->pProg);
+    sqlite3_free(pCache);
+  }
+}
+
+/* Compiles a pattern and gets a matcher ready for it; returns NULL if memory
+** runs out. */
+static RegexCache *regexCompile(const DbStr *pPattern) {
+  RegexCache *pCache;
+  const char *zReason;
+
+  pCache = (RegexCache*)sqlite3_malloc64(sizeof(RegexCache) + pPattern->cb);
+  if (!pCache) return nullptr;
+  memset(pCache, 0, sizeof(RegexCache));
+  pCache->isWide = pPattern->isWide;
+  pCache->turkic = Com::TurkicCasing;
+  pCache->cbPattern = pPattern->cb;
+  pCache->zPattern = (u8*)&pCache[1];
+  if (pPattern->cb > 0) {
+    memcpy(pCache->zPattern, pPattern->pText, (size_t)pPattern->cb);
+  }
+  pCache->rc = rx_cacheGet(pPattern, pCache->turkic, &pCache->pProg,
+                           &zReason);
+  if (pCache->rc == RESULT_OK) {
+    pCache->pMatcher = rx_matcherNew(pCache->pProg);
+    if (!pCache->pMatcher) pCache->rc = ERR_NOMEM;
+  }
+  if (pCache->rc == ERR_NOMEM) {
+    regexCacheFree(pCache);
+    return nullptr;
+  }
+  return pCache;
+}
+
+/* Returns true if the cached program was compiled from this pattern */
+static bool regexReusable(const RegexCache *p, const DbStr *pPattern) {
+  return p->isWide == pPattern->isWide && p->turkic == Com::TurkicCasing &&
+         p->cbPattern == pPattern->cb &&
+         memcmp(p->zPattern, pPattern->pText, (size_t)pPattern->cb) == 0;
+}
+
+/* Makes sure that the cached replacement was compiled from 'pSub'. Returns
+** RESULT_OK, ERR_NOMEM, or RX_UNSUPPORTED for a replacement that the native
+** engine can't handle. */
+static int regexSetSub(RegexCache *p, const DbStr *pSub) {
+  u8 *zSub;
+  int rc;
+
+  if (p->pSub && p->cbSub == pSub->cb &&
+      memcmp(p->zSub, pSub->pText, (size_t)pSub->cb) == 0)
+  {
+    return RESULT_OK;
+  }
+  rx_subFree(p->pSub);
+  p->pSub = nullptr;
+  zSub = (u8*)sqlite3_realloc64(p->zSub, pSub->cb > 0 ? pSub->cb : 1);
+  if (!zSub) return ERR_NOMEM;
+  p->zSub = zSub;
+  rc = rx_subCompile(p->pProg, pSub, &p->pSub);
+  if (rc != RESULT_OK) return rc;
+  if (pSub->cb > 0) memcpy(p->zSub, pSub->pText, (size_t)pSub->cb);
+  p->cbSub = pSub->cb;
+  return RESULT_OK;
+}
+
+/* Runs regexp() with the managed Regex class */
+static void regexpManaged(sqlite3_context *pCtx,
+                          int argc,
+                          sqlite3_value **argv,
+                          DbStr *pIn,
+                          DbStr *pPattern)
+{
+  char *zError;
+  int rc;
+  int result;
+  int ms = -1;
+
+  if (argc == 3) {
+    ms = sqlite3_value_int(argv[2]);
+  }
+  rc = RegExt::Regexp(pIn, pPattern, ms, &zError, &result);
+  if (rc == RESULT_OK) {
+    sqlite3_result_int(pCtx, result);
+  }
+  else if (rc == ERR_REGEX_PARSE) {
+    sqlite3_result_error(pCtx, zError, -1);
+    free(zError);
+  }
+  else {
+    util_setError(pCtx, rc);
+  }
+}
+
+/* Runs regsub() with the managed Regex class */
+static void regsubManaged(sqlite3_context *pCtx,
+                          int argc,
+                          sqlite3_value **argv,
+                          DbStr *pIn,
+                          DbStr *pPattern,
+                          DbStr *pSub)
+{
+  DbStr result;
+  char *zError;
+  int rc;
+  int ms = -1;
+
+  if (argc == 4) {
+    ms = sqlite3_value_int(argv[3]);
+  }
+  rc = RegExt::Regsub(pIn, pPattern, pSub, ms, &zError, &result);
+  if (rc == RESULT_OK) {
+    util_setText(pCtx, &result);
+  }
+  else if (rc == ERR_REGEX_PARSE) {
+    sqlite3_result_error(pCtx, zError, -1);
+    free(zError);
+  }
+  else {
+    util_setError(pCtx, rc);
+  }
+}
 
 void regexFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   DbStr input;
   DbStr pattern;
+  RegexCache *pCache;
+  RegexCache *pNew = nullptr;
   bool isWide;
-  char *zError;
+  bool found;
   int rc;
-  int result;
-  int ms = -1;
 
   assert(argc == 2 || argc == 3);
   if (argc == 2) {
@@ -62,20 +223,29 @@ void regexFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   isWide = util_getEnc16(pCtx);
   util_getText(argv[0], isWide, &pattern);
   util_getText(argv[1], isWide, &input);
-  if (argc == 3) {
-    ms = sqlite3_value_int(argv[2]);
-  }
-  rc = RegExt::Regexp(&input, &pattern, ms, &zError, &result);
-  if (rc == RESULT_OK) {
-    sqlite3_result_int(pCtx, result);
+  pCache = (RegexCache*)sqlite3_get_auxdata(pCtx, 0);
+  if (!pCache || !regexReusable(pCache, &pattern)) {
+    pCache = pNew = regexCompile(&pattern);
+    if (!pNew) {
+      sqlite3_result_error_nomem(pCtx);
+      return;
+    }
   }
-  else if (rc == ERR_REGEX_PARSE) {
-    sqlite3_result_error(pCtx, zError, -1);
-    free(zError);
+  if (pCache->rc == RESULT_OK) {
+    rc = rx_isMatch(pCache->pMatcher, &input, &found);
+    if (rc == RESULT_OK) {
+      sqlite3_result_int(pCtx, found ? 1 : 0);
+    }
+    else {
+      util_setError(pCtx, rc);
+    }
   }
   else {
-    util_setError(pCtx, rc);
+    regexpManaged(pCtx, argc, argv, &input, &pattern);
   }
+  /* this has to come last, since SQLite is free to destroy the new program
+  ** before sqlite3_set_auxdata() even returns */
+  if (pNew) sqlite3_set_auxdata(pCtx, 0, pNew, regexCacheFree);
 }
 
 
@@ -84,10 +254,10 @@ void regsubFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   DbStr pattern;
   DbStr sub;
   DbStr result;
+  RegexCache *pCache;
+  RegexCache *pNew = nullptr;
   bool isWide;
-  char *zError;
-  int rc;
-  int ms = -1;
+  int rc = RX_UNSUPPORTED;
 
   assert(argc == 3 || argc == 4);
   if (argc == 3) {
@@ -96,14 +266,76 @@ void regsubFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   else {
     CHECK_ARGS_NULL(4);
   }
-  if (argc == 4) {
-    ms = sqlite3_value_int(argv[3]);
-  }
   isWide = util_getEnc16(pCtx);
   util_getText(argv[0], isWide, &input);
   util_getText(argv[1], isWide, &pattern);
   util_getText(argv[2], isWide, &sub);
-  rc = RegExt::Regsub(&input, &pattern, &sub, ms, &zError, &result);
+  pCache = (RegexCache*)sqlite3_get_auxdata(pCtx, 1);
+  if (!pCache || !regexReusable(pCache, &pattern)) {
+    pCache = pNew = regexCompile(&pattern);
+    if (!pNew) {
+      sqlite3_result_error_nomem(pCtx);
+      return;
+    }
+  }
+  if (pCache->rc == RESULT_OK) {
+    rc = regexSetSub(pCache, &sub);
+    if (rc == RESULT_OK) {
+      rc = rx_replace(pCache->pMatcher, &input, pCache->pSub, &result);
+    }
+  }
+  if (rc == RESULT_OK) {
+    if (result.pText) {
+      util_setTextN(pCtx, result.pText, result.cb, isWide, sqlite3_free);
+    }
+    else {
+      util_setTextN(pCtx, input.pText, input.cb, isWide, SQLITE_TRANSIENT);
+    }
+  }
+  else if (rc == RX_UNSUPPORTED) {
+    regsubManaged(pCtx, argc, argv, &input, &pattern, &sub);
+  }
+  else {
+    util_setError(pCtx, rc);
+  }
+  if (pNew) sqlite3_set_auxdata(pCtx, 1, pNew, regexCacheFree);
+}
+
+/* Runs regexp_count() with the managed Regex class */
+static void regexCountManaged(sqlite3_context *pCtx,
+                              DbStr *pIn,
+                              DbStr *pPattern)
+{
+  char *zError;
+  int rc;
+  int result;
+
+  rc = RegExt::Regcount(pIn, pPattern, -1, &zError, &result);
+  if (rc == RESULT_OK) {
+    sqlite3_result_int(pCtx, result);
+  }
+  else if (rc == ERR_REGEX_PARSE) {
+    sqlite3_result_error(pCtx, zError, -1);
+    free(zError);
+  }
+  else {
+    util_setError(pCtx, rc);
+  }
+}
+
+/* Runs regexp_extract() with the managed Regex class */
+static void regexExtractManaged(sqlite3_context *pCtx,
+                                DbStr *pIn,
+                                DbStr *pPattern,
+                                int group,
+                                int occurrence)
+{
+  DbStr result;
+  char *zError;
+  int rc;
+
+  rc = RegExt::Regextract(pIn, pPattern, group, occurrence, -1, &zError,
+                          &result);
   if (rc == RESULT_OK) {
     util_setText(pCtx, &result);
   }
@@ -111,9 +343,173 @@ void regsubFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
     sqlite3_result_error(pCtx, zError, -1);
     free(zError);
   }
+  else if (rc == ERR_INDEX) {
+    sqlite3_result_error_code(pCtx, ERR_INDEX);
+  }
   else {
     util_setError(pCtx, rc);
   }
 }
 
+void regexCountFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
+  DbStr input;
+  DbStr pattern;
+  RegexCache *pCache;
+  RegexCache *pNew = nullptr;
+  bool isWide;
+  int count;
+  int rc;
+
+  assert(argc == 2);
+  CHECK_ARGS_NULL(2);
+  isWide = util_getEnc16(pCtx);
+  util_getText(argv[0], isWide, &input);
+  util_getText(argv[1], isWide, &pattern);
+  pCache = (RegexCache*)sqlite3_get_auxdata(pCtx, 1);
+  if (!pCache || !regexReusable(pCache, &pattern)) {
+    pCache = pNew = regexCompile(&pattern);
+    if (!pNew) {
+      sqlite3_result_error_nomem(pCtx);
+      return;
+    }
+  }
+  if (pCache->rc == RESULT_OK) {
+    rc = rx_count(pCache->pMatcher, &input, &count);
+    if (rc == RESULT_OK) {
+      sqlite3_result_int(pCtx, count);
+    }
+    else {
+      util_setError(pCtx, rc);
+    }
+  }
+  else {
+    regexCountManaged(pCtx, &input, &pattern);
+  }
+  if (pNew) sqlite3_set_auxdata(pCtx, 1, pNew, regexCacheFree);
+}
+
+void regexExtractFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
+  DbStr input;
+  DbStr pattern;
+  RegexCache *pCache;
+  RegexCache *pNew = nullptr;
+  const int *aCap;
+  bool isWide;
+  int group = 0;
+  int occurrence = 1;
+  int rc;
+
+  assert(argc >= 2 && argc <= 4);
+  CHECK_ARGS_NULL(argc);
+  if (argc >= 3) group = sqlite3_value_int(argv[2]);
+  if (argc == 4) occurrence = sqlite3_value_int(argv[3]);
+  if (group < 0 || occurrence < 1) {
+    sqlite3_result_error_code(pCtx, ERR_INDEX);
+    return;
+  }
+  isWide = util_getEnc16(pCtx);
+  util_getText(argv[0], isWide, &input);
+  util_getText(argv[1], isWide, &pattern);
+  pCache = (RegexCache*)sqlite3_get_auxdata(pCtx, 1);
+  if (!pCache || !regexReusable(pCache, &pattern)) {
+    pCache = pNew = regexCompile(&pattern);
+    if (!pNew) {
+      sqlite3_result_error_nomem(pCtx);
+      return;
+    }
+  }
+  if (pCache->rc != RESULT_OK) {
+    regexExtractManaged(pCtx, &input, &pattern, group, occurrence);
+  }
+  else if (group >= rx_groupCount(pCache->pProg)) {
+    sqlite3_result_error_code(pCtx, ERR_INDEX);
+  }
+  else {
+    rc = rx_findNth(pCache->pMatcher, &input, occurrence, &aCap);
+    if (rc != RESULT_OK) {
+      util_setError(pCtx, rc);
+    }
+    else if (aCap && aCap[group * 2] >= 0) {
+      /* the group is a slice of the input, so nothing is built for it */
+      util_setTextN(pCtx, (const u8*)input.pText + aCap[group * 2],
+                    aCap[group * 2 + 1] - aCap[group * 2], isWide,
+                    SQLITE_TRANSIENT);
+    }
+  }
+  if (pNew) sqlite3_set_auxdata(pCtx, 1, pNew, regexCacheFree);
+}
+
+void regexUnsupportedFunc(sqlite3_context *pCtx,
+                          int argc,
+                          sqlite3_value **argv)
+{
+  DbStr pattern;
+  DbStr empty;
+  RxProg *pProg;
+  bool isWide;
+  const char *zReason;
+  char *zError;
+  int rc;
+  int result;
+
+  assert(argc == 1);
+  CHECK_ARGS_NULL(1);
+  isWide = util_getEnc16(pCtx);
+  util_getText(argv[0], isWide, &pattern);
+  rc = rx_cacheGet(&pattern, Com::TurkicCasing, &pProg, &zReason);
+  switch (rc) {
+    case RESULT_OK:
+      rx_cacheRelease(pProg);
+      sqlite3_result_null(pCtx);
+      break;
+    case RX_UNSUPPORTED:
+      sqlite3_result_text(pCtx, zReason, -1, SQLITE_STATIC);
+      break;
+    case RX_INVALID:
+      /* let the managed Regex class describe what is wrong */
+      empty.pText = pattern.pText;
+      empty.cb = 0;
+      empty.isWide = isWide;
+      rc = RegExt::Regexp(&empty, &pattern, -1, &zError, &result);
+      if (rc == ERR_REGEX_PARSE) {
+        sqlite3_result_text(pCtx, zError, -1, SQLITE_TRANSIENT);
+        free(zError);
+      }
+      else if (rc == RESULT_OK) {
+        sqlite3_result_text(pCtx, "syntax the native parser doesn't accept",
+                            -1, SQLITE_STATIC);
+      }
+      else {
+        util_setError(pCtx, rc);
+      }
+      break;
+    default:
+      util_setError(pCtx, rc);
+      break;
+  }
+}
+
+
+void regexCacheStatsFunc(sqlite3_context *pCtx,
+                         int argc,
+                         sqlite3_value **argv)
+{
+  RxCacheStats stats;
+  char *zResult;
+
+  assert(argc == 0);
+  rx_cacheStats(&stats);
+  zResult = sqlite3_mprintf("{\"hits\":%lld,\"misses\":%lld,"
+                            "\"evictions\":%lld,\"entries\":%d,"
+                            "\"bytes\":%lld,\"limit\":%lld}",
+                            stats.nHit, stats.nMiss, stats.nEvict,
+                            stats.nEntry, stats.nByte, stats.nLimit);
+  if (zResult) {
+    sqlite3_result_text(pCtx, zResult, -1, sqlite3_free);
+  }
+  else {
+    sqlite3_result_error_nomem(pCtx);
+  }
+}
+
 #endif /* !UTILEXT_OMIT_REGEX */
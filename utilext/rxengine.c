@@ -0,0 +1,2991 @@
+/*==============================================================================
+ *
+ * Written by: Mark Benningfield
+ *
+ * LICENSE: Public Domain -- see the file LICENSE.txt
+ *
+ *==============================================================================
+ *
+ * This file contains the native regular expression engine that the regex
+ * functions use for the patterns that it supports.
+ *
+ * A pattern is parsed into a syntax tree, which is compiled into a program
+ * for a Pike VM: a simulation of the Thompson NFA for the pattern that runs
+ * all of the alternatives in lock step, one code point of input at a time,
+ * and carries the capture positions along with each thread. The threads are
+ * kept in priority order, so the VM finds the same leftmost match, with the
+ * same captures, that the backtracking .NET matcher does. The one place where
+ * the captures can't be made to agree is inside nested loops that can match
+ * the empty string, so a pattern with such captures is left to .NET (see
+ * nullableLoops()). The running time is bounded by the length of the input
+ * times the size of the program, whatever the pattern is, so there is no
+ * catastrophic backtracking to guard against with a timeout.
+ *
+ * When all we need to know is whether there is a match at all, we run a DFA
+ * instead, which is built lazily from the same program as the input is
+ * scanned. A DFA state is the set of instructions that the NFA threads are
+ * waiting on, plus what we know about the previous character (for the anchors
+ * and word boundaries). The transitions on ASCII characters are cached in the
+ * state, so most of the input costs one table lookup per character. The
+ * number of states is bounded; when the cache fills up, it is emptied and
+ * built up again from the current state.
+ *
+ * The supported syntax is everything in the .NET syntax that can be matched
+ * without backtracking: literals and escapes, character classes (including
+ * \d, \w, \s, and the \p{..} general categories), '.', anchors and word
+ * boundaries, alternation, greedy and lazy quantifiers, capturing, named, and
+ * non-capturing groups, comments, and the i, m, n, s, and x inline options.
+ * Backreferences, lookaround, atomic groups, conditionals, balancing groups,
+ * \G, Unicode block names, and character class subtraction are reported as
+ * unsupported, along with those captures in nested nullable loops and
+ * patterns that would compile to an unreasonably big program. A pattern that doesn't parse is reported as invalid; the managed
+ * Regex class runs both kinds, and produces the .NET error message for an
+ * invalid pattern.
+ *
+ * There are a few differences from the .NET matcher that can't be helped:
+ *
+ *  - The engine matches code points, so '.' or a negated class matches a
+ *    character outside the Basic Multilingual Plane as a whole, rather than
+ *    one UTF-16 surrogate at a time.
+ *
+ *  - Case-insensitive matching uses the simple case folding from the Unicode
+ *    Character Database, with the Turkic mappings for dotted and dotless I
+ *    when the current culture calls for them, instead of the culture's
+ *    ToLower() mappings.
+ *
+ *  - The character properties come from the Unicode data in "unidata.h",
+ *    which may be a newer version than the one the framework uses.
+ *
+ *============================================================================*/
+
+#ifndef UTILEXT_OMIT_REGEX
+
+/* Notes in "utilext.c" */
+#pragma warning( disable : 4127 4339 4514 )
+#ifdef NDEBUG
+#pragma warning( disable : 4100)
+#endif
+
+#pragma warning( disable : 4820 )
+#include <assert.h>
+#include <limits.h>
+#include <string.h>
+#include "rxengine.h"
+#include "unicode.h"
+
+/* _INIT1 gets evaluated in functions.c */
+SQLITE_EXTENSION_INIT3
+
+/* Limits on the patterns that we compile; anything bigger is reported as
+** unsupported, and left to the managed Regex class. */
+#define RX_MAX_DEPTH    200        /* nesting depth of groups              */
+#define RX_MAX_INST     20000      /* instructions in a compiled program   */
+#define RX_MAX_CELLS    (1 << 20)  /* capture slots for all of the threads */
+
+/* Limits on the DFA state cache of a matcher */
+#define RX_DFA_STATES   1000       /* states before the cache is emptied   */
+#define RX_DFA_HASH     1024       /* buckets in the state hash table      */
+
+/* Special DFA transitions */
+#define RX_DFA_UNKNOWN  (-1)       /* not computed yet                     */
+#define RX_DFA_MATCH    (-2)       /* the pattern has matched              */
+#define RX_DFA_DEAD     (-3)       /* the pattern can no longer match      */
+#define RX_DFA_NOMEM    (-4)       /* memory allocation failed             */
+
+/* Largest result from rx_replace() */
+#define RX_MAX_RESULT   INT_MAX
+
+/* Inline options */
+#define RXO_IGNORECASE  0x01  /* i */
+#define RXO_MULTILINE   0x02  /* m */
+#define RXO_EXPLICIT    0x04  /* n */
+#define RXO_SINGLELINE  0x08  /* s */
+#define RXO_WHITESPACE  0x10  /* x */
+
+/* Syntax tree node types */
+#define RXN_EMPTY   0  /* matches the empty string                 */
+#define RXN_CHAR    1  /* x is the code point                      */
+#define RXN_ANY     2  /* x is true for (?s)                       */
+#define RXN_CLASS   3  /* x is the index of the class              */
+#define RXN_ASSERT  4  /* x is the RXA_xxx assertion               */
+#define RXN_CAT     5  /* children match in sequence               */
+#define RXN_ALT     6  /* children are alternatives                */
+#define RXN_REPEAT  7  /* child repeats min to max (-1) times      */
+#define RXN_GROUP   8  /* child is captured in group x             */
+
+/* Instructions; the ones up to RX_MATCH are the ones that a thread waits on */
+#define RX_CHAR     0  /* match the code point x                   */
+#define RX_ANY      1  /* match anything but '\n'                  */
+#define RX_ANYNL    2  /* match any code point                     */
+#define RX_CLASS    3  /* match a member of class x                */
+#define RX_MATCH    4  /* the pattern has matched                  */
+#define RX_JMP      5  /* continue at x                            */
+#define RX_SPLIT    6  /* continue at x, and at y at lower priority */
+#define RX_SAVE     7  /* record the position in capture slot x    */
+#define RX_ASSERT   8  /* continue if assertion x holds            */
+#define RX_EMPTY    9  /* continue at y if slot x is the position  */
+
+/* Zero-width assertions */
+#define RXA_BEGIN   0  /* \A, or ^ without (?m)                    */
+#define RXA_BOL     1  /* ^ with (?m)                              */
+#define RXA_EOL     2  /* $ with (?m)                              */
+#define RXA_ENDZ    3  /* \Z, or $ without (?m)                    */
+#define RXA_END     4  /* \z                                       */
+#define RXA_WORDB   5  /* \b                                       */
+#define RXA_NWORDB  6  /* \B                                       */
+
+/* What we know about a position in the text, for the assertions. The first
+** three are about the previous character, and the rest about the next. */
+#define RXF_START       0x01  /* at the start of the text               */
+#define RXF_AFTER_NL    0x02  /* the previous character is '\n'         */
+#define RXF_PREV_WORD   0x04  /* the previous character is a word char  */
+#define RXF_END         0x08  /* at the end of the text                 */
+#define RXF_BEFORE_NL   0x10  /* the next character is '\n'             */
+#define RXF_FINAL_NL    0x20  /* ... and it is the last character       */
+#define RXF_NEXT_WORD   0x40  /* the next character is a word char      */
+
+/* Sets of general categories */
+#define GC_BIT(G)   (1u << (G))
+#define GC_LETTER   (GC_BIT(GC_Lu) | GC_BIT(GC_Ll) | GC_BIT(GC_Lt) |\
+                     GC_BIT(GC_Lm) | GC_BIT(GC_Lo))
+#define GC_CASED    (GC_BIT(GC_Lu) | GC_BIT(GC_Ll) | GC_BIT(GC_Lt))
+#define GC_MARK     (GC_BIT(GC_Mn) | GC_BIT(GC_Mc) | GC_BIT(GC_Me))
+#define GC_NUMBER   (GC_BIT(GC_Nd) | GC_BIT(GC_Nl) | GC_BIT(GC_No))
+#define GC_PUNCT    (GC_BIT(GC_Pc) | GC_BIT(GC_Pd) | GC_BIT(GC_Ps) |\
+                     GC_BIT(GC_Pe) | GC_BIT(GC_Pi) | GC_BIT(GC_Pf) |\
+                     GC_BIT(GC_Po))
+#define GC_SYMBOL   (GC_BIT(GC_Sm) | GC_BIT(GC_Sc) | GC_BIT(GC_Sk) |\
+                     GC_BIT(GC_So))
+#define GC_SEPARATOR (GC_BIT(GC_Zs) | GC_BIT(GC_Zl) | GC_BIT(GC_Zp))
+#define GC_OTHER    (GC_BIT(GC_Cc) | GC_BIT(GC_Cf) | GC_BIT(GC_Cs) |\
+                     GC_BIT(GC_Co) | GC_BIT(GC_Cn))
+#define GC_WORD     (GC_LETTER | GC_BIT(GC_Mn) | GC_BIT(GC_Nd) |\
+                     GC_BIT(GC_Pc))
+
+/* The general category names that \p{..} accepts */
+static const struct {
+  const char *zName;
+  u32 mask;
+} aCategory[] = {
+  { "L",  GC_LETTER     }, { "Lu", GC_BIT(GC_Lu) }, { "Ll", GC_BIT(GC_Ll) },
+  { "Lt", GC_BIT(GC_Lt) }, { "Lm", GC_BIT(GC_Lm) }, { "Lo", GC_BIT(GC_Lo) },
+  { "M",  GC_MARK       }, { "Mn", GC_BIT(GC_Mn) }, { "Mc", GC_BIT(GC_Mc) },
+  { "Me", GC_BIT(GC_Me) }, { "N",  GC_NUMBER     }, { "Nd", GC_BIT(GC_Nd) },
+  { "Nl", GC_BIT(GC_Nl) }, { "No", GC_BIT(GC_No) }, { "P",  GC_PUNCT      },
+  { "Pc", GC_BIT(GC_Pc) }, { "Pd", GC_BIT(GC_Pd) }, { "Ps", GC_BIT(GC_Ps) },
+  { "Pe", GC_BIT(GC_Pe) }, { "Pi", GC_BIT(GC_Pi) }, { "Pf", GC_BIT(GC_Pf) },
+  { "Po", GC_BIT(GC_Po) }, { "S",  GC_SYMBOL     }, { "Sm", GC_BIT(GC_Sm) },
+  { "Sc", GC_BIT(GC_Sc) }, { "Sk", GC_BIT(GC_Sk) }, { "So", GC_BIT(GC_So) },
+  { "Z",  GC_SEPARATOR  }, { "Zs", GC_BIT(GC_Zs) }, { "Zl", GC_BIT(GC_Zl) },
+  { "Zp", GC_BIT(GC_Zp) }, { "C",  GC_OTHER      }, { "Cc", GC_BIT(GC_Cc) },
+  { "Cf", GC_BIT(GC_Cf) }, { "Cs", GC_BIT(GC_Cs) }, { "Co", GC_BIT(GC_Co) },
+  { "Cn", GC_BIT(GC_Cn) }
+};
+
+#define RX_EOF 0xFFFFFFFF
+
+/* One instruction of a compiled program */
+struct RxInst {
+  u8 op;        /* RX_xxx opcode                          */
+  bool fold;    /* RX_CHAR: compare the simple case folding */
+  int x;        /* first operand                          */
+  int y;        /* second operand (RX_SPLIT)              */
+};
+
+/* A set of general categories in a character class; \s also includes the
+** white space control characters */
+struct RxItem {
+  u32 mask;     /* GC_BIT() of the categories in the set  */
+  bool space;   /* includes '\t' to '\r' and U+0085       */
+  bool negate;  /* the item matches what is not in the set */
+};
+
+/* A character class. The ranges are sorted, and don't overlap; with the
+** ignore case option, they are closed under the simple case folding, so we
+** only need to look up the folding of the input character. */
+struct RxClass {
+  u32 aAscii[4];  /* the answer for each code point below 0x80 */
+  int iRange;     /* first range in RxProg.aRange              */
+  int nRange;     /* count of ranges                           */
+  int iItem;      /* first item in RxProg.aItem                */
+  int nItem;      /* count of items                            */
+  bool negate;    /* the class matches what is not in the set  */
+  bool fold;      /* match the simple case folding of the input */
+};
+
+/* A named capture group */
+struct RxName {
+  int iText;      /* first code point of the name in aNameText */
+  int nText;      /* count of code points in the name          */
+  int iGroup;     /* group number                              */
+};
+
+typedef struct RxCacheEntry RxCacheEntry;
+
+/* A literal for the prefilter; see litAnalyze() */
+struct RxLiteral {
+  int iText;      /* first byte of the literal in aLitText     */
+  int cb;         /* count of bytes in the literal             */
+  bool noCase;    /* search with ASCII case folding            */
+};
+
+struct RxProg {
+  RxInst *aInst;      /* the instructions                       */
+  int nInst;
+  RxClass *aClass;    /* character classes                      */
+  int nClass;
+  u32 *aRange;        /* class ranges, as pairs of code points  */
+  int nRange;
+  RxItem *aItem;      /* class category items                   */
+  int nItem;
+  RxName *aName;      /* named groups                           */
+  int nName;
+  u32 *aNameText;     /* code points of the group names         */
+  int nNameText;
+  RxLiteral *aLit;    /* prefix literals, then required ones    */
+  int nPrefix;        /* every match starts with one of these   */
+  int nRequired;      /* every match contains one of these      */
+  u8 *aLitText;       /* the literals, in the pattern encoding  */
+  int nGroup;         /* count of groups, including group 0     */
+  int nSlot;          /* capture slots, plus the RX_EMPTY slots */
+  int nThread;        /* most threads the VM can have at a time */
+  bool anchored;      /* every match starts at the start        */
+  bool turkic;        /* use the Turkic case folding            */
+  RxCacheEntry *pEntry; /* cache entry that owns the program, if any */
+};
+
+/* A syntax tree node; the tree is stored in an array, and linked by index */
+struct RxNode {
+  u8 type;        /* RXN_xxx node type                         */
+  bool fold;      /* RXN_CHAR: ignore case                     */
+  bool lazy;      /* RXN_REPEAT: lazy quantifier               */
+  int min;        /* RXN_REPEAT: fewest repetitions            */
+  int max;        /* RXN_REPEAT: most repetitions, -1 for any  */
+  int x;          /* operand, depending on the type            */
+  int iChild;     /* first child, or -1                        */
+  int iNext;      /* next sibling, or -1                       */
+};
+
+/* Parser and compiler state */
+struct RxParse {
+  const u8 *z;          /* the pattern                               */
+  int cb;               /* count of bytes in z                       */
+  bool isWide;          /* true if the pattern is UTF-16             */
+  int i;                /* byte offset of the next code point        */
+  int depth;            /* current group nesting depth               */
+  int rc;               /* RESULT_OK or the first error              */
+  const char *zReason;  /* what is unsupported, for RX_UNSUPPORTED   */
+  RxProg *pProg;        /* the program being built                   */
+  RxNode *aNode;        /* syntax tree nodes                         */
+  int nNode;
+  int nNodeAlloc;
+  int nCapture;         /* count of numbered groups                  */
+  u32 *aTmp;            /* ranges of the class being parsed          */
+  int nTmp;
+  int nTmpAlloc;
+  int nInstAlloc;       /* allocated sizes of the program arrays     */
+  int nClassAlloc;
+  int nRangeAlloc;
+  int nItemAlloc;
+  int nNameAlloc;
+  int nNameTextAlloc;
+  bool foldReady;       /* aFoldUnsafe has been filled in            */
+  u32 aFoldUnsafe[4];   /* ASCII characters that non-ASCII folds to  */
+};
+
+/* Makes room for at least one more element in an array */
+template<typename T>
+static bool grow(T **pa, int *pnAlloc, int n) {
+  T *aNew;
+  int nNew;
+
+  if (n < *pnAlloc) return true;
+  nNew = *pnAlloc ? *pnAlloc * 2 : 16;
+  aNew = (T*)sqlite3_realloc64(*pa, (sqlite3_uint64)nNew * sizeof(T));
+  if (aNew == nullptr) return false;
+  *pa = aNew;
+  *pnAlloc = nNew;
+  return true;
+}
+
+/* Returns true if 'c' is a word character, as the .NET \b sees it */
+static bool isWordChar(u32 c) {
+  if (c < 0x80) {
+    return (c >= '0' && c <= '9') || c == '_' ||
+           ((c | 0x20) >= 'a' && (c | 0x20) <= 'z');
+  }
+  if (c == 0x200C || c == 0x200D) return true; /* ZWNJ and ZWJ */
+  return (GC_WORD & GC_BIT(uni_category(c))) != 0;
+}
+
+/* Returns true for the white space control characters in \s */
+static bool isSpaceControl(u32 c) {
+  return (c >= '\t' && c <= '\r') || c == 0x85;
+}
+
+/*
+** Parsing
+*/
+
+static int setUnsupported(RxParse *p, const char *zReason) {
+  if (p->rc == RESULT_OK) {
+    p->rc = RX_UNSUPPORTED;
+    p->zReason = zReason;
+  }
+  return -1;
+}
+
+static int setInvalid(RxParse *p) {
+  if (p->rc == RESULT_OK) p->rc = RX_INVALID;
+  return -1;
+}
+
+static int setNoMem(RxParse *p) {
+  if (p->rc == RESULT_OK) p->rc = ERR_NOMEM;
+  return -1;
+}
+
+/* Gets the code point at byte offset 'i' of the pattern, or RX_EOF */
+static u32 charAt(RxParse *p, int i, int *pLen) {
+  if (i >= p->cb) {
+    *pLen = 0;
+    return RX_EOF;
+  }
+  return uni_decode(p->z + i, p->cb - i, p->isWide, pLen);
+}
+
+static u32 peekChar(RxParse *p) {
+  int len;
+  return charAt(p, p->i, &len);
+}
+
+static u32 nextChar(RxParse *p) {
+  int len;
+  u32 c = charAt(p, p->i, &len);
+  p->i += len;
+  return c;
+}
+
+/* Gets the code unit 'k' units past the next code point, or RX_EOF. This is
+** good enough for finding the ASCII characters of the syntax. */
+static u32 unitAt(RxParse *p, int k) {
+  int i = p->i + k * (p->isWide ? 2 : 1);
+  if (i >= p->cb) return RX_EOF;
+  return p->isWide ? ((const u16*)p->z)[i / 2] : p->z[i];
+}
+
+static int newNode(RxParse *p, u8 type, int x) {
+  RxNode *pNode;
+  if (!grow(&p->aNode, &p->nNodeAlloc, p->nNode)) return setNoMem(p);
+  pNode = &p->aNode[p->nNode];
+  memset(pNode, 0, sizeof(*pNode));
+  pNode->type = type;
+  pNode->x = x;
+  pNode->iChild = -1;
+  pNode->iNext = -1;
+  return p->nNode++;
+}
+
+/* Skips (?#...) comments, and with the x option, white space and the rest
+** of the line after '#' */
+static void skipBlank(RxParse *p, int opts) {
+  for (;;) {
+    if (opts & RXO_WHITESPACE) {
+      u32 c = peekChar(p);
+      if (c == ' ' || (c >= '\t' && c <= '\r')) {
+        nextChar(p);
+        continue;
+      }
+      if (c == '#') {
+        while (c != RX_EOF && c != '\n') {
+          nextChar(p);
+          c = peekChar(p);
+        }
+        continue;
+      }
+    }
+    if (unitAt(p, 0) == '(' && unitAt(p, 1) == '?' && unitAt(p, 2) == '#') {
+      u32 c;
+      do {
+        c = nextChar(p);
+        if (c == RX_EOF) {
+          setInvalid(p);
+          return;
+        }
+      } while (c != ')');
+      continue;
+    }
+    return;
+  }
+}
+
+/* Scans a decimal number into 'pN'; returns false on overflow */
+static bool scanDecimal(RxParse *p, int *pN) {
+  i64 n = 0;
+  u32 c;
+  while ((c = peekChar(p)) >= '0' && c <= '9') {
+    n = n * 10 + (c - '0');
+    if (n > INT_MAX) return false;
+    nextChar(p);
+  }
+  *pN = (int)n;
+  return true;
+}
+
+/* Returns true if the next characters are a {n}, {n,}, or {n,m} quantifier */
+static bool isQuantifier(RxParse *p) {
+  int k = 1;
+  u32 c = unitAt(p, 0);
+  if (c != '{') return c == '*' || c == '+' || c == '?';
+  if (!(unitAt(p, k) >= '0' && unitAt(p, k) <= '9')) return false;
+  while (unitAt(p, k) >= '0' && unitAt(p, k) <= '9') k++;
+  if (unitAt(p, k) == ',') {
+    k++;
+    while (unitAt(p, k) >= '0' && unitAt(p, k) <= '9') k++;
+  }
+  return unitAt(p, k) == '}';
+}
+
+/* Scans a group name, which is a run of word characters, into the name
+** table; returns the count of code points. */
+static int scanName(RxParse *p) {
+  RxProg *pProg = p->pProg;
+  int n = 0;
+  while (peekChar(p) != RX_EOF && isWordChar(peekChar(p))) {
+    if (!grow(&pProg->aNameText, &p->nNameTextAlloc, pProg->nNameText)) {
+      return setNoMem(p);
+    }
+    pProg->aNameText[pProg->nNameText++] = nextChar(p);
+    n++;
+  }
+  return n;
+}
+
+/* Scans the hex digits of \x or \u */
+static u32 scanHex(RxParse *p, int n) {
+  u32 c = 0;
+  for (int k = 0; k < n; k++) {
+    u32 d = peekChar(p);
+    if (d >= '0' && d <= '9') {
+      d -= '0';
+    }
+    else if ((d | 0x20) >= 'a' && (d | 0x20) <= 'f') {
+      d = (d | 0x20) - 'a' + 10;
+    }
+    else {
+      setInvalid(p);
+      return 0;
+    }
+    nextChar(p);
+    c = c * 16 + d;
+  }
+  return c;
+}
+
+/* Scans a character escape, just past the backslash; this is the .NET
+** ScanCharEscape() */
+static u32 scanCharEscape(RxParse *p) {
+  u32 c = nextChar(p);
+  u32 value;
+
+  if (c >= '0' && c <= '7') {
+    value = c - '0';
+    for (int k = 0; k < 2 && peekChar(p) >= '0' && peekChar(p) <= '7'; k++) {
+      value = value * 8 + (nextChar(p) - '0');
+    }
+    return value & 0xFF;
+  }
+  switch (c) {
+    case 'x': return scanHex(p, 2);
+    case 'u': return scanHex(p, 4);
+    case 'a': return 0x07;
+    case 'b': return 0x08;
+    case 'e': return 0x1B;
+    case 'f': return 0x0C;
+    case 'n': return 0x0A;
+    case 'r': return 0x0D;
+    case 't': return 0x09;
+    case 'v': return 0x0B;
+    case 'c':
+      c = nextChar(p);
+      if (c >= 'a' && c <= 'z') c -= 0x20;
+      if (c >= '@' && c - '@' < 0x20) return c - '@';
+      setInvalid(p);
+      return 0;
+  }
+  if (c == RX_EOF || isWordChar(c)) setInvalid(p);
+  return c;
+}
+
+/* Adds a category item to the class being parsed */
+static bool addItem(RxParse *p, u32 mask, bool space, bool negate) {
+  RxProg *pProg = p->pProg;
+  RxItem *pItem;
+  if (!grow(&pProg->aItem, &p->nItemAlloc, pProg->nItem)) {
+    setNoMem(p);
+    return false;
+  }
+  pItem = &pProg->aItem[pProg->nItem++];
+  pItem->mask = mask;
+  pItem->space = space;
+  pItem->negate = negate;
+  return true;
+}
+
+/* Adds the class item for \d, \w, \s, or their negations */
+static bool addClassEscape(RxParse *p, u32 c) {
+  switch (c) {
+    case 'd': case 'D':
+      return addItem(p, GC_BIT(GC_Nd), false, c == 'D');
+    case 'w': case 'W':
+      return addItem(p, GC_WORD, false, c == 'W');
+    default:
+      return addItem(p, GC_SEPARATOR, true, c == 'S');
+  }
+}
+
+/* Parses the {name} of \p{name} or \P{name}, and adds its item */
+static bool addProperty(RxParse *p, bool negate, int opts) {
+  const int nCategory = (int)(sizeof(aCategory) / sizeof(aCategory[0]));
+  u32 aName[3];
+  int n = 0;
+  u32 c;
+
+  if (nextChar(p) != '{') {
+    setInvalid(p);
+    return false;
+  }
+  while ((c = peekChar(p)) != RX_EOF && (isWordChar(c) || c == '-')) {
+    if (n < 3) aName[n] = c;
+    n++;
+    nextChar(p);
+  }
+  if (nextChar(p) != '}') {
+    setInvalid(p);
+    return false;
+  }
+  for (int k = 0; n <= 2 && k < nCategory; k++) {
+    const char *z = aCategory[k].zName;
+    if (z[0] == (char)aName[0] && aName[0] < 0x80 &&
+        ((n == 1 && z[1] == 0) || (n == 2 && z[1] == (char)aName[1])))
+    {
+      u32 mask = aCategory[k].mask;
+      /* like .NET, any of the cased letter categories matches them all */
+      if ((opts & RXO_IGNORECASE) && (mask & GC_CASED) == mask) {
+        mask = GC_CASED;
+      }
+      return addItem(p, mask, false, negate);
+    }
+  }
+  /* the rest are Unicode block names, or nothing at all */
+  setUnsupported(p, "Unicode block names in \\p{..}");
+  return false;
+}
+
+/* Adds a range of code points to the class being parsed */
+static bool addRange(RxParse *p, u32 lo, u32 hi) {
+  if (!grow(&p->aTmp, &p->nTmpAlloc, p->nTmp + 1)) {
+    setNoMem(p);
+    return false;
+  }
+  p->aTmp[p->nTmp++] = lo;
+  p->aTmp[p->nTmp++] = hi;
+  return true;
+}
+
+/* Returns true if 'c' is in one of the sorted ranges */
+static bool inRanges(const u32 *aRange, int nRange, u32 c) {
+  int lo = 0;
+  int hi = nRange - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    if (c < aRange[mid * 2]) {
+      hi = mid - 1;
+    }
+    else if (c > aRange[mid * 2 + 1]) {
+      lo = mid + 1;
+    }
+    else {
+      return true;
+    }
+  }
+  return false;
+}
+
+/* Returns true if 'c' is in one of the ranges, which aren't sorted yet */
+static bool inRangesUnsorted(const u32 *aRange, int nRange, u32 c) {
+  for (int k = 0; k < nRange; k++) {
+    if (c >= aRange[k * 2] && c <= aRange[k * 2 + 1]) return true;
+  }
+  return false;
+}
+
+/* Tests a code point at or above 0x80 against a class */
+static bool classMatchSlow(const RxProg *pProg, const RxClass *pClass, u32 c) {
+  u32 f = pClass->fold ? uni_foldSimple(c, pProg->turkic) : c;
+  bool in = inRanges(pProg->aRange + pClass->iRange * 2, pClass->nRange, f);
+  if (!in && pClass->nItem > 0) {
+    u32 bit = GC_BIT(uni_category(c));
+    for (int k = 0; k < pClass->nItem && !in; k++) {
+      const RxItem *pItem = &pProg->aItem[pClass->iItem + k];
+      bool m = (pItem->mask & bit) != 0 || (pItem->space && isSpaceControl(c));
+      in = m != pItem->negate;
+    }
+  }
+  return in != pClass->negate;
+}
+
+static bool classMatch(const RxProg *pProg, const RxClass *pClass, u32 c) {
+  if (c < 0x80) return (pClass->aAscii[c >> 5] >> (c & 31)) & 1;
+  return classMatchSlow(pProg, pClass, c);
+}
+
+/* Sorts the ranges of the class being parsed, and merges the ones that
+** overlap or touch */
+static void mergeRanges(RxParse *p) {
+  u32 *a = p->aTmp;
+  int n = p->nTmp / 2;
+  int k = 0;
+
+  /* shell sort on the low code point of each pair */
+  for (int gap = n / 2; gap > 0; gap /= 2) {
+    for (int i = gap; i < n; i++) {
+      u32 lo = a[i * 2];
+      u32 hi = a[i * 2 + 1];
+      int j = i;
+      for (; j >= gap && a[(j - gap) * 2] > lo; j -= gap) {
+        a[j * 2] = a[(j - gap) * 2];
+        a[j * 2 + 1] = a[(j - gap) * 2 + 1];
+      }
+      a[j * 2] = lo;
+      a[j * 2 + 1] = hi;
+    }
+  }
+  for (int i = 0; i < n; i++) {
+    if (k > 0 && a[i * 2] <= a[k * 2 - 1] + 1) {
+      if (a[i * 2 + 1] > a[k * 2 - 1]) a[k * 2 - 1] = a[i * 2 + 1];
+    }
+    else {
+      a[k * 2] = a[i * 2];
+      a[k * 2 + 1] = a[i * 2 + 1];
+      k++;
+    }
+  }
+  p->nTmp = k * 2;
+}
+
+/* Turns the ranges and items that have been parsed into a class, and returns
+** a node for it. With the ignore case option, every range gets the foldings
+** of its members added, so that a class like [A-Z] matches 'q'. */
+static int finishClass(RxParse *p, int iItem, bool negate, int opts) {
+  RxProg *pProg = p->pProg;
+  RxClass *pClass;
+  bool fold = (opts & RXO_IGNORECASE) != 0;
+
+  if (fold) {
+    int nRange = p->nTmp / 2;
+    u32 from;
+    u32 to;
+    for (u32 c = 0; c < 0x80; c++) {
+      if (inRangesUnsorted(p->aTmp, nRange, c)) {
+        u32 f = uni_foldSimple(c, pProg->turkic);
+        if (f != c && !addRange(p, f, f)) return -1;
+      }
+    }
+    for (int k = 0; uni_foldMapping(k, pProg->turkic, &from, &to); k++) {
+      if (from >= 0x80 && inRangesUnsorted(p->aTmp, nRange, from) &&
+          !addRange(p, to, to))
+      {
+        return -1;
+      }
+    }
+  }
+  mergeRanges(p);
+  if (!grow(&pProg->aClass, &p->nClassAlloc, pProg->nClass)) {
+    return setNoMem(p);
+  }
+  while (pProg->nRange + p->nTmp > p->nRangeAlloc) {
+    if (!grow(&pProg->aRange, &p->nRangeAlloc, p->nRangeAlloc)) {
+      return setNoMem(p);
+    }
+  }
+  pClass = &pProg->aClass[pProg->nClass];
+  memset(pClass, 0, sizeof(*pClass));
+  pClass->iRange = pProg->nRange / 2;
+  pClass->nRange = p->nTmp / 2;
+  pClass->iItem = iItem;
+  pClass->nItem = pProg->nItem - iItem;
+  pClass->negate = negate;
+  pClass->fold = fold;
+  if (p->nTmp > 0) {
+    memcpy(pProg->aRange + pProg->nRange, p->aTmp, p->nTmp * sizeof(u32));
+    pProg->nRange += p->nTmp;
+  }
+  p->nTmp = 0;
+  for (u32 c = 0; c < 0x80; c++) {
+    if (classMatchSlow(pProg, pClass, c)) {
+      pClass->aAscii[c >> 5] |= 1u << (c & 31);
+    }
+  }
+  return newNode(p, RXN_CLASS, pProg->nClass++);
+}
+
+/* Parses a character class, just past the '['; this follows the .NET
+** ScanCharClass(), quirks and all */
+static int parseClass(RxParse *p, int opts) {
+  int iItem = p->pProg->nItem;
+  bool negate = false;
+  bool inRange = false;
+  u32 prev = 0;
+
+  p->nTmp = 0;
+  if (peekChar(p) == '^') {
+    nextChar(p);
+    negate = true;
+  }
+  for (bool first = true; ; first = false) {
+    bool translated = false;
+    u32 c = nextChar(p);
+    if (c == RX_EOF) return setInvalid(p);
+    if (c == ']' && !first) break;
+    if (c == '\\' && peekChar(p) != RX_EOF) {
+      c = peekChar(p);
+      switch (c) {
+        case 'd': case 'D': case 'w': case 'W': case 's': case 'S':
+          nextChar(p);
+          if (inRange) return setInvalid(p);
+          if (!addClassEscape(p, c)) return -1;
+          continue;
+        case 'p': case 'P':
+          nextChar(p);
+          if (inRange) return setInvalid(p);
+          if (!addProperty(p, c == 'P', opts)) return -1;
+          continue;
+        case '-':
+          nextChar(p);
+          if (!addRange(p, c, c)) return -1;
+          continue;
+        default:
+          c = scanCharEscape(p);
+          if (p->rc != RESULT_OK) return -1;
+          translated = true;
+          break;
+      }
+    }
+    else if (c == '[' && peekChar(p) == ':' && !inRange) {
+      return setUnsupported(p, "POSIX character classes [:name:]");
+    }
+    if (inRange) {
+      inRange = false;
+      if (c == '[' && !translated && !first) {
+        return setUnsupported(p, "character class subtraction");
+      }
+      if (prev > c) return setInvalid(p);
+      if (!addRange(p, prev, c)) return -1;
+    }
+    else if (unitAt(p, 0) == '-' && unitAt(p, 1) != ']' &&
+             unitAt(p, 1) != RX_EOF)
+    {
+      prev = c;
+      inRange = true;
+      nextChar(p);
+    }
+    else if (c == '-' && !translated && !first && unitAt(p, 0) == '[') {
+      return setUnsupported(p, "character class subtraction");
+    }
+    else if (!addRange(p, c, c)) {
+      return -1;
+    }
+  }
+  return finishClass(p, iItem, negate, opts);
+}
+
+/* Makes a class node for \d, \w, \s, \p{..}, or their negations */
+static int parseClassEscape(RxParse *p, u32 c, int opts) {
+  int iItem = p->pProg->nItem;
+  p->nTmp = 0;
+  if (c == 'p' || c == 'P') {
+    if (!addProperty(p, c == 'P', opts)) return -1;
+  }
+  else if (!addClassEscape(p, c)) {
+    return -1;
+  }
+  return finishClass(p, iItem, false, opts);
+}
+
+/* Makes a node for a literal code point */
+static int literalNode(RxParse *p, u32 c, int opts) {
+  int iNode;
+  bool fold = (opts & RXO_IGNORECASE) != 0;
+  iNode = newNode(p, RXN_CHAR, (int)(fold ? uni_foldSimple(c, p->pProg->turkic)
+                                          : c));
+  if (iNode >= 0) p->aNode[iNode].fold = fold;
+  return iNode;
+}
+
+/* Parses an escape outside of a character class, just past the backslash */
+static int parseEscape(RxParse *p, int opts) {
+  u32 c = peekChar(p);
+
+  switch (c) {
+    case RX_EOF:
+      return setInvalid(p);
+    case 'b': nextChar(p); return newNode(p, RXN_ASSERT, RXA_WORDB);
+    case 'B': nextChar(p); return newNode(p, RXN_ASSERT, RXA_NWORDB);
+    case 'A': nextChar(p); return newNode(p, RXN_ASSERT, RXA_BEGIN);
+    case 'Z': nextChar(p); return newNode(p, RXN_ASSERT, RXA_ENDZ);
+    case 'z': nextChar(p); return newNode(p, RXN_ASSERT, RXA_END);
+    case 'G':
+      return setUnsupported(p, "the \\G anchor");
+    case 'd': case 'D': case 'w': case 'W': case 's': case 'S':
+    case 'p': case 'P':
+      nextChar(p);
+      return parseClassEscape(p, c, opts);
+    case 'k':
+      return setUnsupported(p, "backreferences");
+    case '<': case '\'':
+      /* \<name> is a backreference, but a lone \< is just a '<' */
+      if (unitAt(p, 1) != RX_EOF) {
+        int len;
+        u32 d = charAt(p, p->i + (p->isWide ? 2 : 1), &len);
+        if (isWordChar(d)) return setUnsupported(p, "backreferences");
+      }
+      break;
+  }
+  if (c >= '1' && c <= '9') return setUnsupported(p, "backreferences");
+  c = scanCharEscape(p);
+  if (p->rc != RESULT_OK) return -1;
+  return literalNode(p, c, opts);
+}
+
+static int parseAlt(RxParse *p, int opts);
+
+/* Scans inline options, like the "im-s" in "(?im-s)"; returns the new set */
+static int scanOptions(RxParse *p, int opts) {
+  bool off = false;
+  for (;;) {
+    u32 c = peekChar(p);
+    int flag = 0;
+    switch (c | 0x20) {
+      case 'i': flag = RXO_IGNORECASE; break;
+      case 'm': flag = RXO_MULTILINE; break;
+      case 'n': flag = RXO_EXPLICIT; break;
+      case 's': flag = RXO_SINGLELINE; break;
+      case 'x': flag = RXO_WHITESPACE; break;
+    }
+    if (c == '-' || c == '+') {
+      off = (c == '-');
+    }
+    else if (flag == 0 || c > 'z') {
+      return opts;
+    }
+    else if (off) {
+      opts &= ~flag;
+    }
+    else {
+      opts |= flag;
+    }
+    nextChar(p);
+  }
+}
+
+/* Parses the body of a group and its closing parenthesis */
+static int parseGroupBody(RxParse *p, int opts) {
+  int iBody;
+  if (p->depth >= RX_MAX_DEPTH) {
+    return setUnsupported(p, "groups nested too deeply");
+  }
+  p->depth++;
+  iBody = parseAlt(p, opts);
+  p->depth--;
+  if (iBody < 0) return -1;
+  if (nextChar(p) != ')') return setInvalid(p);
+  return iBody;
+}
+
+/* Wraps a group body in a capture node */
+static int captureNode(RxParse *p, int iBody, int group) {
+  int iNode = newNode(p, RXN_GROUP, group);
+  if (iNode >= 0) p->aNode[iNode].iChild = iBody;
+  return iNode;
+}
+
+/* Value returned by parseGroup() for a "(?imnsx)" that sets the options for
+** the rest of the enclosing group */
+#define RX_NO_NODE (-2)
+
+/* Parses a group, just past the '(' */
+static int parseGroup(RxParse *p, int *pOpts) {
+  RxProg *pProg = p->pProg;
+  u32 c;
+  int iBody;
+
+  if (peekChar(p) != '?') {
+    if (*pOpts & RXO_EXPLICIT) return parseGroupBody(p, *pOpts);
+    int group = ++p->nCapture;
+    iBody = parseGroupBody(p, *pOpts);
+    return iBody < 0 ? -1 : captureNode(p, iBody, group);
+  }
+  nextChar(p);
+  c = nextChar(p);
+  switch (c) {
+    case ':':
+      return parseGroupBody(p, *pOpts);
+    case '=': case '!':
+      return setUnsupported(p, "lookahead assertions");
+    case '>':
+      return setUnsupported(p, "atomic groups");
+    case '(':
+      return setUnsupported(p, "conditional expressions");
+    case '<': case '\'': {
+      u32 close = (c == '<') ? '>' : '\'';
+      RxName *pName;
+      int iName;
+      int iText = pProg->nNameText;
+      int nText;
+      c = peekChar(p);
+      if (close == '>' && (c == '=' || c == '!')) {
+        return setUnsupported(p, "lookbehind assertions");
+      }
+      if (c >= '0' && c <= '9') {
+        return setUnsupported(p, "numbered group names");
+      }
+      if (c == '-') return setUnsupported(p, "balancing groups");
+      if (c == RX_EOF || !isWordChar(c)) return setInvalid(p);
+      nText = scanName(p);
+      if (nText < 0) return -1;
+      if (peekChar(p) == '-') return setUnsupported(p, "balancing groups");
+      if (nextChar(p) != close) return setInvalid(p);
+      for (int k = 0; k < pProg->nName; k++) {
+        if (pProg->aName[k].nText == nText &&
+            memcmp(pProg->aNameText + pProg->aName[k].iText,
+                   pProg->aNameText + iText, nText * sizeof(u32)) == 0)
+        {
+          return setUnsupported(p, "group names that are used twice");
+        }
+      }
+      if (!grow(&pProg->aName, &p->nNameAlloc, pProg->nName)) {
+        return setNoMem(p);
+      }
+      pName = &pProg->aName[pProg->nName++];
+      pName->iText = iText;
+      pName->nText = nText;
+      pName->iGroup = 0; /* numbered after the unnamed groups */
+      /* the body may add names of its own, so take ours before parsing it */
+      iName = pProg->nName;
+      iBody = parseGroupBody(p, *pOpts);
+      /* named groups are tagged with a negative number until then */
+      return iBody < 0 ? -1 : captureNode(p, iBody, -iName);
+    }
+    default: {
+      int opts;
+      p->i -= p->isWide ? 2 : 1;
+      if (c == RX_EOF || c >= 0x80) return setInvalid(p);
+      opts = scanOptions(p, *pOpts);
+      c = nextChar(p);
+      if (c == ')') {
+        *pOpts = opts;
+        return RX_NO_NODE;
+      }
+      if (c == ':') return parseGroupBody(p, opts);
+      return setInvalid(p);
+    }
+  }
+}
+
+/* Parses one atom, not counting any quantifier */
+static int parseAtom(RxParse *p, int *pOpts) {
+  u32 c = nextChar(p);
+  switch (c) {
+    case '(':
+      return parseGroup(p, pOpts);
+    case '[':
+      return parseClass(p, *pOpts);
+    case '.':
+      return newNode(p, RXN_ANY, (*pOpts & RXO_SINGLELINE) != 0);
+    case '^':
+      return newNode(p, RXN_ASSERT,
+                     (*pOpts & RXO_MULTILINE) ? RXA_BOL : RXA_BEGIN);
+    case '$':
+      return newNode(p, RXN_ASSERT,
+                     (*pOpts & RXO_MULTILINE) ? RXA_EOL : RXA_ENDZ);
+    case '\\':
+      return parseEscape(p, *pOpts);
+  }
+  return literalNode(p, c, *pOpts);
+}
+
+/* Parses a quantifier, if there is one, and applies it to 'iAtom' */
+static int parseQuantifier(RxParse *p, int iAtom, int opts) {
+  int min;
+  int max;
+  int iNode;
+  u32 c;
+
+  skipBlank(p, opts);
+  if (p->rc != RESULT_OK) return -1;
+  if (!isQuantifier(p)) return iAtom;
+  c = nextChar(p);
+  switch (c) {
+    case '*': min = 0; max = -1; break;
+    case '+': min = 1; max = -1; break;
+    case '?': min = 0; max = 1; break;
+    default:
+      if (!scanDecimal(p, &min)) return setInvalid(p);
+      max = min;
+      if (peekChar(p) == ',') {
+        nextChar(p);
+        max = -1;
+        if (peekChar(p) != '}' && !scanDecimal(p, &max)) return setInvalid(p);
+        if (max >= 0 && max < min) return setInvalid(p);
+      }
+      nextChar(p); /* the '}' */
+      break;
+  }
+  iNode = newNode(p, RXN_REPEAT, 0);
+  if (iNode < 0) return -1;
+  p->aNode[iNode].min = min;
+  p->aNode[iNode].max = max;
+  p->aNode[iNode].iChild = iAtom;
+  if (peekChar(p) == '?') {
+    nextChar(p);
+    p->aNode[iNode].lazy = true;
+  }
+  /* a quantifier can't follow another one */
+  skipBlank(p, opts);
+  if (p->rc != RESULT_OK) return -1;
+  if (isQuantifier(p)) return setInvalid(p);
+  return iNode;
+}
+
+/* Parses a sequence of atoms, up to a '|', a ')', or the end */
+static int parseConcat(RxParse *p, int *pOpts) {
+  int iCat = newNode(p, RXN_CAT, 0);
+  int iLast = -1;
+
+  if (iCat < 0) return -1;
+  for (;;) {
+    u32 c;
+    int iAtom;
+    skipBlank(p, *pOpts);
+    if (p->rc != RESULT_OK) return -1;
+    c = peekChar(p);
+    if (c == RX_EOF || c == '|' || c == ')') break;
+    /* nothing to quantify */
+    if (isQuantifier(p)) return setInvalid(p);
+    iAtom = parseAtom(p, pOpts);
+    if (iAtom == RX_NO_NODE) continue;
+    if (iAtom < 0) return -1;
+    iAtom = parseQuantifier(p, iAtom, *pOpts);
+    if (iAtom < 0) return -1;
+    if (iLast < 0) {
+      p->aNode[iCat].iChild = iAtom;
+    }
+    else {
+      p->aNode[iLast].iNext = iAtom;
+    }
+    iLast = iAtom;
+  }
+  if (iLast < 0) {
+    p->aNode[iCat].type = RXN_EMPTY;
+  }
+  else if (p->aNode[iCat].iChild == iLast) {
+    return iLast;
+  }
+  return iCat;
+}
+
+/* Parses alternatives separated by '|'. Inline options set in one of them
+** carry on into the ones that follow, up to the end of the group. */
+static int parseAlt(RxParse *p, int opts) {
+  int iAlt;
+  int iLast;
+  int iFirst = parseConcat(p, &opts);
+
+  if (iFirst < 0 || peekChar(p) != '|') return iFirst;
+  iAlt = newNode(p, RXN_ALT, 0);
+  if (iAlt < 0) return -1;
+  p->aNode[iAlt].iChild = iFirst;
+  iLast = iFirst;
+  while (peekChar(p) == '|') {
+    int iNext;
+    nextChar(p);
+    iNext = parseConcat(p, &opts);
+    if (iNext < 0) return -1;
+    p->aNode[iLast].iNext = iNext;
+    iLast = iNext;
+  }
+  return iAlt;
+}
+
+/*
+** Compiling
+*/
+
+/* Appends an instruction to the program; returns its index */
+static int emit(RxParse *p, u8 op, int x, int y) {
+  RxProg *pProg = p->pProg;
+  RxInst *pInst;
+  if (pProg->nInst >= RX_MAX_INST) {
+    return setUnsupported(p, "patterns that compile to too many instructions");
+  }
+  if (!grow(&pProg->aInst, &p->nInstAlloc, pProg->nInst)) return setNoMem(p);
+  pInst = &pProg->aInst[pProg->nInst];
+  pInst->op = op;
+  pInst->fold = false;
+  pInst->x = x;
+  pInst->y = y;
+  return pProg->nInst++;
+}
+
+/* Emits a split whose preferred branch is the next instruction, unless the
+** quantifier is lazy; the other branch is filled in by the caller */
+static int emitSplit(RxParse *p, bool lazy) {
+  int i = emit(p, RX_SPLIT, 0, 0);
+  if (i >= 0) {
+    if (lazy) {
+      p->pProg->aInst[i].y = i + 1;
+    }
+    else {
+      p->pProg->aInst[i].x = i + 1;
+    }
+  }
+  return i;
+}
+
+/* Points the other branch of a split from emitSplit() at 'target' */
+static void patchSplit(RxParse *p, int iSplit, bool lazy, int target) {
+  if (lazy) {
+    p->pProg->aInst[iSplit].x = target;
+  }
+  else {
+    p->pProg->aInst[iSplit].y = target;
+  }
+}
+
+static bool compileNode(RxParse *p, int iNode);
+
+/* Returns true if the node can match the empty string */
+static bool isNullable(RxParse *p, int iNode) {
+  const RxNode *pNode = &p->aNode[iNode];
+  switch (pNode->type) {
+    case RXN_CHAR:
+    case RXN_ANY:
+    case RXN_CLASS:
+      return false;
+    case RXN_CAT:
+      for (int i = pNode->iChild; i >= 0; i = p->aNode[i].iNext) {
+        if (!isNullable(p, i)) return false;
+      }
+      return true;
+    case RXN_ALT:
+      for (int i = pNode->iChild; i >= 0; i = p->aNode[i].iNext) {
+        if (isNullable(p, i)) return true;
+      }
+      return false;
+    case RXN_REPEAT:
+      return pNode->min == 0 || isNullable(p, pNode->iChild);
+    case RXN_GROUP:
+      return isNullable(p, pNode->iChild);
+  }
+  return true;
+}
+
+/* Returns how deeply the loops with a nullable body are nested in the node,
+** given how many of them enclose it. The RX_EMPTY checks give the .NET result
+** for one such loop, but not for one inside another, where the iterations of
+** the inner loop that .NET stops on depend on its backtracking order; so a
+** capture that is inside, or around, a pair of them is left to .NET. */
+static int nullableLoops(RxParse *p, int iNode, int nOuter) {
+  const RxNode *pNode = &p->aNode[iNode];
+  int nDeepest = 0;
+  bool isLoop = pNode->type == RXN_REPEAT && pNode->max != pNode->min &&
+                isNullable(p, pNode->iChild);
+
+  for (int i = pNode->iChild; i >= 0; i = p->aNode[i].iNext) {
+    int n = nullableLoops(p, i, nOuter + (isLoop ? 1 : 0));
+    if (n > nDeepest) nDeepest = n;
+  }
+  if (isLoop) nDeepest++;
+  if (pNode->type == RXN_GROUP && nOuter + nDeepest >= 2) {
+    setUnsupported(p, "captures in nested loops that can match nothing");
+  }
+  return nDeepest;
+}
+
+/* Compiles one iteration of a repetition. If 'iEmpty' is a slot number, the
+** iteration is followed by an RX_EMPTY that leaves the repetition when it
+** matched the empty string; the RX_EMPTY is added to the chain of branches to
+** the end of the repetition. */
+static bool compileIteration(RxParse *p, int iChild, int iEmpty, int *piChain)
+{
+  int i;
+  if (iEmpty < 0) return compileNode(p, iChild);
+  if (emit(p, RX_SAVE, iEmpty, 0) < 0 || !compileNode(p, iChild)) return false;
+  i = emit(p, RX_EMPTY, iEmpty, *piChain);
+  if (i < 0) return false;
+  *piChain = i;
+  return true;
+}
+
+/* Compiles x{min,max}, x{min,}, and the like. The bounded repetitions after
+** the first 'min' are chained optional copies, and x{min,} becomes min-1
+** copies followed by a loop of x+. */
+static bool compileRepeat(RxParse *p, const RxNode *pNode) {
+  RxProg *pProg = p->pProg;
+  int iChild = pNode->iChild;
+  bool lazy = pNode->lazy;
+  int iEmpty = -1;
+  int iChain = -1;
+  int iSplit;
+
+  /* an empty child doesn't add any instructions, so check the count here */
+  if (pNode->min > RX_MAX_INST) {
+    setUnsupported(p, "patterns that compile to too many instructions");
+    return false;
+  }
+  /* an iteration past the minimum that matches the empty string ends the
+  ** loop in .NET, which matters for the captures inside it */
+  if (pNode->max != pNode->min && isNullable(p, iChild)) {
+    iEmpty = pProg->nSlot++;
+  }
+  if (pNode->max < 0 && iEmpty >= 0) {
+    int iLoop;
+
+    for (int k = 1; k < pNode->min; k++) {
+      if (!compileNode(p, iChild)) return false;
+    }
+    if (pNode->min > 0 && !compileIteration(p, iChild, iEmpty, &iChain)) {
+      return false;
+    }
+    /* The optional iterations alternate between two copies of x, so that the
+    ** iteration after one that ends at some position doesn't run into the
+    ** instructions that the VM has already visited there; otherwise it would
+    ** be cut off, and an empty last iteration wouldn't set its captures. */
+    iLoop = pProg->nInst;
+    for (int k = 0; k < 2; k++) {
+      iSplit = emit(p, RX_SPLIT, 0, iChain);
+      if (iSplit < 0) return false;
+      pProg->aInst[iSplit].x = iSplit + 1;
+      iChain = iSplit;
+      if (!compileIteration(p, iChild, iEmpty, &iChain)) return false;
+    }
+    if (emit(p, RX_JMP, iLoop, 0) < 0) return false;
+  }
+  else if (pNode->max < 0) {
+    int iLoop;
+    int iBack;
+
+    for (int k = 1; k < pNode->min; k++) {
+      if (!compileNode(p, iChild)) return false;
+    }
+    /* x* is compiled as (x+)? */
+    if (pNode->min == 0) {
+      iSplit = emit(p, RX_SPLIT, 0, iChain);
+      if (iSplit < 0) return false;
+      pProg->aInst[iSplit].x = iSplit + 1;
+      iChain = iSplit;
+    }
+    iLoop = pProg->nInst;
+    if (!compileNode(p, iChild)) return false;
+    iBack = emit(p, RX_SPLIT, 0, 0);
+    if (iBack < 0) return false;
+    pProg->aInst[iBack].x = lazy ? iBack + 1 : iLoop;
+    pProg->aInst[iBack].y = lazy ? iLoop : iBack + 1;
+  }
+  else {
+    for (int k = 0; k < pNode->min; k++) {
+      if (iEmpty >= 0 && k == pNode->min - 1) {
+        if (!compileIteration(p, iChild, iEmpty, &iChain)) return false;
+      }
+      else if (!compileNode(p, iChild)) {
+        return false;
+      }
+    }
+    for (int k = pNode->min; k < pNode->max; k++) {
+      iSplit = emit(p, RX_SPLIT, 0, iChain);
+      if (iSplit < 0) return false;
+      pProg->aInst[iSplit].x = iSplit + 1;
+      iChain = iSplit;
+      if (!compileIteration(p, iChild, iEmpty, &iChain)) return false;
+    }
+  }
+  /* the branches to the end are chained through their 'y' operands */
+  while (iChain >= 0) {
+    RxInst *pInst = &pProg->aInst[iChain];
+    iChain = pInst->y;
+    if (pInst->op == RX_SPLIT && lazy) {
+      pInst->y = pInst->x;
+      pInst->x = pProg->nInst;
+    }
+    else {
+      pInst->y = pProg->nInst;
+    }
+  }
+  return true;
+}
+
+/* Gets the group number of a capture node; named groups are numbered after
+** all of the unnamed ones */
+static int groupNumber(RxParse *p, int x) {
+  return x > 0 ? x : p->pProg->aName[-x - 1].iGroup;
+}
+
+static bool compileNode(RxParse *p, int iNode) {
+  RxProg *pProg = p->pProg;
+  RxNode node = p->aNode[iNode];
+  int i;
+
+  switch (node.type) {
+    case RXN_EMPTY:
+      return true;
+    case RXN_CHAR:
+      i = emit(p, RX_CHAR, node.x, 0);
+      if (i >= 0) pProg->aInst[i].fold = node.fold;
+      return i >= 0;
+    case RXN_ANY:
+      return emit(p, node.x ? RX_ANYNL : RX_ANY, 0, 0) >= 0;
+    case RXN_CLASS:
+      return emit(p, RX_CLASS, node.x, 0) >= 0;
+    case RXN_ASSERT:
+      return emit(p, RX_ASSERT, node.x, 0) >= 0;
+    case RXN_CAT:
+      for (i = node.iChild; i >= 0; i = p->aNode[i].iNext) {
+        if (!compileNode(p, i)) return false;
+      }
+      return true;
+    case RXN_ALT: {
+      /* the jumps to the end are chained through their operands */
+      int iChain = -1;
+      for (i = node.iChild; i >= 0; i = p->aNode[i].iNext) {
+        if (p->aNode[i].iNext < 0) {
+          if (!compileNode(p, i)) return false;
+          break;
+        }
+        int iSplit = emitSplit(p, false);
+        if (iSplit < 0 || !compileNode(p, i)) return false;
+        iChain = emit(p, RX_JMP, iChain, 0);
+        if (iChain < 0) return false;
+        patchSplit(p, iSplit, false, pProg->nInst);
+      }
+      while (iChain >= 0) {
+        int iPrev = pProg->aInst[iChain].x;
+        pProg->aInst[iChain].x = pProg->nInst;
+        iChain = iPrev;
+      }
+      return true;
+    }
+    case RXN_REPEAT:
+      return compileRepeat(p, &node);
+    default: {
+      int slot = groupNumber(p, node.x) * 2;
+      return emit(p, RX_SAVE, slot, 0) >= 0 && compileNode(p, node.iChild) &&
+             emit(p, RX_SAVE, slot + 1, 0) >= 0;
+    }
+  }
+}
+
+/* Returns true if every match of the node has to start at the start of the
+** text, so the VM doesn't need to look for one anywhere else */
+static bool isAnchored(RxParse *p, int iNode) {
+  const RxNode *pNode = &p->aNode[iNode];
+  switch (pNode->type) {
+    case RXN_ASSERT:
+      return pNode->x == RXA_BEGIN;
+    case RXN_CAT:
+    case RXN_GROUP:
+      return isAnchored(p, pNode->iChild);
+    case RXN_ALT:
+      for (int i = pNode->iChild; i >= 0; i = p->aNode[i].iNext) {
+        if (!isAnchored(p, i)) return false;
+      }
+      return true;
+  }
+  return false;
+}
+
+/*
+** Literal prefilter
+**
+** Most patterns that we see in practice have a literal in them that every
+** match has to contain, like 'ERROR' or 'user_id=', and most of the inputs
+** don't have it. So while compiling, we work out from the syntax tree a small
+** set of literals, one of which is in every match, and if we can, a set of
+** literals that every match starts with. The matcher looks for those with the
+** same vectorized search that charindex() uses (see uni_asciiFind()) before it
+** runs the engine at all: an input without any of the required literals can't
+** match, and rather than start a match at every position, the DFA starts where
+** the first prefix literal does, and the VM skips ahead to the next one
+** whenever it has no threads left.
+**
+** A literal is a run of code points that the pattern matches exactly. A case
+** insensitive character can be part of one if it is ASCII, and nothing but
+** its ASCII counterpart folds to it, so that a search that ignores ASCII case
+** finds every place where the pattern can match; the search ignores case for
+** the whole literal, which can only turn up more candidates. The analysis
+** gives up on anything that gets too big, which is always safe: no literals
+** just means no prefilter.
+*/
+#define RX_MAX_LITERALS  8   /* literals in a set                    */
+#define RX_MAX_LITLEN    16  /* code points in a literal             */
+#define RX_MAX_LITDEPTH  32  /* tree depth that the analysis follows */
+
+/* A set of literals found by the analysis */
+struct RxLitSet {
+  int n;           /* count of literals, or -1 if there is no set   */
+  bool complete;   /* every match is exactly one of the literals    */
+  bool aNoCase[RX_MAX_LITERALS];
+  int aLen[RX_MAX_LITERALS];
+  u32 aChar[RX_MAX_LITERALS][RX_MAX_LITLEN];
+};
+
+static void litNone(RxLitSet *pSet) {
+  pSet->n = -1;
+  pSet->complete = false;
+}
+
+/* The set that holds just the empty string */
+static void litEmpty(RxLitSet *pSet) {
+  pSet->n = 1;
+  pSet->complete = true;
+  pSet->aNoCase[0] = false;
+  pSet->aLen[0] = 0;
+}
+
+/* Appends every literal of 'pRight' to every literal of 'pLeft', which must be
+** complete. If the result would be too big, 'pLeft' is left as it is, but it
+** is no longer complete. */
+static void litCross(RxLitSet *pLeft, const RxLitSet *pRight) {
+  RxLitSet out;
+  assert(pLeft->complete);
+  if (pRight->n < 0 || pLeft->n * pRight->n > RX_MAX_LITERALS) {
+    pLeft->complete = false;
+    return;
+  }
+  out.n = 0;
+  out.complete = pRight->complete;
+  for (int a = 0; a < pLeft->n; a++) {
+    for (int b = 0; b < pRight->n; b++) {
+      int len = pLeft->aLen[a];
+      memcpy(out.aChar[out.n], pLeft->aChar[a], len * sizeof(u32));
+      for (int k = 0; k < pRight->aLen[b]; k++) {
+        if (len == RX_MAX_LITLEN) {
+          out.complete = false;
+          break;
+        }
+        out.aChar[out.n][len++] = pRight->aChar[b][k];
+      }
+      out.aLen[out.n] = len;
+      out.aNoCase[out.n] = pLeft->aNoCase[a] || pRight->aNoCase[b];
+      out.n++;
+    }
+  }
+  *pLeft = out;
+}
+
+/* Adds the literals of 'pRight' to 'pLeft'; the result has no set if either
+** one doesn't, or if it would be too big. */
+static void litUnion(RxLitSet *pLeft, const RxLitSet *pRight) {
+  if (pLeft->n < 0 || pRight->n < 0 ||
+      pLeft->n + pRight->n > RX_MAX_LITERALS)
+  {
+    litNone(pLeft);
+    return;
+  }
+  for (int b = 0; b < pRight->n; b++) {
+    int a = pLeft->n++;
+    pLeft->aLen[a] = pRight->aLen[b];
+    pLeft->aNoCase[a] = pRight->aNoCase[b];
+    memcpy(pLeft->aChar[a], pRight->aChar[b], pRight->aLen[b] * sizeof(u32));
+  }
+  pLeft->complete = pLeft->complete && pRight->complete;
+}
+
+/* Rates a set as a prefilter: longer literals are better, and a smaller set
+** is better. A set with an empty literal is useless, since every position
+** has one. */
+static int litScore(const RxLitSet *pSet) {
+  int minLen = RX_MAX_LITLEN;
+  if (pSet->n <= 0) return 0;
+  for (int a = 0; a < pSet->n; a++) {
+    if (pSet->aLen[a] < minLen) minLen = pSet->aLen[a];
+  }
+  if (minLen == 0) return 0;
+  return minLen * RX_MAX_LITERALS + (RX_MAX_LITERALS - pSet->n) + 1;
+}
+
+/* Replaces the required set with 'pOther' if that is a better prefilter */
+static void litBetter(RxLitSet *pRequired, const RxLitSet *pOther) {
+  if (litScore(pOther) > litScore(pRequired)) {
+    *pRequired = *pOther;
+    pRequired->complete = false;
+  }
+}
+
+/* Returns true if a case-insensitive character can be searched for with ASCII
+** case folding; 'c' is already folded. */
+static bool litFoldOk(RxParse *p, u32 c) {
+  if (c >= 0x80) return false;
+  if (!p->foldReady) {
+    u32 from;
+    u32 to;
+    /* mark the ASCII characters that something outside ASCII folds to, like
+    ** 'k' for the KELVIN SIGN */
+    for (int i = 0; uni_foldMapping(i, p->pProg->turkic, &from, &to); i++) {
+      if (to < 0x80 && from >= 0x80) p->aFoldUnsafe[to >> 5] |= 1u << (to & 31);
+    }
+    p->foldReady = true;
+  }
+  return ((p->aFoldUnsafe[c >> 5] >> (c & 31)) & 1) == 0;
+}
+
+/* Works out the literal sets for a node: a set that every match starts with,
+** and a set that every match contains one of. */
+static void litAnalyze(RxParse *p, int iNode, int depth, RxLitSet *pPrefix,
+                       RxLitSet *pRequired)
+{
+  const RxNode *pNode = &p->aNode[iNode];
+  RxLitSet prefix;
+  RxLitSet required;
+  RxLitSet run;
+
+  litNone(pPrefix);
+  litNone(pRequired);
+  if (depth > RX_MAX_LITDEPTH) return;
+  switch (pNode->type) {
+    case RXN_CHAR:
+      /* a surrogate or U+FFFD can match text that doesn't hold its code
+      ** units, like a stray byte in UTF-8 */
+      if ((pNode->x >= 0xD800 && pNode->x <= 0xDFFF) || pNode->x == 0xFFFD) {
+        return;
+      }
+      if (pNode->fold && !litFoldOk(p, (u32)pNode->x)) return;
+      pPrefix->n = 1;
+      pPrefix->complete = true;
+      pPrefix->aNoCase[0] = pNode->fold;
+      pPrefix->aLen[0] = 1;
+      pPrefix->aChar[0][0] = (u32)pNode->x;
+      break;
+    case RXN_EMPTY:
+    case RXN_ASSERT:
+      litEmpty(pPrefix);
+      break;
+    case RXN_CAT:
+      litEmpty(pPrefix);
+      litNone(&run);
+      for (int i = pNode->iChild; i >= 0; i = p->aNode[i].iNext) {
+        litAnalyze(p, i, depth + 1, &prefix, &required);
+        litBetter(pRequired, &required);
+        if (pPrefix->complete) litCross(pPrefix, &prefix);
+        /* a run of exact literals, ending with the prefix of the next node */
+        if (run.complete) {
+          litCross(&run, &prefix);
+        }
+        else {
+          run = prefix;
+        }
+        litBetter(pRequired, &run);
+      }
+      break;
+    case RXN_ALT:
+      for (int i = pNode->iChild; i >= 0; i = p->aNode[i].iNext) {
+        litAnalyze(p, i, depth + 1, &prefix, &required);
+        litBetter(&required, &prefix);
+        if (i == pNode->iChild) {
+          *pPrefix = prefix;
+          *pRequired = required;
+        }
+        else {
+          litUnion(pPrefix, &prefix);
+          litUnion(pRequired, &required);
+        }
+      }
+      if (litScore(pRequired) == 0) litNone(pRequired);
+      break;
+    case RXN_REPEAT:
+      if (pNode->min == 0) return;
+      litAnalyze(p, pNode->iChild, depth + 1, &prefix, pRequired);
+      /* the child's literals repeated 'min' times start every match */
+      *pPrefix = prefix;
+      for (int k = 1; k < pNode->min && pPrefix->complete; k++) {
+        litCross(pPrefix, &prefix);
+      }
+      if (pNode->max != pNode->min) pPrefix->complete = false;
+      break;
+    case RXN_GROUP:
+      litAnalyze(p, pNode->iChild, depth + 1, pPrefix, pRequired);
+      break;
+  }
+  litBetter(pRequired, pPrefix);
+}
+
+/* Returns true if two sets have the same literals, in the same order */
+static bool litSame(const RxLitSet *pLeft, const RxLitSet *pRight) {
+  if (pLeft->n != pRight->n) return false;
+  for (int a = 0; a < pLeft->n; a++) {
+    if (pLeft->aLen[a] != pRight->aLen[a] ||
+        pLeft->aNoCase[a] != pRight->aNoCase[a] ||
+        memcmp(pLeft->aChar[a], pRight->aChar[a],
+               pLeft->aLen[a] * sizeof(u32)) != 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* Encodes a code point in UTF-8 or UTF-16; returns the count of bytes */
+static int litEncode(u32 c, bool isWide, u8 *z) {
+  if (isWide) {
+    u16 *w = (u16*)z;
+    if (c < 0x10000) {
+      w[0] = (u16)c;
+      return 2;
+    }
+    c -= 0x10000;
+    w[0] = (u16)(0xD800 + (c >> 10));
+    w[1] = (u16)(0xDC00 + (c & 0x3FF));
+    return 4;
+  }
+  if (c < 0x80) {
+    z[0] = (u8)c;
+    return 1;
+  }
+  if (c < 0x800) {
+    z[0] = (u8)(0xC0 | (c >> 6));
+    z[1] = (u8)(0x80 | (c & 0x3F));
+    return 2;
+  }
+  if (c < 0x10000) {
+    z[0] = (u8)(0xE0 | (c >> 12));
+    z[1] = (u8)(0x80 | ((c >> 6) & 0x3F));
+    z[2] = (u8)(0x80 | (c & 0x3F));
+    return 3;
+  }
+  z[0] = (u8)(0xF0 | (c >> 18));
+  z[1] = (u8)(0x80 | ((c >> 12) & 0x3F));
+  z[2] = (u8)(0x80 | ((c >> 6) & 0x3F));
+  z[3] = (u8)(0x80 | (c & 0x3F));
+  return 4;
+}
+
+/* Stores the prefilter literals in the program. The required set is left out
+** when it is the same as the prefix set, since finding the next prefix also
+** tells whether there is one at all. Returns false if memory runs out. */
+static bool litStore(RxParse *p, const RxLitSet *pPrefix,
+                     const RxLitSet *pRequired)
+{
+  RxProg *pProg = p->pProg;
+  const RxLitSet *aSet[2];
+  int nLit = 0;
+  int nText = 0;
+
+  aSet[0] = (litScore(pPrefix) > 0 && !pProg->anchored) ? pPrefix : nullptr;
+  aSet[1] = litScore(pRequired) > 0 ? pRequired : nullptr;
+  if (aSet[0] && aSet[1] && litSame(aSet[0], aSet[1])) aSet[1] = nullptr;
+  for (int k = 0; k < 2; k++) {
+    if (!aSet[k]) continue;
+    nLit += aSet[k]->n;
+    for (int a = 0; a < aSet[k]->n; a++) nText += aSet[k]->aLen[a] * 4;
+  }
+  if (nLit == 0) return true;
+  pProg->aLit = (RxLiteral*)sqlite3_malloc64(nLit * sizeof(RxLiteral));
+  pProg->aLitText = (u8*)sqlite3_malloc64(nText);
+  if (!pProg->aLit || !pProg->aLitText) return false;
+  nLit = nText = 0;
+  for (int k = 0; k < 2; k++) {
+    if (!aSet[k]) continue;
+    for (int a = 0; a < aSet[k]->n; a++) {
+      RxLiteral *pLit = &pProg->aLit[nLit++];
+      pLit->iText = nText;
+      pLit->noCase = aSet[k]->aNoCase[a];
+      for (int j = 0; j < aSet[k]->aLen[a]; j++) {
+        nText += litEncode(aSet[k]->aChar[a][j], p->isWide,
+                           pProg->aLitText + nText);
+      }
+      pLit->cb = nText - pLit->iText;
+    }
+    if (k == 0) {
+      pProg->nPrefix = aSet[k]->n;
+    }
+    else {
+      pProg->nRequired = aSet[k]->n;
+    }
+  }
+  return true;
+}
+
+/* Compiles a pattern for the native engine. On success, the program is
+** written to 'ppProg', and must be freed with rx_free(). If the pattern uses
+** something that the engine doesn't support, RX_UNSUPPORTED is returned, and
+** a description of it is written to 'pzReason'; RX_INVALID is returned if it
+** isn't a valid pattern at all. If 'turkic' is true, case-insensitive matches
+** use the Turkic mappings for dotted and dotless I. */
+int rx_compile(const DbStr *pPattern, bool turkic, RxProg **ppProg,
+               const char **pzReason)
+{
+  RxParse parse;
+  RxProg *pProg;
+  int iRoot;
+
+  *ppProg = nullptr;
+  *pzReason = nullptr;
+  pProg = (RxProg*)sqlite3_malloc(sizeof(RxProg));
+  if (pProg == nullptr) return ERR_NOMEM;
+  memset(pProg, 0, sizeof(*pProg));
+  pProg->turkic = turkic;
+  memset(&parse, 0, sizeof(parse));
+  parse.z = (const u8*)pPattern->pText;
+  parse.cb = pPattern->cb;
+  parse.isWide = pPattern->isWide;
+  parse.pProg = pProg;
+
+  iRoot = parseAlt(&parse, 0);
+  /* the only thing that stops the top level short is an extra ')' */
+  if (iRoot >= 0 && parse.i < parse.cb) setInvalid(&parse);
+  if (iRoot >= 0 && parse.rc == RESULT_OK) nullableLoops(&parse, iRoot, 0);
+  if (parse.rc == RESULT_OK) {
+    for (int k = 0; k < pProg->nName; k++) {
+      pProg->aName[k].iGroup = parse.nCapture + 1 + k;
+    }
+    pProg->nGroup = parse.nCapture + pProg->nName + 1;
+    pProg->nSlot = pProg->nGroup * 2;
+    pProg->anchored = isAnchored(&parse, iRoot);
+    if (emit(&parse, RX_SAVE, 0, 0) >= 0 && compileNode(&parse, iRoot) &&
+        emit(&parse, RX_SAVE, 1, 0) >= 0)
+    {
+      emit(&parse, RX_MATCH, 0, 0);
+    }
+  }
+  if (parse.rc == RESULT_OK) {
+    for (int i = 0; i < pProg->nInst; i++) {
+      if (pProg->aInst[i].op <= RX_MATCH) pProg->nThread++;
+    }
+    if ((i64)pProg->nThread * pProg->nSlot > RX_MAX_CELLS) {
+      setUnsupported(&parse, "patterns with too many groups");
+    }
+  }
+  if (parse.rc == RESULT_OK) {
+    RxLitSet prefix;
+    RxLitSet required;
+    litAnalyze(&parse, iRoot, 0, &prefix, &required);
+    if (!litStore(&parse, &prefix, &required)) parse.rc = ERR_NOMEM;
+  }
+  sqlite3_free(parse.aNode);
+  sqlite3_free(parse.aTmp);
+  if (parse.rc != RESULT_OK) {
+    rx_free(pProg);
+    *pzReason = parse.zReason;
+    return parse.rc;
+  }
+  *ppProg = pProg;
+  return RESULT_OK;
+}
+
+/* Frees a compiled program */
+void rx_free(RxProg *pProg) {
+  if (pProg) {
+    sqlite3_free(pProg->aInst);
+    sqlite3_free(pProg->aClass);
+    sqlite3_free(pProg->aRange);
+    sqlite3_free(pProg->aItem);
+    sqlite3_free(pProg->aName);
+    sqlite3_free(pProg->aNameText);
+    sqlite3_free(pProg->aLit);
+    sqlite3_free(pProg->aLitText);
+    sqlite3_free(pProg);
+  }
+}
+
+/* Gets the count of capture groups, including group 0 for the whole match */
+int rx_groupCount(const RxProg *pProg) {
+  return pProg->nGroup;
+}
+
+/*
+** Matching
+*/
+
+/* A list of VM threads, in priority order */
+struct RxThreads {
+  int n;          /* count of threads                              */
+  int *aPc;       /* the instruction that each thread waits on      */
+  int *aCap;      /* the capture slots of each thread               */
+  u32 *aMark;     /* the generation that last visited each instruction */
+  u32 gen;        /* current generation                            */
+};
+
+/* A cached DFA state */
+struct RxState {
+  int iKernel;       /* first instruction of the state in aKernel     */
+  int nKernel;       /* count of instructions                         */
+  int flags;         /* RXF_xxx flags for the previous character      */
+  int iHashNext;     /* next state in the same hash bucket            */
+  int aNext[128];    /* transitions on ASCII characters               */
+};
+
+struct RxMatcher {
+  const RxProg *pProg;
+  int nSlot;            /* capture slots, plus the RX_EMPTY slots     */
+  RxThreads aList[2];   /* VM threads at this position and the next   */
+  int *aStack;          /* explicit stack for following instructions  */
+  int *aWork;           /* capture slots of a new thread              */
+  int *aMatch;          /* capture slots for rx_replace and rx_count  */
+  int *aPc;             /* instructions collected by a DFA step       */
+  int *aKernelTmp;      /* the next DFA state's instructions          */
+  u32 *aMark;           /* visited marks for the DFA steps            */
+  u32 gen;
+  RxState *aState;      /* cached DFA states                          */
+  int nState;
+  int nStateAlloc;
+  int *aKernel;         /* instructions of the cached states          */
+  int nKernel;
+  int nKernelAlloc;
+  int aHash[RX_DFA_HASH];
+  int nReset;           /* count of times the cache has been emptied  */
+};
+
+/* Starts a new generation of visited marks */
+static u32 newGeneration(u32 *pGen, u32 *aMark, int n) {
+  if (++*pGen == 0) {
+    memset(aMark, 0, n * sizeof(u32));
+    *pGen = 1;
+  }
+  return *pGen;
+}
+
+/* Gets the RXF_xxx flags for the character before a position */
+static int flagsAfter(u32 c) {
+  return (c == '\n' ? RXF_AFTER_NL : 0) | (isWordChar(c) ? RXF_PREV_WORD : 0);
+}
+
+/* Gets the RXF_xxx flags for the character after a position */
+static int flagsBefore(u32 c, bool isLast) {
+  int flags = isWordChar(c) ? RXF_NEXT_WORD : 0;
+  if (c == '\n') flags |= isLast ? RXF_BEFORE_NL | RXF_FINAL_NL : RXF_BEFORE_NL;
+  return flags;
+}
+
+/* Gets the flags for the character before byte offset 'i' */
+static int flagsAt(const u8 *z, bool isWide, int i) {
+  u32 c;
+  int len;
+
+  if (i == 0) return RXF_START;
+  if (isWide) {
+    const u16 *w = (const u16*)z;
+    c = w[i / 2 - 1];
+    if (c >= 0xDC00 && c <= 0xDFFF && i >= 4 &&
+        w[i / 2 - 2] >= 0xD800 && w[i / 2 - 2] <= 0xDBFF)
+    {
+      c = 0x10000 + ((w[i / 2 - 2] - 0xD800) << 10) + (c - 0xDC00);
+    }
+  }
+  else {
+    int j = i - 1;
+    while (j > 0 && i - j < 4 && (z[j] & 0xC0) == 0x80) j--;
+    c = uni_decode(z + j, i - j, false, &len);
+    if (j + len != i) c = 0xFFFD; /* a stray continuation byte */
+  }
+  return flagsAfter(c);
+}
+
+static bool assertionHolds(int kind, int flags) {
+  switch (kind) {
+    case RXA_BEGIN: return (flags & RXF_START) != 0;
+    case RXA_BOL:   return (flags & (RXF_START | RXF_AFTER_NL)) != 0;
+    case RXA_EOL:   return (flags & (RXF_END | RXF_BEFORE_NL)) != 0;
+    case RXA_ENDZ:  return (flags & (RXF_END | RXF_FINAL_NL)) != 0;
+    case RXA_END:   return (flags & RXF_END) != 0;
+    case RXA_WORDB:
+      return !(flags & RXF_PREV_WORD) != !(flags & RXF_NEXT_WORD);
+    default:
+      return !(flags & RXF_PREV_WORD) == !(flags & RXF_NEXT_WORD);
+  }
+}
+
+/* Returns true if an instruction that consumes a character matches 'c' */
+static bool instMatches(const RxProg *pProg, const RxInst *pInst, u32 c) {
+  switch (pInst->op) {
+    case RX_CHAR:
+      if (pInst->fold) c = uni_foldSimple(c, pProg->turkic);
+      return c == (u32)pInst->x;
+    case RX_ANY:
+      return c != '\n';
+    case RX_ANYNL:
+      return true;
+    case RX_CLASS:
+      return classMatch(pProg, &pProg->aClass[pInst->x], c);
+  }
+  return false;
+}
+
+/* Adds a thread at instruction 'pc' to a list, following the jumps, splits,
+** saves, and assertions with an explicit stack. The stack holds pairs: an
+** instruction to visit, or the negated slot number and old value of a capture
+** slot to restore, so that 'aCap' is left as it was. */
+static void addThread(RxMatcher *pMatcher, RxThreads *pList, int pc,
+                      int *aCap, int pos, int flags)
+{
+  const RxInst *aInst = pMatcher->pProg->aInst;
+  int *aStack = pMatcher->aStack;
+  int nSlot = pMatcher->nSlot;
+  int nStack = 0;
+
+  aStack[nStack++] = pc;
+  aStack[nStack++] = 0;
+  while (nStack > 0) {
+    nStack -= 2;
+    pc = aStack[nStack];
+    if (pc < 0) {
+      aCap[-pc - 1] = aStack[nStack + 1];
+      continue;
+    }
+    while (pList->aMark[pc] != pList->gen) {
+      const RxInst *pInst = &aInst[pc];
+      pList->aMark[pc] = pList->gen;
+      if (pInst->op == RX_JMP) {
+        pc = pInst->x;
+      }
+      else if (pInst->op == RX_SPLIT) {
+        aStack[nStack++] = pInst->y;
+        aStack[nStack++] = 0;
+        pc = pInst->x;
+      }
+      else if (pInst->op == RX_SAVE) {
+        aStack[nStack++] = -pInst->x - 1;
+        aStack[nStack++] = aCap[pInst->x];
+        aCap[pInst->x] = pos;
+        pc++;
+      }
+      else if (pInst->op == RX_ASSERT) {
+        if (!assertionHolds(pInst->x, flags)) break;
+        pc++;
+      }
+      else if (pInst->op == RX_EMPTY) {
+        pc = aCap[pInst->x] == pos ? pInst->y : pc + 1;
+      }
+      else {
+        pList->aPc[pList->n] = pc;
+        memcpy(&pList->aCap[pList->n * nSlot], aCap, nSlot * sizeof(int));
+        pList->n++;
+        break;
+      }
+    }
+  }
+}
+
+/* Finds the first byte offset at or after 'iStart' where one of 'nLit'
+** literals of the program starts, or returns -1 if there is none. The next
+** occurrence of each literal is remembered in 'aNext', which the caller sets
+** to -2 before the first call, so that a scan that moves forward doesn't look
+** at the same text twice; -1 there means that the literal doesn't occur
+** again. */
+static int litFind(const RxProg *pProg, const RxLiteral *aLit, int nLit,
+                   const u8 *z, int cb, bool isWide, int iStart, int *aNext)
+{
+  const int unit = isWide ? 2 : 1;
+  DbStr in;
+  int best = -1;
+
+  in.pText = (void*)z;
+  in.cb = cb;
+  in.isWide = isWide;
+  for (int k = 0; k < nLit; k++) {
+    if (aNext[k] == -2 || (aNext[k] >= 0 && aNext[k] < iStart)) {
+      DbStr find;
+      int j;
+      find.pText = pProg->aLitText + aLit[k].iText;
+      find.cb = aLit[k].cb;
+      find.isWide = isWide;
+      j = uni_asciiFind(&in, &find, iStart / unit, aLit[k].noCase);
+      aNext[k] = j < 0 ? -1 : j * unit;
+    }
+    if (aNext[k] >= 0 && (best < 0 || aNext[k] < best)) best = aNext[k];
+  }
+  return best;
+}
+
+/* Runs the Pike VM from byte offset 'iStart' to find the leftmost match. A
+** new thread is started at each position until there is a match; after that,
+** the threads with a lower priority than the match are dropped, and the rest
+** run until they either match or die out. While there are no threads, the
+** scan skips ahead to the next place where a prefix literal starts. */
+template<bool isWide>
+static bool pikeFind(RxMatcher *pMatcher, const u8 *z, int cb, int iStart,
+                     int *aCap)
+{
+  const RxProg *pProg = pMatcher->pProg;
+  const RxInst *aInst = pProg->aInst;
+  RxThreads *pCur = &pMatcher->aList[0];
+  RxThreads *pNext = &pMatcher->aList[1];
+  int nSlot = pMatcher->nSlot;
+  bool found = false;
+  int i = iStart;
+  int len = 0;
+  u32 c = 0;
+  int flags = flagsAt(z, isWide, i);
+  int aNext[RX_MAX_LITERALS];
+
+  if (i < cb) {
+    c = uni_decode(z + i, cb - i, isWide, &len);
+    flags |= flagsBefore(c, i + len == cb);
+  }
+  else {
+    flags |= RXF_END;
+  }
+  for (int k = 0; k < pProg->nPrefix; k++) aNext[k] = -2;
+  pCur->n = 0;
+  newGeneration(&pCur->gen, pCur->aMark, pProg->nInst);
+  for (;;) {
+    int iNext;
+    int lenNext = 0;
+    u32 cNext = 0;
+    int flagsNext = 0;
+    RxThreads *pSwap;
+
+    if (!found && pCur->n == 0 && pProg->nPrefix > 0) {
+      int j = litFind(pProg, pProg->aLit, pProg->nPrefix, z, cb, isWide, i,
+                      aNext);
+      if (j < 0) break;
+      if (j > i) {
+        i = j;
+        c = uni_decode(z + i, cb - i, isWide, &len);
+        flags = flagsAt(z, isWide, i) | flagsBefore(c, i + len == cb);
+      }
+    }
+    iNext = i + len;
+    if (!found && (!pProg->anchored || i == 0)) {
+      for (int k = 0; k < nSlot; k++) pMatcher->aWork[k] = -1;
+      addThread(pMatcher, pCur, 0, pMatcher->aWork, i, flags);
+    }
+    if (pCur->n == 0 && (found || pProg->anchored)) break;
+    if (i < cb) {
+      flagsNext = flagsAfter(c);
+      if (iNext < cb) {
+        cNext = uni_decode(z + iNext, cb - iNext, isWide, &lenNext);
+        flagsNext |= flagsBefore(cNext, iNext + lenNext == cb);
+      }
+      else {
+        flagsNext |= RXF_END;
+      }
+    }
+    pNext->n = 0;
+    newGeneration(&pNext->gen, pNext->aMark, pProg->nInst);
+    for (int t = 0; t < pCur->n; t++) {
+      const RxInst *pInst = &aInst[pCur->aPc[t]];
+      int *aThreadCap = &pCur->aCap[t * nSlot];
+      if (pInst->op == RX_MATCH) {
+        found = true;
+        memcpy(aCap, aThreadCap, pProg->nGroup * 2 * sizeof(int));
+        break;
+      }
+      if (i < cb && instMatches(pProg, pInst, c)) {
+        addThread(pMatcher, pNext, pCur->aPc[t] + 1, aThreadCap, iNext,
+                  flagsNext);
+      }
+    }
+    if (i >= cb) break;
+    pSwap = pCur;
+    pCur = pNext;
+    pNext = pSwap;
+    i = iNext;
+    c = cNext;
+    len = lenNext;
+    flags = flagsNext;
+  }
+  return found;
+}
+
+/* Empties the DFA state cache */
+static void dfaReset(RxMatcher *pMatcher) {
+  pMatcher->nState = 0;
+  pMatcher->nKernel = 0;
+  memset(pMatcher->aHash, 0xFF, sizeof(pMatcher->aHash));
+  pMatcher->nReset++;
+}
+
+/* Finds or adds the DFA state for a sorted set of instructions and the flags
+** for the previous character. Returns the state index or RX_DFA_NOMEM. */
+static int dfaState(RxMatcher *pMatcher, const int *aPc, int n, int flags) {
+  u32 h = (u32)flags;
+  RxState *pState;
+  int s;
+
+  for (int k = 0; k < n; k++) h = h * 31 + (u32)aPc[k];
+  h %= RX_DFA_HASH;
+  for (s = pMatcher->aHash[h]; s >= 0; s = pMatcher->aState[s].iHashNext) {
+    pState = &pMatcher->aState[s];
+    if (pState->flags == flags && pState->nKernel == n &&
+        memcmp(pMatcher->aKernel + pState->iKernel, aPc, n * sizeof(int)) == 0)
+    {
+      return s;
+    }
+  }
+  if (pMatcher->nState >= RX_DFA_STATES) dfaReset(pMatcher);
+  if (!grow(&pMatcher->aState, &pMatcher->nStateAlloc, pMatcher->nState)) {
+    return RX_DFA_NOMEM;
+  }
+  while (pMatcher->nKernel + n > pMatcher->nKernelAlloc) {
+    if (!grow(&pMatcher->aKernel, &pMatcher->nKernelAlloc,
+              pMatcher->nKernelAlloc))
+    {
+      return RX_DFA_NOMEM;
+    }
+  }
+  s = pMatcher->nState++;
+  pState = &pMatcher->aState[s];
+  pState->iKernel = pMatcher->nKernel;
+  pState->nKernel = n;
+  pState->flags = flags;
+  pState->iHashNext = pMatcher->aHash[h];
+  memset(pState->aNext, 0xFF, sizeof(pState->aNext)); /* RX_DFA_UNKNOWN */
+  memcpy(pMatcher->aKernel + pMatcher->nKernel, aPc, n * sizeof(int));
+  pMatcher->nKernel += n;
+  pMatcher->aHash[h] = s;
+  return s;
+}
+
+/* Computes the DFA transition from state 's' on the code point 'c', whose
+** RXF_xxx flags are 'flagsNext'; at the end of the text, 'flagsNext' is
+** RXF_END. Returns the next state, RX_DFA_MATCH if the pattern matches before
+** 'c', RX_DFA_DEAD if it can't match any more, or RX_DFA_NOMEM. */
+static int dfaStep(RxMatcher *pMatcher, int s, u32 c, int flagsNext) {
+  const RxProg *pProg = pMatcher->pProg;
+  const RxInst *aInst = pProg->aInst;
+  const RxState *pState = &pMatcher->aState[s];
+  int flags = pState->flags | flagsNext;
+  int *aStack = pMatcher->aStack;
+  int *aPc = pMatcher->aPc;
+  int *aNew = pMatcher->aKernelTmp;
+  int nPc = 0;
+  int nNew = 0;
+  u32 gen = newGeneration(&pMatcher->gen, pMatcher->aMark, pProg->nInst);
+
+  /* follow the kernel instructions to the ones that consume a character */
+  for (int k = 0; k < pState->nKernel; k++) {
+    int nStack = 0;
+    aStack[nStack++] = pMatcher->aKernel[pState->iKernel + k];
+    while (nStack > 0) {
+      int pc = aStack[--nStack];
+      while (pMatcher->aMark[pc] != gen) {
+        const RxInst *pInst = &aInst[pc];
+        pMatcher->aMark[pc] = gen;
+        if (pInst->op == RX_JMP) {
+          pc = pInst->x;
+        }
+        else if (pInst->op == RX_SPLIT || pInst->op == RX_EMPTY) {
+          /* without the positions, RX_EMPTY could go either way; taking both
+          ** branches doesn't change whether there is a match */
+          aStack[nStack++] = pInst->y;
+          pc = pInst->op == RX_SPLIT ? pInst->x : pc + 1;
+        }
+        else if (pInst->op == RX_SAVE) {
+          pc++;
+        }
+        else if (pInst->op == RX_ASSERT) {
+          if (!assertionHolds(pInst->x, flags)) break;
+          pc++;
+        }
+        else if (pInst->op == RX_MATCH) {
+          return RX_DFA_MATCH;
+        }
+        else {
+          aPc[nPc++] = pc;
+          break;
+        }
+      }
+    }
+  }
+  if (flagsNext & RXF_END) return RX_DFA_DEAD;
+
+  /* step over 'c'; unless the pattern is anchored, a new thread starts at
+  ** every position */
+  if (!pProg->anchored) aNew[nNew++] = 0;
+  for (int k = 0; k < nPc; k++) {
+    if (instMatches(pProg, &aInst[aPc[k]], c)) {
+      /* insertion sort, since the sets are usually small */
+      int pc = aPc[k] + 1;
+      int j = nNew++;
+      for (; j > 0 && aNew[j - 1] > pc; j--) aNew[j] = aNew[j - 1];
+      aNew[j] = pc;
+    }
+  }
+  if (nNew == 0) return RX_DFA_DEAD;
+  return dfaState(pMatcher, aNew, nNew, flagsAfter(c));
+}
+
+/* Scans the text from byte offset 'iStart' with the DFA to find out whether
+** the pattern matches */
+template<bool isWide>
+static int dfaIsMatch(RxMatcher *pMatcher, const u8 *z, int cb, int iStart,
+                      bool *pResult)
+{
+  const int unit = isWide ? 2 : 1;
+  int aStart[1] = { 0 };
+  int s = dfaState(pMatcher, aStart, 1, flagsAt(z, isWide, iStart));
+  int i = iStart;
+  int t;
+
+  if (s < 0) return ERR_NOMEM;
+  while (i < cb) {
+    u32 c = isWide ? ((const u16*)z)[i / 2] : z[i];
+    int len = unit;
+    if (c < 0x80 && (c != '\n' || i + unit < cb)) {
+      t = pMatcher->aState[s].aNext[c];
+      if (t == RX_DFA_UNKNOWN) {
+        int nReset = pMatcher->nReset;
+        t = dfaStep(pMatcher, s, c, flagsBefore(c, false));
+        /* the transition can't be cached if the cache was emptied */
+        if (t != RX_DFA_NOMEM && pMatcher->nReset == nReset) {
+          pMatcher->aState[s].aNext[c] = t;
+        }
+      }
+    }
+    else {
+      c = uni_decode(z + i, cb - i, isWide, &len);
+      t = dfaStep(pMatcher, s, c, flagsBefore(c, i + len == cb));
+    }
+    if (t < 0) {
+      if (t == RX_DFA_NOMEM) return ERR_NOMEM;
+      *pResult = (t == RX_DFA_MATCH);
+      return RESULT_OK;
+    }
+    s = t;
+    i += len;
+  }
+  t = dfaStep(pMatcher, s, 0, RXF_END);
+  if (t == RX_DFA_NOMEM) return ERR_NOMEM;
+  *pResult = (t == RX_DFA_MATCH);
+  return RESULT_OK;
+}
+
+/* Allocates a matcher for a compiled program; returns NULL if memory
+** allocation fails. */
+RxMatcher *rx_matcherNew(const RxProg *pProg) {
+  RxMatcher *pMatcher = (RxMatcher*)sqlite3_malloc(sizeof(RxMatcher));
+  int nInst = pProg->nInst;
+  int nSlot = pProg->nSlot;
+  bool ok;
+
+  if (pMatcher == nullptr) return nullptr;
+  memset(pMatcher, 0, sizeof(*pMatcher));
+  pMatcher->pProg = pProg;
+  pMatcher->nSlot = nSlot;
+  for (int k = 0; k < 2; k++) {
+    RxThreads *pList = &pMatcher->aList[k];
+    pList->aPc = (int*)sqlite3_malloc64(pProg->nThread * sizeof(int));
+    pList->aCap = (int*)sqlite3_malloc64(
+      (sqlite3_uint64)pProg->nThread * nSlot * sizeof(int));
+    pList->aMark = (u32*)sqlite3_malloc64(nInst * sizeof(u32));
+    if (pList->aMark) memset(pList->aMark, 0, nInst * sizeof(u32));
+  }
+  /* every instruction is pushed at most once, along with a restore */
+  pMatcher->aStack = (int*)sqlite3_malloc64((nInst + 1) * 4 * sizeof(int));
+  pMatcher->aWork = (int*)sqlite3_malloc64(nSlot * sizeof(int));
+  pMatcher->aMatch = (int*)sqlite3_malloc64(nSlot * sizeof(int));
+  pMatcher->aPc = (int*)sqlite3_malloc64(nInst * sizeof(int));
+  pMatcher->aKernelTmp = (int*)sqlite3_malloc64((nInst + 1) * sizeof(int));
+  pMatcher->aMark = (u32*)sqlite3_malloc64(nInst * sizeof(u32));
+  ok = pMatcher->aList[0].aPc && pMatcher->aList[0].aCap &&
+       pMatcher->aList[0].aMark && pMatcher->aList[1].aPc &&
+       pMatcher->aList[1].aCap && pMatcher->aList[1].aMark &&
+       pMatcher->aStack && pMatcher->aWork && pMatcher->aMatch &&
+       pMatcher->aPc && pMatcher->aKernelTmp && pMatcher->aMark;
+  if (!ok) {
+    rx_matcherFree(pMatcher);
+    return nullptr;
+  }
+  memset(pMatcher->aMark, 0, nInst * sizeof(u32));
+  dfaReset(pMatcher);
+  pMatcher->nReset = 0;
+  return pMatcher;
+}
+
+/* Frees a matcher */
+void rx_matcherFree(RxMatcher *pMatcher) {
+  if (pMatcher) {
+    for (int k = 0; k < 2; k++) {
+      sqlite3_free(pMatcher->aList[k].aPc);
+      sqlite3_free(pMatcher->aList[k].aCap);
+      sqlite3_free(pMatcher->aList[k].aMark);
+    }
+    sqlite3_free(pMatcher->aStack);
+    sqlite3_free(pMatcher->aWork);
+    sqlite3_free(pMatcher->aMatch);
+    sqlite3_free(pMatcher->aPc);
+    sqlite3_free(pMatcher->aKernelTmp);
+    sqlite3_free(pMatcher->aMark);
+    sqlite3_free(pMatcher->aState);
+    sqlite3_free(pMatcher->aKernel);
+    sqlite3_free(pMatcher);
+  }
+}
+
+/* Returns false if the text can't have a match because it is missing the
+** literals that every match contains */
+static bool hasRequired(const RxProg *pProg, const DbStr *pIn, int iStart) {
+  int aNext[RX_MAX_LITERALS];
+  if (pProg->nRequired == 0) return true;
+  for (int k = 0; k < pProg->nRequired; k++) aNext[k] = -2;
+  return litFind(pProg, pProg->aLit + pProg->nPrefix, pProg->nRequired,
+                 (const u8*)pIn->pText, pIn->cb, pIn->isWide, iStart,
+                 aNext) >= 0;
+}
+
+/* Finds out whether the pattern matches anywhere in the text, using the
+** DFA. The text is checked for the literals first, and the DFA starts where
+** the first prefix literal does. Returns RESULT_OK or ERR_NOMEM. */
+int rx_isMatch(RxMatcher *pMatcher, const DbStr *pIn, bool *pResult) {
+  const RxProg *pProg = pMatcher->pProg;
+  const u8 *z = (const u8*)pIn->pText;
+  int iStart = 0;
+
+  if (!hasRequired(pProg, pIn, 0)) {
+    *pResult = false;
+    return RESULT_OK;
+  }
+  if (pProg->nPrefix > 0) {
+    int aNext[RX_MAX_LITERALS];
+    for (int k = 0; k < pProg->nPrefix; k++) aNext[k] = -2;
+    iStart = litFind(pProg, pProg->aLit, pProg->nPrefix, z, pIn->cb,
+                     pIn->isWide, 0, aNext);
+    if (iStart < 0) {
+      *pResult = false;
+      return RESULT_OK;
+    }
+  }
+  if (pIn->isWide) {
+    return dfaIsMatch<true>(pMatcher, z, pIn->cb, iStart, pResult);
+  }
+  return dfaIsMatch<false>(pMatcher, z, pIn->cb, iStart, pResult);
+}
+
+/* Finds the leftmost match that starts at or after byte offset 'iStart',
+** using the VM. If there is one, the byte offsets of the start and end of each
+** group are written to 'aCap', which must have room for two slots for each
+** group; the slots for a group that didn't take part in the match are -1. */
+bool rx_find(RxMatcher *pMatcher, const DbStr *pIn, int iStart, int *aCap) {
+  const u8 *z = (const u8*)pIn->pText;
+  assert(iStart >= 0 && iStart <= pIn->cb);
+  if (!hasRequired(pMatcher->pProg, pIn, iStart)) return false;
+  if (pIn->isWide) return pikeFind<true>(pMatcher, z, pIn->cb, iStart, aCap);
+  return pikeFind<false>(pMatcher, z, pIn->cb, iStart, aCap);
+}
+
+/* Gets where the search for the next match starts, the way Regex.Matches()
+** steps from one match to the next: at the end of the last match, or one
+** character after it if the match was empty. An empty match at the end of
+** the text leaves nowhere to start, so the result is past the end. */
+static int nextStart(const DbStr *pIn, const int *aCap) {
+  int len;
+  if (aCap[0] != aCap[1]) return aCap[1];
+  if (aCap[1] == pIn->cb) return pIn->cb + 1;
+  uni_decode((const u8*)pIn->pText + aCap[1], pIn->cb - aCap[1], pIn->isWide,
+             &len);
+  return aCap[1] + len;
+}
+
+/* Counts the matches in the text, as Regex.Matches() finds them. Returns
+** RESULT_OK or ERR_NOMEM. */
+int rx_count(RxMatcher *pMatcher, const DbStr *pIn, int *pnMatch) {
+  int *aCap = pMatcher->aMatch;
+  int iStart = 0;
+  bool found;
+  int rc;
+
+  *pnMatch = 0;
+  /* the DFA is much faster at ruling out the text that doesn't match */
+  rc = rx_isMatch(pMatcher, pIn, &found);
+  if (rc != RESULT_OK || !found) return rc;
+  while (iStart <= pIn->cb && rx_find(pMatcher, pIn, iStart, aCap)) {
+    ++*pnMatch;
+    iStart = nextStart(pIn, aCap);
+  }
+  return RESULT_OK;
+}
+
+/* Finds match number 'n' in the text, counting from 1, as Regex.Matches()
+** finds them. If there is one, '*paCap' points to the byte offsets of its
+** groups, which are good until the matcher is used again; if there are fewer
+** matches, it is NULL. Returns RESULT_OK or ERR_NOMEM. */
+int rx_findNth(RxMatcher *pMatcher, const DbStr *pIn, int n,
+               const int **paCap)
+{
+  int *aCap = pMatcher->aMatch;
+  int iStart = 0;
+  bool found;
+  int rc;
+
+  assert(n > 0);
+  *paCap = nullptr;
+  rc = rx_isMatch(pMatcher, pIn, &found);
+  if (rc != RESULT_OK || !found) return rc;
+  while (iStart <= pIn->cb && rx_find(pMatcher, pIn, iStart, aCap)) {
+    if (--n == 0) {
+      *paCap = aCap;
+      break;
+    }
+    iStart = nextStart(pIn, aCap);
+  }
+  return RESULT_OK;
+}
+
+/*
+** Substitution
+*/
+
+/* Replacement pattern items */
+#define RXS_TEXT   0  /* literal text: x is the offset, y the length  */
+#define RXS_GROUP  1  /* x is the group number                        */
+#define RXS_LEFT   2  /* the input before the match                   */
+#define RXS_RIGHT  3  /* the input after the match                    */
+#define RXS_INPUT  4  /* the whole input                              */
+
+struct RxSubItem {
+  int type;     /* RXS_xxx item type */
+  int x;
+  int y;
+};
+
+struct RxSub {
+  RxSubItem *aItem;   /* the items, in order                     */
+  int nItem;
+  u8 *aText;          /* the literal text of the RXS_TEXT items  */
+  int nText;
+};
+
+/* Looks up a group name, given as the code points in the replacement pattern
+** from byte offset 'i' to 'iEnd'; returns the group number, or -1 */
+static int findGroupName(const RxProg *pProg, const DbStr *pSub, int i,
+                         int iEnd)
+{
+  const u8 *z = (const u8*)pSub->pText;
+  for (int k = 0; k < pProg->nName; k++) {
+    const RxName *pName = &pProg->aName[k];
+    const u32 *aText = pProg->aNameText + pName->iText;
+    int j = i;
+    int n = 0;
+    while (j < iEnd && n < pName->nText) {
+      int len;
+      if (uni_decode(z + j, iEnd - j, pSub->isWide, &len) != aText[n]) break;
+      j += len;
+      n++;
+    }
+    if (j == iEnd && n == pName->nText) return pName->iGroup;
+  }
+  return -1;
+}
+
+/* Appends an item to a replacement pattern; literal text runs are merged */
+static void addSubItem(RxSub *pSub, int type, int x, int y) {
+  if (type == RXS_TEXT && pSub->nItem > 0) {
+    RxSubItem *pLast = &pSub->aItem[pSub->nItem - 1];
+    if (pLast->type == RXS_TEXT && pLast->x + pLast->y == x) {
+      pLast->y += y;
+      return;
+    }
+  }
+  pSub->aItem[pSub->nItem].type = type;
+  pSub->aItem[pSub->nItem].x = x;
+  pSub->aItem[pSub->nItem].y = y;
+  pSub->nItem++;
+}
+
+/* Scans the substitution that follows a '$' at byte offset '*pi'. If there is
+** one, the item is filled in, '*pi' is moved past it, and the return is 1;
+** otherwise the '$' is literal, and the return is 0. Returns RX_UNSUPPORTED
+** for a group number too big for .NET to parse. */
+static int scanDollar(const RxProg *pProg, const DbStr *pSub, int *pi,
+                      RxSubItem *pItem)
+{
+  const u8 *z = (const u8*)pSub->pText;
+  int cb = pSub->cb;
+  int i = *pi;
+  bool angled = false;
+  int len;
+  u32 c;
+
+  pItem->type = RXS_GROUP;
+  pItem->x = -1;
+  pItem->y = 0;
+  c = uni_decode(z + i, cb - i, pSub->isWide, &len);
+  if (c == '{' && i + len < cb) {
+    angled = true;
+    i += len;
+    c = uni_decode(z + i, cb - i, pSub->isWide, &len);
+  }
+  if (c >= '0' && c <= '9') {
+    i64 n = 0;
+    while (i < cb) {
+      c = uni_decode(z + i, cb - i, pSub->isWide, &len);
+      if (c < '0' || c > '9') break;
+      n = n * 10 + (c - '0');
+      if (n > INT_MAX) return RX_UNSUPPORTED;
+      i += len;
+    }
+    if (angled) {
+      if (i == cb || c != '}') return 0;
+      i += len;
+    }
+    if (n < pProg->nGroup) pItem->x = (int)n;
+  }
+  else if (angled && isWordChar(c)) {
+    int iName = i;
+    while (i < cb) {
+      c = uni_decode(z + i, cb - i, pSub->isWide, &len);
+      if (!isWordChar(c)) break;
+      i += len;
+    }
+    if (i == cb || c != '}') return 0;
+    pItem->x = findGroupName(pProg, pSub, iName, i);
+    i += len;
+  }
+  else if (!angled) {
+    i += len;
+    switch (c) {
+      case '$':  pItem->type = RXS_TEXT; break;
+      case '&':  pItem->x = 0; break;
+      case '`':  pItem->type = RXS_LEFT; break;
+      case '\'': pItem->type = RXS_RIGHT; break;
+      case '+':  pItem->x = pProg->nGroup - 1; break;
+      case '_':  pItem->type = RXS_INPUT; break;
+      default:   return 0;
+    }
+  }
+  if (pItem->type == RXS_GROUP && pItem->x < 0) return 0;
+  *pi = i;
+  return 1;
+}
+
+/* Compiles a replacement pattern for a program, following the .NET rules for
+** substitutions: $n, ${n}, and ${name} for a group that exists in the pattern,
+** $$, $&, $`, $', $+, and $_; a '$' that doesn't start any of those is taken
+** literally. Returns RESULT_OK, ERR_NOMEM, or RX_UNSUPPORTED for a group
+** number too big for .NET to parse, so that the managed Regex class can raise
+** the error. */
+int rx_subCompile(const RxProg *pProg, const DbStr *pSub, RxSub **ppSub) {
+  const u8 *z = (const u8*)pSub->pText;
+  const int unit = pSub->isWide ? 2 : 1;
+  int cb = pSub->cb;
+  int iText = 0;
+  int i = 0;
+  RxSub *p;
+
+  *ppSub = nullptr;
+  p = (RxSub*)sqlite3_malloc(sizeof(RxSub));
+  if (p == nullptr) return ERR_NOMEM;
+  memset(p, 0, sizeof(*p));
+  /* no pattern has more items than code units, and the literal text is never
+  ** longer than the pattern */
+  p->aItem = (RxSubItem*)sqlite3_malloc64(
+    ((sqlite3_uint64)cb / unit + 1) * sizeof(RxSubItem));
+  p->aText = (u8*)sqlite3_malloc64((sqlite3_uint64)cb + 1);
+  if (p->aItem == nullptr || p->aText == nullptr) {
+    rx_subFree(p);
+    return ERR_NOMEM;
+  }
+  while (i < cb) {
+    int iChar = i;
+    int len;
+    u32 c = uni_decode(z + i, cb - i, pSub->isWide, &len);
+
+    i += len;
+    if (c == '$' && i < cb) {
+      RxSubItem item;
+      int rc = scanDollar(pProg, pSub, &i, &item);
+      if (rc == RX_UNSUPPORTED) {
+        rx_subFree(p);
+        return rc;
+      }
+      if (rc && item.type != RXS_TEXT) {
+        addSubItem(p, item.type, item.x, item.y);
+        continue;
+      }
+      /* "$$" is copied as a single '$' */
+    }
+    memcpy(p->aText + iText, z + iChar, len);
+    addSubItem(p, RXS_TEXT, iText, len);
+    iText += len;
+  }
+  p->nText = iText;
+  *ppSub = p;
+  return RESULT_OK;
+}
+
+/* Frees a compiled replacement pattern */
+void rx_subFree(RxSub *pSub) {
+  if (pSub) {
+    sqlite3_free(pSub->aItem);
+    sqlite3_free(pSub->aText);
+    sqlite3_free(pSub);
+  }
+}
+
+/* Output buffer for rx_replace() */
+struct RxBuffer {
+  u8 *z;
+  i64 n;
+  i64 nAlloc;
+  int rc;
+};
+
+static void appendText(RxBuffer *pBuf, const u8 *z, i64 n) {
+  if (pBuf->rc != RESULT_OK || n <= 0) return;
+  if (pBuf->n + n > RX_MAX_RESULT) {
+    pBuf->rc = SQLITE_TOOBIG;
+    return;
+  }
+  if (pBuf->n + n > pBuf->nAlloc) {
+    i64 nNew = pBuf->nAlloc * 2 + n;
+    u8 *zNew;
+    if (nNew > RX_MAX_RESULT) nNew = RX_MAX_RESULT;
+    zNew = (u8*)sqlite3_realloc64(pBuf->z, nNew);
+    if (zNew == nullptr) {
+      pBuf->rc = ERR_NOMEM;
+      return;
+    }
+    pBuf->z = zNew;
+    pBuf->nAlloc = nNew;
+  }
+  memcpy(pBuf->z + pBuf->n, z, n);
+  pBuf->n += n;
+}
+
+/* Replaces every match in the text with the replacement pattern. If there is
+** no match, the pText member of the result is set to NULL; otherwise it is
+** a buffer from sqlite3_malloc() that the caller must free. Returns RESULT_OK,
+** ERR_NOMEM, or SQLITE_TOOBIG. */
+int rx_replace(RxMatcher *pMatcher, const DbStr *pIn, const RxSub *pSub,
+               DbStr *pResult)
+{
+  const u8 *z = (const u8*)pIn->pText;
+  int *aCap = pMatcher->aMatch;
+  RxBuffer buf = { nullptr, 0, 0, RESULT_OK };
+  int iCopied = 0;
+  int iStart = 0;
+  bool found;
+  int rc;
+
+  pResult->pText = nullptr;
+  pResult->cb = 0;
+  pResult->isWide = pIn->isWide;
+  /* the DFA is much faster at ruling out the text that doesn't match */
+  rc = rx_isMatch(pMatcher, pIn, &found);
+  if (rc != RESULT_OK || !found) return rc;
+  buf.nAlloc = (i64)pIn->cb + 16;
+  buf.z = (u8*)sqlite3_malloc64(buf.nAlloc);
+  if (buf.z == nullptr) return ERR_NOMEM;
+  while (iStart <= pIn->cb && rx_find(pMatcher, pIn, iStart, aCap)) {
+    appendText(&buf, z + iCopied, aCap[0] - iCopied);
+    for (int k = 0; k < pSub->nItem; k++) {
+      const RxSubItem *pItem = &pSub->aItem[k];
+      switch (pItem->type) {
+        case RXS_TEXT:
+          appendText(&buf, pSub->aText + pItem->x, pItem->y);
+          break;
+        case RXS_GROUP:
+          if (aCap[pItem->x * 2] >= 0) {
+            appendText(&buf, z + aCap[pItem->x * 2],
+                       aCap[pItem->x * 2 + 1] - aCap[pItem->x * 2]);
+          }
+          break;
+        case RXS_LEFT:
+          appendText(&buf, z, aCap[0]);
+          break;
+        case RXS_RIGHT:
+          appendText(&buf, z + aCap[1], pIn->cb - aCap[1]);
+          break;
+        default:
+          appendText(&buf, z, pIn->cb);
+          break;
+      }
+    }
+    iCopied = aCap[1];
+    iStart = nextStart(pIn, aCap);
+    if (buf.rc != RESULT_OK) break;
+  }
+  appendText(&buf, z + iCopied, pIn->cb - iCopied);
+  if (buf.rc != RESULT_OK) {
+    sqlite3_free(buf.z);
+    return buf.rc;
+  }
+  pResult->pText = buf.z;
+  pResult->cb = (int)buf.n;
+  return RESULT_OK;
+}
+
+
+/*
+** Program cache
+**
+** Compiled programs are shared by every connection in the process through a
+** bounded cache, keyed by the pattern bytes, the text encoding, and whether
+** the Turkic case folding applies. A statement holds on to the program it gets
+** for as long as it runs (see "regex.c"), so the cache is only consulted when
+** a statement first sees a pattern, never per row. It is split into shards by
+** the hash of the pattern, each with its own mutex that is only held for a
+** hash lookup and a few pointer updates, and the pattern is compiled outside
+** the mutex; threads looking up different patterns rarely wait on each other,
+** and a thread never waits on another thread's compile.
+**
+** Each shard keeps its entries in least-recently-used order, and evicts from
+** the tail when the programs it holds take up more than its share of the
+** memory limit. A program is reference counted, so one that is evicted while
+** statements still use it is freed when the last of them lets go of it.
+*/
+#ifndef UTILEXT_REGEX_CACHE_SIZE
+#define UTILEXT_REGEX_CACHE_SIZE (4 * 1024 * 1024)  /* bytes, all shards */
+#endif
+#define RX_CACHE_SHARDS   8    /* must be a power of two                 */
+#define RX_CACHE_BUCKETS  64   /* hash buckets per shard; a power of two */
+#define RX_SHARD_LIMIT    ((i64)UTILEXT_REGEX_CACHE_SIZE / RX_CACHE_SHARDS)
+
+/* A cached program; the pattern bytes follow the struct */
+struct RxCacheEntry {
+  RxProg *pProg;             /* the compiled program                  */
+  u32 hash;                  /* hash of the pattern bytes             */
+  int cb;                    /* count of bytes in the pattern         */
+  bool isWide;               /* true if the pattern is UTF-16         */
+  bool turkic;               /* compiled with the Turkic case folding */
+  bool inCache;              /* false once the entry has been evicted */
+  int nRef;                  /* references held by rx_cacheGet() callers */
+  i64 nByte;                 /* memory charged against the shard      */
+  RxCacheEntry *pHashNext;   /* next entry in the same hash bucket    */
+  RxCacheEntry *pPrev;       /* next more recently used entry         */
+  RxCacheEntry *pNext;       /* next less recently used entry         */
+};
+
+struct RxCacheShard {
+  sqlite3_mutex *mutex;      /* guards the rest of the shard, or NULL */
+  RxCacheEntry *aBucket[RX_CACHE_BUCKETS];
+  RxCacheEntry *pHead;       /* most recently used entry              */
+  RxCacheEntry *pTail;       /* least recently used entry             */
+  i64 nByte;                 /* memory held by the cached programs    */
+  int nEntry;                /* count of cached programs              */
+  i64 nHit;                  /* lookups that found a program          */
+  i64 nMiss;                 /* lookups that had to compile           */
+  i64 nEvict;                /* programs evicted to stay in the limit */
+};
+
+static RxCacheShard aShard[RX_CACHE_SHARDS];
+static bool cacheReady = false;
+
+#define RX_ENTRY_TEXT(E) ((const u8*)&(E)[1])
+#define RX_SHARD(H) (&aShard[((H) >> 24) & (RX_CACHE_SHARDS - 1)])
+#define RX_BUCKET(S,H) (&(S)->aBucket[(H) & (RX_CACHE_BUCKETS - 1)])
+
+/* Sets up the shard mutexes, the first time that any connection registers
+** the regex functions. Returns RESULT_OK or ERR_NOMEM. */
+int rx_cacheInit(void) {
+  sqlite3_mutex *mutex = sqlite3_mutex_alloc(SQLITE_MUTEX_STATIC_APP1);
+  int rc = RESULT_OK;
+
+  sqlite3_mutex_enter(mutex);
+  if (!cacheReady) {
+    for (int i = 0; i < RX_CACHE_SHARDS && sqlite3_threadsafe(); i++) {
+      aShard[i].mutex = sqlite3_mutex_alloc(SQLITE_MUTEX_FAST);
+      if (!aShard[i].mutex) {
+        while (i-- > 0) {
+          sqlite3_mutex_free(aShard[i].mutex);
+          aShard[i].mutex = nullptr;
+        }
+        rc = ERR_NOMEM;
+        break;
+      }
+    }
+    cacheReady = (rc == RESULT_OK);
+  }
+  sqlite3_mutex_leave(mutex);
+  return rc;
+}
+
+/* Gets the memory used by a compiled program */
+static i64 progSize(const RxProg *p) {
+  return (i64)(sqlite3_msize((void*)p) + sqlite3_msize(p->aInst) +
+               sqlite3_msize(p->aClass) + sqlite3_msize(p->aRange) +
+               sqlite3_msize(p->aItem) + sqlite3_msize(p->aName) +
+               sqlite3_msize(p->aNameText) + sqlite3_msize(p->aLit) +
+               sqlite3_msize(p->aLitText));
+}
+
+/* Finds the entry for a pattern. The shard mutex must be held. */
+static RxCacheEntry *cacheFind(RxCacheShard *pShard, const DbStr *pPattern,
+                               bool turkic, u32 h)
+{
+  RxCacheEntry *p = *RX_BUCKET(pShard, h);
+  for (; p; p = p->pHashNext) {
+    if (p->hash == h && p->cb == pPattern->cb &&
+        p->isWide == pPattern->isWide && p->turkic == turkic &&
+        memcmp(RX_ENTRY_TEXT(p), pPattern->pText, (size_t)p->cb) == 0)
+    {
+      return p;
+    }
+  }
+  return nullptr;
+}
+
+/* Takes an entry out of the LRU list. The shard mutex must be held. */
+static void lruUnlink(RxCacheShard *pShard, RxCacheEntry *p) {
+  if (p->pPrev) p->pPrev->pNext = p->pNext; else pShard->pHead = p->pNext;
+  if (p->pNext) p->pNext->pPrev = p->pPrev; else pShard->pTail = p->pPrev;
+  p->pPrev = p->pNext = nullptr;
+}
+
+/* Puts an entry at the head of the LRU list. The shard mutex must be held. */
+static void lruPush(RxCacheShard *pShard, RxCacheEntry *p) {
+  p->pPrev = nullptr;
+  p->pNext = pShard->pHead;
+  if (pShard->pHead) pShard->pHead->pPrev = p; else pShard->pTail = p;
+  pShard->pHead = p;
+}
+
+/* Takes an entry out of the cache. If nothing holds it, it is put on the list
+** at 'ppFree' (linked through pHashNext), to be freed once the shard mutex has
+** been released. The shard mutex must be held. */
+static void cacheEvict(RxCacheShard *pShard, RxCacheEntry *p,
+                       RxCacheEntry **ppFree)
+{
+  RxCacheEntry **pp = RX_BUCKET(pShard, p->hash);
+  while (*pp != p) pp = &(*pp)->pHashNext;
+  *pp = p->pHashNext;
+  lruUnlink(pShard, p);
+  p->inCache = false;
+  pShard->nByte -= p->nByte;
+  pShard->nEntry--;
+  pShard->nEvict++;
+  if (p->nRef == 0) {
+    p->pHashNext = *ppFree;
+    *ppFree = p;
+  }
+  else {
+    p->pHashNext = nullptr;
+  }
+}
+
+/* Frees an entry and its program */
+static void entryFree(RxCacheEntry *p) {
+  rx_free(p->pProg);
+  sqlite3_free(p);
+}
+
+/* Gets the compiled program for a pattern from the process-wide cache,
+** compiling it on a miss. The results are the same as for rx_compile(), except
+** that the program must be let go of with rx_cacheRelease() instead of being
+** freed. Patterns that don't compile aren't cached. */
+int rx_cacheGet(const DbStr *pPattern, bool turkic, RxProg **ppProg,
+                const char **pzReason)
+{
+  u32 h = uni_hash(pPattern, false, false);
+  RxCacheShard *pShard = RX_SHARD(h);
+  RxCacheEntry *pEntry;
+  RxCacheEntry *pOld;
+  RxCacheEntry *pFree = nullptr;
+  RxProg *pProg;
+  int rc;
+
+  assert(cacheReady);
+  *ppProg = nullptr;
+  *pzReason = nullptr;
+  sqlite3_mutex_enter(pShard->mutex);
+  pEntry = cacheFind(pShard, pPattern, turkic, h);
+  if (pEntry) {
+    lruUnlink(pShard, pEntry);
+    lruPush(pShard, pEntry);
+    pEntry->nRef++;
+    pShard->nHit++;
+    *ppProg = pEntry->pProg;
+  }
+  else {
+    pShard->nMiss++;
+  }
+  sqlite3_mutex_leave(pShard->mutex);
+  if (pEntry) return RESULT_OK;
+
+  rc = rx_compile(pPattern, turkic, &pProg, pzReason);
+  if (rc != RESULT_OK) return rc;
+  pEntry = (RxCacheEntry*)sqlite3_malloc64(sizeof(RxCacheEntry) + pPattern->cb);
+  if (pEntry == nullptr) {
+    rx_free(pProg);
+    return ERR_NOMEM;
+  }
+  memset(pEntry, 0, sizeof(*pEntry));
+  pEntry->pProg = pProg;
+  pEntry->hash = h;
+  pEntry->cb = pPattern->cb;
+  pEntry->isWide = pPattern->isWide;
+  pEntry->turkic = turkic;
+  pEntry->nRef = 1;
+  pEntry->nByte = progSize(pProg) + (i64)sqlite3_msize(pEntry);
+  if (pPattern->cb > 0) {
+    memcpy((void*)RX_ENTRY_TEXT(pEntry), pPattern->pText, (size_t)pPattern->cb);
+  }
+  pProg->pEntry = pEntry;
+
+  sqlite3_mutex_enter(pShard->mutex);
+  /* another thread may have compiled the same pattern in the meantime */
+  pOld = cacheFind(pShard, pPattern, turkic, h);
+  if (pOld) {
+    lruUnlink(pShard, pOld);
+    lruPush(pShard, pOld);
+    pOld->nRef++;
+    pEntry->pHashNext = pFree;
+    pFree = pEntry;
+    pEntry = pOld;
+  }
+  else if (pEntry->nByte <= RX_SHARD_LIMIT) {
+    RxCacheEntry **ppBucket = RX_BUCKET(pShard, h);
+    while (pShard->pTail && pShard->nByte + pEntry->nByte > RX_SHARD_LIMIT) {
+      cacheEvict(pShard, pShard->pTail, &pFree);
+    }
+    pEntry->pHashNext = *ppBucket;
+    *ppBucket = pEntry;
+    lruPush(pShard, pEntry);
+    pEntry->inCache = true;
+    pShard->nByte += pEntry->nByte;
+    pShard->nEntry++;
+  }
+  /* otherwise the program is too big to cache; it is freed on release */
+  sqlite3_mutex_leave(pShard->mutex);
+  while (pFree) {
+    RxCacheEntry *pNext = pFree->pHashNext;
+    entryFree(pFree);
+    pFree = pNext;
+  }
+  *ppProg = pEntry->pProg;
+  return RESULT_OK;
+}
+
+/* Lets go of a program from rx_cacheGet(); a NULL program is a no-op */
+void rx_cacheRelease(RxProg *pProg) {
+  RxCacheEntry *pEntry;
+  RxCacheShard *pShard;
+  bool isDead;
+
+  if (pProg == nullptr) return;
+  pEntry = pProg->pEntry;
+  pShard = RX_SHARD(pEntry->hash);
+  sqlite3_mutex_enter(pShard->mutex);
+  assert(pEntry->nRef > 0);
+  isDead = --pEntry->nRef == 0 && !pEntry->inCache;
+  sqlite3_mutex_leave(pShard->mutex);
+  if (isDead) entryFree(pEntry);
+}
+
+/* Gets the totals of the cache counters over all of the shards */
+void rx_cacheStats(RxCacheStats *pStats) {
+  memset(pStats, 0, sizeof(*pStats));
+  pStats->nLimit = RX_SHARD_LIMIT * RX_CACHE_SHARDS;
+  for (int i = 0; i < RX_CACHE_SHARDS; i++) {
+    RxCacheShard *pShard = &aShard[i];
+    sqlite3_mutex_enter(pShard->mutex);
+    pStats->nHit += pShard->nHit;
+    pStats->nMiss += pShard->nMiss;
+    pStats->nEvict += pShard->nEvict;
+    pStats->nByte += pShard->nByte;
+    pStats->nEntry += pShard->nEntry;
+    sqlite3_mutex_leave(pShard->mutex);
+  }
+}
+
+#endif /* !UTILEXT_OMIT_REGEX */
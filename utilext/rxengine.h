@@ -0,0 +1,80 @@
+/*==============================================================================
+ *
+ * Written by: Mark Benningfield
+ *
+ * LICENSE: Public Domain -- see the file LICENSE.txt
+ *
+ *==============================================================================
+ *
+ * Header file for the native regular expression engine.
+ *
+ * The engine compiles the subset of the .NET regular expression syntax that
+ * can be matched without backtracking, and matches it in time proportional to
+ * the length of the input (see "rxengine.c"). Patterns that use anything else
+ * are reported as unsupported, and the regex functions hand those over to the
+ * managed Regex class instead.
+ *
+ * Like the Unicode text routines, the engine works directly on the UTF-8 or
+ * UTF-16 bytes that we get from SQLite, and all positions are byte offsets
+ * into the original text.
+ *
+ *============================================================================*/
+
+#pragma once
+
+#include "utilext.h"
+
+/* Result codes from rx_compile(), in addition to RESULT_OK and ERR_NOMEM */
+#define RX_UNSUPPORTED  (-3)  /* valid .NET syntax that the engine can't run */
+#define RX_INVALID      (-4)  /* not a valid .NET pattern                     */
+
+/* A compiled pattern; it is never modified after rx_compile() returns, so it
+** may be shared by any number of matchers. */
+typedef struct RxProg RxProg;
+
+/* The scratch space for matching against a compiled pattern, including the
+** cache of DFA states that is built up as the matcher runs. A matcher must
+** not be used by more than one thread at a time. */
+typedef struct RxMatcher RxMatcher;
+
+/* A compiled replacement pattern for rx_replace() */
+typedef struct RxSub RxSub;
+
+/* Counters for the process-wide program cache, from rx_cacheStats() */
+typedef struct RxCacheStats RxCacheStats;
+struct RxCacheStats {
+  i64 nHit;     /* lookups that found a compiled program          */
+  i64 nMiss;    /* lookups that had to compile the pattern        */
+  i64 nEvict;   /* programs evicted to stay within the limit      */
+  i64 nByte;    /* memory held by the cached programs             */
+  i64 nLimit;   /* most memory that the cached programs may hold  */
+  int nEntry;   /* count of cached programs                       */
+};
+
+/* Compiling patterns */
+int rx_compile(const DbStr *pPattern, bool turkic, RxProg **ppProg,
+               const char **pzReason);
+void rx_free(RxProg *pProg);
+int rx_groupCount(const RxProg *pProg);
+
+/* Sharing compiled programs across connections */
+int rx_cacheInit(void);
+int rx_cacheGet(const DbStr *pPattern, bool turkic, RxProg **ppProg,
+                const char **pzReason);
+void rx_cacheRelease(RxProg *pProg);
+void rx_cacheStats(RxCacheStats *pStats);
+
+/* Matching */
+RxMatcher *rx_matcherNew(const RxProg *pProg);
+void rx_matcherFree(RxMatcher *pMatcher);
+int rx_isMatch(RxMatcher *pMatcher, const DbStr *pIn, bool *pResult);
+bool rx_find(RxMatcher *pMatcher, const DbStr *pIn, int iStart, int *aCap);
+int rx_count(RxMatcher *pMatcher, const DbStr *pIn, int *pnMatch);
+int rx_findNth(RxMatcher *pMatcher, const DbStr *pIn, int n,
+               const int **paCap);
+
+/* Substitution */
+int rx_subCompile(const RxProg *pProg, const DbStr *pSub, RxSub **ppSub);
+void rx_subFree(RxSub *pSub);
+int rx_replace(RxMatcher *pMatcher, const DbStr *pIn, const RxSub *pSub,
+               DbStr *pResult);
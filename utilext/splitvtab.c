@@ -9,7 +9,9 @@
  * Code adapted from "templatevtab.c" and "series.c" in the sqlite source repo.
  *
  * A virtual table implementation to perform Regex.Split() and return the
- * resulting items as rows. The table schema is:
+ * resulting items as rows. The split is done by the native engine in
+ * "rxengine.c" when it supports the pattern, one match at a time as the
+ * cursor moves, and by the managed Regex class otherwise. The table schema is:
  *
  *  CREATE TABLE x(item TEXT,
  *                 input TEXT HIDDEN,
@@ -22,7 +24,11 @@
  *
  * Like the csv.c extension, the xBestIndex and xFilter functions just do a
  * full table scan, because anything else for this situation is rather
- * pointless.
+ * pointless; the only things that xBestIndex takes from the query besides the
+ * arguments are the LIMIT, so that the split can stop early, and an IN list
+ * for the input, so that all of its values are split by one xFilter call:
+ *  select input, item from regsplit where input in (select body from docs)
+ *    and pattern = '\s+';
  *
  *============================================================================*/
 
@@ -37,33 +43,258 @@
 #pragma warning( disable : 4820 )
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include <assert.h>
 #include "sqlite3ext.h"
 #include "RegexExt.h"
+#include "rxengine.h"
 
 /* _INIT1 gets evaluated in functions.c */
 SQLITE_EXTENSION_INIT3
 
 typedef UtilityExtensions::RegexExt RegExt;
+typedef UtilityExtensions::Common Com;
 
 #pragma warning( push )
 #pragma warning( disable : 4820 ) /* struct padding added */
 
-/* Subclass the sqlite3_vtab_cursor base class */
+/* Subclass the sqlite3_vtab_cursor base class. A split done by the native
+** engine is streamed: the cursor keeps the compiled pattern and a position in
+** its copy of the input, finds the next match in xNext, and returns each item
+** as a slice of the input. A split done by the managed Regex class comes back
+** as an array of strings. The buffers and the compiled pattern are kept from
+** one xFilter call to the next, for a join that splits a column of each row
+** with the same pattern. When SQLite hands over a whole IN list for the
+** input, the cursor copies every value and splits them one after another. */
 typedef struct splitvtab_cursor splitvtab_cursor;
 struct splitvtab_cursor {
   sqlite3_vtab_cursor base; /* Base class - must be first */
-  DbStrArr data;            /* split results */
-  char *zInput;             /* input arg */
-  char *zPattern;           /* pattern arg */
+  u8 *zInput;               /* copies of the input values, each terminated */
+  int cbInputs;             /* bytes used in zInput */
+  int nInputAlloc;
+  int *aInput;              /* offset of each input in zInput, and the end */
+  int nInput;
+  int nInputSlot;
+  int iInput;               /* input that is being split */
+  int iText;                /* offset of the current input in zInput */
+  int cbText;               /* count of bytes in the current input */
+  u8 *zPattern;             /* copy of the pattern arg */
+  int cbPattern;
+  int nPatternAlloc;
   int timeout;              /* timeout arg */
-  int index;                /* current index into the results array */
-  bool isSet;               /* the split has been performed */
+  int index;                /* rowid of the current item in its input */
+  sqlite3_int64 iRow;       /* count of rows before the current one */
+  sqlite3_int64 nLimit;     /* most items that are needed, or -1 for all */
+  bool isEof;               /* there are no more items */
+  bool hasPattern;          /* the pattern has been compiled */
+  bool isManaged;           /* the pattern needs the managed Regex class */
+  RxProg *pProg;            /* compiled pattern, or NULL for a managed split */
+  RxMatcher *pMatcher;
+  int *aCap;                /* groups of the last match */
+  int nGroup;
+  int iFind;                /* where the next search starts, or -1 if done */
+  int iCopied;              /* end of the last match */
+  int iGroup;               /* next group of the last match to return */
+  int iItem;                /* byte offset of the current item */
+  int cbItem;               /* count of bytes in the current item */
+  DbStrArr data;            /* managed split results */
 };
 
 #pragma warning ( pop ) /* 4820 */
 
 
+/* Copies an argument, with its terminator, to offset iAt of a buffer owned
+** by the cursor, which only grows when the argument doesn't fit. Returns
+** RESULT_OK or ERR_NOMEM. */
+static int splitCopyArg(sqlite3_value *pValue, u8 **pz, int iAt, int *pcb,
+                        int *pnAlloc)
+{
+  const u8 *z = sqlite3_value_text(pValue);
+  int cb = sqlite3_value_bytes(pValue);
+  sqlite3_int64 nNeed = (sqlite3_int64)iAt + cb + 1;
+  if (z == nullptr || nNeed > INT_MAX) return ERR_NOMEM;
+  if (nNeed > *pnAlloc) {
+    /* at least double it, for an IN list that is copied one value at a time */
+    sqlite3_int64 nNew = (sqlite3_int64)*pnAlloc * 2;
+    if (nNew < nNeed || nNew > INT_MAX) nNew = nNeed;
+    u8 *zNew = (u8*)sqlite3_realloc64(*pz, (sqlite3_uint64)nNew);
+    if (zNew == nullptr) return ERR_NOMEM;
+    *pz = zNew;
+    *pnAlloc = (int)nNew;
+  }
+  memcpy(*pz + iAt, z, (size_t)cb + 1);
+  *pcb = cb;
+  return RESULT_OK;
+}
+
+/* Adds a copy of an input value to the ones the cursor splits */
+static int splitAddInput(splitvtab_cursor *pCur, sqlite3_value *pValue) {
+  int cb;
+  int rc;
+  if (pCur->nInput + 2 > pCur->nInputSlot) {
+    int nNew = pCur->nInputSlot ? pCur->nInputSlot * 2 : 8;
+    int *aNew = (int*)sqlite3_realloc64(pCur->aInput, nNew * sizeof(int));
+    if (aNew == nullptr) return ERR_NOMEM;
+    pCur->aInput = aNew;
+    pCur->nInputSlot = nNew;
+  }
+  rc = splitCopyArg(pValue, &pCur->zInput, pCur->cbInputs, &cb,
+                    &pCur->nInputAlloc);
+  if (rc != RESULT_OK) return rc;
+  pCur->aInput[pCur->nInput++] = pCur->cbInputs;
+  pCur->cbInputs += cb + 1;
+  pCur->aInput[pCur->nInput] = pCur->cbInputs;
+  return RESULT_OK;
+}
+
+/* Returns true if an argument is the same text as a copy of an earlier one */
+static bool splitSameArg(sqlite3_value *pValue, const u8 *z, int cb) {
+  const u8 *zValue = sqlite3_value_text(pValue);
+  return zValue && sqlite3_value_bytes(pValue) == cb &&
+         memcmp(zValue, z, (size_t)cb) == 0;
+}
+
+/* Compiles the pattern for a native split. Returns RX_UNSUPPORTED or
+** RX_INVALID if the pattern has to be left to the managed Regex class. */
+static int splitNativeBegin(splitvtab_cursor *pCur) {
+  DbStr pattern;
+  const char *zReason;
+  int rc;
+
+  pattern.pText = pCur->zPattern;
+  pattern.cb = pCur->cbPattern;
+  pattern.isWide = false;
+  rc = rx_cacheGet(&pattern, Com::TurkicCasing, &pCur->pProg, &zReason);
+  if (rc != RESULT_OK) return rc;
+  pCur->nGroup = rx_groupCount(pCur->pProg);
+  pCur->pMatcher = rx_matcherNew(pCur->pProg);
+  pCur->aCap = (int*)sqlite3_malloc64(pCur->nGroup * 2 * sizeof(int));
+  if (pCur->pMatcher == nullptr || pCur->aCap == nullptr) return ERR_NOMEM;
+  return RESULT_OK;
+}
+
+/* Moves a native split to its next item, following the rules of
+** Regex.Split(): the items are the text between the matches, along with the
+** text of each capture group that took part in a match. */
+static void splitNativeStep(splitvtab_cursor *pCur) {
+  const u8 *z = pCur->zInput + pCur->iText;
+  int cb = pCur->cbText;
+  int *aCap = pCur->aCap;
+  DbStr input;
+
+  /* the groups of the last match come before the text after it */
+  while (pCur->iGroup > 0 && pCur->iGroup < pCur->nGroup) {
+    int g = pCur->iGroup++;
+    if (aCap[g * 2] >= 0) {
+      pCur->iItem = aCap[g * 2];
+      pCur->cbItem = aCap[g * 2 + 1] - aCap[g * 2];
+      return;
+    }
+  }
+  pCur->iGroup = 0;
+  if (pCur->iFind < 0) {
+    pCur->isEof = true;
+    return;
+  }
+  input.pText = z;
+  input.cb = cb;
+  input.isWide = false;
+  if (pCur->iFind > cb ||
+      !rx_find(pCur->pMatcher, &input, pCur->iFind, aCap))
+  {
+    /* the rest of the input is the last item */
+    pCur->iItem = pCur->iCopied;
+    pCur->cbItem = cb - pCur->iCopied;
+    pCur->iFind = -1;
+    return;
+  }
+  pCur->iItem = pCur->iCopied;
+  pCur->cbItem = aCap[0] - pCur->iCopied;
+  pCur->iCopied = aCap[1];
+  pCur->iFind = aCap[1];
+  pCur->iGroup = 1;
+  if (aCap[0] == aCap[1]) {
+    /* step over one character after an empty match */
+    if (pCur->iFind == cb) {
+      pCur->iFind = cb + 1; /* only the empty rest of the input is left */
+    }
+    else {
+      do {
+        pCur->iFind++;
+      } while (pCur->iFind < cb && (z[pCur->iFind] & 0xC0) == 0x80);
+    }
+  }
+}
+
+/* Frees the results of a managed split */
+static void splitFreeItems(splitvtab_cursor *pCur) {
+  for (int i = 0; i < pCur->data.n; i++) {
+    free(pCur->data.pArr[i]);
+  }
+  free(pCur->data.pArr);
+  memset(&pCur->data, 0, sizeof(pCur->data));
+}
+
+/* Frees the compiled pattern and the results of the last split */
+static void splitReset(splitvtab_cursor *pCur) {
+  splitFreeItems(pCur);
+  pCur->hasPattern = false;
+  pCur->isManaged = false;
+  sqlite3_free(pCur->aCap);
+  pCur->aCap = nullptr;
+  rx_matcherFree(pCur->pMatcher);
+  pCur->pMatcher = nullptr;
+  rx_cacheRelease(pCur->pProg);
+  pCur->pProg = nullptr;
+}
+
+/* Starts the split of the next input, or sets isEof if there isn't one.
+** Returns RESULT_OK or the error from the managed split. */
+static int splitNextInput(splitvtab_cursor *pCur, char **pzError) {
+  DbStr input = { 0 };
+  DbStr pattern = { 0 };
+  int rc;
+  while (++pCur->iInput < pCur->nInput) {
+    pCur->iText = pCur->aInput[pCur->iInput];
+    pCur->cbText = pCur->aInput[pCur->iInput + 1] - pCur->iText - 1;
+    pCur->index = 0;
+    if (!pCur->isManaged) {
+      pCur->iFind = 0;
+      pCur->iCopied = 0;
+      pCur->iGroup = 0;
+      splitNativeStep(pCur);
+      return RESULT_OK;
+    }
+    splitFreeItems(pCur);
+    input.pText = pCur->zInput + pCur->iText;
+    input.cb = pCur->cbText;
+    pattern.pText = pCur->zPattern;
+    pattern.cb = pCur->cbPattern;
+    rc = RegExt::Regsplit(&input, &pattern, pCur->timeout, pzError,
+                          &pCur->data);
+    if (rc != RESULT_OK) return rc;
+    if (pCur->data.n > 0) return RESULT_OK;
+  }
+  pCur->isEof = true;
+  return RESULT_OK;
+}
+
+/* Turns the result of a split into an SQLite result code */
+static int splitResult(splitvtab_cursor *pCur, int rc, char *zError) {
+  switch (rc) {
+    case ERR_NOMEM:
+      splitReset(pCur);
+      return SQLITE_NOMEM;
+    case ERR_REGEX_PARSE:
+      pCur->base.pVtab->zErrMsg = sqlite3_mprintf("%s", zError);
+      free(zError);
+      return SQLITE_ERROR;
+    case ERR_REGEX_TIMEOUT:
+      return SQLITE_ABORT;
+  }
+  return SQLITE_OK;
+}
+
 /* the constructor for splitvtab_vtab objects.
 **
 ** All this routine needs to do is:
@@ -115,7 +346,7 @@ static int splitvtabOpen(sqlite3_vtab *p, sqlite3_vtab_cursor **ppCursor) {
   splitvtab_cursor *pCur = (splitvtab_cursor*)sqlite3_malloc(sizeof(*pCur));
   if (pCur == nullptr) return SQLITE_NOMEM;
   memset(pCur, 0, sizeof(*pCur));
-  pCur->index = -1; /* start before the first row */
+  pCur->isEof = true;
   *ppCursor = &pCur->base;
   return SQLITE_OK;
 }
@@ -123,16 +354,34 @@ static int splitvtabOpen(sqlite3_vtab *p, sqlite3_vtab_cursor **ppCursor) {
 /* Destructor for a splitvtab_cursor. */
 static int splitvtabClose(sqlite3_vtab_cursor *cur) {
   splitvtab_cursor *pCur = (splitvtab_cursor*)cur;
-  free(pCur->zInput);
-  free(pCur->zPattern);
+  splitReset(pCur);
+  sqlite3_free(pCur->zInput);
+  sqlite3_free(pCur->aInput);
+  sqlite3_free(pCur->zPattern);
   sqlite3_free(pCur);
   return SQLITE_OK;
 }
 
-/* Advance a splitvtab_cursor to its next row of output */
+/* Advance a splitvtab_cursor to its next row of output, which may be the
+** first item of the next input */
 static int splitvtabNext(sqlite3_vtab_cursor *cur) {
-  ((splitvtab_cursor*)cur)->index++;
-  return SQLITE_OK;
+  splitvtab_cursor *pCur = (splitvtab_cursor*)cur;
+  char *zError = nullptr;
+  pCur->iRow++;
+  if (pCur->nLimit >= 0 && pCur->iRow >= pCur->nLimit) {
+    pCur->isEof = true;
+    return SQLITE_OK;
+  }
+  pCur->index++;
+  if (pCur->pProg) {
+    splitNativeStep(pCur);
+    if (!pCur->isEof) return SQLITE_OK;
+    pCur->isEof = false;
+  }
+  else if (pCur->index < pCur->data.n) {
+    return SQLITE_OK;
+  }
+  return splitResult(pCur, splitNextInput(pCur, &zError), zError);
 }
 
 /* Indexes for the table columns */
@@ -141,35 +390,57 @@ static int splitvtabNext(sqlite3_vtab_cursor *cur) {
 #define SPLIT_COL_PATTERN 2
 #define SPLIT_COL_TIMEOUT 3
 
+/* Arguments that xBestIndex can pass to xFilter; idxNum has bit (1 << n) set
+** for each one that is passed */
+#define SPLIT_ARG_INPUT   0
+#define SPLIT_ARG_PATTERN 1
+#define SPLIT_ARG_TIMEOUT 2
+#define SPLIT_ARG_LIMIT   3
+#define SPLIT_ARG_OFFSET  4
+#define SPLIT_ARG_COUNT   5
+
+/* idxNum flag for an input that is an IN list which xFilter reads all at
+** once */
+#define SPLIT_IN_LIST     (1 << SPLIT_ARG_COUNT)
+
 /* Return the column value for the specified column */
 static int splitvtabColumn(sqlite3_vtab_cursor *cur,
                            sqlite3_context *ctx,
                            int i)
 {
   splitvtab_cursor *pCur = (splitvtab_cursor*)cur;
-  char *zValue = nullptr;
-  if (i == SPLIT_COL_TIMEOUT) {
-    sqlite3_result_int(ctx, pCur->timeout);
-  }
-  else {
-    switch (i) {
-      case SPLIT_COL_ITEM:
-        zValue = pCur->data.pArr[pCur->index];
-        break;
-      case SPLIT_COL_INPUT:
-        zValue = pCur->zInput;
-        break;
-      case SPLIT_COL_PATTERN:
-        zValue = pCur->zPattern;
-        break;
-    }
-    sqlite3_result_text(ctx, zValue, -1, SQLITE_TRANSIENT);
+  switch (i) {
+    case SPLIT_COL_ITEM:
+      /* SQLite copies the slice into the result register, which keeps its
+      ** buffer from one row to the next */
+      if (pCur->pProg) {
+        sqlite3_result_text(ctx,
+                            (const char*)pCur->zInput + pCur->iText +
+                            pCur->iItem,
+                            pCur->cbItem, SQLITE_TRANSIENT);
+      }
+      else {
+        sqlite3_result_text(ctx, pCur->data.pArr[pCur->index], -1,
+                            SQLITE_TRANSIENT);
+      }
+      break;
+    case SPLIT_COL_INPUT:
+      sqlite3_result_text(ctx, (const char*)pCur->zInput + pCur->iText,
+                          pCur->cbText, SQLITE_TRANSIENT);
+      break;
+    case SPLIT_COL_PATTERN:
+      sqlite3_result_text(ctx, (const char*)pCur->zPattern, pCur->cbPattern,
+                          SQLITE_TRANSIENT);
+      break;
+    case SPLIT_COL_TIMEOUT:
+      sqlite3_result_int(ctx, pCur->timeout);
+      break;
   }
   return SQLITE_OK;
 }
 
 /* Return the rowid for the current row. In this implementation, the rowid is
-** the current index into the result array.
+** the index of the current item in its input.
 */
 static int splitvtabRowid(sqlite3_vtab_cursor *cur, sqlite_int64 *pRowid) {
   *pRowid = ((splitvtab_cursor*)cur)->index;
@@ -178,13 +449,13 @@ static int splitvtabRowid(sqlite3_vtab_cursor *cur, sqlite_int64 *pRowid) {
 
 /* Return TRUE if the cursor has been moved off of the last row of output. */
 static int splitvtabEof(sqlite3_vtab_cursor *cur) {
-  splitvtab_cursor *pCur = (splitvtab_cursor*)cur;
-
-  return pCur->index >= pCur->data.n || pCur->index < 0;
+  return ((splitvtab_cursor*)cur)->isEof;
 }
 
-/* Set up the results of splitting the input and move to the first row of the
-** result set.
+/* Set up the split of the input and move to the first row of the result set.
+** The native engine finds the matches one at a time as the cursor moves; the
+** managed Regex class splits each input when the cursor gets to it. The
+** pattern is only compiled again if it isn't the one from the last call.
 */
 static int splitvtabFilter(sqlite3_vtab_cursor *pVtabCursor,
                            int idxNum,
@@ -193,83 +464,192 @@ static int splitvtabFilter(sqlite3_vtab_cursor *pVtabCursor,
                            sqlite3_value **argv)
 {
   _CRT_UNUSED(idxStr);
-  assert(idxNum >= 3 && idxNum <= 7);
-  DbStrArr result;
-  char *zError;
-  int rc;
-  DbStr input = { 0 };
-  DbStr pattern = { 0 };
+  _CRT_UNUSED(argc);
+  assert((idxNum & 3) == 3);
+  char *zError = nullptr;
+  int rc = RESULT_OK;
   int ms = -1;
+  int iArg = 2;
+  bool samePattern;
   splitvtab_cursor *pCur = (splitvtab_cursor*)pVtabCursor;
-  if (!pCur->isSet) {
-    /* return no rows if any argument is null */
-    for (int i = 0; i < argc; i++) {
-      if (sqlite3_value_type(argv[i]) == SQLITE_NULL) {
-        pCur->index = -1;
-        pCur->isSet = true;
-        return SQLITE_OK;
+  pCur->index = 0;
+  pCur->iRow = 0;
+  pCur->isEof = true;
+  pCur->nLimit = -1;
+  pCur->nInput = 0;
+  pCur->cbInputs = 0;
+  /* return no rows if the input, the pattern, or the timeout is null */
+  if (sqlite3_value_type(argv[1]) == SQLITE_NULL ||
+      (!(idxNum & SPLIT_IN_LIST) &&
+       sqlite3_value_type(argv[0]) == SQLITE_NULL))
+  {
+    return SQLITE_OK;
+  }
+  if (idxNum & (1 << SPLIT_ARG_TIMEOUT)) {
+    if (sqlite3_value_type(argv[iArg]) == SQLITE_NULL) return SQLITE_OK;
+    ms = sqlite3_value_int(argv[iArg++]);
+  }
+  if (idxNum & (1 << SPLIT_ARG_LIMIT)) {
+    /* SQLite applies LIMIT and OFFSET to the rows too; the split just stops
+    ** after the last row that they let through */
+    sqlite3_int64 nOffset = 0;
+    pCur->nLimit = sqlite3_value_int64(argv[iArg++]);
+    if (idxNum & (1 << SPLIT_ARG_OFFSET)) {
+      nOffset = sqlite3_value_int64(argv[iArg]);
+    }
+    if (pCur->nLimit == 0) return SQLITE_OK;
+    if (pCur->nLimit < 0 || nOffset > LLONG_MAX - pCur->nLimit) {
+      pCur->nLimit = -1;
+    }
+    else if (nOffset > 0) {
+      pCur->nLimit += nOffset;
+    }
+  }
+#if SQLITE_VERSION_NUMBER >= MIN_VTAB_IN_VERSION
+  if (idxNum & SPLIT_IN_LIST) {
+    /* the values can only be read here, so all of them are copied; a null
+    ** never equals the input, so it is left out */
+    sqlite3_value *pValue;
+    int rcIn = sqlite3_vtab_in_first(argv[0], &pValue);
+    while (rcIn == SQLITE_OK && rc == RESULT_OK) {
+      if (sqlite3_value_type(pValue) != SQLITE_NULL) {
+        rc = splitAddInput(pCur, pValue);
       }
+      rcIn = sqlite3_vtab_in_next(argv[0], &pValue);
     }
-    input.pText = sqlite3_value_text(argv[0]);
-    input.cb = sqlite3_value_bytes(argv[0]);
-    pattern.pText = sqlite3_value_text(argv[1]);
-    pattern.cb = sqlite3_value_bytes(argv[1]);
-    if (idxNum & 4) {
-      ms = sqlite3_value_int(argv[2]);
+    if (rcIn != SQLITE_OK && rcIn != SQLITE_DONE) return rcIn;
+  }
+  else
+#endif
+  {
+    rc = splitAddInput(pCur, argv[0]);
+  }
+  samePattern = pCur->hasPattern &&
+                splitSameArg(argv[1], pCur->zPattern, pCur->cbPattern);
+  if (rc == RESULT_OK && !samePattern) {
+    splitReset(pCur);
+    rc = splitCopyArg(argv[1], &pCur->zPattern, 0, &pCur->cbPattern,
+                      &pCur->nPatternAlloc);
+    if (rc == RESULT_OK) rc = splitNativeBegin(pCur);
+    if (rc == RX_UNSUPPORTED || rc == RX_INVALID) {
+      splitReset(pCur);
+      pCur->isManaged = true;
+      rc = RESULT_OK;
     }
-    rc = RegExt::Regsplit(&input, &pattern, ms, &zError, &result);
-    switch (rc) {
-      case ERR_NOMEM:
-        return SQLITE_NOMEM;
-      case ERR_REGEX_PARSE:
-        pVtabCursor->pVtab->zErrMsg = sqlite3_mprintf("%s", zError);
-        free(zError);
-        return SQLITE_ERROR;
-      case ERR_REGEX_TIMEOUT:
-        return SQLITE_ABORT;
+    pCur->hasPattern = (rc == RESULT_OK);
+  }
+  pCur->timeout = ms;
+  pCur->iInput = -1;
+  pCur->isEof = false;
+  if (rc == RESULT_OK) rc = splitNextInput(pCur, &zError);
+  if (rc != RESULT_OK) pCur->isEof = true;
+  return splitResult(pCur, rc, zError);
+}
+
+/* The LIMIT and OFFSET constraints are new in SQLite 3.38.0; older versions
+** never pass them to xBestIndex. */
+#ifndef SQLITE_INDEX_CONSTRAINT_LIMIT
+#define SQLITE_INDEX_CONSTRAINT_LIMIT  73
+#define SQLITE_INDEX_CONSTRAINT_OFFSET 74
+#endif
+
+/* Guesses for the cost estimate: the count of items when the input isn't
+** known when the statement is prepared, and the average length of an item
+** when it is */
+#define SPLIT_DEFAULT_ROWS  100
+#define SPLIT_ITEM_BYTES    16
+
+/* Gets the value of a constraint if it is a constant; returns nullptr if it
+** isn't, or if SQLite is too old to tell */
+static sqlite3_value *splitConstant(sqlite3_index_info *pIdxInfo, int i) {
+  sqlite3_value *pValue = nullptr;
+#if SQLITE_VERSION_NUMBER >= MIN_VTAB_RHS_VERSION
+  if (sqlite3_libversion_number() >= MIN_VTAB_RHS_VERSION) {
+    if (sqlite3_vtab_rhs_value(pIdxInfo, i, &pValue) != SQLITE_OK) {
+      pValue = nullptr;
     }
-    pCur->zInput = _strdup((char*)input.pText);
-    pCur->zPattern = _strdup((char*)pattern.pText);
-    pCur->timeout = ms;
-    pCur->data = result;
-    pCur->isSet = true;
   }
-  pCur->index = 0;
-  return SQLITE_OK;
+#else
+  _CRT_UNUSED(pIdxInfo);
+  _CRT_UNUSED(i);
+#endif
+  return pValue;
 }
 
-/* The cost estimate reflects a full table scan only; The arguments to xFilter
-** are [0] input string, [1] pattern string, and [2] timeout in ms.
+/* The arguments to xFilter are [0] input string, [1] pattern string, and the
+** ones that idxNum has a bit for, in order: timeout in ms, LIMIT, and OFFSET.
+** The input is an IN list if idxNum has SPLIT_IN_LIST set. The split stops
+** after the items that LIMIT and OFFSET let through, and the count of items
+** is estimated from the length of the input if it is known.
 */
 static int splitvtabBestIndex(sqlite3_vtab *tab,
                               sqlite3_index_info *pIdxInfo)
 {
   _CRT_UNUSED(tab);
   sqlite3_index_info::sqlite3_index_constraint *pConstraint;
+  int aArg[SPLIT_ARG_COUNT]; /* constraint for each arg, or -1 */
   int idxNum = 0; /* bitmask for arg values */
   int nArg = 0; /* how many args are passed to xFilter */
-  if (pIdxInfo->nConstraint < 2) {
-    tab->zErrMsg = sqlite3_mprintf("not enough arguments on regsplit() - min 2");
-    return SQLITE_ERROR;
-  }
+  sqlite3_value *pValue;
+  sqlite3_int64 nRow = SPLIT_DEFAULT_ROWS;
+  for (int k = 0; k < SPLIT_ARG_COUNT; k++) aArg[k] = -1;
   pConstraint = pIdxInfo->aConstraint;
   for (int i = 0; i < pIdxInfo->nConstraint; i++, pConstraint++) {
+    if (pConstraint->op == SQLITE_INDEX_CONSTRAINT_LIMIT ||
+        pConstraint->op == SQLITE_INDEX_CONSTRAINT_OFFSET)
+    {
+      if (pConstraint->usable) {
+        aArg[pConstraint->op == SQLITE_INDEX_CONSTRAINT_LIMIT ?
+             SPLIT_ARG_LIMIT : SPLIT_ARG_OFFSET] = i;
+      }
+      continue;
+    }
     if (pConstraint->iColumn < SPLIT_COL_INPUT) continue;
     if (!pConstraint->usable) return SQLITE_CONSTRAINT;
     if (pConstraint->op == SQLITE_INDEX_CONSTRAINT_EQ) {
-      int iCol = pConstraint->iColumn - SPLIT_COL_INPUT;
       /* 0 input; 1 pattern; 2 timeout */
-      assert(iCol >= 0 && iCol <= 2);
-      idxNum |= 1 << iCol;
-      pIdxInfo->aConstraintUsage[i].argvIndex = ++nArg;
-      pIdxInfo->aConstraintUsage[i].omit = 1;
+      assert(pConstraint->iColumn - SPLIT_COL_INPUT <= SPLIT_ARG_TIMEOUT);
+      aArg[pConstraint->iColumn - SPLIT_COL_INPUT] = i;
     }
   }
-  /* estimated cost is swiped from csv.c, which is a constant cost for a full-
-  ** table scan. I don't know that it will take a million CPU cycles for a
-  ** simple split operation, but the specific cost is not important.
-  */
-  pIdxInfo->estimatedCost = 1000000;
+  /* LIMIT and OFFSET are constraints too, so they can't be counted toward
+  ** the required arguments */
+  if (aArg[SPLIT_ARG_INPUT] < 0 || aArg[SPLIT_ARG_PATTERN] < 0) {
+    tab->zErrMsg = sqlite3_mprintf("not enough arguments on regsplit() - min 2");
+    return SQLITE_ERROR;
+  }
+  /* OFFSET is left to SQLite, which skips the rows itself; it only matters
+  ** here as part of the count of rows that LIMIT needs */
+  for (int k = 0; k < SPLIT_ARG_COUNT; k++) {
+    if (aArg[k] < 0) continue;
+    idxNum |= 1 << k;
+    pIdxInfo->aConstraintUsage[aArg[k]].argvIndex = ++nArg;
+    pIdxInfo->aConstraintUsage[aArg[k]].omit = (k <= SPLIT_ARG_TIMEOUT);
+  }
+#if SQLITE_VERSION_NUMBER >= MIN_VTAB_IN_VERSION
+  /* an IN list for the input is read in one xFilter call, rather than one
+  ** call for each value, so the pattern is only looked at once */
+  if (aArg[SPLIT_ARG_INPUT] >= 0 &&
+      sqlite3_libversion_number() >= MIN_VTAB_IN_VERSION &&
+      sqlite3_vtab_in(pIdxInfo, aArg[SPLIT_ARG_INPUT], 1))
+  {
+    idxNum |= SPLIT_IN_LIST;
+  }
+#endif
+  if (aArg[SPLIT_ARG_INPUT] >= 0 &&
+      (pValue = splitConstant(pIdxInfo, aArg[SPLIT_ARG_INPUT])) != nullptr)
+  {
+    nRow = sqlite3_value_bytes(pValue) / SPLIT_ITEM_BYTES + 1;
+  }
+  if (aArg[SPLIT_ARG_LIMIT] >= 0 &&
+      (pValue = splitConstant(pIdxInfo, aArg[SPLIT_ARG_LIMIT])) != nullptr &&
+      sqlite3_value_int64(pValue) >= 0 &&
+      sqlite3_value_int64(pValue) < nRow)
+  {
+    nRow = sqlite3_value_int64(pValue);
+  }
+  pIdxInfo->estimatedRows = nRow;
+  pIdxInfo->estimatedCost = (double)nRow * 10;
   pIdxInfo->idxNum = idxNum;
   return SQLITE_OK;
 }
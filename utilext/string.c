@@ -13,6 +13,17 @@
  * just wrappers that fixup the data for consumption by their managed
  * counterparts, and return the result to SQLite.
  *
+ * The functions that only need to find grapheme cluster boundaries, like
+ * leftstr(), rightstr(), and reverse(), don't need managed code at all; they
+ * walk the text with the native routines in "unicode.c" and hand SQLite a
+ * slice of the input (or a reordered copy of it) directly.
+ *
+ * Most of the others check for pure ASCII input first. Printable ASCII has one
+ * character per code unit, so charindex(), upper(), lower(), and the collations
+ * can do their work on the code units without a trip through managed code, as
+ * long as the current culture treats ASCII text the same way that a byte-wise
+ * comparison does (see "Common.cpp").
+ *
  * We could probably reduce the LOC count significantly with clever use of
  * macros, but we find that such things invariably result in more pain than
  * it's worth.
@@ -28,20 +39,56 @@
 #ifndef UTILEXT_OMIT_STRING
 
 /* Notes in "utilext.c" */
-#pragma warning( disable : 4339 4514 )
+#pragma warning( disable : 4127 4339 4514 )
 #ifdef NDEBUG
 #pragma warning( disable : 4100)
 #endif
 
 #pragma warning( disable : 4820 )
 #include <assert.h>
+#include <limits.h>
 #include <stdlib.h>
+#include <string.h>
+#include <type_traits>
 #include "StringExt.h"
+#include "unicode.h"
 
 /* _INIT1 gets evaluated in functions.c */
 SQLITE_EXTENSION_INIT3
 
 typedef UtilityExtensions::StringExt StrEx;
+typedef UtilityExtensions::Common Com;
+
+/* Most of the string functions have an entry point for each database encoding
+** (and for case sensitivity, where that applies), instantiated from the same
+** template, so the encoding is settled when the function is registered rather
+** than checked on every row. These get the arguments and set the results for
+** those entry points. */
+template<bool isWide>
+static inline void getText(sqlite3_value *value, DbStr *pStr) {
+  pStr->isWide = isWide;
+  if (isWide) {
+    pStr->pText = sqlite3_value_text16(value);
+    pStr->cb = sqlite3_value_bytes16(value);
+  }
+  else {
+    pStr->pText = sqlite3_value_text(value);
+    pStr->cb = sqlite3_value_bytes(value);
+  }
+}
+
+template<bool isWide>
+static inline void setTextN(sqlite3_context *pCtx, const void *pText, int cb,
+                            void(*xDel)(void*))
+{
+  assert(pText && cb >= 0);
+  if (isWide) {
+    sqlite3_result_text16(pCtx, pText, cb, xDel);
+  }
+  else {
+    sqlite3_result_text(pCtx, (const char*)pText, cb, xDel);
+  }
+}
 
 /* The crux of the implementation of the like() function overload is to be able
 ** to provide Unicode case-folding when case-sensitivity is enabled; the default
@@ -51,12 +98,18 @@ typedef UtilityExtensions::StringExt StrEx;
 ** usually only set once when the extension is loaded, so it's not really worth
 ** the effort to subclass the default VFS and override the xFileControl function
 ** in order to trap the set_case_sensitive_like PRAGMA.
+**
+** The case-sensitivity flag belongs to the connection, but like() reads it on
+** every row, so it doesn't take a lock: like() reads the flag with an acquire
+** load, and set_case_sensitive_like() swaps in the new value with an atomic
+** exchange, so a change is seen by the next call to like() on any thread.
 */
 #ifndef UTILEXT_OMIT_LIKE
 
+typedef System::Threading::Interlocked Interlocked;
+typedef System::Threading::Volatile Volatile;
+
 /* Init extern variables */
-sqlite3_mutex *LikeMutex = nullptr;
-bool Serialized = false;
 bool MatchBlobs = false;
 
 /* Allocate user data for the like() and set_case_sensitive_like() overloads;
@@ -66,9 +119,9 @@ bool MatchBlobs = false;
 ** "destroyLikeState()" to get rid of the allocated shared pointer.
 */
 int allocLikeStates(LikeState **aStates) {
-  bool *pFlag = (bool*)malloc(sizeof(*pFlag));
+  int *pFlag = (int*)malloc(sizeof(*pFlag));
   if (!pFlag) return 1;
-  *pFlag = true;
+  *pFlag = 1;
   for (int i = 0; i < LIKE_STATE_CNT; i++) {
     aStates[i] = (LikeState*)malloc(sizeof(*aStates[i]));
     if (!aStates[i]) {
@@ -92,14 +145,347 @@ void destroyLikeState(void *ps) {
   free(ps);
 }
 
+/* Compiled like() patterns
+**
+** The pattern is compiled the first time that a statement sees it, and the
+** compiled form is kept with sqlite3_set_auxdata() for as long as the pattern
+** argument stays the same (usually for the whole statement).
+**
+** Each grapheme cluster of the pattern becomes a literal, a '_' wildcard, or a
+** '%' wildcard. The '%' wildcards split the pattern into segments, and every
+** item in a segment consumes exactly one cluster of the input, so the first
+** segment has to match at the start of the input, the last segment has to
+** match at the end, and each segment in between can be taken at the leftmost
+** place where it matches. Nothing ever has to be tried twice, so the worst
+** case is O(N*M) for an input of N clusters and a pattern of M clusters, where
+** the backtracking matcher in "func.c" (which we used to mimic) is exponential
+** for patterns like '%a%a%a%b'.
+**
+** When both the input and the literals are printable ASCII, and the current
+** culture treats ASCII the same way a byte-wise comparison does, the matching
+** is done on the code units directly; a segment of nothing but literals is
+** found with a straight substring search in that case.
+*/
+#define LIKE_LITERAL  0  /* a literal grapheme cluster */
+#define LIKE_ONE      1  /* the '_' wildcard           */
+
+struct LikeItem {
+  int eType;  /* LIKE_LITERAL or LIKE_ONE                  */
+  int iOff;   /* byte offset of a literal in zText         */
+  int cb;     /* count of bytes in a literal               */
+};
+
+struct LikeSeg {
+  int iItem;       /* index of the first item of the segment   */
+  int nItem;       /* count of items in the segment            */
+  bool isLiteral;  /* true if the segment has no '_' wildcards */
+};
+
+struct LikePattern {
+  bool isWide;       /* true if the text is UTF-16                        */
+  bool noCase;       /* true if compiled for case-insensitive matching    */
+  bool asciiOk;      /* true if ASCII can be compared by code unit        */
+  bool isAscii;      /* true if every literal is printable ASCII          */
+  bool noMatch;      /* true if the pattern ends with the escape char     */
+  bool hasAny;       /* true if the pattern has a '%' wildcard            */
+  bool anchorStart;  /* true if the pattern doesn't begin with '%'        */
+  bool anchorEnd;    /* true if the pattern doesn't end with '%'          */
+  int nSeg;          /* count of segments in aSeg                         */
+  LikeSeg *aSeg;     /* segments between the '%' wildcards                */
+  LikeItem *aItem;   /* pattern items for all segments                    */
+  u8 *zText;         /* literals; consecutive literals are contiguous     */
+  u8 *zEscape;       /* copy of the escape character, or NULL             */
+  int cbEscape;      /* count of bytes in zEscape                         */
+};
+
+#define LIKE_UNIT(Z,I,W) \
+  ((W) ? (u32)((const u16*)(Z))[I] : (u32)((const u8*)(Z))[I])
+
+/* Returns true if a grapheme cluster is the single ASCII character 'c' */
+static bool likeIsChar(const u8 *z, int cb, bool isWide, u32 c) {
+  return cb == (isWide ? 2 : 1) && LIKE_UNIT(z, 0, isWide) == c;
+}
+
+/* Compares two grapheme clusters the way the current culture does. Identical
+** clusters are always equal. When case is ignored, the clusters are equal if
+** their case foldings are, and clusters of one code point each are different
+** if their foldings are; when case matters, single printable ASCII characters
+** are different if they aren't identical and 'asciiOk' is set. Anything else
+** takes a trip through managed code, to pick up canonical equivalence. */
+static bool likeEqual(const LikePattern *p, const u8 *zA, int cbA,
+                      const u8 *zB, int cbB)
+{
+  int cbUnit = p->isWide ? 2 : 1;
+  DbStr left = { zA, cbA, p->isWide };
+  DbStr right = { zB, cbB, p->isWide };
+  int len;
+
+  if (cbA == cbB && memcmp(zA, zB, (size_t)cbA) == 0) return true;
+  if (p->noCase) {
+    if (uni_foldEqual(&left, &right, Com::TurkicCasing)) return true;
+    uni_decode(zA, cbA, p->isWide, &len);
+    if (len == cbA) {
+      uni_decode(zB, cbB, p->isWide, &len);
+      if (len == cbB) return false;
+    }
+  }
+  else if (p->asciiOk && cbA == cbUnit && cbB == cbUnit) {
+    u32 a = LIKE_UNIT(zA, 0, p->isWide);
+    u32 b = LIKE_UNIT(zB, 0, p->isWide);
+    if (a >= 0x20 && a < 0x7F && b >= 0x20 && b < 0x7F) return false;
+  }
+  return StrEx::GraphemeEquals(&left, &right, p->noCase);
+}
+
+/* Compiles a like() pattern; returns NULL if out of memory. The escape
+** character, if any, has already been checked for length. */
+static LikePattern *likeCompile(const DbStr *pPattern, const DbStr *pEscape,
+                                bool noCase, bool asciiOk)
+{
+  LikePattern *p;
+  LikeSeg *pSeg = nullptr;
+  GraphemeIter iter;
+  int nMax = uni_graphemeCount(pPattern) + 1;
+  int cbEscape = pEscape ? pEscape->cb : 0;
+  int cbText = 0;
+  bool afterAny = false;
+
+  p = (LikePattern*)sqlite3_malloc((int)(sizeof(*p) +
+        nMax * (sizeof(LikeSeg) + sizeof(LikeItem)) + pPattern->cb + cbEscape));
+  if (!p) return nullptr;
+  memset(p, 0, sizeof(*p));
+  p->aSeg = (LikeSeg*)&p[1];
+  p->aItem = (LikeItem*)&p->aSeg[nMax];
+  p->zText = (u8*)&p->aItem[nMax];
+  if (pEscape) {
+    p->zEscape = p->zText + pPattern->cb;
+    p->cbEscape = cbEscape;
+    memcpy(p->zEscape, pEscape->pText, (size_t)cbEscape);
+  }
+  p->isWide = pPattern->isWide;
+  p->noCase = noCase;
+  p->asciiOk = asciiOk;
+  p->isAscii = true;
+  p->anchorStart = true;
+  uni_iterInit(&iter, pPattern);
+  while (uni_nextGrapheme(&iter)) {
+    const u8 *z = iter.z + iter.iStart;
+    int cb = iter.iEnd - iter.iStart;
+    int eType = LIKE_LITERAL;
+    LikeItem *pItem;
+
+    if (likeIsChar(z, cb, p->isWide, '%')) {
+      if (p->nSeg == 0) p->anchorStart = false;
+      p->hasAny = true;
+      afterAny = true;
+      pSeg = nullptr;
+      continue;
+    }
+    /* As with the core, a '_' that follows a '%' is always a wildcard, even
+    ** when '_' is the escape character */
+    if (afterAny && likeIsChar(z, cb, p->isWide, '_')) {
+      eType = LIKE_ONE;
+    }
+    else if (p->zEscape && likeEqual(p, z, cb, p->zEscape, p->cbEscape)) {
+      if (!uni_nextGrapheme(&iter)) {
+        p->noMatch = true;
+        break;
+      }
+      z = iter.z + iter.iStart;
+      cb = iter.iEnd - iter.iStart;
+      afterAny = false;
+    }
+    else if (likeIsChar(z, cb, p->isWide, '_')) {
+      eType = LIKE_ONE;
+    }
+    else {
+      afterAny = false;
+    }
+    if (!pSeg) {
+      pSeg = &p->aSeg[p->nSeg++];
+      pSeg->iItem = p->aSeg == pSeg ? 0 : pSeg[-1].iItem + pSeg[-1].nItem;
+      pSeg->nItem = 0;
+      pSeg->isLiteral = true;
+    }
+    pItem = &p->aItem[pSeg->iItem + pSeg->nItem++];
+    pItem->eType = eType;
+    if (eType == LIKE_LITERAL) {
+      pItem->iOff = cbText;
+      pItem->cb = cb;
+      memcpy(p->zText + cbText, z, (size_t)cb);
+      cbText += cb;
+      if (cb != (p->isWide ? 2 : 1) || LIKE_UNIT(z, 0, p->isWide) < 0x20 ||
+          LIKE_UNIT(z, 0, p->isWide) >= 0x7F)
+      {
+        p->isAscii = false;
+      }
+    }
+    else {
+      pSeg->isLiteral = false;
+    }
+  }
+  p->anchorEnd = pSeg != nullptr;
+  return p;
+}
+
+/* Returns true if a compiled pattern can be used for the given arguments */
+static bool likeReusable(const LikePattern *p, const DbStr *pEscape,
+                         bool noCase)
+{
+  if (p->noCase != noCase) return false;
+  if (!pEscape) return p->zEscape == nullptr;
+  return p->zEscape && p->cbEscape == pEscape->cb &&
+         memcmp(p->zEscape, pEscape->pText, (size_t)pEscape->cb) == 0;
+}
+
+/* Matches a segment against the clusters that follow the current position of
+** 'pIter'; on success, the iterator is left on the last cluster matched. */
+static bool likeSegAt(const LikePattern *p, const LikeSeg *pSeg,
+                      GraphemeIter *pIter)
+{
+  for (int i = 0; i < pSeg->nItem; i++) {
+    const LikeItem *pItem = &p->aItem[pSeg->iItem + i];
+    if (!uni_nextGrapheme(pIter)) return false;
+    if (pItem->eType == LIKE_LITERAL &&
+        !likeEqual(p, pIter->z + pIter->iStart, pIter->iEnd - pIter->iStart,
+                   p->zText + pItem->iOff, pItem->cb))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* Finds the leftmost match of a segment that ends at or before cluster index
+** 'nLimit'; '*piPos' is the cluster index of the current iterator position. */
+static bool likeSegFind(const LikePattern *p, const LikeSeg *pSeg,
+                        GraphemeIter *pIter, int *piPos, int nLimit)
+{
+  GraphemeIter probe;
+  while (*piPos + pSeg->nItem <= nLimit) {
+    probe = *pIter;
+    if (likeSegAt(p, pSeg, &probe)) {
+      *pIter = probe;
+      *piPos += pSeg->nItem;
+      return true;
+    }
+    if (!uni_nextGrapheme(pIter)) break;
+    (*piPos)++;
+  }
+  return false;
+}
+
+/* Matches a compiled pattern against the grapheme clusters of the input */
+static bool likeMatch(const LikePattern *p, const DbStr *pIn) {
+  GraphemeIter iter;
+  int nSeg = p->nSeg;
+  int nLimit = INT_MAX;
+  int iPos = 0;
+  int iSeg = 0;
+
+  uni_iterInit(&iter, pIn);
+  if (!p->hasAny) {
+    if (nSeg == 0) return pIn->cb == 0;
+    return likeSegAt(p, p->aSeg, &iter) && !uni_nextGrapheme(&iter);
+  }
+  if (p->anchorEnd) {
+    nLimit = uni_graphemeCount(pIn) - p->aSeg[--nSeg].nItem;
+    if (nLimit < 0) return false;
+  }
+  if (p->anchorStart) {
+    if (p->aSeg->nItem > nLimit || !likeSegAt(p, p->aSeg, &iter)) return false;
+    iPos = p->aSeg->nItem;
+    iSeg = 1;
+  }
+  for (; iSeg < nSeg; iSeg++) {
+    if (!likeSegFind(p, &p->aSeg[iSeg], &iter, &iPos, nLimit)) return false;
+  }
+  if (p->anchorEnd) {
+    while (iPos++ < nLimit) uni_nextGrapheme(&iter);
+    return likeSegAt(p, &p->aSeg[nSeg], &iter);
+  }
+  return true;
+}
+
+/* Matches a segment at code unit 'i' of printable ASCII input */
+static bool likeAsciiAt(const LikePattern *p, const LikeSeg *pSeg,
+                        const DbStr *pIn, int i)
+{
+  for (int j = 0; j < pSeg->nItem; j++) {
+    const LikeItem *pItem = &p->aItem[pSeg->iItem + j];
+    u32 a;
+    u32 b;
+    if (pItem->eType != LIKE_LITERAL) continue;
+    a = LIKE_UNIT(pIn->pText, i + j, p->isWide);
+    b = LIKE_UNIT(p->zText + pItem->iOff, 0, p->isWide);
+    if (a != b && (!p->noCase || ASCII_FOLD(a) != ASCII_FOLD(b))) return false;
+  }
+  return true;
+}
+
+/* Finds the leftmost match of a segment in printable ASCII input that starts
+** at or after code unit 'iStart' and ends at or before 'nLimit'. Returns the
+** index of the match, or -1 if there is none. */
+static int likeAsciiFind(const LikePattern *p, const LikeSeg *pSeg,
+                         const DbStr *pIn, int iStart, int nLimit)
+{
+  if (pSeg->isLiteral) {
+    int cbUnit = p->isWide ? 2 : 1;
+    DbStr lit = { p->zText + p->aItem[pSeg->iItem].iOff, pSeg->nItem * cbUnit,
+                  p->isWide };
+    int i = uni_asciiFind(pIn, &lit, iStart, p->noCase);
+    return (i >= 0 && i + pSeg->nItem <= nLimit) ? i : -1;
+  }
+  for (int i = iStart; i + pSeg->nItem <= nLimit; i++) {
+    if (likeAsciiAt(p, pSeg, pIn, i)) return i;
+  }
+  return -1;
+}
+
+/* Matches a compiled pattern against printable ASCII input, where each code
+** unit is a grapheme cluster. Only used if 'isAscii' and 'asciiOk' are set. */
+static bool likeMatchAscii(const LikePattern *p, const DbStr *pIn) {
+  int n = p->isWide ? pIn->cb / 2 : pIn->cb;
+  int nSeg = p->nSeg;
+  int nLimit = n;
+  int iPos = 0;
+  int iSeg = 0;
+
+  assert(p->isAscii && p->asciiOk);
+  if (!p->hasAny) {
+    if (nSeg == 0) return n == 0;
+    return p->aSeg->nItem == n && likeAsciiAt(p, p->aSeg, pIn, 0);
+  }
+  if (p->anchorEnd) {
+    nLimit = n - p->aSeg[--nSeg].nItem;
+    if (nLimit < 0) return false;
+  }
+  if (p->anchorStart) {
+    if (p->aSeg->nItem > nLimit || !likeAsciiAt(p, p->aSeg, pIn, 0)) {
+      return false;
+    }
+    iPos = p->aSeg->nItem;
+    iSeg = 1;
+  }
+  for (; iSeg < nSeg; iSeg++) {
+    int i = likeAsciiFind(p, &p->aSeg[iSeg], pIn, iPos, nLimit);
+    if (i < 0) return false;
+    iPos = i + p->aSeg[iSeg].nItem;
+  }
+  if (p->anchorEnd) return likeAsciiAt(p, &p->aSeg[nSeg], pIn, nLimit);
+  return true;
+}
+
 /* like(P,S,E) override */
 void likeFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   sqlite3 *db;
   bool isWide;
   bool noCase;
-  int result;
-  int rc;
+  bool asciiOk;
+  bool result;
   LikeState *pState;
+  LikePattern *pLike;
+  LikePattern *pNew = nullptr;
   DbStr input;
   DbStr pattern;
   DbStr escape;
@@ -132,17 +518,37 @@ void likeFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   else {
     pEscape = NULL;
   }
-  sqlite3_mutex_enter(LikeMutex);
   pState = (LikeState*)sqlite3_user_data(pCtx);
-  noCase = *pState->pNoCase;
-  sqlite3_mutex_leave(LikeMutex);
-  rc = StrEx::Like(&input, &pattern, pEscape, noCase, &result);
-  if (rc == RESULT_OK) {
-    sqlite3_result_int(pCtx, result);
+  noCase = Volatile::Read(*pState->pNoCase) != 0;
+  asciiOk = Com::AsciiOrdinal && (!noCase || Com::AsciiCasing);
+  pLike = (LikePattern*)sqlite3_get_auxdata(pCtx, 0);
+  if (!pLike || !likeReusable(pLike, pEscape, noCase)) {
+    if (pEscape && uni_graphemeCount(pEscape) != 1) {
+      util_setError(pCtx, ERR_ESC_LENGTH);
+      return;
+    }
+    pLike = pNew = likeCompile(&pattern, pEscape, noCase, asciiOk);
+    if (!pNew) {
+      sqlite3_result_error_nomem(pCtx);
+      return;
+    }
+  }
+  pLike->asciiOk = asciiOk;
+  if (pLike->noMatch) {
+    result = false;
+  }
+  else if (pLike->isAscii && asciiOk &&
+           (uni_asciiClass(&input) & UNI_PRINTABLE))
+  {
+    result = likeMatchAscii(pLike, &input);
   }
   else {
-    util_setError(pCtx, rc);
+    result = likeMatch(pLike, &input);
   }
+  sqlite3_result_int(pCtx, result ? 1 : 0);
+  /* this has to come last, since SQLite is free to destroy the new pattern
+  ** before sqlite3_set_auxdata() even returns */
+  if (pNew) sqlite3_set_auxdata(pCtx, 0, pNew, sqlite3_free);
 }
 
 /* set_case_sensitive_like(B) function */
@@ -155,10 +561,8 @@ void setLikeFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
 
   assert(argc == 1);
   if (sqlite3_value_type(argv[0]) == SQLITE_NULL) {
-    sqlite3_mutex_enter(LikeMutex);
     pState = (LikeState*)sqlite3_user_data(pCtx);
-    result = *pState->pNoCase ? 0 : 1;
-    sqlite3_mutex_leave(LikeMutex);
+    result = Volatile::Read(*pState->pNoCase) ? 0 : 1;
     sqlite3_result_int(pCtx, result);
     return;
   }
@@ -180,23 +584,20 @@ void setLikeFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   else {
     return; /* result NULL on unrecognized option */
   }
-  sqlite3_mutex_enter(LikeMutex);
   pState = (LikeState*)sqlite3_user_data(pCtx);
-  result = *pState->pNoCase ? 0 : 1;
-  *pState->pNoCase = noCase;
-  sqlite3_mutex_leave(LikeMutex);
+  result = Interlocked::Exchange(*pState->pNoCase, noCase ? 1 : 0) ? 0 : 1;
   sqlite3_result_int(pCtx, result);
 }
 #endif /* !UTILEXT_OMIT_LIKE */
 
 /* charindex[_i](S,P[,I]) function */
+template<bool isWide, bool noCase>
 void charindexFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   DbStr input;
   DbStr pattern;
+  DbStr tail;
   int index;
-  int mode;
-  bool isWide;
-  bool noCase;
+  int start;
   int result;
   int rc;
 
@@ -217,78 +618,256 @@ void charindexFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   else {
     index = 1;
   }
-  mode = util_getData(pCtx);
-  isWide = ((mode & UTF16_ENC) == 1);
-  noCase = ((mode & NOCASE) == NOCASE);
-  util_getText(argv[0], isWide, &input);
-  util_getText(argv[1], isWide, &pattern);
-  rc = StrEx::CharIndex(&input, &pattern, index, noCase, &result);
+  getText<isWide>(argv[0], &input);
+  getText<isWide>(argv[1], &pattern);
+  /* Seek to the starting character natively, so that nothing before it has
+  ** to be decoded; the search only sees the rest of the input. */
+  start = 0;
+  if (index > 1) {
+    start = uni_graphemeOffset(&input, index - 1);
+    if (start == input.cb) {
+      sqlite3_result_error_code(pCtx, ERR_INDEX);
+      return;
+    }
+  }
+  tail.pText = (const u8*)input.pText + start;
+  tail.cb = input.cb - start;
+  tail.isWide = isWide;
+  if (Com::AsciiOrdinal && (!noCase || Com::AsciiCasing) &&
+      (uni_asciiClass(&tail) & UNI_PRINTABLE) &&
+      (uni_asciiClass(&pattern) & UNI_PRINTABLE))
+  {
+    /* code unit indexes are character indexes */
+    result = uni_asciiFind(&tail, &pattern, 0, noCase);
+    sqlite3_result_int(pCtx, result < 0 ? 0 : result + index);
+    return;
+  }
+  rc = StrEx::CharIndex(&tail, &pattern, noCase, &result);
   if (rc == RESULT_OK) {
-    sqlite3_result_int(pCtx, result);
+    sqlite3_result_int(pCtx, result < 0 ? 0 : result + index);
   }
   else {
     util_setError(pCtx, rc);
   }
 }
 
-/* exfilter[_i](S,M) SQL function */
-void exfilterFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
+/* Character sets for exfilter[_i]() and infilter[_i]()
+**
+** The match string is compiled into the set of grapheme clusters that it
+** holds, once per statement, and kept as auxdata along with a copy of the
+** string. Clusters that are a single ASCII character are looked up in a
+** bitmap; anything else goes through a hash table of the clusters in the match
+** string, which are compared byte-wise or, when case is ignored, by their full
+** case folding. The bitmap is filled in by looking up each ASCII character in
+** the hash table, so that 'k' is a member when case is ignored and the match
+** string has a KELVIN SIGN.
+**
+** Filtering the input only has to find the cluster boundaries, which for ASCII
+** text is every code unit, except for the one in front of a non-ASCII code
+** unit (it might be followed by a combining mark) and CR/LF pairs. The runs of
+** ASCII text are found 16 bytes at a time.
+*/
+struct CharSetEntry {
+  u32 hash;   /* hash of the cluster, or of its folding       */
+  int iOff;   /* byte offset of the cluster in the match text */
+  int cb;     /* count of bytes in the cluster, zero if empty */
+};
+
+struct CharSet {
+  bool isWide;           /* true if the text is UTF-16              */
+  bool noCase;           /* true if case is ignored                 */
+  bool turkic;           /* true to use the Turkic case folding     */
+  int cbMatch;           /* count of bytes in zMatch                */
+  const u8 *zMatch;      /* copy of the match string                */
+  u32 aAscii[4];         /* bitmap of the ASCII members             */
+  int mask;              /* count of hash table slots, less one     */
+  CharSetEntry *aSlot;   /* hash table of all of the members        */
+};
+
+/* Gets the slot for a cluster in the hash table, and writes the hash of the
+** cluster to 'pHash'; the slot is empty if the cluster isn't a member of the
+** set. The table isn't changed, so that a set in auxdata can be shared; it is
+** up to the caller to fill in an empty slot. */
+static CharSetEntry *charsetSlot(const CharSet *p, const u8 *z, int cb,
+                                 u32 *pHash)
+{
+  DbStr key = { z, cb, p->isWide };
+  u32 h = uni_hash(&key, p->noCase, p->turkic);
+  int i = (int)(h & (u32)p->mask);
+  *pHash = h;
+  for (;; i = (i + 1) & p->mask) {
+    CharSetEntry *pEntry = &p->aSlot[i];
+    if (pEntry->cb == 0) return pEntry;
+    if (pEntry->hash == h) {
+      DbStr member = { p->zMatch + pEntry->iOff, pEntry->cb, p->isWide };
+      if (p->noCase ? uni_foldEqual(&key, &member, p->turkic) :
+                      (cb == pEntry->cb &&
+                       memcmp(z, member.pText, (size_t)cb) == 0))
+      {
+        return pEntry;
+      }
+    }
+  }
+}
+
+/* Returns true if a cluster is a member of the set */
+static bool charsetHas(const CharSet *p, const u8 *z, int cb) {
+  u32 h;
+  return charsetSlot(p, z, cb, &h)->cb != 0;
+}
+
+/* Compiles a match string into a set; returns NULL if out of memory */
+static CharSet *charsetCompile(const DbStr *pMatch, bool noCase) {
+  GraphemeIter iter;
+  CharSet *p;
+  int nSlot = 16;
+  int nMember = uni_graphemeCount(pMatch);
+  int unit = pMatch->isWide ? 2 : 1;
+  u8 *zMatch;
+
+  while (nSlot < nMember * 2) nSlot *= 2;
+  p = (CharSet*)sqlite3_malloc((int)sizeof(*p) +
+                               nSlot * (int)sizeof(CharSetEntry) +
+                               pMatch->cb + 2);
+  if (!p) return nullptr;
+  memset(p, 0, sizeof(*p) + nSlot * sizeof(CharSetEntry));
+  p->isWide = pMatch->isWide;
+  p->noCase = noCase;
+  p->turkic = noCase && Com::TurkicCasing;
+  p->cbMatch = pMatch->cb;
+  p->mask = nSlot - 1;
+  p->aSlot = (CharSetEntry*)&p[1];
+  zMatch = (u8*)&p->aSlot[nSlot];
+  memcpy(zMatch, pMatch->pText, (size_t)pMatch->cb);
+  p->zMatch = zMatch;
+  uni_iterInit(&iter, pMatch);
+  while (uni_nextGrapheme(&iter)) {
+    u32 h;
+    CharSetEntry *pEntry = charsetSlot(p, zMatch + iter.iStart,
+                                       iter.iEnd - iter.iStart, &h);
+    if (pEntry->cb == 0) {
+      pEntry->hash = h;
+      pEntry->iOff = iter.iStart;
+      pEntry->cb = iter.iEnd - iter.iStart;
+    }
+  }
+  for (u32 c = 0; c < 0x80; c++) {
+    u8 z[2] = { 0, 0 };
+    /* one code unit in native byte order, as SQLite hands it to us */
+    if (p->isWide) {
+      u16 w = (u16)c;
+      memcpy(z, &w, 2);
+    }
+    else {
+      z[0] = (u8)c;
+    }
+    if (charsetHas(p, z, unit)) p->aAscii[c >> 5] |= 1u << (c & 31);
+  }
+  return p;
+}
+
+/* Returns true if a compiled set can be used for a match string */
+static bool charsetReusable(const CharSet *p, const DbStr *pMatch,
+                            bool noCase)
+{
+  return p->isWide == pMatch->isWide && p->noCase == noCase &&
+         p->turkic == (noCase && Com::TurkicCasing) &&
+         p->cbMatch == pMatch->cb &&
+         memcmp(p->zMatch, pMatch->pText, (size_t)pMatch->cb) == 0;
+}
+
+/* Implements exfilter[_i]() and infilter[_i](); keeps the clusters of the
+** input that are members of the match set if 'keep' is true, or that aren't,
+** if it's false. */
+template<bool isWide, bool noCase, bool keep>
+static void filterFunc(sqlite3_context *pCtx, sqlite3_value **argv) {
+  typedef typename std::conditional<isWide, u16, u8>::type Unit;
   DbStr source;
   DbStr match;
-  DbStr result;
-  int mode;
-  bool isWide;
-  bool noCase;
-  int rc;
+  DbStr tail;
+  GraphemeIter iter;
+  CharSet *pSet;
+  CharSet *pNew = nullptr;
+  const Unit *zIn;
+  u8 *zOut;
+  const int unit = sizeof(Unit);
+  int n;
+  int nOut = 0;
+  int i = 0;
 
-  assert(argc == 2);
-  CHECK_ARGS_NULL(2);
-  mode = util_getData(pCtx);
-  isWide = ((mode & UTF16_ENC) == 1);
-  noCase = ((mode & NOCASE) == NOCASE);
-  util_getText(argv[0], isWide, &source);
-  util_getText(argv[1], isWide, &match);
-  rc = StrEx::ExFilter(&source, &match, noCase, &result);
-  if (rc == RESULT_OK) {
-    util_setText(pCtx, &result);
+  getText<isWide>(argv[0], &source);
+  getText<isWide>(argv[1], &match);
+  if (source.cb == 0) {
+    setTextN<isWide>(pCtx, source.pText, 0, SQLITE_TRANSIENT);
+    return;
   }
-  else {
-    util_setError(pCtx, rc);
+  pSet = (CharSet*)sqlite3_get_auxdata(pCtx, 1);
+  if (!pSet || !charsetReusable(pSet, &match, noCase)) {
+    pSet = pNew = charsetCompile(&match, noCase);
+    if (!pSet) {
+      sqlite3_result_error_nomem(pCtx);
+      return;
+    }
+  }
+  zOut = (u8*)sqlite3_malloc(source.cb);
+  if (!zOut) {
+    sqlite3_free(pNew);
+    sqlite3_result_error_nomem(pCtx);
+    return;
   }
+  zIn = (const Unit*)source.pText;
+  n = source.cb / unit;
+  while (i < n) {
+    int end = i + uni_asciiSpan(&source, i);
+    /* the last ASCII character in front of a non-ASCII one may be the start
+    ** of a longer cluster, so it goes the long way */
+    int stop = (end < n) ? end - 1 : end;
+    for (; i < stop; i++) {
+      u32 c = zIn[i];
+      if (c == '\r') break; /* might be a CR/LF pair */
+      if (((pSet->aAscii[c >> 5] >> (c & 31)) & 1) == (keep ? 1u : 0u)) {
+        memcpy(zOut + nOut, zIn + i, (size_t)unit);
+        nOut += unit;
+      }
+    }
+    if (i >= n) break;
+    tail.pText = zIn + i;
+    tail.cb = source.cb - i * unit;
+    tail.isWide = isWide;
+    uni_iterInit(&iter, &tail);
+    uni_nextGrapheme(&iter);
+    if (charsetHas(pSet, (const u8*)tail.pText, iter.iEnd) == keep) {
+      memcpy(zOut + nOut, tail.pText, (size_t)iter.iEnd);
+      nOut += iter.iEnd;
+    }
+    i += iter.iEnd / unit;
+  }
+  setTextN<isWide>(pCtx, zOut, nOut, sqlite3_free);
+  if (pNew) sqlite3_set_auxdata(pCtx, 1, pNew, sqlite3_free);
+}
+
+/* exfilter[_i](S,M) SQL function */
+template<bool isWide, bool noCase>
+void exfilterFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
+  assert(argc == 2);
+  CHECK_ARGS_NULL(2);
+  filterFunc<isWide, noCase, false>(pCtx, argv);
 }
 
 /* infilter[_i](S,M) SQL function */
+template<bool isWide, bool noCase>
 void infilterFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
-  DbStr source;
-  DbStr match;
-  DbStr result;
-  int mode;
-  bool isWide;
-  bool noCase;
-  int rc;
-
   assert(argc == 2);
   CHECK_ARGS_NULL(2);
-  mode = util_getData(pCtx);
-  isWide = ((mode & UTF16_ENC) == 1);
-  noCase = ((mode & NOCASE) == NOCASE);
-  util_getText(argv[0], isWide, &source);
-  util_getText(argv[1], isWide, &match);
-  rc = StrEx::InFilter(&source, &match, noCase, &result);
-  if (rc == RESULT_OK) {
-    util_setText(pCtx, &result);
-  }
-  else {
-    util_setError(pCtx, rc);
-  }
+  filterFunc<isWide, noCase, true>(pCtx, argv);
 }
 
 /* leftstr(S,N) SQL function */
+template<bool isWide>
 void leftFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   DbStr input;
-  DbStr result;
   int count;
-  int rc;
+  int cb;
 
   assert(argc == 2);
   CHECK_ARGS_NULL(1);
@@ -301,17 +880,42 @@ void leftFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
     sqlite3_result_error_code(pCtx, SQLITE_MISUSE);
     return;
   }
-  util_getText(argv[0], util_getEnc16(pCtx), &input);
-  rc = StrEx::LeftString(&input, count, &result);
-  if (rc == RESULT_OK) {
-    util_setText(pCtx, &result);
+  getText<isWide>(argv[0], &input);
+  cb = uni_graphemeOffset(&input, count);
+  setTextN<isWide>(pCtx, input.pText, cb, SQLITE_TRANSIENT);
+}
+
+/* Case-maps ASCII text one code unit at a time. Returns false, without
+** setting a result, if the text isn't ASCII or the culture has its own ideas
+** about ASCII letters (the Turkish 'i', for instance). */
+template<bool isWide>
+static bool caseMapAscii(sqlite3_context *pCtx, DbStr *pIn, bool upper) {
+  u8 *zOut;
+  u8 first = upper ? 'a' : 'A';
+  u8 last = upper ? 'z' : 'Z';
+
+  if (!Com::AsciiCasing || !(uni_asciiClass(pIn) & UNI_ASCII)) return false;
+  if (pIn->cb == 0) {
+    setTextN<isWide>(pCtx, pIn->pText, 0, SQLITE_TRANSIENT);
+    return true;
   }
-  else {
-    util_setError(pCtx, rc);
+  zOut = (u8*)sqlite3_malloc(pIn->cb);
+  if (!zOut) {
+    sqlite3_result_error_nomem(pCtx);
+    return true;
+  }
+  memcpy(zOut, pIn->pText, (size_t)pIn->cb);
+  /* for UTF-16 the high byte of every code unit is zero, so we only ever
+  ** need to touch the low bytes */
+  for (int i = 0; i < pIn->cb; i++) {
+    if (zOut[i] >= first && zOut[i] <= last) zOut[i] ^= 0x20;
   }
+  setTextN<isWide>(pCtx, zOut, pIn->cb, sqlite3_free);
+  return true;
 }
 
 /* lower(S) function */
+template<bool isWide>
 void lowerFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   DbStr input;
   DbStr result;
@@ -319,7 +923,8 @@ void lowerFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
 
   assert(argc == 1);
   CHECK_ARGS_NULL(1);
-  util_getText(argv[0], util_getEnc16(pCtx), &input);
+  getText<isWide>(argv[0], &input);
+  if (caseMapAscii<isWide>(pCtx, &input, false)) return;
   rc = StrEx::UpperLower(&input, false, &result);
   if (rc == RESULT_OK) {
     util_setText(pCtx, &result);
@@ -329,141 +934,200 @@ void lowerFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   }
 }
 
-/* padcenter(S,N) function */
-void padcFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
-  DbStr input;
-  DbStr result;
-  int iLen;
-  int rc;
+#define PAD_LEFT    1
+#define PAD_RIGHT   2
+#define PAD_CENTER  (PAD_LEFT | PAD_RIGHT)
 
-  assert(argc == 2);
-  CHECK_ARGS_NULL(1);
-  if (sqlite3_value_type(argv[1]) == SQLITE_NULL) {
-    sqlite3_result_value(pCtx, argv[0]);
-    return;
+/* Checks that a result of 'cb' bytes isn't over the length limit of the
+** database connection, and sets the error result if it is */
+static bool checkLength(sqlite3_context *pCtx, i64 cb) {
+  sqlite3 *db = sqlite3_context_db_handle(pCtx);
+  if (cb > sqlite3_limit(db, SQLITE_LIMIT_LENGTH, -1)) {
+    sqlite3_result_error_toobig(pCtx);
+    return false;
   }
-  iLen = sqlite3_value_int(argv[1]);
-  if (iLen < 0) {
-    sqlite3_result_error_code(pCtx, SQLITE_MISUSE);
-    return;
-  }
-  util_getText(argv[0], util_getEnc16(pCtx), &input);
-  rc = StrEx::PadCenter(&input, iLen, &result);
-  if (rc == RESULT_OK) {
-    util_setText(pCtx, &result);
-  }
-  else {
-    util_setError(pCtx, rc);
+  return true;
+}
+
+/* Checks that a result of 'cbFixed' bytes plus 'n' pieces of 'cbPiece' bytes
+** each isn't over the length limit, without working out the product, which
+** can overflow; sets the error result if it is over */
+static bool checkLengthN(sqlite3_context *pCtx, i64 cbFixed, i64 n,
+                         i64 cbPiece)
+{
+  sqlite3 *db = sqlite3_context_db_handle(pCtx);
+  i64 limit = sqlite3_limit(db, SQLITE_LIMIT_LENGTH, -1);
+  if (cbFixed > limit || n > (limit - cbFixed) / cbPiece) {
+    sqlite3_result_error_toobig(pCtx);
+    return false;
   }
+  return true;
 }
 
-/* padleft(S,N) function */
-void padlFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
+/* Implements padleft(), padright(), and padcenter(). The length of the result
+** is known up front, so the spaces and the input are written straight into
+** one buffer. */
+template<bool isWide>
+static void padFunc(sqlite3_context *pCtx, sqlite3_value **argv, int side) {
+  typedef typename std::conditional<isWide, u16, u8>::type Unit;
   DbStr input;
-  DbStr result;
-  int iLen;
-  int rc;
+  i64 len;
+  i64 nPad;
+  i64 nLeft;
+  const int unit = sizeof(Unit);
+  const Unit space = ' ';
+  int cb;
+  u8 *zOut;
+  u8 *z;
 
-  assert(argc == 2);
   CHECK_ARGS_NULL(1);
   if (sqlite3_value_type(argv[1]) == SQLITE_NULL) {
     sqlite3_result_value(pCtx, argv[0]);
     return;
   }
-  iLen = sqlite3_value_int(argv[1]);
-  if (iLen < 0) {
+  len = sqlite3_value_int64(argv[1]);
+  if (len < 0) {
     sqlite3_result_error_code(pCtx, SQLITE_MISUSE);
     return;
   }
-  util_getText(argv[0], util_getEnc16(pCtx), &input);
-  rc = StrEx::PadLeft(&input, iLen, &result);
-  if (rc == RESULT_OK) {
-    util_setText(pCtx, &result);
+  getText<isWide>(argv[0], &input);
+  nPad = len - uni_graphemeCount(&input);
+  if (nPad <= 0) {
+    setTextN<isWide>(pCtx, input.pText, input.cb, SQLITE_TRANSIENT);
+    return;
   }
-  else {
-    util_setError(pCtx, rc);
+  if (!checkLengthN(pCtx, input.cb, nPad, unit)) return;
+  cb = input.cb + (int)(nPad * unit);
+  zOut = (u8*)sqlite3_malloc(cb);
+  if (!zOut) {
+    sqlite3_result_error_nomem(pCtx);
+    return;
+  }
+  nLeft = (side == PAD_LEFT) ? nPad : (side == PAD_RIGHT) ? 0 : nPad / 2;
+  z = zOut;
+  for (i64 i = 0; i < nPad; i++) {
+    if (i == nLeft) {
+      memcpy(z, input.pText, (size_t)input.cb);
+      z += input.cb;
+    }
+    memcpy(z, &space, (size_t)unit);
+    z += unit;
   }
+  if (nLeft == nPad) memcpy(z, input.pText, (size_t)input.cb);
+  setTextN<isWide>(pCtx, zOut, cb, sqlite3_free);
+}
+
+/* padcenter(S,N) function */
+template<bool isWide>
+void padcFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
+  assert(argc == 2);
+  padFunc<isWide>(pCtx, argv, PAD_CENTER);
+}
+
+/* padleft(S,N) function */
+template<bool isWide>
+void padlFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
+  assert(argc == 2);
+  padFunc<isWide>(pCtx, argv, PAD_LEFT);
 }
 
 /* padright(S,N) SQL function */
+template<bool isWide>
 void padrFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
-  DbStr input;
-  DbStr result;
-  int iLen;
-  int rc;
-
   assert(argc == 2);
-  CHECK_ARGS_NULL(1);
-  if (sqlite3_value_type(argv[1]) == SQLITE_NULL) {
-    sqlite3_result_value(pCtx, argv[0]);
-    return;
-  }
-  iLen = sqlite3_value_int(argv[1]);
-  if (iLen < 0) {
-    sqlite3_result_error_code(pCtx, SQLITE_MISUSE);
-    return;
-  }
-  util_getText(argv[0], util_getEnc16(pCtx), &input);
-  rc = StrEx::PadRight(&input, iLen, &result);
-  if (rc == RESULT_OK) {
-    util_setText(pCtx, &result);
-  }
-  else {
-    util_setError(pCtx, rc);
-  }
+  padFunc<isWide>(pCtx, argv, PAD_RIGHT);
 }
 
 /* replicate(S,N) SQL function */
+template<bool isWide>
 void replicateFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   DbStr input;
-  DbStr result;
-  int count;
-  int rc;
+  i64 count;
+  int cb;
+  int cbDone;
+  u8 *zOut;
 
   assert(argc == 2);
   CHECK_ARGS_NULL(2);
-  count = sqlite3_value_int(argv[1]);
+  count = sqlite3_value_int64(argv[1]);
   if (count < 0) {
     sqlite3_result_error_code(pCtx, SQLITE_MISUSE);
     return;
   }
-  util_getText(argv[0], util_getEnc16(pCtx), &input);
-  if (input.cb == 0) {
-    count = 0;
+  getText<isWide>(argv[0], &input);
+  if (input.cb == 0 || count == 0) {
+    setTextN<isWide>(pCtx, input.pText, 0, SQLITE_TRANSIENT);
+    return;
   }
-  rc = StrEx::Replicate(&input, count, &result);
-  if (rc == RESULT_OK) {
-    util_setText(pCtx, &result);
+  if (!checkLengthN(pCtx, 0, count, input.cb)) return;
+  cb = (int)(input.cb * count);
+  zOut = (u8*)sqlite3_malloc(cb);
+  if (!zOut) {
+    sqlite3_result_error_nomem(pCtx);
+    return;
   }
-  else {
-    util_setError(pCtx, rc);
+  /* copy the input once, then keep doubling what has been copied so far */
+  memcpy(zOut, input.pText, (size_t)input.cb);
+  cbDone = input.cb;
+  while (cbDone < cb) {
+    int n = (cbDone < cb - cbDone) ? cbDone : cb - cbDone;
+    memcpy(zOut + cbDone, zOut, (size_t)n);
+    cbDone += n;
   }
+  setTextN<isWide>(pCtx, zOut, cb, sqlite3_free);
 }
 
 /* reverse(S) function */
+template<bool isWide>
 void reverseFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
+  typedef typename std::conditional<isWide, u16, u8>::type Unit;
   DbStr input;
-  DbStr result;
-  int rc;
+  GraphemeIter iter;
+  const u8 *zIn;
+  u8 *zOut;
 
   assert(argc == 1);
   CHECK_ARGS_NULL(1);
-  util_getText(argv[0], util_getEnc16(pCtx), &input);
-  rc = StrEx::Reverse(&input, &result);
-  if (rc == RESULT_OK) {
-    util_setText(pCtx, &result);
+  getText<isWide>(argv[0], &input);
+  if (input.cb == 0) {
+    setTextN<isWide>(pCtx, input.pText, 0, SQLITE_TRANSIENT);
+    return;
   }
-  else {
-    util_setError(pCtx, rc);
+  zOut = (u8*)sqlite3_malloc(input.cb);
+  if (!zOut) {
+    sqlite3_result_error_nomem(pCtx);
+    return;
   }
+  /* each cluster goes to the mirror image of its position in the input, so
+  ** the bytes within a cluster keep their order */
+  zIn = (const u8*)input.pText;
+  if (uni_asciiClass(&input) & UNI_PRINTABLE) {
+    /* one character per code unit */
+    const Unit *pIn = (const Unit*)zIn;
+    Unit *pOut = (Unit*)zOut;
+    int n = input.cb / (int)sizeof(Unit);
+    for (int i = 0; i < n; i++) {
+      pOut[n - 1 - i] = pIn[i];
+    }
+    setTextN<isWide>(pCtx, zOut, input.cb, sqlite3_free);
+    return;
+  }
+  uni_iterInit(&iter, &input);
+  while (uni_nextGrapheme(&iter)) {
+    memcpy(zOut + input.cb - iter.iEnd,
+           zIn + iter.iStart,
+           (size_t)(iter.iEnd - iter.iStart));
+  }
+  setTextN<isWide>(pCtx, zOut, input.cb, sqlite3_free);
 }
 
 /* rightstr(S,N) function */
+template<bool isWide>
 void rightFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   DbStr input;
-  DbStr result;
   int count;
-  int rc;
+  int total;
+  int iStart;
 
   assert(argc == 2);
   CHECK_ARGS_NULL(1);
@@ -476,14 +1140,15 @@ void rightFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
     sqlite3_result_error_code(pCtx, SQLITE_MISUSE);
     return;
   }
-  util_getText(argv[0], util_getEnc16(pCtx), &input);
-  rc = StrEx::RightString(&input, count, &result);
-  if (rc == RESULT_OK) {
-    util_setText(pCtx, &result);
-  }
-  else {
-    util_setError(pCtx, rc);
-  }
+  getText<isWide>(argv[0], &input);
+  /* Clusters can only be found reliably going forward, so count them first
+  ** and then skip over the ones that aren't wanted. */
+  total = uni_graphemeCount(&input);
+  iStart = (count >= total) ? 0 : uni_graphemeOffset(&input, total - count);
+  setTextN<isWide>(pCtx,
+                   (const u8*)input.pText + iStart,
+                   input.cb - iStart,
+                   SQLITE_TRANSIENT);
 }
 
 /* set_culture(L) SQL function */
@@ -508,12 +1173,16 @@ void cultureFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   }
 }
 
-/* str_concat(S,...) function */
+/* str_concat(S,...) function. The total length of the result is known once
+** we have the byte counts of the arguments, so the pieces are copied straight
+** into a single buffer; there is no need to decode anything. */
+template<bool isWide>
 void strcatFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
-  DbStr *aValues;
-  DbStr result;
-  int rc;
-  bool isWide;
+  DbStr sep;
+  DbStr value;
+  i64 cb = 0;
+  u8 *zOut;
+  int nOut = 0;
   int n = 0; /* count of non-null args besides separator */
 
   if (argc < 3) {
@@ -524,35 +1193,215 @@ void strcatFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
     sqlite3_result_error_code(pCtx, SQLITE_MISUSE);
     return;
   }
-  aValues = (DbStr*)malloc(sizeof(*aValues) * argc);
-  if (!aValues) {
-    sqlite3_result_error_nomem(pCtx);
-    return;
-  }
-  isWide = util_getEnc16(pCtx);
   /* get the separator first */
-  util_getText(argv[0], isWide, aValues);
+  getText<isWide>(argv[0], &sep);
   for (int i = 1; i < argc; i++) {
     if (sqlite3_value_type(argv[i]) != SQLITE_NULL) {
+      getText<isWide>(argv[i], &value);
+      cb += (n > 0) ? sep.cb + value.cb : value.cb;
       n++;
-      util_getText(argv[i], isWide, aValues + n);
     }
   }
   if (n == 0) {
-    free(aValues);
     sqlite3_result_null(pCtx);
     return;
   }
-  rc = StrEx::Join(n + 1, aValues, &result);
-  if (rc == RESULT_OK) {
-    util_setText(pCtx, &result);
+  if (!checkLength(pCtx, cb)) return;
+  zOut = (u8*)sqlite3_malloc((int)cb + 1);
+  if (!zOut) {
+    sqlite3_result_error_nomem(pCtx);
+    return;
+  }
+  /* the separator goes in front of every value after the first one */
+  n = 0;
+  for (int i = 1; i < argc; i++) {
+    if (sqlite3_value_type(argv[i]) == SQLITE_NULL) continue;
+    getText<isWide>(argv[i], &value);
+    if (n++ > 0) {
+      memcpy(zOut + nOut, sep.pText, (size_t)sep.cb);
+      nOut += sep.cb;
+    }
+    memcpy(zOut + nOut, value.pText, (size_t)value.cb);
+    nOut += value.cb;
+  }
+  setTextN<isWide>(pCtx, zOut, nOut, sqlite3_free);
+}
+
+/* One row of the str_concat() aggregate: the separator and the value are
+** stored back to back in the buffer, in that order. */
+struct ConcatRow {
+  int cbSep;
+  int cbValue;
+};
+
+/* Aggregate context for the str_concat() aggregate function. The rows in the
+** current frame occupy the bytes from iStart up to iEnd in the buffer; the
+** separator of the first row is not part of the result. Rows leave the frame
+** from the front, so xInverse() only has to move iStart and iHead along. */
+struct ConcatAgg {
+  u8 *pBuf;         /* buffer that holds the separators and values */
+  i64 cbAlloc;      /* allocated size of pBuf                      */
+  i64 iStart;       /* offset of the first row in pBuf             */
+  i64 iEnd;         /* offset just past the last row in pBuf       */
+  ConcatRow *aRow;  /* byte counts of the rows in the buffer       */
+  int nAlloc;       /* allocated size of aRow                      */
+  int iHead;        /* index of the first row in aRow              */
+  int nRow;         /* count of rows in the current frame          */
+  bool isError;     /* true if xStep() has set an error            */
+};
+
+/* Makes room for a row of 'cb' bytes at the end of the aggregate buffer. The
+** rows that have left the frame are dropped before we grow anything. */
+static bool concatReserve(ConcatAgg *pAgg, i64 cb) {
+  if (pAgg->iHead > 0 && pAgg->iHead + pAgg->nRow == pAgg->nAlloc) {
+    memmove(pAgg->aRow, pAgg->aRow + pAgg->iHead,
+            sizeof(*pAgg->aRow) * pAgg->nRow);
+    pAgg->iHead = 0;
+  }
+  if (pAgg->nRow == pAgg->nAlloc) {
+    int nNew = pAgg->nAlloc ? pAgg->nAlloc * 2 : 16;
+    ConcatRow *aNew = (ConcatRow*)sqlite3_realloc64(pAgg->aRow,
+                                                    sizeof(*aNew) * nNew);
+    if (!aNew) return false;
+    pAgg->aRow = aNew;
+    pAgg->nAlloc = nNew;
+  }
+  if (pAgg->iEnd + cb > pAgg->cbAlloc && pAgg->iStart > 0) {
+    memmove(pAgg->pBuf, pAgg->pBuf + pAgg->iStart,
+            (size_t)(pAgg->iEnd - pAgg->iStart));
+    pAgg->iEnd -= pAgg->iStart;
+    pAgg->iStart = 0;
+  }
+  if (!pAgg->pBuf || pAgg->iEnd + cb > pAgg->cbAlloc) {
+    i64 cbNew = pAgg->cbAlloc ? pAgg->cbAlloc * 2 : 256;
+    u8 *pNew;
+    while (cbNew < pAgg->iEnd + cb) cbNew *= 2;
+    pNew = (u8*)sqlite3_realloc64(pAgg->pBuf, (sqlite3_uint64)cbNew);
+    if (!pNew) return false;
+    pAgg->pBuf = pNew;
+    pAgg->cbAlloc = cbNew;
+  }
+  return true;
+}
+
+/* Returns the offset of the result in the aggregate buffer, and sets the byte
+** count of the result in 'pcb' */
+static i64 concatResult(ConcatAgg *pAgg, int *pcb) {
+  i64 iFirst = pAgg->iStart + pAgg->aRow[pAgg->iHead].cbSep;
+  *pcb = (int)(pAgg->iEnd - iFirst);
+  return iFirst;
+}
+
+/* str_concat(S,sep) aggregate function */
+void concatStep(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
+  DbStr value;
+  DbStr sep;
+  bool isWide;
+  ConcatAgg *pAgg;
+  ConcatRow *pRow;
+
+  assert(argc == 2);
+  pAgg = (ConcatAgg*)sqlite3_aggregate_context(pCtx, sizeof(*pAgg));
+  if (!pAgg) {
+    sqlite3_result_error_nomem(pCtx);
+    return;
+  }
+  if (pAgg->isError) return;
+  if (sqlite3_value_type(argv[1]) == SQLITE_NULL) {
+    pAgg->isError = true; /* flag an error state for the call to xFinal() */
+    sqlite3_result_error_code(pCtx, SQLITE_MISUSE);
+    return;
+  }
+  if (sqlite3_value_type(argv[0]) == SQLITE_NULL) return;
+  isWide = util_getEnc16(pCtx);
+  util_getText(argv[0], isWide, &value);
+  util_getText(argv[1], isWide, &sep);
+  if (pAgg->nRow > 0) {
+    i64 cb = pAgg->iEnd - pAgg->iStart - pAgg->aRow[pAgg->iHead].cbSep;
+    if (!checkLength(pCtx, cb + sep.cb + value.cb)) {
+      pAgg->isError = true;
+      return;
+    }
+  }
+  if (!concatReserve(pAgg, (i64)sep.cb + value.cb)) {
+    pAgg->isError = true;
+    sqlite3_result_error_nomem(pCtx);
+    return;
+  }
+  memcpy(pAgg->pBuf + pAgg->iEnd, sep.pText, (size_t)sep.cb);
+  pAgg->iEnd += sep.cb;
+  memcpy(pAgg->pBuf + pAgg->iEnd, value.pText, (size_t)value.cb);
+  pAgg->iEnd += value.cb;
+  pRow = pAgg->aRow + pAgg->iHead + pAgg->nRow++;
+  pRow->cbSep = sep.cb;
+  pRow->cbValue = value.cb;
+}
+
+/* xInverse() function for the str_concat() aggregate function. */
+void concatInv(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
+  ConcatAgg *pAgg;
+  ConcatRow *pRow;
+
+  assert(argc == 2);
+  pAgg = (ConcatAgg*)sqlite3_aggregate_context(pCtx, sizeof(*pAgg));
+  if (!pAgg || pAgg->isError) return;
+  /* NULL values were never added, so there is nothing to take out */
+  if (sqlite3_value_type(argv[0]) == SQLITE_NULL) return;
+  assert(pAgg->nRow > 0);
+  pRow = pAgg->aRow + pAgg->iHead;
+  pAgg->iStart += (i64)pRow->cbSep + pRow->cbValue;
+  pAgg->iHead++;
+  if (--pAgg->nRow == 0) {
+    pAgg->iStart = pAgg->iEnd = 0;
+    pAgg->iHead = 0;
+  }
+}
+
+/* The xValue() function for the str_concat() aggregate function. */
+void concatValue(sqlite3_context *pCtx) {
+  ConcatAgg *pAgg = (ConcatAgg*)sqlite3_aggregate_context(pCtx, sizeof(*pAgg));
+  i64 iFirst;
+  int cb;
+
+  if (!pAgg || pAgg->isError) return;
+  if (pAgg->nRow == 0) {
+    sqlite3_result_null(pCtx);
+    return;
+  }
+  iFirst = concatResult(pAgg, &cb);
+  util_setTextN(pCtx, pAgg->pBuf + iFirst, cb, util_getEnc16(pCtx),
+                SQLITE_TRANSIENT);
+}
+
+/* The xFinal() function for the str_concat() aggregate function. The buffer
+** is handed over to SQLite, rather than copied. */
+void concatFinal(sqlite3_context *pCtx) {
+  ConcatAgg *pAgg = (ConcatAgg*)sqlite3_aggregate_context(pCtx, 0);
+  i64 iFirst;
+  int cb;
+
+  if (!pAgg) {
+    sqlite3_result_null(pCtx);
+    return;
+  }
+  if (pAgg->isError) {
+    /* the error result has already been set by xStep() */
+  }
+  else if (pAgg->nRow == 0) {
+    sqlite3_result_null(pCtx);
   }
   else {
-    util_setError(pCtx, rc);
+    iFirst = concatResult(pAgg, &cb);
+    if (iFirst > 0) memmove(pAgg->pBuf, pAgg->pBuf + iFirst, (size_t)cb);
+    util_setTextN(pCtx, pAgg->pBuf, cb, util_getEnc16(pCtx), sqlite3_free);
+    pAgg->pBuf = NULL;
   }
+  sqlite3_free(pAgg->pBuf);
+  sqlite3_free(pAgg->aRow);
 }
 
 /* upper(S) function */
+template<bool isWide>
 void upperFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   DbStr input;
   DbStr result;
@@ -560,7 +1409,8 @@ void upperFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
 
   assert(argc == 1);
   CHECK_ARGS_NULL(1);
-  util_getText(argv[0], util_getEnc16(pCtx), &input);
+  getText<isWide>(argv[0], &input);
+  if (caseMapAscii<isWide>(pCtx, &input, true)) return;
   rc = StrEx::UpperLower(&input, true, &result);
   if (rc == RESULT_OK) {
     util_setText(pCtx, &result);
@@ -570,6 +1420,267 @@ void upperFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   }
 }
 
+/* Sort keys for the 'utf[_i]' collations
+**
+** A culture-aware comparison has to decode both strings into managed Strings
+** and run the culture's comparison rules over them, every time. A sort key
+** does that work once: comparing two keys byte-wise gives the same answer as
+** comparing the strings through the culture. The utf_sortkey() function hands
+** the key to SQL, so it can be stored in an index, and the collations keep the
+** keys of the strings they have seen most recently in a small per-connection
+** cache, since a sort or a GROUP BY compares each string many times.
+**
+** The cache is direct-mapped on a hash of the string bytes. If a sort is
+** thrashing the cache (all distinct strings, say), the keys cost more than
+** they save, so the collation stops using the cache for a while and goes
+** straight to the culture comparison. The sorter can call a collation from
+** its worker threads, so the cache is guarded by a mutex; a thread that can't
+** get the mutex right away just does the comparison the long way.
+*/
+#define SORTKEY_SLOTS   1024  /* cache size; must be a power of two       */
+#define SORTKEY_SAMPLE  256   /* lookups between checks of the hit rate   */
+#define SORTKEY_BYPASS  4096  /* comparisons to skip when thrashing       */
+
+/* A cached sort key; the string bytes follow the struct, then the key */
+struct SortKeyEntry {
+  u32 hash;   /* hash of the string bytes    */
+  int cbText; /* count of bytes in the string */
+  int cbKey;  /* count of bytes in the key    */
+};
+
+struct CollateState {
+  int mode;              /* UTF16_ENC and NOCASE flags                */
+  sqlite3_mutex *mutex;  /* guards the rest of the state, or NULL     */
+  int version;           /* culture version that the keys belong to   */
+  int nLookup;           /* lookups since the hit rate was checked    */
+  int nMiss;             /* misses since the hit rate was checked     */
+  int nBypass;           /* comparisons left before using the cache   */
+  SortKeyEntry *aSlot[SORTKEY_SLOTS];
+};
+
+#define SORTKEY_TEXT(E) ((const u8*)&(E)[1])
+#define SORTKEY_KEY(E) (SORTKEY_TEXT(E) + (E)->cbText)
+
+/* Gets the cached sort key for a string, computing it on a miss, and writes
+** the index of its slot to 'piSlot'. Returns NULL if the key can't be computed.
+** The cache mutex must be held. */
+static SortKeyEntry *sortKeyGet(CollateState *p, const DbStr *pStr,
+                                int *piSlot)
+{
+  u32 h = uni_hash(pStr, false, false);
+  SortKeyEntry **ppSlot = &p->aSlot[*piSlot = (int)(h & (SORTKEY_SLOTS - 1))];
+  SortKeyEntry *pEntry = *ppSlot;
+  void *pKey;
+  int cbKey;
+
+  p->nLookup++;
+  if (pEntry && pEntry->hash == h && pEntry->cbText == pStr->cb &&
+      memcmp(SORTKEY_TEXT(pEntry), pStr->pText, (size_t)pStr->cb) == 0)
+  {
+    return pEntry;
+  }
+  p->nMiss++;
+  if (StrEx::SortKey((DbStr*)pStr, (p->mode & NOCASE) != 0, &pKey, &cbKey)) {
+    return nullptr;
+  }
+  pEntry = (SortKeyEntry*)sqlite3_malloc(
+                              (int)sizeof(*pEntry) + pStr->cb + cbKey);
+  if (pEntry) {
+    pEntry->hash = h;
+    pEntry->cbText = pStr->cb;
+    pEntry->cbKey = cbKey;
+    memcpy((void*)SORTKEY_TEXT(pEntry), pStr->pText, (size_t)pStr->cb);
+    memcpy((void*)SORTKEY_KEY(pEntry), pKey, (size_t)cbKey);
+    sqlite3_free(*ppSlot);
+    *ppSlot = pEntry;
+  }
+  free(pKey);
+  return pEntry;
+}
+
+/* Compares two byte strings the way memcmp() does, with a shorter string that
+** is a prefix of the longer one sorting first */
+static int compareBytes(const u8 *zLeft, int cbLeft,
+                        const u8 *zRight, int cbRight)
+{
+  int cb = cbLeft < cbRight ? cbLeft : cbRight;
+  int rc = memcmp(zLeft, zRight, (size_t)cb);
+  return rc != 0 ? rc : cbLeft - cbRight;
+}
+
+/* Compares two strings by their cached sort keys. Returns false if the cache
+** is busy, bypassed, or out of memory, in which case the caller has to do the
+** comparison itself. */
+static bool sortKeyCompare(CollateState *p, const DbStr *pLeft,
+                           const DbStr *pRight, int *pResult)
+{
+  SortKeyEntry *pLeftKey;
+  SortKeyEntry *pRightKey;
+  int iLeft;
+  int iRight;
+  bool found = false;
+
+  if (sqlite3_mutex_try(p->mutex) != SQLITE_OK) return false;
+  if (p->version != Com::CultureVersion) {
+    for (int i = 0; i < SORTKEY_SLOTS; i++) {
+      sqlite3_free(p->aSlot[i]);
+      p->aSlot[i] = nullptr;
+    }
+    p->version = Com::CultureVersion;
+    p->nBypass = 0;
+  }
+  if (p->nBypass > 0) {
+    p->nBypass--;
+  }
+  else {
+    pLeftKey = sortKeyGet(p, pLeft, &iLeft);
+    pRightKey = pLeftKey ? sortKeyGet(p, pRight, &iRight) : nullptr;
+    /* if both strings hash to the same slot, the right key has evicted the
+    ** left one */
+    if (pRightKey && iLeft != iRight) {
+      *pResult = compareBytes(SORTKEY_KEY(pLeftKey), pLeftKey->cbKey,
+                              SORTKEY_KEY(pRightKey), pRightKey->cbKey);
+      found = true;
+    }
+    if (p->nLookup >= SORTKEY_SAMPLE) {
+      if (p->nMiss * 2 > p->nLookup) p->nBypass = SORTKEY_BYPASS;
+      p->nLookup = p->nMiss = 0;
+    }
+  }
+  sqlite3_mutex_leave(p->mutex);
+  return found;
+}
+
+/* Allocate the state for one of the 'utf[_i]' collations */
+CollateState *allocCollateState(int mode) {
+  CollateState *p = (CollateState*)sqlite3_malloc((int)sizeof(*p));
+  if (!p) return nullptr;
+  memset(p, 0, sizeof(*p));
+  p->mode = mode;
+  p->version = Com::CultureVersion;
+  if (sqlite3_threadsafe()) {
+    p->mutex = sqlite3_mutex_alloc(SQLITE_MUTEX_FAST);
+    if (!p->mutex) {
+      sqlite3_free(p);
+      return nullptr;
+    }
+  }
+  return p;
+}
+
+/* Release the state of a 'utf[_i]' collation, along with its cached keys */
+void destroyCollateState(void *ps) {
+  CollateState *p = (CollateState*)ps;
+  for (int i = 0; i < SORTKEY_SLOTS; i++) {
+    sqlite3_free(p->aSlot[i]);
+  }
+  sqlite3_mutex_free(p->mutex);
+  sqlite3_free(p);
+}
+
+/* utf_sortkey(S[,N]) function */
+template<bool isWide>
+void sortkeyFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
+  DbStr input;
+  void *pKey;
+  int cbKey;
+  bool noCase = false;
+  int rc;
+
+  assert(argc == 1 || argc == 2);
+  CHECK_ARGS_NULL(1);
+  if (argc == 2) noCase = sqlite3_value_int(argv[1]) != 0;
+  getText<isWide>(argv[0], &input);
+  rc = StrEx::SortKey(&input, noCase, &pKey, &cbKey);
+  if (rc == RESULT_OK) {
+    sqlite3_result_blob(pCtx, pKey, cbKey, free);
+  }
+  else {
+    util_setError(pCtx, rc);
+  }
+}
+
+/* Returns true if the code unit at index 'i' of a string of 'n' units is
+** ASCII, or is past the end of the string */
+template<typename Unit>
+static bool collateAsciiAt(const Unit *z, int i, int n) {
+  return i >= n || z[i] < 0x80;
+}
+
+/* Compares two strings as far as their ASCII prefixes allow, without calling
+** the culture. Returns true if that decides the comparison, with the result in
+** 'pResult'. Otherwise, writes to 'piCut' the count of leading code units that
+** are the same in both strings (ignoring ASCII case, if case is ignored), and
+** that sort the same no matter what follows them; the culture only has to
+** compare what is left.
+**
+** This relies on the current culture not treating any run of ASCII characters
+** as a single sort element (Com::AsciiOrdinal). A shared prefix then adds the
+** same weights to both strings, as long as it ends between two ASCII
+** characters, since a non-ASCII character might be a combining mark that
+** belongs with the one before it. After the prefix, a letter or digit with a
+** different primary weight from the one in the other string decides the
+** comparison, whatever comes after it; so does a letter or digit in one
+** string when the other string has ended. */
+template<bool isWide, bool noCase>
+static bool collateAscii(const DbStr *pLeft, const DbStr *pRight,
+                         int *piCut, int *pResult)
+{
+  typedef typename std::conditional<isWide, u16, u8>::type Unit;
+  const u8 *aRank = Com::AsciiRank;
+  const Unit *zLeft = (const Unit*)pLeft->pText;
+  const Unit *zRight = (const Unit*)pRight->pText;
+  bool fold = noCase && Com::AsciiCasing;
+  int nLeft = pLeft->cb / (int)sizeof(Unit);
+  int nRight = pRight->cb / (int)sizeof(Unit);
+  int i = 0;
+  u32 a = 0;
+  u32 b = 0;
+
+  *piCut = 0;
+  if (!Com::AsciiOrdinal) return false;
+  while (i < nLeft && i < nRight) {
+    a = zLeft[i];
+    b = zRight[i];
+    if (a >= 0x80 || b >= 0x80) break;
+    if (a != b && !(fold && ASCII_FOLD(a) == ASCII_FOLD(b))) break;
+    i++;
+  }
+  if (i == nLeft && i == nRight) {
+    /* only reached when case is ignored; identical strings were checked */
+    *pResult = 0;
+    return true;
+  }
+  if (collateAsciiAt(zLeft, i, nLeft) && collateAsciiAt(zRight, i, nRight)) {
+    if (collateAsciiAt(zLeft, i + 1, nLeft) &&
+        collateAsciiAt(zRight, i + 1, nRight))
+    {
+      /* when one string has ended, 'a' and 'b' are still the last code units
+      ** that matched, so look at the one that follows in the other string */
+      if (i == nLeft && aRank[zRight[i]]) {
+        *pResult = -1;
+        return true;
+      }
+      if (i == nRight && aRank[zLeft[i]]) {
+        *pResult = 1;
+        return true;
+      }
+      if (i < nLeft && i < nRight && aRank[a] && aRank[b] &&
+          aRank[a] != aRank[b])
+      {
+        *pResult = aRank[a] < aRank[b] ? -1 : 1;
+        return true;
+      }
+    }
+    *piCut = i;
+  }
+  else if (i > 0) {
+    /* the non-ASCII character may belong to the one before it */
+    *piCut = i - 1;
+  }
+  return false;
+}
+
 /* Implements the 'utf[_i]' collation sequence
 ** SQL Usage: COLLATE UTF[_I]
 **
@@ -578,31 +1689,98 @@ void upperFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
 **
 ** [comparison] - case sensitive or not, depending on version called
 */
-int utfCollate(void *pMode,
+template<bool isWide, bool noCase>
+int utfCollate(void *pState,
                int cbLeft,
                const void *pLeft,
                int cbRight,
                const void *pRight)
 {
   /* As with the decimal collation, we let the managed method do all the work
-  ** and assume the correct answer; we just return the result to SQLite */
-  int mode;
-  bool isWide;
-  bool noCase;
+  ** and assume the correct answer; we just return the result to SQLite. The
+  ** exceptions are when the strings are known to be equal, which is common
+  ** enough for GROUP BY, DISTINCT, and joins to be worth checking first, when
+  ** the ASCII text at the start of the strings decides the order, and when
+  ** the sort keys of both strings are in the cache. Otherwise, the managed
+  ** method only gets the parts of the strings that follow the prefix that
+  ** they have in common. Strings with the same case folding are NOT taken to
+  ** be equal here: the culture may still order them (U+017F and 's', for one),
+  ** and a collation that disagrees with itself isn't transitive. */
+  CollateState *p = (CollateState*)pState;
+  int result;
+  int iCut;
   DbStr lhs;
   DbStr rhs;
+  DbStr lhsTail;
+  DbStr rhsTail;
 
   assert(pLeft && pRight); /* SQLite will sort the NULLs before hand */
-  mode = PTR_TO_INT(pMode);
-  isWide = ((mode & UTF16_ENC) == 1);
-  noCase = ((mode & NOCASE) == NOCASE);
+  assert(p->mode == ((isWide ? UTF16_ENC : UTF8_ENC) | (noCase ? NOCASE : 0)));
   lhs.pText = pLeft;
   lhs.cb = cbLeft;
   lhs.isWide = isWide;
   rhs.pText = pRight;
   rhs.cb = cbRight;
   rhs.isWide = isWide;
-  return StrEx::UtfCollate(&lhs, &rhs, noCase);
+  if (cbLeft == cbRight && memcmp(pLeft, pRight, (size_t)cbLeft) == 0) {
+    return 0;
+  }
+  if (collateAscii<isWide, noCase>(&lhs, &rhs, &iCut, &result)) return result;
+  if (isWide) iCut *= 2;
+  lhsTail.pText = (const u8*)pLeft + iCut;
+  lhsTail.cb = cbLeft - iCut;
+  lhsTail.isWide = isWide;
+  rhsTail.pText = (const u8*)pRight + iCut;
+  rhsTail.cb = cbRight - iCut;
+  rhsTail.isWide = isWide;
+  if (sortKeyCompare(p, &lhs, &rhs, &result)) return result;
+  return StrEx::UtfCollate(&lhsTail, &rhsTail, noCase);
 }
 
+/* The entry points that are registered in "utilext.c", one for each encoding
+** (and case sensitivity) */
+#define XFUNC_ARGS sqlite3_context*, int, sqlite3_value**
+template void charindexFunc<false, false>(XFUNC_ARGS);
+template void charindexFunc<false, true>(XFUNC_ARGS);
+template void charindexFunc<true, false>(XFUNC_ARGS);
+template void charindexFunc<true, true>(XFUNC_ARGS);
+template void exfilterFunc<false, false>(XFUNC_ARGS);
+template void exfilterFunc<false, true>(XFUNC_ARGS);
+template void exfilterFunc<true, false>(XFUNC_ARGS);
+template void exfilterFunc<true, true>(XFUNC_ARGS);
+template void infilterFunc<false, false>(XFUNC_ARGS);
+template void infilterFunc<false, true>(XFUNC_ARGS);
+template void infilterFunc<true, false>(XFUNC_ARGS);
+template void infilterFunc<true, true>(XFUNC_ARGS);
+template void leftFunc<false>(XFUNC_ARGS);
+template void leftFunc<true>(XFUNC_ARGS);
+template void lowerFunc<false>(XFUNC_ARGS);
+template void lowerFunc<true>(XFUNC_ARGS);
+template void padcFunc<false>(XFUNC_ARGS);
+template void padcFunc<true>(XFUNC_ARGS);
+template void padlFunc<false>(XFUNC_ARGS);
+template void padlFunc<true>(XFUNC_ARGS);
+template void padrFunc<false>(XFUNC_ARGS);
+template void padrFunc<true>(XFUNC_ARGS);
+template void replicateFunc<false>(XFUNC_ARGS);
+template void replicateFunc<true>(XFUNC_ARGS);
+template void reverseFunc<false>(XFUNC_ARGS);
+template void reverseFunc<true>(XFUNC_ARGS);
+template void rightFunc<false>(XFUNC_ARGS);
+template void rightFunc<true>(XFUNC_ARGS);
+template void strcatFunc<false>(XFUNC_ARGS);
+template void strcatFunc<true>(XFUNC_ARGS);
+template void upperFunc<false>(XFUNC_ARGS);
+template void upperFunc<true>(XFUNC_ARGS);
+template void sortkeyFunc<false>(XFUNC_ARGS);
+template void sortkeyFunc<true>(XFUNC_ARGS);
+#undef XFUNC_ARGS
+
+#define XCOMPARE_ARGS void*, int, const void*, int, const void*
+template int utfCollate<false, false>(XCOMPARE_ARGS);
+template int utfCollate<false, true>(XCOMPARE_ARGS);
+template int utfCollate<true, false>(XCOMPARE_ARGS);
+template int utfCollate<true, true>(XCOMPARE_ARGS);
+#undef XCOMPARE_ARGS
+
 #endif /* !UTILEXT_OMIT_STRING */
\ No newline at end of file
@@ -10,7 +10,8 @@
  *
  * Most of these functions are very "boilerplate-ish", since they are really
  * just wrappers that fixup the data for consumption by their managed
- * counterparts, and return the result to SQLite.
+ * counterparts, and return the result to SQLite. The timespan_str() function
+ * is formatted entirely in native code, since it's just integer arithmetic.
  *
  * We could probably reduce the LOC count significantly with clever use of
  * macros, but we find that such things invariably result in more pain than
@@ -194,21 +195,136 @@ void timeSubFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   sqlite3_result_int64(pCtx, lhs);
 }
 
-/* timespan_str(V) function */
-void timeStrFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
-  int rc;
-  i64 time;
-  DbStr result;
+/* TimeSpan tick counts for each unit */
+#define TICKS_PER_DAY    864000000000ULL
+#define TICKS_PER_HOUR   36000000000ULL
+#define TICKS_PER_MINUTE 600000000ULL
+#define TICKS_PER_SECOND 10000000ULL
+
+/* Formats for timespan_str() */
+#define TIME_FMT_CONST 0   /* [-][d.]hh:mm:ss[.fffffff]  "c" */
+#define TIME_FMT_SHORT 1   /* [-][d:]h:mm:ss[.FFFFFFF]   "g" */
+#define TIME_FMT_ISO   2   /* [-]P[nD][T[nH][nM][n[.F]S]] "iso" */
+
+/* Writes the decimal digits of 'v' to 'z', zero-padded to 'width' digits,
+** and returns the number of characters written. */
+static int putNum(char *z, u64 v, int width) {
+  char buf[20];
+  int n = 0;
+  do {
+    buf[n++] = (char)('0' + v % 10);
+    v /= 10;
+  } while (v);
+  while (n < width) buf[n++] = '0';
+  for (int i = 0; i < n; i++) z[i] = buf[n - 1 - i];
+  return n;
+}
 
-  assert(argc == 1);
+/* Writes the fractional seconds of 'ticks' to 'z' with a leading '.', either
+** as all 7 digits, or with trailing zeros trimmed; nothing is written if the
+** fraction is zero. Returns the number of characters written. */
+static int putFraction(char *z, u64 ticks, bool trim) {
+  int n;
+  if (ticks == 0) return 0;
+  z[0] = '.';
+  n = 1 + putNum(z + 1, ticks, 7);
+  if (trim) {
+    while (z[n - 1] == '0') n--;
+  }
+  return n;
+}
+
+/* Formats a TimeSpan tick count as ASCII text in 'z', which must hold at least
+** 32 characters, and returns the length. This matches the output of the .NET
+** TimeSpan.ToString() method for the "c" and "g" formats, except that "g"
+** always uses '.' as the decimal separator. */
+static int formatTimespan(char *z, i64 time, int fmt) {
+  int n = 0;
+  u64 ticks = time < 0 ? 0 - (u64)time : (u64)time;
+  u64 d = ticks / TICKS_PER_DAY;
+  u64 h = ticks % TICKS_PER_DAY / TICKS_PER_HOUR;
+  u64 m = ticks % TICKS_PER_HOUR / TICKS_PER_MINUTE;
+  u64 s = ticks % TICKS_PER_MINUTE / TICKS_PER_SECOND;
+  u64 f = ticks % TICKS_PER_SECOND;
+
+  if (time < 0) z[n++] = '-';
+  switch (fmt) {
+    case TIME_FMT_CONST:
+    case TIME_FMT_SHORT:
+      if (d) {
+        n += putNum(z + n, d, 0);
+        z[n++] = (fmt == TIME_FMT_CONST) ? '.' : ':';
+      }
+      n += putNum(z + n, h, (fmt == TIME_FMT_CONST) ? 2 : 0);
+      z[n++] = ':';
+      n += putNum(z + n, m, 2);
+      z[n++] = ':';
+      n += putNum(z + n, s, 2);
+      n += putFraction(z + n, f, fmt == TIME_FMT_SHORT);
+      break;
+    case TIME_FMT_ISO:
+      z[n++] = 'P';
+      if (d) {
+        n += putNum(z + n, d, 0);
+        z[n++] = 'D';
+      }
+      if (h || m || s || f || !d) {
+        z[n++] = 'T';
+        if (h) {
+          n += putNum(z + n, h, 0);
+          z[n++] = 'H';
+        }
+        if (m) {
+          n += putNum(z + n, m, 0);
+          z[n++] = 'M';
+        }
+        if (s || f || !(d || h || m)) {
+          n += putNum(z + n, s, 0);
+          n += putFraction(z + n, f, true);
+          z[n++] = 'S';
+        }
+      }
+      break;
+  }
+  return n;
+}
+
+/* timespan_str(V[,F]) function */
+void timeStrFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
+  char zBuf[32];
+  u16 aBuf[32];
+  const char *zFmt;
+  int cbFmt;
+  int fmt = TIME_FMT_CONST;
+  int n;
+
+  assert(argc == 1 || argc == 2);
   CHECK_ARGS_NULL(1);
-  time = sqlite3_value_int64(argv[0]);
-  rc = TimeEx::TimespanStr(time, util_getEnc16(pCtx), &result);
-  if (rc == RESULT_OK) {
-    util_setText(pCtx, &result);
+  if (argc == 2 && sqlite3_value_type(argv[1]) != SQLITE_NULL) {
+    zFmt = util_getAscii(argv[1], &cbFmt);
+    if (cbFmt == 1 && zFmt[0] == 'c') {
+      fmt = TIME_FMT_CONST;
+    }
+    else if (cbFmt == 1 && zFmt[0] == 'g') {
+      fmt = TIME_FMT_SHORT;
+    }
+    else if (sqlite3_stricmp(zFmt, "iso") == 0) {
+      fmt = TIME_FMT_ISO;
+    }
+    else {
+      sqlite3_result_error_code(pCtx, ERR_TIME_FORMAT);
+      return;
+    }
+  }
+  /* The result is pure ASCII and never more than a couple of dozen characters,
+  ** so format it on the stack and let SQLite take its copy. */
+  n = formatTimespan(zBuf, sqlite3_value_int64(argv[0]), fmt);
+  if (util_getEnc16(pCtx)) {
+    for (int i = 0; i < n; i++) aBuf[i] = (u16)zBuf[i];
+    sqlite3_result_text16(pCtx, aBuf, n * 2, SQLITE_TRANSIENT);
   }
   else {
-    util_setError(pCtx, rc);
+    sqlite3_result_text(pCtx, zBuf, n, SQLITE_TRANSIENT);
   }
 }
 
@@ -246,14 +362,20 @@ void timeCmpFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   sqlite3_result_int(pCtx, result);
 }
 
-/* timespan_addto(D,V) function */
+/* timespan_addto(D,V[,Z]) function */
 void timeAddToFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   DbDate startDate;
   DbDate result;
+  DbStr zone;
+  DbStr *pZone = NULL;
   int rc = 0;
 
-  assert(argc == 2);
+  assert(argc == 2 || argc == 3);
   CHECK_ARGS_NULL(2);
+  if (argc == 3 && sqlite3_value_type(argv[2]) != SQLITE_NULL) {
+    util_getText(argv[2], util_getEnc16(pCtx), &zone);
+    pZone = &zone;
+  }
   int t = sqlite3_value_type(argv[0]);
   switch (t) {
     case SQLITE_INTEGER:
@@ -270,7 +392,8 @@ void timeAddToFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
       return;
   }
   startDate.type = t;
-  rc = TimeEx::TimespanAddTo(sqlite3_value_int64(argv[1]), &startDate, &result);
+  rc = TimeEx::TimespanAddTo(sqlite3_value_int64(argv[1]), &startDate, pZone,
+                             &result);
   if (rc == RESULT_OK) {
     switch (t) {
       case SQLITE_INTEGER:
@@ -289,7 +412,7 @@ void timeAddToFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   }
 }
 
-/* timespan_diff(D1,D2) function */
+/* timespan_diff(D1,D2[,Z]) function */
 void timeDiffFunc(sqlite3_context *pCtx, int argc, sqlite3_value ** argv) {
   int rc;
   bool isWide;
@@ -297,8 +420,10 @@ void timeDiffFunc(sqlite3_context *pCtx, int argc, sqlite3_value ** argv) {
   int t;
   DbDate d1;
   DbDate d2;
+  DbStr zone;
+  DbStr *pZone = NULL;
 
-  assert(argc == 2);
+  assert(argc == 2 || argc == 3);
   CHECK_ARGS_NULL(2);
   if ((t = sqlite3_value_type(argv[0])) != SQLITE_BLOB) {
     d1.type = t;
@@ -337,7 +462,11 @@ void timeDiffFunc(sqlite3_context *pCtx, int argc, sqlite3_value ** argv) {
       util_getText(argv[1], isWide, &d2.iso);
       break;
   }
-  rc = TimeEx::TimespanDiff(&d1, &d2, &result);
+  if (argc == 3 && sqlite3_value_type(argv[2]) != SQLITE_NULL) {
+    util_getText(argv[2], isWide, &zone);
+    pZone = &zone;
+  }
+  rc = TimeEx::TimespanDiff(&d1, &d2, pZone, &result);
   if (rc == RESULT_OK) {
     sqlite3_result_int64(pCtx, result);
   }
@@ -348,7 +477,6 @@ void timeDiffFunc(sqlite3_context *pCtx, int argc, sqlite3_value ** argv) {
 
 /* xStep() for timespan_total(V) */
 void timeTotStep(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
-  i64 sum;
   SumCtx *pAgg;
 
   assert(argc == 1);
@@ -358,25 +486,22 @@ void timeTotStep(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
     sqlite3_result_error_nomem(pCtx);
     return;
   }
-  sum = pAgg->sum;
-  if (util_addCheck64(&sum, sqlite3_value_int64(argv[0]))) {
-    pAgg->overflow = true;
-    sqlite3_result_error_code(pCtx, SQLITE_TOOBIG);
-  }
-  pAgg->sum = sum;
+  /* The 128-bit sum can't overflow, so range checking is left until we have
+  ** to produce a value. */
+  util_add128(&pAgg->sum, sqlite3_value_int64(argv[0]));
 }
 
 /* xFinal() function for the timespan_total() */
 void timeTotFinal(sqlite3_context *pCtx) {
-  /* No rows if pAgg is NULL; if overflow has occurred, the error is already
-  ** thrown from the 'step()' call */
+  i64 result = 0;
+
+  /* No rows if pAgg is NULL */
   SumCtx *pAgg = (SumCtx*)sqlite3_aggregate_context(pCtx, 0);
-  if (pAgg) {
-    if (!pAgg->overflow) sqlite3_result_int64(pCtx, pAgg->sum);
-  }
-  else {
-    sqlite3_result_int64(pCtx, 0);
+  if (pAgg && util_get128(&pAgg->sum, &result)) {
+    sqlite3_result_error_code(pCtx, SQLITE_TOOBIG);
+    return;
   }
+  sqlite3_result_int64(pCtx, result);
 }
 
 /* xInverse() function for the timespan_total() */
@@ -386,20 +511,25 @@ void timeTotInv(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   assert(argc == 1);
   CHECK_ARGS_NULL(1);
   SumCtx *pAgg = (SumCtx*)sqlite3_aggregate_context(pCtx, sizeof(*pAgg));
-  pAgg->sum -= sqlite3_value_int64(argv[0]);
+  util_sub128(&pAgg->sum, sqlite3_value_int64(argv[0]));
 }
 
 /* xValue() function for the timespan_total() */
 void timeTotVal(sqlite3_context *pCtx) {
-  /* If we overflowed at any point, the error is raised then, so just return
-  ** the current value. */
+  i64 result;
+
+  /* The current frame may be out of range even though the frames before it
+  ** were not (and the frames after it may be in range again). */
   SumCtx *pAgg = (SumCtx*)sqlite3_aggregate_context(pCtx, sizeof(*pAgg));
-  sqlite3_result_int64(pCtx, pAgg->sum);
+  if (util_get128(&pAgg->sum, &result)) {
+    sqlite3_result_error_code(pCtx, SQLITE_TOOBIG);
+    return;
+  }
+  sqlite3_result_int64(pCtx, result);
 }
 
 /* xStep() for timespan_avg(V) */
 void timeAvgStep(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
-  i64 sum;
   SumCtx *pAgg;
 
   assert(argc == 1);
@@ -409,30 +539,18 @@ void timeAvgStep(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
     sqlite3_result_error_nomem(pCtx);
     return;
   }
-  sum = pAgg->sum;
-  if (util_addCheck64(&sum, sqlite3_value_int64(argv[0]))) {
-    pAgg->overflow = true;
-    sqlite3_result_error_code(pCtx, SQLITE_TOOBIG);
-    return;
-  }
+  util_add128(&pAgg->sum, sqlite3_value_int64(argv[0]));
   pAgg->cnt++;
-  pAgg->sum = sum;
 }
 
 /* xFinal() function for the timespan_avg() */
 void timeAvgFinal(sqlite3_context *pCtx) {
+  /* The average of signed long integers is always in range, so there is no
+  ** overflow to check for; no rows if pAgg is NULL (or if the count has been
+  ** inverted back to zero). */
   SumCtx *pAgg = (SumCtx*)sqlite3_aggregate_context(pCtx, 0);
-  if (pAgg) {
-    if (!pAgg->overflow) {
-      i64 temp = pAgg->sum;
-      if (temp < 0) {
-        temp = -((i64)((u64)(-temp) / pAgg->cnt));
-      }
-      else {
-        temp = (i64)((u64)(temp) / pAgg->cnt);
-      }
-      sqlite3_result_int64(pCtx, temp);
-    }
+  if (pAgg && pAgg->cnt > 0) {
+    sqlite3_result_int64(pCtx, util_avg128(&pAgg->sum, pAgg->cnt));
   }
   else {
     sqlite3_result_int64(pCtx, 0);
@@ -445,20 +563,18 @@ void timeAvgInv(sqlite3_context *pCtx, int argc, sqlite3_value **argv) {
   CHECK_ARGS_NULL(1);
   SumCtx *pAgg = (SumCtx*)sqlite3_aggregate_context(pCtx, sizeof(*pAgg));
   pAgg->cnt--;
-  pAgg->sum -= sqlite3_value_int64(argv[0]);
+  util_sub128(&pAgg->sum, sqlite3_value_int64(argv[0]));
 }
 
 /* xValue() function for the timespan_avg() */
 void timeAvgVal(sqlite3_context *pCtx) {
   SumCtx *pAgg = (SumCtx*)sqlite3_aggregate_context(pCtx, sizeof(*pAgg));
-  i64 temp = pAgg->sum;
-  if (temp < 0) {
-    temp = -((i64)((u64)(-temp) / pAgg->cnt));
+  if (pAgg->cnt > 0) {
+    sqlite3_result_int64(pCtx, util_avg128(&pAgg->sum, pAgg->cnt));
   }
   else {
-    temp = (i64)((u64)(temp) / pAgg->cnt);
+    sqlite3_result_int64(pCtx, 0);
   }
-  sqlite3_result_int64(pCtx,temp);
 }
 
 
@@ -0,0 +1,233 @@
+#===============================================================================
+#
+# Written by: Mark Benningfield
+#
+# LICENSE: Public Domain -- see the file LICENSE.txt
+#
+#===============================================================================
+#
+# This script generates the "unidata.h" header file that holds the Unicode
+# property tables used by the native text routines in "unicode.c".
+#
+# Usage: tclsh mkunidata.tcl UCD-DIR
+#
+# UCD-DIR is a directory that holds the following files from the Unicode
+# Character Database (https://www.unicode.org/Public/<version>/ucd/):
+#
+#   GraphemeBreakProperty.txt   (from the 'auxiliary' folder)
+#   emoji-data.txt              (from the 'emoji' folder)
+#   DerivedGeneralCategory.txt  (from the 'extracted' folder)
+#   CaseFolding.txt
+#
+# The tables are emitted as constexpr arrays, so the header is only regenerated
+# when we move to a new version of Unicode; the output is written to the parent
+# folder, same as the README file from "makedoc.tcl".
+#
+# The Grapheme_Cluster_Break table is an inversion map: each entry holds the
+# first code point of a run in the upper 24 bits, and the property value of the
+# run in the low 8 bits. A run extends up to the first code point of the next
+# entry. The Extended_Pictographic property is folded into the same table as
+# its own value, since none of those code points has a Grapheme_Cluster_Break
+# value other than 'Other'. The Hangul LV and LVT syllables are left out
+# altogether, since they alternate every 28 code points and are easily
+# computed from the code point value.
+#
+# The General_Category table is an inversion map in the same format, which the
+# native regex engine uses for the \d, \w, \s, and \p{..} character classes.
+# Unassigned code points get the default value of 'Cn'.
+#
+# The case folding tables are sorted by code point, for a binary search. The
+# common (status C) mappings are shared by the simple and full foldings, and
+# are all one-to-one; the full (status F) mappings expand to two or three code
+# points. The simple-only (status S) mappings get a table of their own, since
+# only the simple folding used by the regex engine needs them. The Turkic
+# (status T) mappings for dotted and dotless I get a table of their own, since
+# they replace the default mappings for the Turkish and Azeri cultures.
+#
+#===============================================================================
+
+if {$argc != 1} {
+  puts stderr "usage: tclsh mkunidata.tcl UCD-DIR"
+  exit 1
+}
+set ucdDir [lindex $argv 0]
+
+# These names and values must match the GCB_xxx defines in "unicode.h"
+set GcbNames {
+  Other               GCB_Other
+  CR                  GCB_CR
+  LF                  GCB_LF
+  Control             GCB_Control
+  Extend              GCB_Extend
+  ZWJ                 GCB_ZWJ
+  Regional_Indicator  GCB_RI
+  Prepend             GCB_Prepend
+  SpacingMark         GCB_SpacingMark
+  L                   GCB_L
+  V                   GCB_V
+  T                   GCB_T
+  Extended_Pictographic GCB_ExtPict
+}
+
+# These names and values must match the GC_xxx defines in "unicode.h"
+set GcNames {
+  Cn GC_Cn  Lu GC_Lu  Ll GC_Ll  Lt GC_Lt  Lm GC_Lm  Lo GC_Lo
+  Mn GC_Mn  Mc GC_Mc  Me GC_Me  Nd GC_Nd  Nl GC_Nl  No GC_No
+  Pc GC_Pc  Pd GC_Pd  Ps GC_Ps  Pe GC_Pe  Pi GC_Pi  Pf GC_Pf
+  Po GC_Po  Sm GC_Sm  Sc GC_Sc  Sk GC_Sk  So GC_So  Zs GC_Zs
+  Zl GC_Zl  Zp GC_Zp  Cc GC_Cc  Cf GC_Cf  Cs GC_Cs  Co GC_Co
+}
+
+# Reads a UCD property file and returns a list of {first last value} triples
+# for the lines whose property value is in 'names'.
+proc readRanges {path names} {
+  set result {}
+  set fd [open $path r]
+  while {[gets $fd line] >= 0} {
+    set line [string trim [lindex [split $line #] 0]]
+    if {$line eq ""} continue
+    if {![regexp {^([0-9A-F]+)(?:\.\.([0-9A-F]+))?\s*;\s*(\w+)} $line -> lo hi value]} {
+      error "unrecognized line in $path: $line"
+    }
+    if {![dict exists $names $value]} continue
+    if {$hi eq ""} {set hi $lo}
+    lappend result [list [expr {"0x$lo"}] [expr {"0x$hi"}] [dict get $names $value]]
+  }
+  close $fd
+  return $result
+}
+
+# Converts a list of non-overlapping ranges into an inversion map, filling the
+# gaps with 'default' and merging adjacent runs with the same value.
+proc makeRuns {ranges default} {
+  set runs {}
+  set next 0
+  set prev ""
+  foreach r [lsort -integer -index 0 $ranges] {
+    lassign $r lo hi value
+    if {$lo < $next} {
+      error [format "overlapping range at U+%04X" $lo]
+    }
+    if {$lo > $next && $prev ne $default} {
+      lappend runs [list $next $default]
+      set prev $default
+    }
+    if {$value ne $prev} {
+      lappend runs [list $lo $value]
+      set prev $value
+    }
+    set next [expr {$hi + 1}]
+  }
+  if {$next <= 0x10FFFF && $prev ne $default} {
+    lappend runs [list $next $default]
+  }
+  return $runs
+}
+
+# Reads "CaseFolding.txt" and returns a dict of status -> list of mappings,
+# where each mapping is a list of the code point and its folded code points.
+proc readFolds {path} {
+  set result [dict create C {} F {} S {} T {}]
+  set fd [open $path r]
+  while {[gets $fd line] >= 0} {
+    set line [string trim [lindex [split $line #] 0]]
+    if {$line eq ""} continue
+    if {![regexp {^([0-9A-F]+);\s*([CFST]);\s*([0-9A-F ]+);} $line -> code status map]} {
+      error "unrecognized line in $path: $line"
+    }
+    set item [list [expr {"0x$code"}]]
+    foreach c $map {lappend item [expr {"0x$c"}]}
+    dict lappend result $status $item
+  }
+  close $fd
+  return $result
+}
+
+proc emitFolds {fd name width folds} {
+  set n [llength $folds]
+  puts $fd "constexpr u32 ${name}\[\]\[$width\] = {"
+  set items {}
+  foreach f [lsort -integer -index 0 $folds] {
+    while {[llength $f] < $width} {lappend f 0}
+    set hex {}
+    foreach c $f {lappend hex [format 0x%04X $c]}
+    lappend items "{[join $hex {, }]}"
+  }
+  set perLine [expr {$width == 2 ? 3 : 2}]
+  for {set i 0} {$i < $n} {incr i $perLine} {
+    set line "  [join [lrange $items $i [expr {$i + $perLine - 1}]] {, }]"
+    if {$i + $perLine < $n} {append line ,}
+    puts $fd $line
+  }
+  puts $fd "};"
+}
+
+proc emitRuns {fd name macro runs} {
+  puts $fd "constexpr u32 ${name}\[\] = {"
+  set items {}
+  foreach r $runs {
+    lassign $r lo value
+    lappend items [format "%s(0x%04X, %s)" $macro $lo $value]
+  }
+  set n [llength $items]
+  for {set i 0} {$i < $n} {incr i 2} {
+    set line "  [join [lrange $items $i [expr {$i + 1}]] {, }]"
+    if {$i + 2 < $n} {append line ,}
+    puts $fd $line
+  }
+  puts $fd "};"
+}
+
+# The first line of each UCD file names the file and the Unicode version
+set fd [open [file join $ucdDir GraphemeBreakProperty.txt] r]
+if {![regexp {(\d+\.\d+\.\d+)} [gets $fd] -> ucdVersion]} {
+  error "no Unicode version in GraphemeBreakProperty.txt"
+}
+close $fd
+
+set gcb [readRanges [file join $ucdDir GraphemeBreakProperty.txt] $GcbNames]
+set ext [readRanges [file join $ucdDir emoji-data.txt] $GcbNames]
+set gcbRuns [makeRuns [concat $gcb $ext] GCB_Other]
+set gcRuns [makeRuns [readRanges [file join $ucdDir DerivedGeneralCategory.txt] $GcNames] GC_Cn]
+set folds [readFolds [file join $ucdDir CaseFolding.txt]]
+
+set fd [open [file join .. unidata.h] w]
+fconfigure $fd -translation lf
+puts $fd [string map [list UCD_VERSION $ucdVersion] {/*==============================================================================
+ *
+ * Written by: Mark Benningfield
+ *
+ * LICENSE: Public Domain -- see the file LICENSE.txt
+ *
+ *==============================================================================
+ *
+ * Unicode property tables for the native text routines.
+ *
+ * This file is generated by "tools/mkunidata.tcl" from the Unicode Character
+ * Database, version UCD_VERSION; don't edit it by hand.
+ *
+ *============================================================================*/
+
+#pragma once
+}]
+puts $fd "/* Grapheme_Cluster_Break runs ([llength $gcbRuns] entries), as described in"
+puts $fd "** \"mkunidata.tcl\". Hangul LV and LVT syllables are computed. */"
+puts $fd "#define GCB_RUN(C,P) (((u32)(C) << 8) | (u32)(P))"
+emitRuns $fd GcbRuns GCB_RUN $gcbRuns
+puts $fd ""
+puts $fd "/* General_Category runs ([llength $gcRuns] entries), as described in \"mkunidata.tcl\" */"
+puts $fd "#define GC_RUN(C,P) (((u32)(C) << 8) | (u32)(P))"
+emitRuns $fd GcRuns GC_RUN $gcRuns
+puts $fd ""
+puts $fd "/* Common case folding ([llength [dict get $folds C]] entries): code point, folded code point */"
+emitFolds $fd FoldSimple 2 [dict get $folds C]
+puts $fd ""
+puts $fd "/* Full case folding ([llength [dict get $folds F]] entries): code point, folded code points */"
+emitFolds $fd FoldFull 4 [dict get $folds F]
+puts $fd ""
+puts $fd "/* Simple case folding ([llength [dict get $folds S]] entries): code point, folded code point */"
+emitFolds $fd FoldSimpleOnly 2 [dict get $folds S]
+puts $fd ""
+puts $fd "/* Turkic case folding ([llength [dict get $folds T]] entries): code point, folded code point */"
+emitFolds $fd FoldTurkic 2 [dict get $folds T]
+close $fd
@@ -0,0 +1,733 @@
+/*==============================================================================
+ *
+ * Written by: Mark Benningfield
+ *
+ * LICENSE: Public Domain -- see the file LICENSE.txt
+ *
+ *==============================================================================
+ *
+ * This file contains the native Unicode text routines that the string
+ * functions use to walk the text they get from SQLite.
+ *
+ * Grapheme clusters are segmented according to the extended grapheme cluster
+ * rules of UAX #29 (https://www.unicode.org/reports/tr29/). The property data
+ * lives in "unidata.h", which is generated from the Unicode Character Database
+ * by "tools/mkunidata.tcl".
+ *
+ * Malformed text is never an error here. An invalid UTF-8 sequence is treated
+ * as a single U+FFFD code point that is one byte long, and an unpaired UTF-16
+ * surrogate is treated as a code point on its own, so that every byte of the
+ * input ends up in exactly one grapheme cluster.
+ *
+ * Since nearly all of the text we see is plain ASCII, the entry points first
+ * classify their input with uni_asciiClass(), which checks 16 bytes at a time
+ * with SSE2 where it's available. Printable ASCII text has exactly one
+ * grapheme cluster per code unit, so those callers can skip decoding
+ * altogether, and searching ASCII text filters the candidate positions 16
+ * bytes at a time before comparing them. The SIMD routines are compiled as
+ * native code, since the vector types can't be used in managed code.
+ *
+ * Case-insensitive comparisons use the full case folding from the Unicode
+ * Character Database (CaseFolding.txt), with the Turkic mappings for dotted
+ * and dotless I swapped in when the current culture calls for them. The
+ * tables are generated along with the grapheme cluster data.
+ *
+ *============================================================================*/
+
+/* Notes in "utilext.c" */
+#pragma warning( disable : 4127 4339 4514 )
+#pragma warning( disable : 4820 )
+
+#include <assert.h>
+#include <string.h>
+#include "unicode.h"
+#include "unidata.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define UNI_SSE2
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#define REPLACEMENT_CHAR 0xFFFD
+
+/* Hangul syllable block; LV syllables are every 28th code point */
+#define HANGUL_FIRST 0xAC00
+#define HANGUL_LAST  0xD7A3
+#define HANGUL_TCOUNT 28
+
+/* State of the emoji ZWJ sequence rule (GB11) */
+#define EMOJI_NONE 0   /* not in an emoji sequence        */
+#define EMOJI_BASE 1   /* seen ExtPict Extend*            */
+#define EMOJI_ZWJ  2   /* seen ExtPict Extend* ZWJ        */
+
+#ifdef UNI_SSE2
+#pragma managed(push, off)
+#endif
+
+/* Classifies UTF-8 text; see uni_asciiClass() */
+static int asciiClass8(const u8 *z, int cb) {
+  int flags = UNI_ASCII | UNI_PRINTABLE;
+  int i = 0;
+#ifdef UNI_SSE2
+  const __m128i k20 = _mm_set1_epi8(0x20);
+  const __m128i k7F = _mm_set1_epi8(0x7F);
+  __m128i ctl = _mm_setzero_si128();
+  for (; i + 16 <= cb; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(z + i));
+    if (_mm_movemask_epi8(v)) return 0; /* high bit set */
+    ctl = _mm_or_si128(ctl, _mm_or_si128(_mm_cmplt_epi8(v, k20),
+                                         _mm_cmpeq_epi8(v, k7F)));
+  }
+  if (_mm_movemask_epi8(ctl)) flags = UNI_ASCII;
+#endif
+  for (; i < cb; i++) {
+    if (z[i] >= 0x80) return 0;
+    if (z[i] < 0x20 || z[i] == 0x7F) flags = UNI_ASCII;
+  }
+  return flags;
+}
+
+/* Classifies UTF-16 text of 'n' code units; see uni_asciiClass() */
+static int asciiClass16(const u16 *w, int n) {
+  int flags = UNI_ASCII | UNI_PRINTABLE;
+  int i = 0;
+#ifdef UNI_SSE2
+  const __m128i kHigh = _mm_set1_epi16((short)0xFF80);
+  const __m128i k20 = _mm_set1_epi16(0x20);
+  const __m128i k7F = _mm_set1_epi16(0x7F);
+  const __m128i zero = _mm_setzero_si128();
+  __m128i ctl = _mm_setzero_si128();
+  for (; i + 8 <= n; i += 8) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(w + i));
+    __m128i high = _mm_cmpeq_epi16(_mm_and_si128(v, kHigh), zero);
+    if (_mm_movemask_epi8(high) != 0xFFFF) return 0;
+    ctl = _mm_or_si128(ctl, _mm_or_si128(_mm_cmplt_epi16(v, k20),
+                                         _mm_cmpeq_epi16(v, k7F)));
+  }
+  if (_mm_movemask_epi8(ctl)) flags = UNI_ASCII;
+#endif
+  for (; i < n; i++) {
+    if (w[i] >= 0x80) return 0;
+    if (w[i] < 0x20 || w[i] == 0x7F) flags = UNI_ASCII;
+  }
+  return flags;
+}
+
+/* Compares 'n' ASCII code units, with ASCII case folding if 'noCase' is true */
+static bool asciiMatch8(const u8 *z, const u8 *f, int n, bool noCase) {
+  if (!noCase) return memcmp(z, f, (size_t)n) == 0;
+  for (int j = 0; j < n; j++) {
+    if (ASCII_FOLD(z[j]) != ASCII_FOLD(f[j])) return false;
+  }
+  return true;
+}
+
+static bool asciiMatch16(const u16 *w, const u16 *f, int n, bool noCase) {
+  if (!noCase) return memcmp(w, f, (size_t)n * 2) == 0;
+  for (int j = 0; j < n; j++) {
+    if (ASCII_FOLD(w[j]) != ASCII_FOLD(f[j])) return false;
+  }
+  return true;
+}
+
+#ifdef UNI_SSE2
+/* Index of the lowest set bit of a non-zero mask */
+static int lowBit(u32 bits) {
+#ifdef _MSC_VER
+  unsigned long i;
+  _BitScanForward(&i, bits);
+  return (int)i;
+#else
+  return __builtin_ctz(bits);
+#endif
+}
+#endif
+
+/* Finds 'nf' units of ASCII text in UTF-8 text of 'n' units, starting at
+** index 'i'; see uni_asciiFind(). Candidates are found 16 at a time by
+** matching the first and last units of the pattern at once, and only those
+** are compared in full. When case is ignored, the candidate filter sets the
+** 0x20 bit of both sides, which lets through every pair of units that fold
+** to the same letter (and a few that don't). */
+static int asciiFind8(const u8 *z, int n, const u8 *f, int nf, int i,
+                      bool noCase)
+{
+  u8 mask = noCase ? 0x20 : 0;
+  u8 first = f[0] | mask;
+  u8 last = f[nf - 1] | mask;
+#ifdef UNI_SSE2
+  const __m128i vMask = _mm_set1_epi8((char)mask);
+  const __m128i vFirst = _mm_set1_epi8((char)first);
+  const __m128i vLast = _mm_set1_epi8((char)last);
+  for (; i + nf - 1 + 16 <= n; i += 16) {
+    __m128i a = _mm_or_si128(_mm_loadu_si128((const __m128i*)(z + i)), vMask);
+    __m128i b = _mm_or_si128(
+                  _mm_loadu_si128((const __m128i*)(z + i + nf - 1)), vMask);
+    u32 bits = (u32)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, vFirst),
+                                                    _mm_cmpeq_epi8(b, vLast)));
+    while (bits) {
+      int k = lowBit(bits);
+      if (asciiMatch8(z + i + k, f, nf, noCase)) return i + k;
+      bits &= bits - 1;
+    }
+  }
+#endif
+  for (; i + nf <= n; i++) {
+    if ((z[i] | mask) == first && asciiMatch8(z + i, f, nf, noCase)) return i;
+  }
+  return -1;
+}
+
+/* Finds ASCII text in UTF-16 text; see asciiFind8() */
+static int asciiFind16(const u16 *w, int n, const u16 *f, int nf, int i,
+                       bool noCase)
+{
+  u16 mask = noCase ? 0x20 : 0;
+  u16 first = f[0] | mask;
+  u16 last = f[nf - 1] | mask;
+#ifdef UNI_SSE2
+  const __m128i vMask = _mm_set1_epi16((short)mask);
+  const __m128i vFirst = _mm_set1_epi16((short)first);
+  const __m128i vLast = _mm_set1_epi16((short)last);
+  for (; i + nf - 1 + 8 <= n; i += 8) {
+    __m128i a = _mm_or_si128(_mm_loadu_si128((const __m128i*)(w + i)), vMask);
+    __m128i b = _mm_or_si128(
+                  _mm_loadu_si128((const __m128i*)(w + i + nf - 1)), vMask);
+    u32 bits = (u32)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi16(a, vFirst),
+                                                    _mm_cmpeq_epi16(b, vLast)));
+    while (bits) {
+      int k = lowBit(bits) / 2; /* two mask bits per code unit */
+      if (asciiMatch16(w + i + k, f, nf, noCase)) return i + k;
+      bits &= ~(3u << (k * 2));
+    }
+  }
+#endif
+  for (; i + nf <= n; i++) {
+    if ((w[i] | mask) == first && asciiMatch16(w + i, f, nf, noCase)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/* Counts the ASCII bytes at the start of UTF-8 text */
+static int asciiSpan8(const u8 *z, int n) {
+  int i = 0;
+#ifdef UNI_SSE2
+  for (; i + 16 <= n; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(z + i));
+    u32 bits = (u32)_mm_movemask_epi8(v);
+    if (bits) return i + lowBit(bits);
+  }
+#endif
+  while (i < n && z[i] < 0x80) i++;
+  return i;
+}
+
+/* Counts the ASCII code units at the start of UTF-16 text */
+static int asciiSpan16(const u16 *w, int n) {
+  int i = 0;
+#ifdef UNI_SSE2
+  const __m128i kHigh = _mm_set1_epi16((short)0xFF80);
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 8 <= n; i += 8) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(w + i));
+    u32 bits = (u32)_mm_movemask_epi8(
+                      _mm_cmpeq_epi16(_mm_and_si128(v, kHigh), zero)) ^ 0xFFFF;
+    if (bits) return i + lowBit(bits) / 2;
+  }
+#endif
+  while (i < n && w[i] < 0x80) i++;
+  return i;
+}
+
+#ifdef UNI_SSE2
+#pragma managed(pop)
+#endif
+
+/* Classifies the code units of a string. Returns UNI_ASCII if every code unit
+** is ASCII, with UNI_PRINTABLE added if there are no control characters, or
+** zero if there is anything outside the ASCII range. An empty string is
+** printable ASCII. */
+int uni_asciiClass(const DbStr *pStr) {
+  assert(pStr);
+  if (pStr->isWide) {
+    return asciiClass16((const u16*)pStr->pText, pStr->cb / 2);
+  }
+  return asciiClass8((const u8*)pStr->pText, pStr->cb);
+}
+
+/* Counts the consecutive ASCII code units of a string, starting at the code
+** unit index 'iStart' */
+int uni_asciiSpan(const DbStr *pStr, int iStart) {
+  if (pStr->isWide) {
+    return asciiSpan16((const u16*)pStr->pText + iStart,
+                       pStr->cb / 2 - iStart);
+  }
+  return asciiSpan8((const u8*)pStr->pText + iStart, pStr->cb - iStart);
+}
+
+/* Finds the first occurrence of 'pFind' in 'pIn' at or after the code unit
+** index 'iStart', comparing ASCII code units (with ASCII case folding if
+** 'noCase' is true). A case-sensitive search works on any valid text; when
+** case is ignored, code units outside ASCII are compared exactly, so that
+** would be wrong for 'pFind' with a character outside ASCII that has case.
+** Returns the code unit index of the match, or -1 if there is none. */
+int uni_asciiFind(const DbStr *pIn, const DbStr *pFind, int iStart,
+                  bool noCase)
+{
+  int nIn;
+  int nFind;
+  assert(pIn->isWide == pFind->isWide);
+  nIn = pIn->isWide ? pIn->cb / 2 : pIn->cb;
+  nFind = pFind->isWide ? pFind->cb / 2 : pFind->cb;
+  if (nFind == 0) return (iStart <= nIn) ? iStart : -1;
+  if (pIn->isWide) {
+    return asciiFind16((const u16*)pIn->pText, nIn,
+                       (const u16*)pFind->pText, nFind, iStart, noCase);
+  }
+  return asciiFind8((const u8*)pIn->pText, nIn,
+                    (const u8*)pFind->pText, nFind, iStart, noCase);
+}
+
+/* Decodes one code point from UTF-8 text */
+static u32 decode8(const u8 *z, int cb, int *pLen) {
+  u32 c = z[0];
+  u32 min;
+  int n;
+
+  if (c < 0x80) {
+    *pLen = 1;
+    return c;
+  }
+  if (c >= 0xC2 && c <= 0xDF) {
+    c &= 0x1F;
+    n = 2;
+    min = 0x80;
+  }
+  else if (c >= 0xE0 && c <= 0xEF) {
+    c &= 0x0F;
+    n = 3;
+    min = 0x800;
+  }
+  else if (c >= 0xF0 && c <= 0xF4) {
+    c &= 0x07;
+    n = 4;
+    min = 0x10000;
+  }
+  else {
+    *pLen = 1;
+    return REPLACEMENT_CHAR;
+  }
+  if (n > cb) {
+    *pLen = 1;
+    return REPLACEMENT_CHAR;
+  }
+  for (int i = 1; i < n; i++) {
+    if ((z[i] & 0xC0) != 0x80) {
+      *pLen = 1;
+      return REPLACEMENT_CHAR;
+    }
+    c = (c << 6) | (z[i] & 0x3F);
+  }
+  if (c < min || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) {
+    *pLen = 1;
+    return REPLACEMENT_CHAR;
+  }
+  *pLen = n;
+  return c;
+}
+
+/* Decodes one code point from UTF-16 text in native byte order */
+static u32 decode16(const u8 *z, int cb, int *pLen) {
+  const u16 *w = (const u16*)z;
+  u32 c;
+
+  if (cb < 2) {
+    *pLen = cb; /* stray trailing byte */
+    return REPLACEMENT_CHAR;
+  }
+  c = w[0];
+  if (c >= 0xD800 && c <= 0xDBFF && cb >= 4 &&
+      w[1] >= 0xDC00 && w[1] <= 0xDFFF)
+  {
+    *pLen = 4;
+    return 0x10000 + ((c - 0xD800) << 10) + (w[1] - 0xDC00);
+  }
+  *pLen = 2;
+  return c;
+}
+
+/* Decodes one code point in the encoding picked at compile time; the loops
+** below are instantiated once for each encoding, so they don't have to check
+** it for every code point */
+template<bool isWide>
+static u32 decode(const u8 *z, int cb, int *pLen) {
+  return isWide ? decode16(z, cb, pLen) : decode8(z, cb, pLen);
+}
+
+/* Decodes the code point at the start of 'z', which must have at least one
+** byte, and writes its length in bytes into 'pLen'. */
+u32 uni_decode(const u8 *z, int cb, bool isWide, int *pLen) {
+  assert(cb > 0);
+  return isWide ? decode16(z, cb, pLen) : decode8(z, cb, pLen);
+}
+
+/* Finds the value of the last run in an inversion map that starts at or
+** before 'c' */
+static int findRun(const u32 *aRun, int n, u32 c) {
+  int lo = 0;
+  int hi = n - 1;
+  while (lo < hi) {
+    int mid = (lo + hi + 1) / 2;
+    if ((aRun[mid] >> 8) <= c) {
+      lo = mid;
+    }
+    else {
+      hi = mid - 1;
+    }
+  }
+  return (int)(aRun[lo] & 0xFF);
+}
+
+/* Gets the Grapheme_Cluster_Break property of a code point */
+int uni_gcbProperty(u32 c) {
+  if (c < 0x7F) {
+    if (c >= 0x20) return GCB_Other;
+    if (c == '\r') return GCB_CR;
+    if (c == '\n') return GCB_LF;
+    return GCB_Control;
+  }
+  if (c >= HANGUL_FIRST && c <= HANGUL_LAST) {
+    return (c - HANGUL_FIRST) % HANGUL_TCOUNT == 0 ? GCB_LV : GCB_LVT;
+  }
+  return findRun(GcbRuns, (int)(sizeof(GcbRuns) / sizeof(GcbRuns[0])), c);
+}
+
+/* Gets the General_Category property of a code point */
+int uni_category(u32 c) {
+  return findRun(GcRuns, (int)(sizeof(GcRuns) / sizeof(GcRuns[0])), c);
+}
+
+/* Returns true if the UAX #29 rules allow a cluster boundary between code
+** points with the properties 'prev' and 'next'. The 'riCount' argument is the
+** number of regional indicators in a row that end with 'prev', and 'emoji' is
+** the state of the current emoji sequence. */
+static bool isBoundary(int prev, int next, int riCount, int emoji) {
+  switch (prev) {
+    case GCB_CR:
+      return next != GCB_LF;                                      /* GB3,4 */
+    case GCB_LF:
+    case GCB_Control:
+      return true;                                                /* GB4 */
+  }
+  switch (next) {
+    case GCB_CR:
+    case GCB_LF:
+    case GCB_Control:
+      return true;                                                /* GB5 */
+    case GCB_Extend:
+    case GCB_ZWJ:
+    case GCB_SpacingMark:
+      return false;                                               /* GB9,9a */
+  }
+  switch (prev) {
+    case GCB_Prepend:
+      return false;                                               /* GB9b */
+    case GCB_L:
+      return !(next == GCB_L || next == GCB_V ||
+               next == GCB_LV || next == GCB_LVT);                /* GB6 */
+    case GCB_LV:
+    case GCB_V:
+      return !(next == GCB_V || next == GCB_T);                   /* GB7 */
+    case GCB_LVT:
+    case GCB_T:
+      return next != GCB_T;                                       /* GB8 */
+    case GCB_ZWJ:
+      return !(next == GCB_ExtPict && emoji == EMOJI_ZWJ);        /* GB11 */
+    case GCB_RI:
+      return !(next == GCB_RI && (riCount & 1));                  /* GB12,13 */
+  }
+  return true;                                                    /* GB999 */
+}
+
+/* Decodes the code point at iEnd into the lookahead */
+template<bool isWide>
+static void peekNext(GraphemeIter *pIter) {
+  u32 c = decode<isWide>(pIter->z + pIter->iEnd,
+                         pIter->cb - pIter->iEnd,
+                         &pIter->nextLen);
+  pIter->nextProp = uni_gcbProperty(c);
+}
+
+/* Prepares an iterator to walk the grapheme clusters of a string */
+void uni_iterInit(GraphemeIter *pIter, const DbStr *pStr) {
+  assert(pIter && pStr);
+  pIter->z = (const u8*)pStr->pText;
+  pIter->cb = pStr->cb;
+  pIter->isWide = pStr->isWide;
+  pIter->iStart = 0;
+  pIter->iEnd = 0;
+  pIter->nextProp = GCB_Other;
+  pIter->nextLen = 0; /* no lookahead yet */
+}
+
+/* Advances to the next grapheme cluster; see uni_nextGrapheme() */
+template<bool isWide>
+static bool nextGrapheme(GraphemeIter *pIter) {
+  int prev;
+  int riCount;
+  int emoji;
+
+  assert(pIter->isWide == isWide);
+  pIter->iStart = pIter->iEnd;
+  if (pIter->iStart >= pIter->cb) return false;
+  if (pIter->nextLen == 0) peekNext<isWide>(pIter);
+  prev = pIter->nextProp;
+  riCount = (prev == GCB_RI) ? 1 : 0;
+  emoji = (prev == GCB_ExtPict) ? EMOJI_BASE : EMOJI_NONE;
+  pIter->iEnd += pIter->nextLen;
+  while (pIter->iEnd < pIter->cb) {
+    int next;
+    peekNext<isWide>(pIter);
+    next = pIter->nextProp;
+    if (isBoundary(prev, next, riCount, emoji)) return true;
+    riCount = (next == GCB_RI) ? riCount + 1 : 0;
+    if (next == GCB_ExtPict) {
+      emoji = EMOJI_BASE;
+    }
+    else if (emoji == EMOJI_BASE && next == GCB_ZWJ) {
+      emoji = EMOJI_ZWJ;
+    }
+    else if (!(emoji == EMOJI_BASE && next == GCB_Extend)) {
+      emoji = EMOJI_NONE;
+    }
+    prev = next;
+    pIter->iEnd += pIter->nextLen;
+  }
+  pIter->nextLen = 0;
+  return true;
+}
+
+/* Advances to the next grapheme cluster. Returns false when there are no more
+** clusters in the text. The code point that ends a cluster is kept as the
+** lookahead for the next call, so each code point is only decoded once. */
+bool uni_nextGrapheme(GraphemeIter *pIter) {
+  return pIter->isWide ? nextGrapheme<true>(pIter) :
+                         nextGrapheme<false>(pIter);
+}
+
+/* Counts the grapheme clusters of text that isn't all printable ASCII */
+template<bool isWide>
+static int graphemeCount(const DbStr *pStr) {
+  GraphemeIter iter;
+  int n = 0;
+  uni_iterInit(&iter, pStr);
+  while (nextGrapheme<isWide>(&iter)) {
+    n++;
+  }
+  return n;
+}
+
+/* Gets the number of grapheme clusters in a string */
+int uni_graphemeCount(const DbStr *pStr) {
+  if (uni_asciiClass(pStr) & UNI_PRINTABLE) {
+    return pStr->isWide ? pStr->cb / 2 : pStr->cb;
+  }
+  return pStr->isWide ? graphemeCount<true>(pStr) : graphemeCount<false>(pStr);
+}
+
+/* Skips 'n' grapheme clusters of text that isn't all printable ASCII */
+template<bool isWide>
+static int graphemeOffset(const DbStr *pStr, int n) {
+  GraphemeIter iter;
+  uni_iterInit(&iter, pStr);
+  while (n > 0 && nextGrapheme<isWide>(&iter)) {
+    n--;
+  }
+  return iter.iEnd;
+}
+
+/* Gets the byte offset just past the first 'n' grapheme clusters of a string,
+** or the length of the string if it has 'n' or fewer clusters. */
+int uni_graphemeOffset(const DbStr *pStr, int n) {
+  assert(n >= 0);
+  if (uni_asciiClass(pStr) & UNI_PRINTABLE) {
+    int unit = pStr->isWide ? 2 : 1;
+    return (n >= pStr->cb / unit) ? pStr->cb : n * unit;
+  }
+  return pStr->isWide ? graphemeOffset<true>(pStr, n) :
+                        graphemeOffset<false>(pStr, n);
+}
+
+/* Finds the entry for code point 'c' in a case folding table with 'n' rows
+** of 'width' code points each; returns NULL if there is no entry. */
+static const u32 *findFold(const u32 *aFold, int n, int width, u32 c) {
+  int lo = 0;
+  int hi = n - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    const u32 *pEntry = aFold + mid * width;
+    if (pEntry[0] == c) return pEntry;
+    if (pEntry[0] < c) {
+      lo = mid + 1;
+    }
+    else {
+      hi = mid - 1;
+    }
+  }
+  return nullptr;
+}
+
+#define FOLD_ROWS(A) ((int)(sizeof(A) / sizeof(A[0])))
+
+/* Gets the full case folding of a code point, which is one to three code
+** points, and returns the count of code points written to 'aOut'. If 'turkic'
+** is true, the Turkic mappings for dotted and dotless I are used. */
+int uni_foldFull(u32 c, bool turkic, u32 *aOut) {
+  const u32 *pEntry;
+
+  if (c < 0x80 && !(turkic && c == 'I')) {
+    aOut[0] = ASCII_FOLD(c);
+    return 1;
+  }
+  if (turkic) {
+    pEntry = findFold(&FoldTurkic[0][0], FOLD_ROWS(FoldTurkic), 2, c);
+    if (pEntry) {
+      aOut[0] = pEntry[1];
+      return 1;
+    }
+  }
+  pEntry = findFold(&FoldFull[0][0], FOLD_ROWS(FoldFull), 4, c);
+  if (pEntry) {
+    aOut[0] = pEntry[1];
+    aOut[1] = pEntry[2];
+    if (pEntry[3] == 0) return 2;
+    aOut[2] = pEntry[3];
+    return 3;
+  }
+  pEntry = findFold(&FoldSimple[0][0], FOLD_ROWS(FoldSimple), 2, c);
+  aOut[0] = pEntry ? pEntry[1] : c;
+  return 1;
+}
+
+/* Gets the simple case folding of a code point, which is always a single code
+** point; this is the folding that the regex engine uses for case-insensitive
+** matching. If 'turkic' is true, the Turkic mappings for dotted and dotless I
+** are used. */
+u32 uni_foldSimple(u32 c, bool turkic) {
+  const u32 *pEntry;
+
+  if (c < 0x80 && !(turkic && c == 'I')) return ASCII_FOLD(c);
+  if (turkic) {
+    pEntry = findFold(&FoldTurkic[0][0], FOLD_ROWS(FoldTurkic), 2, c);
+    if (pEntry) return pEntry[1];
+  }
+  pEntry = findFold(&FoldSimple[0][0], FOLD_ROWS(FoldSimple), 2, c);
+  if (pEntry) return pEntry[1];
+  pEntry = findFold(&FoldSimpleOnly[0][0], FOLD_ROWS(FoldSimpleOnly), 2, c);
+  return pEntry ? pEntry[1] : c;
+}
+
+/* Gets the i'th mapping of the simple case folding, so that callers can find
+** every code point that folds to a given one. Returns false when 'i' is past
+** the last mapping. Code points that fold to themselves are not listed. */
+bool uni_foldMapping(int i, bool turkic, u32 *pFrom, u32 *pTo) {
+  int nSimple = FOLD_ROWS(FoldSimple);
+  int nOnly = FOLD_ROWS(FoldSimpleOnly);
+
+  if (i < nSimple) {
+    *pFrom = FoldSimple[i][0];
+  }
+  else if (i < nSimple + nOnly) {
+    *pFrom = FoldSimpleOnly[i - nSimple][0];
+  }
+  else if (turkic && i < nSimple + nOnly + FOLD_ROWS(FoldTurkic)) {
+    *pFrom = FoldTurkic[i - nSimple - nOnly][0];
+  }
+  else {
+    return false;
+  }
+  *pTo = uni_foldSimple(*pFrom, turkic);
+  return true;
+}
+
+/* Streams the case-folded code points of a string */
+struct FoldIter {
+  const u8 *z;    /* text being folded                     */
+  int cb;         /* count of bytes in z                   */
+  bool turkic;    /* true to use the Turkic mappings       */
+  int i;          /* byte offset of the next code point    */
+  u32 aFold[3];   /* folding of the current code point     */
+  int nFold;      /* count of code points in aFold         */
+  int iFold;      /* index of the next code point in aFold */
+};
+
+#define FOLD_END 0xFFFFFFFF
+
+/* Gets the next folded code point, or FOLD_END at the end of the text */
+template<bool isWide>
+static u32 nextFold(FoldIter *p) {
+  int len;
+  u32 c;
+  if (p->iFold < p->nFold) return p->aFold[p->iFold++];
+  if (p->i >= p->cb) return FOLD_END;
+  c = decode<isWide>(p->z + p->i, p->cb - p->i, &len);
+  p->i += len;
+  p->nFold = uni_foldFull(c, p->turkic, p->aFold);
+  p->iFold = 1;
+  return p->aFold[0];
+}
+
+template<bool isWide>
+static bool foldEqual(const DbStr *pLeft, const DbStr *pRight, bool turkic) {
+  FoldIter left = { (const u8*)pLeft->pText, pLeft->cb, turkic };
+  FoldIter right = { (const u8*)pRight->pText, pRight->cb, turkic };
+  u32 c;
+  do {
+    c = nextFold<isWide>(&left);
+    if (c != nextFold<isWide>(&right)) return false;
+  } while (c != FOLD_END);
+  return true;
+}
+
+/* Returns true if two strings have the same full case folding. The strings
+** are folded a code point at a time as they are compared, so nothing is
+** allocated and a difference early on ends the comparison early. */
+bool uni_foldEqual(const DbStr *pLeft, const DbStr *pRight, bool turkic) {
+  assert(pLeft->isWide == pRight->isWide);
+  return pLeft->isWide ? foldEqual<true>(pLeft, pRight, turkic) :
+                         foldEqual<false>(pLeft, pRight, turkic);
+}
+
+/* Hashes the full case folding of a string; see uni_hash() */
+template<bool isWide>
+static u32 foldHash(const DbStr *pStr, bool turkic) {
+  FoldIter iter = { (const u8*)pStr->pText, pStr->cb, turkic };
+  u32 h = 2166136261u;
+  for (u32 c = nextFold<isWide>(&iter); c != FOLD_END;
+       c = nextFold<isWide>(&iter))
+  {
+    h = (h ^ c) * 16777619u;
+  }
+  return h;
+}
+
+/* Hashes a string (FNV-1a). If 'noCase' is true, the hash is taken over the
+** full case folding of the string, so strings that uni_foldEqual() finds to
+** be equal have the same hash; otherwise it is taken over the bytes. */
+u32 uni_hash(const DbStr *pStr, bool noCase, bool turkic) {
+  u32 h = 2166136261u;
+  const u8 *z = (const u8*)pStr->pText;
+  if (noCase) {
+    return pStr->isWide ? foldHash<true>(pStr, turkic) :
+                          foldHash<false>(pStr, turkic);
+  }
+  for (int i = 0; i < pStr->cb; i++) {
+    h = (h ^ z[i]) * 16777619u;
+  }
+  return h;
+}
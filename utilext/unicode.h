@@ -0,0 +1,117 @@
+/*==============================================================================
+ *
+ * Written by: Mark Benningfield
+ *
+ * LICENSE: Public Domain -- see the file LICENSE.txt
+ *
+ *==============================================================================
+ *
+ * Header file for the native Unicode text routines.
+ *
+ * These routines work directly on the UTF-8 or UTF-16 bytes that we get from
+ * SQLite, so that the string functions can do their work without decoding the
+ * text into a managed String first. Positions are always byte offsets into the
+ * original text, and none of these routines allocate memory.
+ *
+ *============================================================================*/
+
+#pragma once
+
+#include "utilext.h"
+
+/* Grapheme_Cluster_Break property values from UAX #29; these must match the
+** names used by "tools/mkunidata.tcl". The Extended_Pictographic property is
+** carried as its own value, since it never overlaps any of the others. */
+#define GCB_Other        0
+#define GCB_CR           1
+#define GCB_LF           2
+#define GCB_Control      3
+#define GCB_Extend       4
+#define GCB_ZWJ          5
+#define GCB_RI           6
+#define GCB_Prepend      7
+#define GCB_SpacingMark  8
+#define GCB_L            9
+#define GCB_V           10
+#define GCB_T           11
+#define GCB_LV          12
+#define GCB_LVT         13
+#define GCB_ExtPict     14
+
+/* General_Category values; these must match the names used by
+** "tools/mkunidata.tcl". Unassigned code points are 'Cn', which is zero. */
+#define GC_Cn  0
+#define GC_Lu  1
+#define GC_Ll  2
+#define GC_Lt  3
+#define GC_Lm  4
+#define GC_Lo  5
+#define GC_Mn  6
+#define GC_Mc  7
+#define GC_Me  8
+#define GC_Nd  9
+#define GC_Nl 10
+#define GC_No 11
+#define GC_Pc 12
+#define GC_Pd 13
+#define GC_Ps 14
+#define GC_Pe 15
+#define GC_Pi 16
+#define GC_Pf 17
+#define GC_Po 18
+#define GC_Sm 19
+#define GC_Sc 20
+#define GC_Sk 21
+#define GC_So 22
+#define GC_Zs 23
+#define GC_Zl 24
+#define GC_Zp 25
+#define GC_Cc 26
+#define GC_Cf 27
+#define GC_Cs 28
+#define GC_Co 29
+
+/* Iterator over the extended grapheme clusters in a string. After each
+** successful call to uni_nextGrapheme(), the current cluster occupies the
+** bytes from iStart up to (but not including) iEnd.
+*/
+struct GraphemeIter {
+  const u8 *z;      /* text being iterated                    */
+  int cb;           /* count of bytes in z                    */
+  bool isWide;      /* true if the text is UTF-16             */
+  int iStart;       /* byte offset of the current cluster     */
+  int iEnd;         /* byte offset just past the cluster      */
+  int nextProp;     /* GCB property of the code point at iEnd */
+  int nextLen;      /* byte length of the code point at iEnd  */
+};
+
+/* Flags returned by uni_asciiClass() */
+#define UNI_ASCII      1  /* every code unit is less than 0x80              */
+#define UNI_PRINTABLE  2  /* every code unit is in the range 0x20 to 0x7E   */
+
+/* Folds an ASCII letter to lower case */
+#define ASCII_FOLD(C) (((C) >= 'A' && (C) <= 'Z') ? (C) + 0x20 : (C))
+
+/* ASCII classification and byte-level kernels */
+int uni_asciiClass(const DbStr *pStr);
+int uni_asciiSpan(const DbStr *pStr, int iStart);
+int uni_asciiFind(const DbStr *pIn, const DbStr *pFind, int iStart,
+                  bool noCase);
+
+/* Code point decoding */
+u32 uni_decode(const u8 *z, int cb, bool isWide, int *pLen);
+int uni_gcbProperty(u32 c);
+int uni_category(u32 c);
+
+/* Case folding and hashing */
+int uni_foldFull(u32 c, bool turkic, u32 *aOut);
+u32 uni_foldSimple(u32 c, bool turkic);
+bool uni_foldMapping(int i, bool turkic, u32 *pFrom, u32 *pTo);
+bool uni_foldEqual(const DbStr *pLeft, const DbStr *pRight, bool turkic);
+u32 uni_hash(const DbStr *pStr, bool noCase, bool turkic);
+
+/* Grapheme cluster iteration */
+void uni_iterInit(GraphemeIter *pIter, const DbStr *pStr);
+bool uni_nextGrapheme(GraphemeIter *pIter);
+int uni_graphemeCount(const DbStr *pStr);
+int uni_graphemeOffset(const DbStr *pStr, int n);
@@ -0,0 +1,3080 @@
+/*==============================================================================
+ *
+ * Written by: Mark Benningfield
+ *
+ * LICENSE: Public Domain -- see the file LICENSE.txt
+ *
+ *==============================================================================
+ *
+ * Unicode property tables for the native text routines.
+ *
+ * This file is generated by "tools/mkunidata.tcl" from the Unicode Character
+ * Database, version 14.0.0; don't edit it by hand.
+ *
+ *============================================================================*/
+
+#pragma once
+
+/* Grapheme_Cluster_Break runs (1027 entries), as described in
+** "mkunidata.tcl". Hangul LV and LVT syllables are computed. */
+#define GCB_RUN(C,P) (((u32)(C) << 8) | (u32)(P))
+constexpr u32 GcbRuns[] = {
+  GCB_RUN(0x0000, GCB_Control), GCB_RUN(0x000A, GCB_LF),
+  GCB_RUN(0x000B, GCB_Control), GCB_RUN(0x000D, GCB_CR),
+  GCB_RUN(0x000E, GCB_Control), GCB_RUN(0x0020, GCB_Other),
+  GCB_RUN(0x007F, GCB_Control), GCB_RUN(0x00A0, GCB_Other),
+  GCB_RUN(0x00A9, GCB_ExtPict), GCB_RUN(0x00AA, GCB_Other),
+  GCB_RUN(0x00AD, GCB_Control), GCB_RUN(0x00AE, GCB_ExtPict),
+  GCB_RUN(0x00AF, GCB_Other), GCB_RUN(0x0300, GCB_Extend),
+  GCB_RUN(0x0370, GCB_Other), GCB_RUN(0x0483, GCB_Extend),
+  GCB_RUN(0x048A, GCB_Other), GCB_RUN(0x0591, GCB_Extend),
+  GCB_RUN(0x05BE, GCB_Other), GCB_RUN(0x05BF, GCB_Extend),
+  GCB_RUN(0x05C0, GCB_Other), GCB_RUN(0x05C1, GCB_Extend),
+  GCB_RUN(0x05C3, GCB_Other), GCB_RUN(0x05C4, GCB_Extend),
+  GCB_RUN(0x05C6, GCB_Other), GCB_RUN(0x05C7, GCB_Extend),
+  GCB_RUN(0x05C8, GCB_Other), GCB_RUN(0x0600, GCB_Prepend),
+  GCB_RUN(0x0606, GCB_Other), GCB_RUN(0x0610, GCB_Extend),
+  GCB_RUN(0x061B, GCB_Other), GCB_RUN(0x061C, GCB_Control),
+  GCB_RUN(0x061D, GCB_Other), GCB_RUN(0x064B, GCB_Extend),
+  GCB_RUN(0x0660, GCB_Other), GCB_RUN(0x0670, GCB_Extend),
+  GCB_RUN(0x0671, GCB_Other), GCB_RUN(0x06D6, GCB_Extend),
+  GCB_RUN(0x06DD, GCB_Prepend), GCB_RUN(0x06DE, GCB_Other),
+  GCB_RUN(0x06DF, GCB_Extend), GCB_RUN(0x06E5, GCB_Other),
+  GCB_RUN(0x06E7, GCB_Extend), GCB_RUN(0x06E9, GCB_Other),
+  GCB_RUN(0x06EA, GCB_Extend), GCB_RUN(0x06EE, GCB_Other),
+  GCB_RUN(0x070F, GCB_Prepend), GCB_RUN(0x0710, GCB_Other),
+  GCB_RUN(0x0711, GCB_Extend), GCB_RUN(0x0712, GCB_Other),
+  GCB_RUN(0x0730, GCB_Extend), GCB_RUN(0x074B, GCB_Other),
+  GCB_RUN(0x07A6, GCB_Extend), GCB_RUN(0x07B1, GCB_Other),
+  GCB_RUN(0x07EB, GCB_Extend), GCB_RUN(0x07F4, GCB_Other),
+  GCB_RUN(0x07FD, GCB_Extend), GCB_RUN(0x07FE, GCB_Other),
+  GCB_RUN(0x0816, GCB_Extend), GCB_RUN(0x081A, GCB_Other),
+  GCB_RUN(0x081B, GCB_Extend), GCB_RUN(0x0824, GCB_Other),
+  GCB_RUN(0x0825, GCB_Extend), GCB_RUN(0x0828, GCB_Other),
+  GCB_RUN(0x0829, GCB_Extend), GCB_RUN(0x082E, GCB_Other),
+  GCB_RUN(0x0859, GCB_Extend), GCB_RUN(0x085C, GCB_Other),
+  GCB_RUN(0x0890, GCB_Prepend), GCB_RUN(0x0892, GCB_Other),
+  GCB_RUN(0x0898, GCB_Extend), GCB_RUN(0x08A0, GCB_Other),
+  GCB_RUN(0x08CA, GCB_Extend), GCB_RUN(0x08E2, GCB_Prepend),
+  GCB_RUN(0x08E3, GCB_Extend), GCB_RUN(0x0903, GCB_SpacingMark),
+  GCB_RUN(0x0904, GCB_Other), GCB_RUN(0x093A, GCB_Extend),
+  GCB_RUN(0x093B, GCB_SpacingMark), GCB_RUN(0x093C, GCB_Extend),
+  GCB_RUN(0x093D, GCB_Other), GCB_RUN(0x093E, GCB_SpacingMark),
+  GCB_RUN(0x0941, GCB_Extend), GCB_RUN(0x0949, GCB_SpacingMark),
+  GCB_RUN(0x094D, GCB_Extend), GCB_RUN(0x094E, GCB_SpacingMark),
+  GCB_RUN(0x0950, GCB_Other), GCB_RUN(0x0951, GCB_Extend),
+  GCB_RUN(0x0958, GCB_Other), GCB_RUN(0x0962, GCB_Extend),
+  GCB_RUN(0x0964, GCB_Other), GCB_RUN(0x0981, GCB_Extend),
+  GCB_RUN(0x0982, GCB_SpacingMark), GCB_RUN(0x0984, GCB_Other),
+  GCB_RUN(0x09BC, GCB_Extend), GCB_RUN(0x09BD, GCB_Other),
+  GCB_RUN(0x09BE, GCB_Extend), GCB_RUN(0x09BF, GCB_SpacingMark),
+  GCB_RUN(0x09C1, GCB_Extend), GCB_RUN(0x09C5, GCB_Other),
+  GCB_RUN(0x09C7, GCB_SpacingMark), GCB_RUN(0x09C9, GCB_Other),
+  GCB_RUN(0x09CB, GCB_SpacingMark), GCB_RUN(0x09CD, GCB_Extend),
+  GCB_RUN(0x09CE, GCB_Other), GCB_RUN(0x09D7, GCB_Extend),
+  GCB_RUN(0x09D8, GCB_Other), GCB_RUN(0x09E2, GCB_Extend),
+  GCB_RUN(0x09E4, GCB_Other), GCB_RUN(0x09FE, GCB_Extend),
+  GCB_RUN(0x09FF, GCB_Other), GCB_RUN(0x0A01, GCB_Extend),
+  GCB_RUN(0x0A03, GCB_SpacingMark), GCB_RUN(0x0A04, GCB_Other),
+  GCB_RUN(0x0A3C, GCB_Extend), GCB_RUN(0x0A3D, GCB_Other),
+  GCB_RUN(0x0A3E, GCB_SpacingMark), GCB_RUN(0x0A41, GCB_Extend),
+  GCB_RUN(0x0A43, GCB_Other), GCB_RUN(0x0A47, GCB_Extend),
+  GCB_RUN(0x0A49, GCB_Other), GCB_RUN(0x0A4B, GCB_Extend),
+  GCB_RUN(0x0A4E, GCB_Other), GCB_RUN(0x0A51, GCB_Extend),
+  GCB_RUN(0x0A52, GCB_Other), GCB_RUN(0x0A70, GCB_Extend),
+  GCB_RUN(0x0A72, GCB_Other), GCB_RUN(0x0A75, GCB_Extend),
+  GCB_RUN(0x0A76, GCB_Other), GCB_RUN(0x0A81, GCB_Extend),
+  GCB_RUN(0x0A83, GCB_SpacingMark), GCB_RUN(0x0A84, GCB_Other),
+  GCB_RUN(0x0ABC, GCB_Extend), GCB_RUN(0x0ABD, GCB_Other),
+  GCB_RUN(0x0ABE, GCB_SpacingMark), GCB_RUN(0x0AC1, GCB_Extend),
+  GCB_RUN(0x0AC6, GCB_Other), GCB_RUN(0x0AC7, GCB_Extend),
+  GCB_RUN(0x0AC9, GCB_SpacingMark), GCB_RUN(0x0ACA, GCB_Other),
+  GCB_RUN(0x0ACB, GCB_SpacingMark), GCB_RUN(0x0ACD, GCB_Extend),
+  GCB_RUN(0x0ACE, GCB_Other), GCB_RUN(0x0AE2, GCB_Extend),
+  GCB_RUN(0x0AE4, GCB_Other), GCB_RUN(0x0AFA, GCB_Extend),
+  GCB_RUN(0x0B00, GCB_Other), GCB_RUN(0x0B01, GCB_Extend),
+  GCB_RUN(0x0B02, GCB_SpacingMark), GCB_RUN(0x0B04, GCB_Other),
+  GCB_RUN(0x0B3C, GCB_Extend), GCB_RUN(0x0B3D, GCB_Other),
+  GCB_RUN(0x0B3E, GCB_Extend), GCB_RUN(0x0B40, GCB_SpacingMark),
+  GCB_RUN(0x0B41, GCB_Extend), GCB_RUN(0x0B45, GCB_Other),
+  GCB_RUN(0x0B47, GCB_SpacingMark), GCB_RUN(0x0B49, GCB_Other),
+  GCB_RUN(0x0B4B, GCB_SpacingMark), GCB_RUN(0x0B4D, GCB_Extend),
+  GCB_RUN(0x0B4E, GCB_Other), GCB_RUN(0x0B55, GCB_Extend),
+  GCB_RUN(0x0B58, GCB_Other), GCB_RUN(0x0B62, GCB_Extend),
+  GCB_RUN(0x0B64, GCB_Other), GCB_RUN(0x0B82, GCB_Extend),
+  GCB_RUN(0x0B83, GCB_Other), GCB_RUN(0x0BBE, GCB_Extend),
+  GCB_RUN(0x0BBF, GCB_SpacingMark), GCB_RUN(0x0BC0, GCB_Extend),
+  GCB_RUN(0x0BC1, GCB_SpacingMark), GCB_RUN(0x0BC3, GCB_Other),
+  GCB_RUN(0x0BC6, GCB_SpacingMark), GCB_RUN(0x0BC9, GCB_Other),
+  GCB_RUN(0x0BCA, GCB_SpacingMark), GCB_RUN(0x0BCD, GCB_Extend),
+  GCB_RUN(0x0BCE, GCB_Other), GCB_RUN(0x0BD7, GCB_Extend),
+  GCB_RUN(0x0BD8, GCB_Other), GCB_RUN(0x0C00, GCB_Extend),
+  GCB_RUN(0x0C01, GCB_SpacingMark), GCB_RUN(0x0C04, GCB_Extend),
+  GCB_RUN(0x0C05, GCB_Other), GCB_RUN(0x0C3C, GCB_Extend),
+  GCB_RUN(0x0C3D, GCB_Other), GCB_RUN(0x0C3E, GCB_Extend),
+  GCB_RUN(0x0C41, GCB_SpacingMark), GCB_RUN(0x0C45, GCB_Other),
+  GCB_RUN(0x0C46, GCB_Extend), GCB_RUN(0x0C49, GCB_Other),
+  GCB_RUN(0x0C4A, GCB_Extend), GCB_RUN(0x0C4E, GCB_Other),
+  GCB_RUN(0x0C55, GCB_Extend), GCB_RUN(0x0C57, GCB_Other),
+  GCB_RUN(0x0C62, GCB_Extend), GCB_RUN(0x0C64, GCB_Other),
+  GCB_RUN(0x0C81, GCB_Extend), GCB_RUN(0x0C82, GCB_SpacingMark),
+  GCB_RUN(0x0C84, GCB_Other), GCB_RUN(0x0CBC, GCB_Extend),
+  GCB_RUN(0x0CBD, GCB_Other), GCB_RUN(0x0CBE, GCB_SpacingMark),
+  GCB_RUN(0x0CBF, GCB_Extend), GCB_RUN(0x0CC0, GCB_SpacingMark),
+  GCB_RUN(0x0CC2, GCB_Extend), GCB_RUN(0x0CC3, GCB_SpacingMark),
+  GCB_RUN(0x0CC5, GCB_Other), GCB_RUN(0x0CC6, GCB_Extend),
+  GCB_RUN(0x0CC7, GCB_SpacingMark), GCB_RUN(0x0CC9, GCB_Other),
+  GCB_RUN(0x0CCA, GCB_SpacingMark), GCB_RUN(0x0CCC, GCB_Extend),
+  GCB_RUN(0x0CCE, GCB_Other), GCB_RUN(0x0CD5, GCB_Extend),
+  GCB_RUN(0x0CD7, GCB_Other), GCB_RUN(0x0CE2, GCB_Extend),
+  GCB_RUN(0x0CE4, GCB_Other), GCB_RUN(0x0D00, GCB_Extend),
+  GCB_RUN(0x0D02, GCB_SpacingMark), GCB_RUN(0x0D04, GCB_Other),
+  GCB_RUN(0x0D3B, GCB_Extend), GCB_RUN(0x0D3D, GCB_Other),
+  GCB_RUN(0x0D3E, GCB_Extend), GCB_RUN(0x0D3F, GCB_SpacingMark),
+  GCB_RUN(0x0D41, GCB_Extend), GCB_RUN(0x0D45, GCB_Other),
+  GCB_RUN(0x0D46, GCB_SpacingMark), GCB_RUN(0x0D49, GCB_Other),
+  GCB_RUN(0x0D4A, GCB_SpacingMark), GCB_RUN(0x0D4D, GCB_Extend),
+  GCB_RUN(0x0D4E, GCB_Prepend), GCB_RUN(0x0D4F, GCB_Other),
+  GCB_RUN(0x0D57, GCB_Extend), GCB_RUN(0x0D58, GCB_Other),
+  GCB_RUN(0x0D62, GCB_Extend), GCB_RUN(0x0D64, GCB_Other),
+  GCB_RUN(0x0D81, GCB_Extend), GCB_RUN(0x0D82, GCB_SpacingMark),
+  GCB_RUN(0x0D84, GCB_Other), GCB_RUN(0x0DCA, GCB_Extend),
+  GCB_RUN(0x0DCB, GCB_Other), GCB_RUN(0x0DCF, GCB_Extend),
+  GCB_RUN(0x0DD0, GCB_SpacingMark), GCB_RUN(0x0DD2, GCB_Extend),
+  GCB_RUN(0x0DD5, GCB_Other), GCB_RUN(0x0DD6, GCB_Extend),
+  GCB_RUN(0x0DD7, GCB_Other), GCB_RUN(0x0DD8, GCB_SpacingMark),
+  GCB_RUN(0x0DDF, GCB_Extend), GCB_RUN(0x0DE0, GCB_Other),
+  GCB_RUN(0x0DF2, GCB_SpacingMark), GCB_RUN(0x0DF4, GCB_Other),
+  GCB_RUN(0x0E31, GCB_Extend), GCB_RUN(0x0E32, GCB_Other),
+  GCB_RUN(0x0E33, GCB_SpacingMark), GCB_RUN(0x0E34, GCB_Extend),
+  GCB_RUN(0x0E3B, GCB_Other), GCB_RUN(0x0E47, GCB_Extend),
+  GCB_RUN(0x0E4F, GCB_Other), GCB_RUN(0x0EB1, GCB_Extend),
+  GCB_RUN(0x0EB2, GCB_Other), GCB_RUN(0x0EB3, GCB_SpacingMark),
+  GCB_RUN(0x0EB4, GCB_Extend), GCB_RUN(0x0EBD, GCB_Other),
+  GCB_RUN(0x0EC8, GCB_Extend), GCB_RUN(0x0ECE, GCB_Other),
+  GCB_RUN(0x0F18, GCB_Extend), GCB_RUN(0x0F1A, GCB_Other),
+  GCB_RUN(0x0F35, GCB_Extend), GCB_RUN(0x0F36, GCB_Other),
+  GCB_RUN(0x0F37, GCB_Extend), GCB_RUN(0x0F38, GCB_Other),
+  GCB_RUN(0x0F39, GCB_Extend), GCB_RUN(0x0F3A, GCB_Other),
+  GCB_RUN(0x0F3E, GCB_SpacingMark), GCB_RUN(0x0F40, GCB_Other),
+  GCB_RUN(0x0F71, GCB_Extend), GCB_RUN(0x0F7F, GCB_SpacingMark),
+  GCB_RUN(0x0F80, GCB_Extend), GCB_RUN(0x0F85, GCB_Other),
+  GCB_RUN(0x0F86, GCB_Extend), GCB_RUN(0x0F88, GCB_Other),
+  GCB_RUN(0x0F8D, GCB_Extend), GCB_RUN(0x0F98, GCB_Other),
+  GCB_RUN(0x0F99, GCB_Extend), GCB_RUN(0x0FBD, GCB_Other),
+  GCB_RUN(0x0FC6, GCB_Extend), GCB_RUN(0x0FC7, GCB_Other),
+  GCB_RUN(0x102D, GCB_Extend), GCB_RUN(0x1031, GCB_SpacingMark),
+  GCB_RUN(0x1032, GCB_Extend), GCB_RUN(0x1038, GCB_Other),
+  GCB_RUN(0x1039, GCB_Extend), GCB_RUN(0x103B, GCB_SpacingMark),
+  GCB_RUN(0x103D, GCB_Extend), GCB_RUN(0x103F, GCB_Other),
+  GCB_RUN(0x1056, GCB_SpacingMark), GCB_RUN(0x1058, GCB_Extend),
+  GCB_RUN(0x105A, GCB_Other), GCB_RUN(0x105E, GCB_Extend),
+  GCB_RUN(0x1061, GCB_Other), GCB_RUN(0x1071, GCB_Extend),
+  GCB_RUN(0x1075, GCB_Other), GCB_RUN(0x1082, GCB_Extend),
+  GCB_RUN(0x1083, GCB_Other), GCB_RUN(0x1084, GCB_SpacingMark),
+  GCB_RUN(0x1085, GCB_Extend), GCB_RUN(0x1087, GCB_Other),
+  GCB_RUN(0x108D, GCB_Extend), GCB_RUN(0x108E, GCB_Other),
+  GCB_RUN(0x109D, GCB_Extend), GCB_RUN(0x109E, GCB_Other),
+  GCB_RUN(0x1100, GCB_L), GCB_RUN(0x1160, GCB_V),
+  GCB_RUN(0x11A8, GCB_T), GCB_RUN(0x1200, GCB_Other),
+  GCB_RUN(0x135D, GCB_Extend), GCB_RUN(0x1360, GCB_Other),
+  GCB_RUN(0x1712, GCB_Extend), GCB_RUN(0x1715, GCB_SpacingMark),
+  GCB_RUN(0x1716, GCB_Other), GCB_RUN(0x1732, GCB_Extend),
+  GCB_RUN(0x1734, GCB_SpacingMark), GCB_RUN(0x1735, GCB_Other),
+  GCB_RUN(0x1752, GCB_Extend), GCB_RUN(0x1754, GCB_Other),
+  GCB_RUN(0x1772, GCB_Extend), GCB_RUN(0x1774, GCB_Other),
+  GCB_RUN(0x17B4, GCB_Extend), GCB_RUN(0x17B6, GCB_SpacingMark),
+  GCB_RUN(0x17B7, GCB_Extend), GCB_RUN(0x17BE, GCB_SpacingMark),
+  GCB_RUN(0x17C6, GCB_Extend), GCB_RUN(0x17C7, GCB_SpacingMark),
+  GCB_RUN(0x17C9, GCB_Extend), GCB_RUN(0x17D4, GCB_Other),
+  GCB_RUN(0x17DD, GCB_Extend), GCB_RUN(0x17DE, GCB_Other),
+  GCB_RUN(0x180B, GCB_Extend), GCB_RUN(0x180E, GCB_Control),
+  GCB_RUN(0x180F, GCB_Extend), GCB_RUN(0x1810, GCB_Other),
+  GCB_RUN(0x1885, GCB_Extend), GCB_RUN(0x1887, GCB_Other),
+  GCB_RUN(0x18A9, GCB_Extend), GCB_RUN(0x18AA, GCB_Other),
+  GCB_RUN(0x1920, GCB_Extend), GCB_RUN(0x1923, GCB_SpacingMark),
+  GCB_RUN(0x1927, GCB_Extend), GCB_RUN(0x1929, GCB_SpacingMark),
+  GCB_RUN(0x192C, GCB_Other), GCB_RUN(0x1930, GCB_SpacingMark),
+  GCB_RUN(0x1932, GCB_Extend), GCB_RUN(0x1933, GCB_SpacingMark),
+  GCB_RUN(0x1939, GCB_Extend), GCB_RUN(0x193C, GCB_Other),
+  GCB_RUN(0x1A17, GCB_Extend), GCB_RUN(0x1A19, GCB_SpacingMark),
+  GCB_RUN(0x1A1B, GCB_Extend), GCB_RUN(0x1A1C, GCB_Other),
+  GCB_RUN(0x1A55, GCB_SpacingMark), GCB_RUN(0x1A56, GCB_Extend),
+  GCB_RUN(0x1A57, GCB_SpacingMark), GCB_RUN(0x1A58, GCB_Extend),
+  GCB_RUN(0x1A5F, GCB_Other), GCB_RUN(0x1A60, GCB_Extend),
+  GCB_RUN(0x1A61, GCB_Other), GCB_RUN(0x1A62, GCB_Extend),
+  GCB_RUN(0x1A63, GCB_Other), GCB_RUN(0x1A65, GCB_Extend),
+  GCB_RUN(0x1A6D, GCB_SpacingMark), GCB_RUN(0x1A73, GCB_Extend),
+  GCB_RUN(0x1A7D, GCB_Other), GCB_RUN(0x1A7F, GCB_Extend),
+  GCB_RUN(0x1A80, GCB_Other), GCB_RUN(0x1AB0, GCB_Extend),
+  GCB_RUN(0x1ACF, GCB_Other), GCB_RUN(0x1B00, GCB_Extend),
+  GCB_RUN(0x1B04, GCB_SpacingMark), GCB_RUN(0x1B05, GCB_Other),
+  GCB_RUN(0x1B34, GCB_Extend), GCB_RUN(0x1B3B, GCB_SpacingMark),
+  GCB_RUN(0x1B3C, GCB_Extend), GCB_RUN(0x1B3D, GCB_SpacingMark),
+  GCB_RUN(0x1B42, GCB_Extend), GCB_RUN(0x1B43, GCB_SpacingMark),
+  GCB_RUN(0x1B45, GCB_Other), GCB_RUN(0x1B6B, GCB_Extend),
+  GCB_RUN(0x1B74, GCB_Other), GCB_RUN(0x1B80, GCB_Extend),
+  GCB_RUN(0x1B82, GCB_SpacingMark), GCB_RUN(0x1B83, GCB_Other),
+  GCB_RUN(0x1BA1, GCB_SpacingMark), GCB_RUN(0x1BA2, GCB_Extend),
+  GCB_RUN(0x1BA6, GCB_SpacingMark), GCB_RUN(0x1BA8, GCB_Extend),
+  GCB_RUN(0x1BAA, GCB_SpacingMark), GCB_RUN(0x1BAB, GCB_Extend),
+  GCB_RUN(0x1BAE, GCB_Other), GCB_RUN(0x1BE6, GCB_Extend),
+  GCB_RUN(0x1BE7, GCB_SpacingMark), GCB_RUN(0x1BE8, GCB_Extend),
+  GCB_RUN(0x1BEA, GCB_SpacingMark), GCB_RUN(0x1BED, GCB_Extend),
+  GCB_RUN(0x1BEE, GCB_SpacingMark), GCB_RUN(0x1BEF, GCB_Extend),
+  GCB_RUN(0x1BF2, GCB_SpacingMark), GCB_RUN(0x1BF4, GCB_Other),
+  GCB_RUN(0x1C24, GCB_SpacingMark), GCB_RUN(0x1C2C, GCB_Extend),
+  GCB_RUN(0x1C34, GCB_SpacingMark), GCB_RUN(0x1C36, GCB_Extend),
+  GCB_RUN(0x1C38, GCB_Other), GCB_RUN(0x1CD0, GCB_Extend),
+  GCB_RUN(0x1CD3, GCB_Other), GCB_RUN(0x1CD4, GCB_Extend),
+  GCB_RUN(0x1CE1, GCB_SpacingMark), GCB_RUN(0x1CE2, GCB_Extend),
+  GCB_RUN(0x1CE9, GCB_Other), GCB_RUN(0x1CED, GCB_Extend),
+  GCB_RUN(0x1CEE, GCB_Other), GCB_RUN(0x1CF4, GCB_Extend),
+  GCB_RUN(0x1CF5, GCB_Other), GCB_RUN(0x1CF7, GCB_SpacingMark),
+  GCB_RUN(0x1CF8, GCB_Extend), GCB_RUN(0x1CFA, GCB_Other),
+  GCB_RUN(0x1DC0, GCB_Extend), GCB_RUN(0x1E00, GCB_Other),
+  GCB_RUN(0x200B, GCB_Control), GCB_RUN(0x200C, GCB_Extend),
+  GCB_RUN(0x200D, GCB_ZWJ), GCB_RUN(0x200E, GCB_Control),
+  GCB_RUN(0x2010, GCB_Other), GCB_RUN(0x2028, GCB_Control),
+  GCB_RUN(0x202F, GCB_Other), GCB_RUN(0x203C, GCB_ExtPict),
+  GCB_RUN(0x203D, GCB_Other), GCB_RUN(0x2049, GCB_ExtPict),
+  GCB_RUN(0x204A, GCB_Other), GCB_RUN(0x2060, GCB_Control),
+  GCB_RUN(0x2070, GCB_Other), GCB_RUN(0x20D0, GCB_Extend),
+  GCB_RUN(0x20F1, GCB_Other), GCB_RUN(0x2122, GCB_ExtPict),
+  GCB_RUN(0x2123, GCB_Other), GCB_RUN(0x2139, GCB_ExtPict),
+  GCB_RUN(0x213A, GCB_Other), GCB_RUN(0x2194, GCB_ExtPict),
+  GCB_RUN(0x219A, GCB_Other), GCB_RUN(0x21A9, GCB_ExtPict),
+  GCB_RUN(0x21AB, GCB_Other), GCB_RUN(0x231A, GCB_ExtPict),
+  GCB_RUN(0x231C, GCB_Other), GCB_RUN(0x2328, GCB_ExtPict),
+  GCB_RUN(0x2329, GCB_Other), GCB_RUN(0x2388, GCB_ExtPict),
+  GCB_RUN(0x2389, GCB_Other), GCB_RUN(0x23CF, GCB_ExtPict),
+  GCB_RUN(0x23D0, GCB_Other), GCB_RUN(0x23E9, GCB_ExtPict),
+  GCB_RUN(0x23F4, GCB_Other), GCB_RUN(0x23F8, GCB_ExtPict),
+  GCB_RUN(0x23FB, GCB_Other), GCB_RUN(0x24C2, GCB_ExtPict),
+  GCB_RUN(0x24C3, GCB_Other), GCB_RUN(0x25AA, GCB_ExtPict),
+  GCB_RUN(0x25AC, GCB_Other), GCB_RUN(0x25B6, GCB_ExtPict),
+  GCB_RUN(0x25B7, GCB_Other), GCB_RUN(0x25C0, GCB_ExtPict),
+  GCB_RUN(0x25C1, GCB_Other), GCB_RUN(0x25FB, GCB_ExtPict),
+  GCB_RUN(0x25FF, GCB_Other), GCB_RUN(0x2600, GCB_ExtPict),
+  GCB_RUN(0x2606, GCB_Other), GCB_RUN(0x2607, GCB_ExtPict),
+  GCB_RUN(0x2613, GCB_Other), GCB_RUN(0x2614, GCB_ExtPict),
+  GCB_RUN(0x2686, GCB_Other), GCB_RUN(0x2690, GCB_ExtPict),
+  GCB_RUN(0x2706, GCB_Other), GCB_RUN(0x2708, GCB_ExtPict),
+  GCB_RUN(0x2713, GCB_Other), GCB_RUN(0x2714, GCB_ExtPict),
+  GCB_RUN(0x2715, GCB_Other), GCB_RUN(0x2716, GCB_ExtPict),
+  GCB_RUN(0x2717, GCB_Other), GCB_RUN(0x271D, GCB_ExtPict),
+  GCB_RUN(0x271E, GCB_Other), GCB_RUN(0x2721, GCB_ExtPict),
+  GCB_RUN(0x2722, GCB_Other), GCB_RUN(0x2728, GCB_ExtPict),
+  GCB_RUN(0x2729, GCB_Other), GCB_RUN(0x2733, GCB_ExtPict),
+  GCB_RUN(0x2735, GCB_Other), GCB_RUN(0x2744, GCB_ExtPict),
+  GCB_RUN(0x2745, GCB_Other), GCB_RUN(0x2747, GCB_ExtPict),
+  GCB_RUN(0x2748, GCB_Other), GCB_RUN(0x274C, GCB_ExtPict),
+  GCB_RUN(0x274D, GCB_Other), GCB_RUN(0x274E, GCB_ExtPict),
+  GCB_RUN(0x274F, GCB_Other), GCB_RUN(0x2753, GCB_ExtPict),
+  GCB_RUN(0x2756, GCB_Other), GCB_RUN(0x2757, GCB_ExtPict),
+  GCB_RUN(0x2758, GCB_Other), GCB_RUN(0x2763, GCB_ExtPict),
+  GCB_RUN(0x2768, GCB_Other), GCB_RUN(0x2795, GCB_ExtPict),
+  GCB_RUN(0x2798, GCB_Other), GCB_RUN(0x27A1, GCB_ExtPict),
+  GCB_RUN(0x27A2, GCB_Other), GCB_RUN(0x27B0, GCB_ExtPict),
+  GCB_RUN(0x27B1, GCB_Other), GCB_RUN(0x27BF, GCB_ExtPict),
+  GCB_RUN(0x27C0, GCB_Other), GCB_RUN(0x2934, GCB_ExtPict),
+  GCB_RUN(0x2936, GCB_Other), GCB_RUN(0x2B05, GCB_ExtPict),
+  GCB_RUN(0x2B08, GCB_Other), GCB_RUN(0x2B1B, GCB_ExtPict),
+  GCB_RUN(0x2B1D, GCB_Other), GCB_RUN(0x2B50, GCB_ExtPict),
+  GCB_RUN(0x2B51, GCB_Other), GCB_RUN(0x2B55, GCB_ExtPict),
+  GCB_RUN(0x2B56, GCB_Other), GCB_RUN(0x2CEF, GCB_Extend),
+  GCB_RUN(0x2CF2, GCB_Other), GCB_RUN(0x2D7F, GCB_Extend),
+  GCB_RUN(0x2D80, GCB_Other), GCB_RUN(0x2DE0, GCB_Extend),
+  GCB_RUN(0x2E00, GCB_Other), GCB_RUN(0x302A, GCB_Extend),
+  GCB_RUN(0x3030, GCB_ExtPict), GCB_RUN(0x3031, GCB_Other),
+  GCB_RUN(0x303D, GCB_ExtPict), GCB_RUN(0x303E, GCB_Other),
+  GCB_RUN(0x3099, GCB_Extend), GCB_RUN(0x309B, GCB_Other),
+  GCB_RUN(0x3297, GCB_ExtPict), GCB_RUN(0x3298, GCB_Other),
+  GCB_RUN(0x3299, GCB_ExtPict), GCB_RUN(0x329A, GCB_Other),
+  GCB_RUN(0xA66F, GCB_Extend), GCB_RUN(0xA673, GCB_Other),
+  GCB_RUN(0xA674, GCB_Extend), GCB_RUN(0xA67E, GCB_Other),
+  GCB_RUN(0xA69E, GCB_Extend), GCB_RUN(0xA6A0, GCB_Other),
+  GCB_RUN(0xA6F0, GCB_Extend), GCB_RUN(0xA6F2, GCB_Other),
+  GCB_RUN(0xA802, GCB_Extend), GCB_RUN(0xA803, GCB_Other),
+  GCB_RUN(0xA806, GCB_Extend), GCB_RUN(0xA807, GCB_Other),
+  GCB_RUN(0xA80B, GCB_Extend), GCB_RUN(0xA80C, GCB_Other),
+  GCB_RUN(0xA823, GCB_SpacingMark), GCB_RUN(0xA825, GCB_Extend),
+  GCB_RUN(0xA827, GCB_SpacingMark), GCB_RUN(0xA828, GCB_Other),
+  GCB_RUN(0xA82C, GCB_Extend), GCB_RUN(0xA82D, GCB_Other),
+  GCB_RUN(0xA880, GCB_SpacingMark), GCB_RUN(0xA882, GCB_Other),
+  GCB_RUN(0xA8B4, GCB_SpacingMark), GCB_RUN(0xA8C4, GCB_Extend),
+  GCB_RUN(0xA8C6, GCB_Other), GCB_RUN(0xA8E0, GCB_Extend),
+  GCB_RUN(0xA8F2, GCB_Other), GCB_RUN(0xA8FF, GCB_Extend),
+  GCB_RUN(0xA900, GCB_Other), GCB_RUN(0xA926, GCB_Extend),
+  GCB_RUN(0xA92E, GCB_Other), GCB_RUN(0xA947, GCB_Extend),
+  GCB_RUN(0xA952, GCB_SpacingMark), GCB_RUN(0xA954, GCB_Other),
+  GCB_RUN(0xA960, GCB_L), GCB_RUN(0xA97D, GCB_Other),
+  GCB_RUN(0xA980, GCB_Extend), GCB_RUN(0xA983, GCB_SpacingMark),
+  GCB_RUN(0xA984, GCB_Other), GCB_RUN(0xA9B3, GCB_Extend),
+  GCB_RUN(0xA9B4, GCB_SpacingMark), GCB_RUN(0xA9B6, GCB_Extend),
+  GCB_RUN(0xA9BA, GCB_SpacingMark), GCB_RUN(0xA9BC, GCB_Extend),
+  GCB_RUN(0xA9BE, GCB_SpacingMark), GCB_RUN(0xA9C1, GCB_Other),
+  GCB_RUN(0xA9E5, GCB_Extend), GCB_RUN(0xA9E6, GCB_Other),
+  GCB_RUN(0xAA29, GCB_Extend), GCB_RUN(0xAA2F, GCB_SpacingMark),
+  GCB_RUN(0xAA31, GCB_Extend), GCB_RUN(0xAA33, GCB_SpacingMark),
+  GCB_RUN(0xAA35, GCB_Extend), GCB_RUN(0xAA37, GCB_Other),
+  GCB_RUN(0xAA43, GCB_Extend), GCB_RUN(0xAA44, GCB_Other),
+  GCB_RUN(0xAA4C, GCB_Extend), GCB_RUN(0xAA4D, GCB_SpacingMark),
+  GCB_RUN(0xAA4E, GCB_Other), GCB_RUN(0xAA7C, GCB_Extend),
+  GCB_RUN(0xAA7D, GCB_Other), GCB_RUN(0xAAB0, GCB_Extend),
+  GCB_RUN(0xAAB1, GCB_Other), GCB_RUN(0xAAB2, GCB_Extend),
+  GCB_RUN(0xAAB5, GCB_Other), GCB_RUN(0xAAB7, GCB_Extend),
+  GCB_RUN(0xAAB9, GCB_Other), GCB_RUN(0xAABE, GCB_Extend),
+  GCB_RUN(0xAAC0, GCB_Other), GCB_RUN(0xAAC1, GCB_Extend),
+  GCB_RUN(0xAAC2, GCB_Other), GCB_RUN(0xAAEB, GCB_SpacingMark),
+  GCB_RUN(0xAAEC, GCB_Extend), GCB_RUN(0xAAEE, GCB_SpacingMark),
+  GCB_RUN(0xAAF0, GCB_Other), GCB_RUN(0xAAF5, GCB_SpacingMark),
+  GCB_RUN(0xAAF6, GCB_Extend), GCB_RUN(0xAAF7, GCB_Other),
+  GCB_RUN(0xABE3, GCB_SpacingMark), GCB_RUN(0xABE5, GCB_Extend),
+  GCB_RUN(0xABE6, GCB_SpacingMark), GCB_RUN(0xABE8, GCB_Extend),
+  GCB_RUN(0xABE9, GCB_SpacingMark), GCB_RUN(0xABEB, GCB_Other),
+  GCB_RUN(0xABEC, GCB_SpacingMark), GCB_RUN(0xABED, GCB_Extend),
+  GCB_RUN(0xABEE, GCB_Other), GCB_RUN(0xD7B0, GCB_V),
+  GCB_RUN(0xD7C7, GCB_Other), GCB_RUN(0xD7CB, GCB_T),
+  GCB_RUN(0xD7FC, GCB_Other), GCB_RUN(0xFB1E, GCB_Extend),
+  GCB_RUN(0xFB1F, GCB_Other), GCB_RUN(0xFE00, GCB_Extend),
+  GCB_RUN(0xFE10, GCB_Other), GCB_RUN(0xFE20, GCB_Extend),
+  GCB_RUN(0xFE30, GCB_Other), GCB_RUN(0xFEFF, GCB_Control),
+  GCB_RUN(0xFF00, GCB_Other), GCB_RUN(0xFF9E, GCB_Extend),
+  GCB_RUN(0xFFA0, GCB_Other), GCB_RUN(0xFFF0, GCB_Control),
+  GCB_RUN(0xFFFC, GCB_Other), GCB_RUN(0x101FD, GCB_Extend),
+  GCB_RUN(0x101FE, GCB_Other), GCB_RUN(0x102E0, GCB_Extend),
+  GCB_RUN(0x102E1, GCB_Other), GCB_RUN(0x10376, GCB_Extend),
+  GCB_RUN(0x1037B, GCB_Other), GCB_RUN(0x10A01, GCB_Extend),
+  GCB_RUN(0x10A04, GCB_Other), GCB_RUN(0x10A05, GCB_Extend),
+  GCB_RUN(0x10A07, GCB_Other), GCB_RUN(0x10A0C, GCB_Extend),
+  GCB_RUN(0x10A10, GCB_Other), GCB_RUN(0x10A38, GCB_Extend),
+  GCB_RUN(0x10A3B, GCB_Other), GCB_RUN(0x10A3F, GCB_Extend),
+  GCB_RUN(0x10A40, GCB_Other), GCB_RUN(0x10AE5, GCB_Extend),
+  GCB_RUN(0x10AE7, GCB_Other), GCB_RUN(0x10D24, GCB_Extend),
+  GCB_RUN(0x10D28, GCB_Other), GCB_RUN(0x10EAB, GCB_Extend),
+  GCB_RUN(0x10EAD, GCB_Other), GCB_RUN(0x10F46, GCB_Extend),
+  GCB_RUN(0x10F51, GCB_Other), GCB_RUN(0x10F82, GCB_Extend),
+  GCB_RUN(0x10F86, GCB_Other), GCB_RUN(0x11000, GCB_SpacingMark),
+  GCB_RUN(0x11001, GCB_Extend), GCB_RUN(0x11002, GCB_SpacingMark),
+  GCB_RUN(0x11003, GCB_Other), GCB_RUN(0x11038, GCB_Extend),
+  GCB_RUN(0x11047, GCB_Other), GCB_RUN(0x11070, GCB_Extend),
+  GCB_RUN(0x11071, GCB_Other), GCB_RUN(0x11073, GCB_Extend),
+  GCB_RUN(0x11075, GCB_Other), GCB_RUN(0x1107F, GCB_Extend),
+  GCB_RUN(0x11082, GCB_SpacingMark), GCB_RUN(0x11083, GCB_Other),
+  GCB_RUN(0x110B0, GCB_SpacingMark), GCB_RUN(0x110B3, GCB_Extend),
+  GCB_RUN(0x110B7, GCB_SpacingMark), GCB_RUN(0x110B9, GCB_Extend),
+  GCB_RUN(0x110BB, GCB_Other), GCB_RUN(0x110BD, GCB_Prepend),
+  GCB_RUN(0x110BE, GCB_Other), GCB_RUN(0x110C2, GCB_Extend),
+  GCB_RUN(0x110C3, GCB_Other), GCB_RUN(0x110CD, GCB_Prepend),
+  GCB_RUN(0x110CE, GCB_Other), GCB_RUN(0x11100, GCB_Extend),
+  GCB_RUN(0x11103, GCB_Other), GCB_RUN(0x11127, GCB_Extend),
+  GCB_RUN(0x1112C, GCB_SpacingMark), GCB_RUN(0x1112D, GCB_Extend),
+  GCB_RUN(0x11135, GCB_Other), GCB_RUN(0x11145, GCB_SpacingMark),
+  GCB_RUN(0x11147, GCB_Other), GCB_RUN(0x11173, GCB_Extend),
+  GCB_RUN(0x11174, GCB_Other), GCB_RUN(0x11180, GCB_Extend),
+  GCB_RUN(0x11182, GCB_SpacingMark), GCB_RUN(0x11183, GCB_Other),
+  GCB_RUN(0x111B3, GCB_SpacingMark), GCB_RUN(0x111B6, GCB_Extend),
+  GCB_RUN(0x111BF, GCB_SpacingMark), GCB_RUN(0x111C1, GCB_Other),
+  GCB_RUN(0x111C2, GCB_Prepend), GCB_RUN(0x111C4, GCB_Other),
+  GCB_RUN(0x111C9, GCB_Extend), GCB_RUN(0x111CD, GCB_Other),
+  GCB_RUN(0x111CE, GCB_SpacingMark), GCB_RUN(0x111CF, GCB_Extend),
+  GCB_RUN(0x111D0, GCB_Other), GCB_RUN(0x1122C, GCB_SpacingMark),
+  GCB_RUN(0x1122F, GCB_Extend), GCB_RUN(0x11232, GCB_SpacingMark),
+  GCB_RUN(0x11234, GCB_Extend), GCB_RUN(0x11235, GCB_SpacingMark),
+  GCB_RUN(0x11236, GCB_Extend), GCB_RUN(0x11238, GCB_Other),
+  GCB_RUN(0x1123E, GCB_Extend), GCB_RUN(0x1123F, GCB_Other),
+  GCB_RUN(0x112DF, GCB_Extend), GCB_RUN(0x112E0, GCB_SpacingMark),
+  GCB_RUN(0x112E3, GCB_Extend), GCB_RUN(0x112EB, GCB_Other),
+  GCB_RUN(0x11300, GCB_Extend), GCB_RUN(0x11302, GCB_SpacingMark),
+  GCB_RUN(0x11304, GCB_Other), GCB_RUN(0x1133B, GCB_Extend),
+  GCB_RUN(0x1133D, GCB_Other), GCB_RUN(0x1133E, GCB_Extend),
+  GCB_RUN(0x1133F, GCB_SpacingMark), GCB_RUN(0x11340, GCB_Extend),
+  GCB_RUN(0x11341, GCB_SpacingMark), GCB_RUN(0x11345, GCB_Other),
+  GCB_RUN(0x11347, GCB_SpacingMark), GCB_RUN(0x11349, GCB_Other),
+  GCB_RUN(0x1134B, GCB_SpacingMark), GCB_RUN(0x1134E, GCB_Other),
+  GCB_RUN(0x11357, GCB_Extend), GCB_RUN(0x11358, GCB_Other),
+  GCB_RUN(0x11362, GCB_SpacingMark), GCB_RUN(0x11364, GCB_Other),
+  GCB_RUN(0x11366, GCB_Extend), GCB_RUN(0x1136D, GCB_Other),
+  GCB_RUN(0x11370, GCB_Extend), GCB_RUN(0x11375, GCB_Other),
+  GCB_RUN(0x11435, GCB_SpacingMark), GCB_RUN(0x11438, GCB_Extend),
+  GCB_RUN(0x11440, GCB_SpacingMark), GCB_RUN(0x11442, GCB_Extend),
+  GCB_RUN(0x11445, GCB_SpacingMark), GCB_RUN(0x11446, GCB_Extend),
+  GCB_RUN(0x11447, GCB_Other), GCB_RUN(0x1145E, GCB_Extend),
+  GCB_RUN(0x1145F, GCB_Other), GCB_RUN(0x114B0, GCB_Extend),
+  GCB_RUN(0x114B1, GCB_SpacingMark), GCB_RUN(0x114B3, GCB_Extend),
+  GCB_RUN(0x114B9, GCB_SpacingMark), GCB_RUN(0x114BA, GCB_Extend),
+  GCB_RUN(0x114BB, GCB_SpacingMark), GCB_RUN(0x114BD, GCB_Extend),
+  GCB_RUN(0x114BE, GCB_SpacingMark), GCB_RUN(0x114BF, GCB_Extend),
+  GCB_RUN(0x114C1, GCB_SpacingMark), GCB_RUN(0x114C2, GCB_Extend),
+  GCB_RUN(0x114C4, GCB_Other), GCB_RUN(0x115AF, GCB_Extend),
+  GCB_RUN(0x115B0, GCB_SpacingMark), GCB_RUN(0x115B2, GCB_Extend),
+  GCB_RUN(0x115B6, GCB_Other), GCB_RUN(0x115B8, GCB_SpacingMark),
+  GCB_RUN(0x115BC, GCB_Extend), GCB_RUN(0x115BE, GCB_SpacingMark),
+  GCB_RUN(0x115BF, GCB_Extend), GCB_RUN(0x115C1, GCB_Other),
+  GCB_RUN(0x115DC, GCB_Extend), GCB_RUN(0x115DE, GCB_Other),
+  GCB_RUN(0x11630, GCB_SpacingMark), GCB_RUN(0x11633, GCB_Extend),
+  GCB_RUN(0x1163B, GCB_SpacingMark), GCB_RUN(0x1163D, GCB_Extend),
+  GCB_RUN(0x1163E, GCB_SpacingMark), GCB_RUN(0x1163F, GCB_Extend),
+  GCB_RUN(0x11641, GCB_Other), GCB_RUN(0x116AB, GCB_Extend),
+  GCB_RUN(0x116AC, GCB_SpacingMark), GCB_RUN(0x116AD, GCB_Extend),
+  GCB_RUN(0x116AE, GCB_SpacingMark), GCB_RUN(0x116B0, GCB_Extend),
+  GCB_RUN(0x116B6, GCB_SpacingMark), GCB_RUN(0x116B7, GCB_Extend),
+  GCB_RUN(0x116B8, GCB_Other), GCB_RUN(0x1171D, GCB_Extend),
+  GCB_RUN(0x11720, GCB_Other), GCB_RUN(0x11722, GCB_Extend),
+  GCB_RUN(0x11726, GCB_SpacingMark), GCB_RUN(0x11727, GCB_Extend),
+  GCB_RUN(0x1172C, GCB_Other), GCB_RUN(0x1182C, GCB_SpacingMark),
+  GCB_RUN(0x1182F, GCB_Extend), GCB_RUN(0x11838, GCB_SpacingMark),
+  GCB_RUN(0x11839, GCB_Extend), GCB_RUN(0x1183B, GCB_Other),
+  GCB_RUN(0x11930, GCB_Extend), GCB_RUN(0x11931, GCB_SpacingMark),
+  GCB_RUN(0x11936, GCB_Other), GCB_RUN(0x11937, GCB_SpacingMark),
+  GCB_RUN(0x11939, GCB_Other), GCB_RUN(0x1193B, GCB_Extend),
+  GCB_RUN(0x1193D, GCB_SpacingMark), GCB_RUN(0x1193E, GCB_Extend),
+  GCB_RUN(0x1193F, GCB_Prepend), GCB_RUN(0x11940, GCB_SpacingMark),
+  GCB_RUN(0x11941, GCB_Prepend), GCB_RUN(0x11942, GCB_SpacingMark),
+  GCB_RUN(0x11943, GCB_Extend), GCB_RUN(0x11944, GCB_Other),
+  GCB_RUN(0x119D1, GCB_SpacingMark), GCB_RUN(0x119D4, GCB_Extend),
+  GCB_RUN(0x119D8, GCB_Other), GCB_RUN(0x119DA, GCB_Extend),
+  GCB_RUN(0x119DC, GCB_SpacingMark), GCB_RUN(0x119E0, GCB_Extend),
+  GCB_RUN(0x119E1, GCB_Other), GCB_RUN(0x119E4, GCB_SpacingMark),
+  GCB_RUN(0x119E5, GCB_Other), GCB_RUN(0x11A01, GCB_Extend),
+  GCB_RUN(0x11A0B, GCB_Other), GCB_RUN(0x11A33, GCB_Extend),
+  GCB_RUN(0x11A39, GCB_SpacingMark), GCB_RUN(0x11A3A, GCB_Prepend),
+  GCB_RUN(0x11A3B, GCB_Extend), GCB_RUN(0x11A3F, GCB_Other),
+  GCB_RUN(0x11A47, GCB_Extend), GCB_RUN(0x11A48, GCB_Other),
+  GCB_RUN(0x11A51, GCB_Extend), GCB_RUN(0x11A57, GCB_SpacingMark),
+  GCB_RUN(0x11A59, GCB_Extend), GCB_RUN(0x11A5C, GCB_Other),
+  GCB_RUN(0x11A84, GCB_Prepend), GCB_RUN(0x11A8A, GCB_Extend),
+  GCB_RUN(0x11A97, GCB_SpacingMark), GCB_RUN(0x11A98, GCB_Extend),
+  GCB_RUN(0x11A9A, GCB_Other), GCB_RUN(0x11C2F, GCB_SpacingMark),
+  GCB_RUN(0x11C30, GCB_Extend), GCB_RUN(0x11C37, GCB_Other),
+  GCB_RUN(0x11C38, GCB_Extend), GCB_RUN(0x11C3E, GCB_SpacingMark),
+  GCB_RUN(0x11C3F, GCB_Extend), GCB_RUN(0x11C40, GCB_Other),
+  GCB_RUN(0x11C92, GCB_Extend), GCB_RUN(0x11CA8, GCB_Other),
+  GCB_RUN(0x11CA9, GCB_SpacingMark), GCB_RUN(0x11CAA, GCB_Extend),
+  GCB_RUN(0x11CB1, GCB_SpacingMark), GCB_RUN(0x11CB2, GCB_Extend),
+  GCB_RUN(0x11CB4, GCB_SpacingMark), GCB_RUN(0x11CB5, GCB_Extend),
+  GCB_RUN(0x11CB7, GCB_Other), GCB_RUN(0x11D31, GCB_Extend),
+  GCB_RUN(0x11D37, GCB_Other), GCB_RUN(0x11D3A, GCB_Extend),
+  GCB_RUN(0x11D3B, GCB_Other), GCB_RUN(0x11D3C, GCB_Extend),
+  GCB_RUN(0x11D3E, GCB_Other), GCB_RUN(0x11D3F, GCB_Extend),
+  GCB_RUN(0x11D46, GCB_Prepend), GCB_RUN(0x11D47, GCB_Extend),
+  GCB_RUN(0x11D48, GCB_Other), GCB_RUN(0x11D8A, GCB_SpacingMark),
+  GCB_RUN(0x11D8F, GCB_Other), GCB_RUN(0x11D90, GCB_Extend),
+  GCB_RUN(0x11D92, GCB_Other), GCB_RUN(0x11D93, GCB_SpacingMark),
+  GCB_RUN(0x11D95, GCB_Extend), GCB_RUN(0x11D96, GCB_SpacingMark),
+  GCB_RUN(0x11D97, GCB_Extend), GCB_RUN(0x11D98, GCB_Other),
+  GCB_RUN(0x11EF3, GCB_Extend), GCB_RUN(0x11EF5, GCB_SpacingMark),
+  GCB_RUN(0x11EF7, GCB_Other), GCB_RUN(0x13430, GCB_Control),
+  GCB_RUN(0x13439, GCB_Other), GCB_RUN(0x16AF0, GCB_Extend),
+  GCB_RUN(0x16AF5, GCB_Other), GCB_RUN(0x16B30, GCB_Extend),
+  GCB_RUN(0x16B37, GCB_Other), GCB_RUN(0x16F4F, GCB_Extend),
+  GCB_RUN(0x16F50, GCB_Other), GCB_RUN(0x16F51, GCB_SpacingMark),
+  GCB_RUN(0x16F88, GCB_Other), GCB_RUN(0x16F8F, GCB_Extend),
+  GCB_RUN(0x16F93, GCB_Other), GCB_RUN(0x16FE4, GCB_Extend),
+  GCB_RUN(0x16FE5, GCB_Other), GCB_RUN(0x16FF0, GCB_SpacingMark),
+  GCB_RUN(0x16FF2, GCB_Other), GCB_RUN(0x1BC9D, GCB_Extend),
+  GCB_RUN(0x1BC9F, GCB_Other), GCB_RUN(0x1BCA0, GCB_Control),
+  GCB_RUN(0x1BCA4, GCB_Other), GCB_RUN(0x1CF00, GCB_Extend),
+  GCB_RUN(0x1CF2E, GCB_Other), GCB_RUN(0x1CF30, GCB_Extend),
+  GCB_RUN(0x1CF47, GCB_Other), GCB_RUN(0x1D165, GCB_Extend),
+  GCB_RUN(0x1D166, GCB_SpacingMark), GCB_RUN(0x1D167, GCB_Extend),
+  GCB_RUN(0x1D16A, GCB_Other), GCB_RUN(0x1D16D, GCB_SpacingMark),
+  GCB_RUN(0x1D16E, GCB_Extend), GCB_RUN(0x1D173, GCB_Control),
+  GCB_RUN(0x1D17B, GCB_Extend), GCB_RUN(0x1D183, GCB_Other),
+  GCB_RUN(0x1D185, GCB_Extend), GCB_RUN(0x1D18C, GCB_Other),
+  GCB_RUN(0x1D1AA, GCB_Extend), GCB_RUN(0x1D1AE, GCB_Other),
+  GCB_RUN(0x1D242, GCB_Extend), GCB_RUN(0x1D245, GCB_Other),
+  GCB_RUN(0x1DA00, GCB_Extend), GCB_RUN(0x1DA37, GCB_Other),
+  GCB_RUN(0x1DA3B, GCB_Extend), GCB_RUN(0x1DA6D, GCB_Other),
+  GCB_RUN(0x1DA75, GCB_Extend), GCB_RUN(0x1DA76, GCB_Other),
+  GCB_RUN(0x1DA84, GCB_Extend), GCB_RUN(0x1DA85, GCB_Other),
+  GCB_RUN(0x1DA9B, GCB_Extend), GCB_RUN(0x1DAA0, GCB_Other),
+  GCB_RUN(0x1DAA1, GCB_Extend), GCB_RUN(0x1DAB0, GCB_Other),
+  GCB_RUN(0x1E000, GCB_Extend), GCB_RUN(0x1E007, GCB_Other),
+  GCB_RUN(0x1E008, GCB_Extend), GCB_RUN(0x1E019, GCB_Other),
+  GCB_RUN(0x1E01B, GCB_Extend), GCB_RUN(0x1E022, GCB_Other),
+  GCB_RUN(0x1E023, GCB_Extend), GCB_RUN(0x1E025, GCB_Other),
+  GCB_RUN(0x1E026, GCB_Extend), GCB_RUN(0x1E02B, GCB_Other),
+  GCB_RUN(0x1E130, GCB_Extend), GCB_RUN(0x1E137, GCB_Other),
+  GCB_RUN(0x1E2AE, GCB_Extend), GCB_RUN(0x1E2AF, GCB_Other),
+  GCB_RUN(0x1E2EC, GCB_Extend), GCB_RUN(0x1E2F0, GCB_Other),
+  GCB_RUN(0x1E8D0, GCB_Extend), GCB_RUN(0x1E8D7, GCB_Other),
+  GCB_RUN(0x1E944, GCB_Extend), GCB_RUN(0x1E94B, GCB_Other),
+  GCB_RUN(0x1F000, GCB_ExtPict), GCB_RUN(0x1F100, GCB_Other),
+  GCB_RUN(0x1F10D, GCB_ExtPict), GCB_RUN(0x1F110, GCB_Other),
+  GCB_RUN(0x1F12F, GCB_ExtPict), GCB_RUN(0x1F130, GCB_Other),
+  GCB_RUN(0x1F16C, GCB_ExtPict), GCB_RUN(0x1F172, GCB_Other),
+  GCB_RUN(0x1F17E, GCB_ExtPict), GCB_RUN(0x1F180, GCB_Other),
+  GCB_RUN(0x1F18E, GCB_ExtPict), GCB_RUN(0x1F18F, GCB_Other),
+  GCB_RUN(0x1F191, GCB_ExtPict), GCB_RUN(0x1F19B, GCB_Other),
+  GCB_RUN(0x1F1AD, GCB_ExtPict), GCB_RUN(0x1F1E6, GCB_RI),
+  GCB_RUN(0x1F200, GCB_Other), GCB_RUN(0x1F201, GCB_ExtPict),
+  GCB_RUN(0x1F210, GCB_Other), GCB_RUN(0x1F21A, GCB_ExtPict),
+  GCB_RUN(0x1F21B, GCB_Other), GCB_RUN(0x1F22F, GCB_ExtPict),
+  GCB_RUN(0x1F230, GCB_Other), GCB_RUN(0x1F232, GCB_ExtPict),
+  GCB_RUN(0x1F23B, GCB_Other), GCB_RUN(0x1F23C, GCB_ExtPict),
+  GCB_RUN(0x1F240, GCB_Other), GCB_RUN(0x1F249, GCB_ExtPict),
+  GCB_RUN(0x1F3FB, GCB_Extend), GCB_RUN(0x1F400, GCB_ExtPict),
+  GCB_RUN(0x1F53E, GCB_Other), GCB_RUN(0x1F546, GCB_ExtPict),
+  GCB_RUN(0x1F650, GCB_Other), GCB_RUN(0x1F680, GCB_ExtPict),
+  GCB_RUN(0x1F700, GCB_Other), GCB_RUN(0x1F774, GCB_ExtPict),
+  GCB_RUN(0x1F780, GCB_Other), GCB_RUN(0x1F7D5, GCB_ExtPict),
+  GCB_RUN(0x1F800, GCB_Other), GCB_RUN(0x1F80C, GCB_ExtPict),
+  GCB_RUN(0x1F810, GCB_Other), GCB_RUN(0x1F848, GCB_ExtPict),
+  GCB_RUN(0x1F850, GCB_Other), GCB_RUN(0x1F85A, GCB_ExtPict),
+  GCB_RUN(0x1F860, GCB_Other), GCB_RUN(0x1F888, GCB_ExtPict),
+  GCB_RUN(0x1F890, GCB_Other), GCB_RUN(0x1F8AE, GCB_ExtPict),
+  GCB_RUN(0x1F900, GCB_Other), GCB_RUN(0x1F90C, GCB_ExtPict),
+  GCB_RUN(0x1F93B, GCB_Other), GCB_RUN(0x1F93C, GCB_ExtPict),
+  GCB_RUN(0x1F946, GCB_Other), GCB_RUN(0x1F947, GCB_ExtPict),
+  GCB_RUN(0x1FB00, GCB_Other), GCB_RUN(0x1FC00, GCB_ExtPict),
+  GCB_RUN(0x1FFFE, GCB_Other), GCB_RUN(0xE0000, GCB_Control),
+  GCB_RUN(0xE0020, GCB_Extend), GCB_RUN(0xE0080, GCB_Control),
+  GCB_RUN(0xE0100, GCB_Extend), GCB_RUN(0xE01F0, GCB_Control),
+  GCB_RUN(0xE1000, GCB_Other)
+};
+
+/* General_Category runs (3968 entries), as described in "mkunidata.tcl" */
+#define GC_RUN(C,P) (((u32)(C) << 8) | (u32)(P))
+constexpr u32 GcRuns[] = {
+  GC_RUN(0x0000, GC_Cc), GC_RUN(0x0020, GC_Zs),
+  GC_RUN(0x0021, GC_Po), GC_RUN(0x0024, GC_Sc),
+  GC_RUN(0x0025, GC_Po), GC_RUN(0x0028, GC_Ps),
+  GC_RUN(0x0029, GC_Pe), GC_RUN(0x002A, GC_Po),
+  GC_RUN(0x002B, GC_Sm), GC_RUN(0x002C, GC_Po),
+  GC_RUN(0x002D, GC_Pd), GC_RUN(0x002E, GC_Po),
+  GC_RUN(0x0030, GC_Nd), GC_RUN(0x003A, GC_Po),
+  GC_RUN(0x003C, GC_Sm), GC_RUN(0x003F, GC_Po),
+  GC_RUN(0x0041, GC_Lu), GC_RUN(0x005B, GC_Ps),
+  GC_RUN(0x005C, GC_Po), GC_RUN(0x005D, GC_Pe),
+  GC_RUN(0x005E, GC_Sk), GC_RUN(0x005F, GC_Pc),
+  GC_RUN(0x0060, GC_Sk), GC_RUN(0x0061, GC_Ll),
+  GC_RUN(0x007B, GC_Ps), GC_RUN(0x007C, GC_Sm),
+  GC_RUN(0x007D, GC_Pe), GC_RUN(0x007E, GC_Sm),
+  GC_RUN(0x007F, GC_Cc), GC_RUN(0x00A0, GC_Zs),
+  GC_RUN(0x00A1, GC_Po), GC_RUN(0x00A2, GC_Sc),
+  GC_RUN(0x00A6, GC_So), GC_RUN(0x00A7, GC_Po),
+  GC_RUN(0x00A8, GC_Sk), GC_RUN(0x00A9, GC_So),
+  GC_RUN(0x00AA, GC_Lo), GC_RUN(0x00AB, GC_Pi),
+  GC_RUN(0x00AC, GC_Sm), GC_RUN(0x00AD, GC_Cf),
+  GC_RUN(0x00AE, GC_So), GC_RUN(0x00AF, GC_Sk),
+  GC_RUN(0x00B0, GC_So), GC_RUN(0x00B1, GC_Sm),
+  GC_RUN(0x00B2, GC_No), GC_RUN(0x00B4, GC_Sk),
+  GC_RUN(0x00B5, GC_Ll), GC_RUN(0x00B6, GC_Po),
+  GC_RUN(0x00B8, GC_Sk), GC_RUN(0x00B9, GC_No),
+  GC_RUN(0x00BA, GC_Lo), GC_RUN(0x00BB, GC_Pf),
+  GC_RUN(0x00BC, GC_No), GC_RUN(0x00BF, GC_Po),
+  GC_RUN(0x00C0, GC_Lu), GC_RUN(0x00D7, GC_Sm),
+  GC_RUN(0x00D8, GC_Lu), GC_RUN(0x00DF, GC_Ll),
+  GC_RUN(0x00F7, GC_Sm), GC_RUN(0x00F8, GC_Ll),
+  GC_RUN(0x0100, GC_Lu), GC_RUN(0x0101, GC_Ll),
+  GC_RUN(0x0102, GC_Lu), GC_RUN(0x0103, GC_Ll),
+  GC_RUN(0x0104, GC_Lu), GC_RUN(0x0105, GC_Ll),
+  GC_RUN(0x0106, GC_Lu), GC_RUN(0x0107, GC_Ll),
+  GC_RUN(0x0108, GC_Lu), GC_RUN(0x0109, GC_Ll),
+  GC_RUN(0x010A, GC_Lu), GC_RUN(0x010B, GC_Ll),
+  GC_RUN(0x010C, GC_Lu), GC_RUN(0x010D, GC_Ll),
+  GC_RUN(0x010E, GC_Lu), GC_RUN(0x010F, GC_Ll),
+  GC_RUN(0x0110, GC_Lu), GC_RUN(0x0111, GC_Ll),
+  GC_RUN(0x0112, GC_Lu), GC_RUN(0x0113, GC_Ll),
+  GC_RUN(0x0114, GC_Lu), GC_RUN(0x0115, GC_Ll),
+  GC_RUN(0x0116, GC_Lu), GC_RUN(0x0117, GC_Ll),
+  GC_RUN(0x0118, GC_Lu), GC_RUN(0x0119, GC_Ll),
+  GC_RUN(0x011A, GC_Lu), GC_RUN(0x011B, GC_Ll),
+  GC_RUN(0x011C, GC_Lu), GC_RUN(0x011D, GC_Ll),
+  GC_RUN(0x011E, GC_Lu), GC_RUN(0x011F, GC_Ll),
+  GC_RUN(0x0120, GC_Lu), GC_RUN(0x0121, GC_Ll),
+  GC_RUN(0x0122, GC_Lu), GC_RUN(0x0123, GC_Ll),
+  GC_RUN(0x0124, GC_Lu), GC_RUN(0x0125, GC_Ll),
+  GC_RUN(0x0126, GC_Lu), GC_RUN(0x0127, GC_Ll),
+  GC_RUN(0x0128, GC_Lu), GC_RUN(0x0129, GC_Ll),
+  GC_RUN(0x012A, GC_Lu), GC_RUN(0x012B, GC_Ll),
+  GC_RUN(0x012C, GC_Lu), GC_RUN(0x012D, GC_Ll),
+  GC_RUN(0x012E, GC_Lu), GC_RUN(0x012F, GC_Ll),
+  GC_RUN(0x0130, GC_Lu), GC_RUN(0x0131, GC_Ll),
+  GC_RUN(0x0132, GC_Lu), GC_RUN(0x0133, GC_Ll),
+  GC_RUN(0x0134, GC_Lu), GC_RUN(0x0135, GC_Ll),
+  GC_RUN(0x0136, GC_Lu), GC_RUN(0x0137, GC_Ll),
+  GC_RUN(0x0139, GC_Lu), GC_RUN(0x013A, GC_Ll),
+  GC_RUN(0x013B, GC_Lu), GC_RUN(0x013C, GC_Ll),
+  GC_RUN(0x013D, GC_Lu), GC_RUN(0x013E, GC_Ll),
+  GC_RUN(0x013F, GC_Lu), GC_RUN(0x0140, GC_Ll),
+  GC_RUN(0x0141, GC_Lu), GC_RUN(0x0142, GC_Ll),
+  GC_RUN(0x0143, GC_Lu), GC_RUN(0x0144, GC_Ll),
+  GC_RUN(0x0145, GC_Lu), GC_RUN(0x0146, GC_Ll),
+  GC_RUN(0x0147, GC_Lu), GC_RUN(0x0148, GC_Ll),
+  GC_RUN(0x014A, GC_Lu), GC_RUN(0x014B, GC_Ll),
+  GC_RUN(0x014C, GC_Lu), GC_RUN(0x014D, GC_Ll),
+  GC_RUN(0x014E, GC_Lu), GC_RUN(0x014F, GC_Ll),
+  GC_RUN(0x0150, GC_Lu), GC_RUN(0x0151, GC_Ll),
+  GC_RUN(0x0152, GC_Lu), GC_RUN(0x0153, GC_Ll),
+  GC_RUN(0x0154, GC_Lu), GC_RUN(0x0155, GC_Ll),
+  GC_RUN(0x0156, GC_Lu), GC_RUN(0x0157, GC_Ll),
+  GC_RUN(0x0158, GC_Lu), GC_RUN(0x0159, GC_Ll),
+  GC_RUN(0x015A, GC_Lu), GC_RUN(0x015B, GC_Ll),
+  GC_RUN(0x015C, GC_Lu), GC_RUN(0x015D, GC_Ll),
+  GC_RUN(0x015E, GC_Lu), GC_RUN(0x015F, GC_Ll),
+  GC_RUN(0x0160, GC_Lu), GC_RUN(0x0161, GC_Ll),
+  GC_RUN(0x0162, GC_Lu), GC_RUN(0x0163, GC_Ll),
+  GC_RUN(0x0164, GC_Lu), GC_RUN(0x0165, GC_Ll),
+  GC_RUN(0x0166, GC_Lu), GC_RUN(0x0167, GC_Ll),
+  GC_RUN(0x0168, GC_Lu), GC_RUN(0x0169, GC_Ll),
+  GC_RUN(0x016A, GC_Lu), GC_RUN(0x016B, GC_Ll),
+  GC_RUN(0x016C, GC_Lu), GC_RUN(0x016D, GC_Ll),
+  GC_RUN(0x016E, GC_Lu), GC_RUN(0x016F, GC_Ll),
+  GC_RUN(0x0170, GC_Lu), GC_RUN(0x0171, GC_Ll),
+  GC_RUN(0x0172, GC_Lu), GC_RUN(0x0173, GC_Ll),
+  GC_RUN(0x0174, GC_Lu), GC_RUN(0x0175, GC_Ll),
+  GC_RUN(0x0176, GC_Lu), GC_RUN(0x0177, GC_Ll),
+  GC_RUN(0x0178, GC_Lu), GC_RUN(0x017A, GC_Ll),
+  GC_RUN(0x017B, GC_Lu), GC_RUN(0x017C, GC_Ll),
+  GC_RUN(0x017D, GC_Lu), GC_RUN(0x017E, GC_Ll),
+  GC_RUN(0x0181, GC_Lu), GC_RUN(0x0183, GC_Ll),
+  GC_RUN(0x0184, GC_Lu), GC_RUN(0x0185, GC_Ll),
+  GC_RUN(0x0186, GC_Lu), GC_RUN(0x0188, GC_Ll),
+  GC_RUN(0x0189, GC_Lu), GC_RUN(0x018C, GC_Ll),
+  GC_RUN(0x018E, GC_Lu), GC_RUN(0x0192, GC_Ll),
+  GC_RUN(0x0193, GC_Lu), GC_RUN(0x0195, GC_Ll),
+  GC_RUN(0x0196, GC_Lu), GC_RUN(0x0199, GC_Ll),
+  GC_RUN(0x019C, GC_Lu), GC_RUN(0x019E, GC_Ll),
+  GC_RUN(0x019F, GC_Lu), GC_RUN(0x01A1, GC_Ll),
+  GC_RUN(0x01A2, GC_Lu), GC_RUN(0x01A3, GC_Ll),
+  GC_RUN(0x01A4, GC_Lu), GC_RUN(0x01A5, GC_Ll),
+  GC_RUN(0x01A6, GC_Lu), GC_RUN(0x01A8, GC_Ll),
+  GC_RUN(0x01A9, GC_Lu), GC_RUN(0x01AA, GC_Ll),
+  GC_RUN(0x01AC, GC_Lu), GC_RUN(0x01AD, GC_Ll),
+  GC_RUN(0x01AE, GC_Lu), GC_RUN(0x01B0, GC_Ll),
+  GC_RUN(0x01B1, GC_Lu), GC_RUN(0x01B4, GC_Ll),
+  GC_RUN(0x01B5, GC_Lu), GC_RUN(0x01B6, GC_Ll),
+  GC_RUN(0x01B7, GC_Lu), GC_RUN(0x01B9, GC_Ll),
+  GC_RUN(0x01BB, GC_Lo), GC_RUN(0x01BC, GC_Lu),
+  GC_RUN(0x01BD, GC_Ll), GC_RUN(0x01C0, GC_Lo),
+  GC_RUN(0x01C4, GC_Lu), GC_RUN(0x01C5, GC_Lt),
+  GC_RUN(0x01C6, GC_Ll), GC_RUN(0x01C7, GC_Lu),
+  GC_RUN(0x01C8, GC_Lt), GC_RUN(0x01C9, GC_Ll),
+  GC_RUN(0x01CA, GC_Lu), GC_RUN(0x01CB, GC_Lt),
+  GC_RUN(0x01CC, GC_Ll), GC_RUN(0x01CD, GC_Lu),
+  GC_RUN(0x01CE, GC_Ll), GC_RUN(0x01CF, GC_Lu),
+  GC_RUN(0x01D0, GC_Ll), GC_RUN(0x01D1, GC_Lu),
+  GC_RUN(0x01D2, GC_Ll), GC_RUN(0x01D3, GC_Lu),
+  GC_RUN(0x01D4, GC_Ll), GC_RUN(0x01D5, GC_Lu),
+  GC_RUN(0x01D6, GC_Ll), GC_RUN(0x01D7, GC_Lu),
+  GC_RUN(0x01D8, GC_Ll), GC_RUN(0x01D9, GC_Lu),
+  GC_RUN(0x01DA, GC_Ll), GC_RUN(0x01DB, GC_Lu),
+  GC_RUN(0x01DC, GC_Ll), GC_RUN(0x01DE, GC_Lu),
+  GC_RUN(0x01DF, GC_Ll), GC_RUN(0x01E0, GC_Lu),
+  GC_RUN(0x01E1, GC_Ll), GC_RUN(0x01E2, GC_Lu),
+  GC_RUN(0x01E3, GC_Ll), GC_RUN(0x01E4, GC_Lu),
+  GC_RUN(0x01E5, GC_Ll), GC_RUN(0x01E6, GC_Lu),
+  GC_RUN(0x01E7, GC_Ll), GC_RUN(0x01E8, GC_Lu),
+  GC_RUN(0x01E9, GC_Ll), GC_RUN(0x01EA, GC_Lu),
+  GC_RUN(0x01EB, GC_Ll), GC_RUN(0x01EC, GC_Lu),
+  GC_RUN(0x01ED, GC_Ll), GC_RUN(0x01EE, GC_Lu),
+  GC_RUN(0x01EF, GC_Ll), GC_RUN(0x01F1, GC_Lu),
+  GC_RUN(0x01F2, GC_Lt), GC_RUN(0x01F3, GC_Ll),
+  GC_RUN(0x01F4, GC_Lu), GC_RUN(0x01F5, GC_Ll),
+  GC_RUN(0x01F6, GC_Lu), GC_RUN(0x01F9, GC_Ll),
+  GC_RUN(0x01FA, GC_Lu), GC_RUN(0x01FB, GC_Ll),
+  GC_RUN(0x01FC, GC_Lu), GC_RUN(0x01FD, GC_Ll),
+  GC_RUN(0x01FE, GC_Lu), GC_RUN(0x01FF, GC_Ll),
+  GC_RUN(0x0200, GC_Lu), GC_RUN(0x0201, GC_Ll),
+  GC_RUN(0x0202, GC_Lu), GC_RUN(0x0203, GC_Ll),
+  GC_RUN(0x0204, GC_Lu), GC_RUN(0x0205, GC_Ll),
+  GC_RUN(0x0206, GC_Lu), GC_RUN(0x0207, GC_Ll),
+  GC_RUN(0x0208, GC_Lu), GC_RUN(0x0209, GC_Ll),
+  GC_RUN(0x020A, GC_Lu), GC_RUN(0x020B, GC_Ll),
+  GC_RUN(0x020C, GC_Lu), GC_RUN(0x020D, GC_Ll),
+  GC_RUN(0x020E, GC_Lu), GC_RUN(0x020F, GC_Ll),
+  GC_RUN(0x0210, GC_Lu), GC_RUN(0x0211, GC_Ll),
+  GC_RUN(0x0212, GC_Lu), GC_RUN(0x0213, GC_Ll),
+  GC_RUN(0x0214, GC_Lu), GC_RUN(0x0215, GC_Ll),
+  GC_RUN(0x0216, GC_Lu), GC_RUN(0x0217, GC_Ll),
+  GC_RUN(0x0218, GC_Lu), GC_RUN(0x0219, GC_Ll),
+  GC_RUN(0x021A, GC_Lu), GC_RUN(0x021B, GC_Ll),
+  GC_RUN(0x021C, GC_Lu), GC_RUN(0x021D, GC_Ll),
+  GC_RUN(0x021E, GC_Lu), GC_RUN(0x021F, GC_Ll),
+  GC_RUN(0x0220, GC_Lu), GC_RUN(0x0221, GC_Ll),
+  GC_RUN(0x0222, GC_Lu), GC_RUN(0x0223, GC_Ll),
+  GC_RUN(0x0224, GC_Lu), GC_RUN(0x0225, GC_Ll),
+  GC_RUN(0x0226, GC_Lu), GC_RUN(0x0227, GC_Ll),
+  GC_RUN(0x0228, GC_Lu), GC_RUN(0x0229, GC_Ll),
+  GC_RUN(0x022A, GC_Lu), GC_RUN(0x022B, GC_Ll),
+  GC_RUN(0x022C, GC_Lu), GC_RUN(0x022D, GC_Ll),
+  GC_RUN(0x022E, GC_Lu), GC_RUN(0x022F, GC_Ll),
+  GC_RUN(0x0230, GC_Lu), GC_RUN(0x0231, GC_Ll),
+  GC_RUN(0x0232, GC_Lu), GC_RUN(0x0233, GC_Ll),
+  GC_RUN(0x023A, GC_Lu), GC_RUN(0x023C, GC_Ll),
+  GC_RUN(0x023D, GC_Lu), GC_RUN(0x023F, GC_Ll),
+  GC_RUN(0x0241, GC_Lu), GC_RUN(0x0242, GC_Ll),
+  GC_RUN(0x0243, GC_Lu), GC_RUN(0x0247, GC_Ll),
+  GC_RUN(0x0248, GC_Lu), GC_RUN(0x0249, GC_Ll),
+  GC_RUN(0x024A, GC_Lu), GC_RUN(0x024B, GC_Ll),
+  GC_RUN(0x024C, GC_Lu), GC_RUN(0x024D, GC_Ll),
+  GC_RUN(0x024E, GC_Lu), GC_RUN(0x024F, GC_Ll),
+  GC_RUN(0x0294, GC_Lo), GC_RUN(0x0295, GC_Ll),
+  GC_RUN(0x02B0, GC_Lm), GC_RUN(0x02C2, GC_Sk),
+  GC_RUN(0x02C6, GC_Lm), GC_RUN(0x02D2, GC_Sk),
+  GC_RUN(0x02E0, GC_Lm), GC_RUN(0x02E5, GC_Sk),
+  GC_RUN(0x02EC, GC_Lm), GC_RUN(0x02ED, GC_Sk),
+  GC_RUN(0x02EE, GC_Lm), GC_RUN(0x02EF, GC_Sk),
+  GC_RUN(0x0300, GC_Mn), GC_RUN(0x0370, GC_Lu),
+  GC_RUN(0x0371, GC_Ll), GC_RUN(0x0372, GC_Lu),
+  GC_RUN(0x0373, GC_Ll), GC_RUN(0x0374, GC_Lm),
+  GC_RUN(0x0375, GC_Sk), GC_RUN(0x0376, GC_Lu),
+  GC_RUN(0x0377, GC_Ll), GC_RUN(0x0378, GC_Cn),
+  GC_RUN(0x037A, GC_Lm), GC_RUN(0x037B, GC_Ll),
+  GC_RUN(0x037E, GC_Po), GC_RUN(0x037F, GC_Lu),
+  GC_RUN(0x0380, GC_Cn), GC_RUN(0x0384, GC_Sk),
+  GC_RUN(0x0386, GC_Lu), GC_RUN(0x0387, GC_Po),
+  GC_RUN(0x0388, GC_Lu), GC_RUN(0x038B, GC_Cn),
+  GC_RUN(0x038C, GC_Lu), GC_RUN(0x038D, GC_Cn),
+  GC_RUN(0x038E, GC_Lu), GC_RUN(0x0390, GC_Ll),
+  GC_RUN(0x0391, GC_Lu), GC_RUN(0x03A2, GC_Cn),
+  GC_RUN(0x03A3, GC_Lu), GC_RUN(0x03AC, GC_Ll),
+  GC_RUN(0x03CF, GC_Lu), GC_RUN(0x03D0, GC_Ll),
+  GC_RUN(0x03D2, GC_Lu), GC_RUN(0x03D5, GC_Ll),
+  GC_RUN(0x03D8, GC_Lu), GC_RUN(0x03D9, GC_Ll),
+  GC_RUN(0x03DA, GC_Lu), GC_RUN(0x03DB, GC_Ll),
+  GC_RUN(0x03DC, GC_Lu), GC_RUN(0x03DD, GC_Ll),
+  GC_RUN(0x03DE, GC_Lu), GC_RUN(0x03DF, GC_Ll),
+  GC_RUN(0x03E0, GC_Lu), GC_RUN(0x03E1, GC_Ll),
+  GC_RUN(0x03E2, GC_Lu), GC_RUN(0x03E3, GC_Ll),
+  GC_RUN(0x03E4, GC_Lu), GC_RUN(0x03E5, GC_Ll),
+  GC_RUN(0x03E6, GC_Lu), GC_RUN(0x03E7, GC_Ll),
+  GC_RUN(0x03E8, GC_Lu), GC_RUN(0x03E9, GC_Ll),
+  GC_RUN(0x03EA, GC_Lu), GC_RUN(0x03EB, GC_Ll),
+  GC_RUN(0x03EC, GC_Lu), GC_RUN(0x03ED, GC_Ll),
+  GC_RUN(0x03EE, GC_Lu), GC_RUN(0x03EF, GC_Ll),
+  GC_RUN(0x03F4, GC_Lu), GC_RUN(0x03F5, GC_Ll),
+  GC_RUN(0x03F6, GC_Sm), GC_RUN(0x03F7, GC_Lu),
+  GC_RUN(0x03F8, GC_Ll), GC_RUN(0x03F9, GC_Lu),
+  GC_RUN(0x03FB, GC_Ll), GC_RUN(0x03FD, GC_Lu),
+  GC_RUN(0x0430, GC_Ll), GC_RUN(0x0460, GC_Lu),
+  GC_RUN(0x0461, GC_Ll), GC_RUN(0x0462, GC_Lu),
+  GC_RUN(0x0463, GC_Ll), GC_RUN(0x0464, GC_Lu),
+  GC_RUN(0x0465, GC_Ll), GC_RUN(0x0466, GC_Lu),
+  GC_RUN(0x0467, GC_Ll), GC_RUN(0x0468, GC_Lu),
+  GC_RUN(0x0469, GC_Ll), GC_RUN(0x046A, GC_Lu),
+  GC_RUN(0x046B, GC_Ll), GC_RUN(0x046C, GC_Lu),
+  GC_RUN(0x046D, GC_Ll), GC_RUN(0x046E, GC_Lu),
+  GC_RUN(0x046F, GC_Ll), GC_RUN(0x0470, GC_Lu),
+  GC_RUN(0x0471, GC_Ll), GC_RUN(0x0472, GC_Lu),
+  GC_RUN(0x0473, GC_Ll), GC_RUN(0x0474, GC_Lu),
+  GC_RUN(0x0475, GC_Ll), GC_RUN(0x0476, GC_Lu),
+  GC_RUN(0x0477, GC_Ll), GC_RUN(0x0478, GC_Lu),
+  GC_RUN(0x0479, GC_Ll), GC_RUN(0x047A, GC_Lu),
+  GC_RUN(0x047B, GC_Ll), GC_RUN(0x047C, GC_Lu),
+  GC_RUN(0x047D, GC_Ll), GC_RUN(0x047E, GC_Lu),
+  GC_RUN(0x047F, GC_Ll), GC_RUN(0x0480, GC_Lu),
+  GC_RUN(0x0481, GC_Ll), GC_RUN(0x0482, GC_So),
+  GC_RUN(0x0483, GC_Mn), GC_RUN(0x0488, GC_Me),
+  GC_RUN(0x048A, GC_Lu), GC_RUN(0x048B, GC_Ll),
+  GC_RUN(0x048C, GC_Lu), GC_RUN(0x048D, GC_Ll),
+  GC_RUN(0x048E, GC_Lu), GC_RUN(0x048F, GC_Ll),
+  GC_RUN(0x0490, GC_Lu), GC_RUN(0x0491, GC_Ll),
+  GC_RUN(0x0492, GC_Lu), GC_RUN(0x0493, GC_Ll),
+  GC_RUN(0x0494, GC_Lu), GC_RUN(0x0495, GC_Ll),
+  GC_RUN(0x0496, GC_Lu), GC_RUN(0x0497, GC_Ll),
+  GC_RUN(0x0498, GC_Lu), GC_RUN(0x0499, GC_Ll),
+  GC_RUN(0x049A, GC_Lu), GC_RUN(0x049B, GC_Ll),
+  GC_RUN(0x049C, GC_Lu), GC_RUN(0x049D, GC_Ll),
+  GC_RUN(0x049E, GC_Lu), GC_RUN(0x049F, GC_Ll),
+  GC_RUN(0x04A0, GC_Lu), GC_RUN(0x04A1, GC_Ll),
+  GC_RUN(0x04A2, GC_Lu), GC_RUN(0x04A3, GC_Ll),
+  GC_RUN(0x04A4, GC_Lu), GC_RUN(0x04A5, GC_Ll),
+  GC_RUN(0x04A6, GC_Lu), GC_RUN(0x04A7, GC_Ll),
+  GC_RUN(0x04A8, GC_Lu), GC_RUN(0x04A9, GC_Ll),
+  GC_RUN(0x04AA, GC_Lu), GC_RUN(0x04AB, GC_Ll),
+  GC_RUN(0x04AC, GC_Lu), GC_RUN(0x04AD, GC_Ll),
+  GC_RUN(0x04AE, GC_Lu), GC_RUN(0x04AF, GC_Ll),
+  GC_RUN(0x04B0, GC_Lu), GC_RUN(0x04B1, GC_Ll),
+  GC_RUN(0x04B2, GC_Lu), GC_RUN(0x04B3, GC_Ll),
+  GC_RUN(0x04B4, GC_Lu), GC_RUN(0x04B5, GC_Ll),
+  GC_RUN(0x04B6, GC_Lu), GC_RUN(0x04B7, GC_Ll),
+  GC_RUN(0x04B8, GC_Lu), GC_RUN(0x04B9, GC_Ll),
+  GC_RUN(0x04BA, GC_Lu), GC_RUN(0x04BB, GC_Ll),
+  GC_RUN(0x04BC, GC_Lu), GC_RUN(0x04BD, GC_Ll),
+  GC_RUN(0x04BE, GC_Lu), GC_RUN(0x04BF, GC_Ll),
+  GC_RUN(0x04C0, GC_Lu), GC_RUN(0x04C2, GC_Ll),
+  GC_RUN(0x04C3, GC_Lu), GC_RUN(0x04C4, GC_Ll),
+  GC_RUN(0x04C5, GC_Lu), GC_RUN(0x04C6, GC_Ll),
+  GC_RUN(0x04C7, GC_Lu), GC_RUN(0x04C8, GC_Ll),
+  GC_RUN(0x04C9, GC_Lu), GC_RUN(0x04CA, GC_Ll),
+  GC_RUN(0x04CB, GC_Lu), GC_RUN(0x04CC, GC_Ll),
+  GC_RUN(0x04CD, GC_Lu), GC_RUN(0x04CE, GC_Ll),
+  GC_RUN(0x04D0, GC_Lu), GC_RUN(0x04D1, GC_Ll),
+  GC_RUN(0x04D2, GC_Lu), GC_RUN(0x04D3, GC_Ll),
+  GC_RUN(0x04D4, GC_Lu), GC_RUN(0x04D5, GC_Ll),
+  GC_RUN(0x04D6, GC_Lu), GC_RUN(0x04D7, GC_Ll),
+  GC_RUN(0x04D8, GC_Lu), GC_RUN(0x04D9, GC_Ll),
+  GC_RUN(0x04DA, GC_Lu), GC_RUN(0x04DB, GC_Ll),
+  GC_RUN(0x04DC, GC_Lu), GC_RUN(0x04DD, GC_Ll),
+  GC_RUN(0x04DE, GC_Lu), GC_RUN(0x04DF, GC_Ll),
+  GC_RUN(0x04E0, GC_Lu), GC_RUN(0x04E1, GC_Ll),
+  GC_RUN(0x04E2, GC_Lu), GC_RUN(0x04E3, GC_Ll),
+  GC_RUN(0x04E4, GC_Lu), GC_RUN(0x04E5, GC_Ll),
+  GC_RUN(0x04E6, GC_Lu), GC_RUN(0x04E7, GC_Ll),
+  GC_RUN(0x04E8, GC_Lu), GC_RUN(0x04E9, GC_Ll),
+  GC_RUN(0x04EA, GC_Lu), GC_RUN(0x04EB, GC_Ll),
+  GC_RUN(0x04EC, GC_Lu), GC_RUN(0x04ED, GC_Ll),
+  GC_RUN(0x04EE, GC_Lu), GC_RUN(0x04EF, GC_Ll),
+  GC_RUN(0x04F0, GC_Lu), GC_RUN(0x04F1, GC_Ll),
+  GC_RUN(0x04F2, GC_Lu), GC_RUN(0x04F3, GC_Ll),
+  GC_RUN(0x04F4, GC_Lu), GC_RUN(0x04F5, GC_Ll),
+  GC_RUN(0x04F6, GC_Lu), GC_RUN(0x04F7, GC_Ll),
+  GC_RUN(0x04F8, GC_Lu), GC_RUN(0x04F9, GC_Ll),
+  GC_RUN(0x04FA, GC_Lu), GC_RUN(0x04FB, GC_Ll),
+  GC_RUN(0x04FC, GC_Lu), GC_RUN(0x04FD, GC_Ll),
+  GC_RUN(0x04FE, GC_Lu), GC_RUN(0x04FF, GC_Ll),
+  GC_RUN(0x0500, GC_Lu), GC_RUN(0x0501, GC_Ll),
+  GC_RUN(0x0502, GC_Lu), GC_RUN(0x0503, GC_Ll),
+  GC_RUN(0x0504, GC_Lu), GC_RUN(0x0505, GC_Ll),
+  GC_RUN(0x0506, GC_Lu), GC_RUN(0x0507, GC_Ll),
+  GC_RUN(0x0508, GC_Lu), GC_RUN(0x0509, GC_Ll),
+  GC_RUN(0x050A, GC_Lu), GC_RUN(0x050B, GC_Ll),
+  GC_RUN(0x050C, GC_Lu), GC_RUN(0x050D, GC_Ll),
+  GC_RUN(0x050E, GC_Lu), GC_RUN(0x050F, GC_Ll),
+  GC_RUN(0x0510, GC_Lu), GC_RUN(0x0511, GC_Ll),
+  GC_RUN(0x0512, GC_Lu), GC_RUN(0x0513, GC_Ll),
+  GC_RUN(0x0514, GC_Lu), GC_RUN(0x0515, GC_Ll),
+  GC_RUN(0x0516, GC_Lu), GC_RUN(0x0517, GC_Ll),
+  GC_RUN(0x0518, GC_Lu), GC_RUN(0x0519, GC_Ll),
+  GC_RUN(0x051A, GC_Lu), GC_RUN(0x051B, GC_Ll),
+  GC_RUN(0x051C, GC_Lu), GC_RUN(0x051D, GC_Ll),
+  GC_RUN(0x051E, GC_Lu), GC_RUN(0x051F, GC_Ll),
+  GC_RUN(0x0520, GC_Lu), GC_RUN(0x0521, GC_Ll),
+  GC_RUN(0x0522, GC_Lu), GC_RUN(0x0523, GC_Ll),
+  GC_RUN(0x0524, GC_Lu), GC_RUN(0x0525, GC_Ll),
+  GC_RUN(0x0526, GC_Lu), GC_RUN(0x0527, GC_Ll),
+  GC_RUN(0x0528, GC_Lu), GC_RUN(0x0529, GC_Ll),
+  GC_RUN(0x052A, GC_Lu), GC_RUN(0x052B, GC_Ll),
+  GC_RUN(0x052C, GC_Lu), GC_RUN(0x052D, GC_Ll),
+  GC_RUN(0x052E, GC_Lu), GC_RUN(0x052F, GC_Ll),
+  GC_RUN(0x0530, GC_Cn), GC_RUN(0x0531, GC_Lu),
+  GC_RUN(0x0557, GC_Cn), GC_RUN(0x0559, GC_Lm),
+  GC_RUN(0x055A, GC_Po), GC_RUN(0x0560, GC_Ll),
+  GC_RUN(0x0589, GC_Po), GC_RUN(0x058A, GC_Pd),
+  GC_RUN(0x058B, GC_Cn), GC_RUN(0x058D, GC_So),
+  GC_RUN(0x058F, GC_Sc), GC_RUN(0x0590, GC_Cn),
+  GC_RUN(0x0591, GC_Mn), GC_RUN(0x05BE, GC_Pd),
+  GC_RUN(0x05BF, GC_Mn), GC_RUN(0x05C0, GC_Po),
+  GC_RUN(0x05C1, GC_Mn), GC_RUN(0x05C3, GC_Po),
+  GC_RUN(0x05C4, GC_Mn), GC_RUN(0x05C6, GC_Po),
+  GC_RUN(0x05C7, GC_Mn), GC_RUN(0x05C8, GC_Cn),
+  GC_RUN(0x05D0, GC_Lo), GC_RUN(0x05EB, GC_Cn),
+  GC_RUN(0x05EF, GC_Lo), GC_RUN(0x05F3, GC_Po),
+  GC_RUN(0x05F5, GC_Cn), GC_RUN(0x0600, GC_Cf),
+  GC_RUN(0x0606, GC_Sm), GC_RUN(0x0609, GC_Po),
+  GC_RUN(0x060B, GC_Sc), GC_RUN(0x060C, GC_Po),
+  GC_RUN(0x060E, GC_So), GC_RUN(0x0610, GC_Mn),
+  GC_RUN(0x061B, GC_Po), GC_RUN(0x061C, GC_Cf),
+  GC_RUN(0x061D, GC_Po), GC_RUN(0x0620, GC_Lo),
+  GC_RUN(0x0640, GC_Lm), GC_RUN(0x0641, GC_Lo),
+  GC_RUN(0x064B, GC_Mn), GC_RUN(0x0660, GC_Nd),
+  GC_RUN(0x066A, GC_Po), GC_RUN(0x066E, GC_Lo),
+  GC_RUN(0x0670, GC_Mn), GC_RUN(0x0671, GC_Lo),
+  GC_RUN(0x06D4, GC_Po), GC_RUN(0x06D5, GC_Lo),
+  GC_RUN(0x06D6, GC_Mn), GC_RUN(0x06DD, GC_Cf),
+  GC_RUN(0x06DE, GC_So), GC_RUN(0x06DF, GC_Mn),
+  GC_RUN(0x06E5, GC_Lm), GC_RUN(0x06E7, GC_Mn),
+  GC_RUN(0x06E9, GC_So), GC_RUN(0x06EA, GC_Mn),
+  GC_RUN(0x06EE, GC_Lo), GC_RUN(0x06F0, GC_Nd),
+  GC_RUN(0x06FA, GC_Lo), GC_RUN(0x06FD, GC_So),
+  GC_RUN(0x06FF, GC_Lo), GC_RUN(0x0700, GC_Po),
+  GC_RUN(0x070E, GC_Cn), GC_RUN(0x070F, GC_Cf),
+  GC_RUN(0x0710, GC_Lo), GC_RUN(0x0711, GC_Mn),
+  GC_RUN(0x0712, GC_Lo), GC_RUN(0x0730, GC_Mn),
+  GC_RUN(0x074B, GC_Cn), GC_RUN(0x074D, GC_Lo),
+  GC_RUN(0x07A6, GC_Mn), GC_RUN(0x07B1, GC_Lo),
+  GC_RUN(0x07B2, GC_Cn), GC_RUN(0x07C0, GC_Nd),
+  GC_RUN(0x07CA, GC_Lo), GC_RUN(0x07EB, GC_Mn),
+  GC_RUN(0x07F4, GC_Lm), GC_RUN(0x07F6, GC_So),
+  GC_RUN(0x07F7, GC_Po), GC_RUN(0x07FA, GC_Lm),
+  GC_RUN(0x07FB, GC_Cn), GC_RUN(0x07FD, GC_Mn),
+  GC_RUN(0x07FE, GC_Sc), GC_RUN(0x0800, GC_Lo),
+  GC_RUN(0x0816, GC_Mn), GC_RUN(0x081A, GC_Lm),
+  GC_RUN(0x081B, GC_Mn), GC_RUN(0x0824, GC_Lm),
+  GC_RUN(0x0825, GC_Mn), GC_RUN(0x0828, GC_Lm),
+  GC_RUN(0x0829, GC_Mn), GC_RUN(0x082E, GC_Cn),
+  GC_RUN(0x0830, GC_Po), GC_RUN(0x083F, GC_Cn),
+  GC_RUN(0x0840, GC_Lo), GC_RUN(0x0859, GC_Mn),
+  GC_RUN(0x085C, GC_Cn), GC_RUN(0x085E, GC_Po),
+  GC_RUN(0x085F, GC_Cn), GC_RUN(0x0860, GC_Lo),
+  GC_RUN(0x086B, GC_Cn), GC_RUN(0x0870, GC_Lo),
+  GC_RUN(0x0888, GC_Sk), GC_RUN(0x0889, GC_Lo),
+  GC_RUN(0x088F, GC_Cn), GC_RUN(0x0890, GC_Cf),
+  GC_RUN(0x0892, GC_Cn), GC_RUN(0x0898, GC_Mn),
+  GC_RUN(0x08A0, GC_Lo), GC_RUN(0x08C9, GC_Lm),
+  GC_RUN(0x08CA, GC_Mn), GC_RUN(0x08E2, GC_Cf),
+  GC_RUN(0x08E3, GC_Mn), GC_RUN(0x0903, GC_Mc),
+  GC_RUN(0x0904, GC_Lo), GC_RUN(0x093A, GC_Mn),
+  GC_RUN(0x093B, GC_Mc), GC_RUN(0x093C, GC_Mn),
+  GC_RUN(0x093D, GC_Lo), GC_RUN(0x093E, GC_Mc),
+  GC_RUN(0x0941, GC_Mn), GC_RUN(0x0949, GC_Mc),
+  GC_RUN(0x094D, GC_Mn), GC_RUN(0x094E, GC_Mc),
+  GC_RUN(0x0950, GC_Lo), GC_RUN(0x0951, GC_Mn),
+  GC_RUN(0x0958, GC_Lo), GC_RUN(0x0962, GC_Mn),
+  GC_RUN(0x0964, GC_Po), GC_RUN(0x0966, GC_Nd),
+  GC_RUN(0x0970, GC_Po), GC_RUN(0x0971, GC_Lm),
+  GC_RUN(0x0972, GC_Lo), GC_RUN(0x0981, GC_Mn),
+  GC_RUN(0x0982, GC_Mc), GC_RUN(0x0984, GC_Cn),
+  GC_RUN(0x0985, GC_Lo), GC_RUN(0x098D, GC_Cn),
+  GC_RUN(0x098F, GC_Lo), GC_RUN(0x0991, GC_Cn),
+  GC_RUN(0x0993, GC_Lo), GC_RUN(0x09A9, GC_Cn),
+  GC_RUN(0x09AA, GC_Lo), GC_RUN(0x09B1, GC_Cn),
+  GC_RUN(0x09B2, GC_Lo), GC_RUN(0x09B3, GC_Cn),
+  GC_RUN(0x09B6, GC_Lo), GC_RUN(0x09BA, GC_Cn),
+  GC_RUN(0x09BC, GC_Mn), GC_RUN(0x09BD, GC_Lo),
+  GC_RUN(0x09BE, GC_Mc), GC_RUN(0x09C1, GC_Mn),
+  GC_RUN(0x09C5, GC_Cn), GC_RUN(0x09C7, GC_Mc),
+  GC_RUN(0x09C9, GC_Cn), GC_RUN(0x09CB, GC_Mc),
+  GC_RUN(0x09CD, GC_Mn), GC_RUN(0x09CE, GC_Lo),
+  GC_RUN(0x09CF, GC_Cn), GC_RUN(0x09D7, GC_Mc),
+  GC_RUN(0x09D8, GC_Cn), GC_RUN(0x09DC, GC_Lo),
+  GC_RUN(0x09DE, GC_Cn), GC_RUN(0x09DF, GC_Lo),
+  GC_RUN(0x09E2, GC_Mn), GC_RUN(0x09E4, GC_Cn),
+  GC_RUN(0x09E6, GC_Nd), GC_RUN(0x09F0, GC_Lo),
+  GC_RUN(0x09F2, GC_Sc), GC_RUN(0x09F4, GC_No),
+  GC_RUN(0x09FA, GC_So), GC_RUN(0x09FB, GC_Sc),
+  GC_RUN(0x09FC, GC_Lo), GC_RUN(0x09FD, GC_Po),
+  GC_RUN(0x09FE, GC_Mn), GC_RUN(0x09FF, GC_Cn),
+  GC_RUN(0x0A01, GC_Mn), GC_RUN(0x0A03, GC_Mc),
+  GC_RUN(0x0A04, GC_Cn), GC_RUN(0x0A05, GC_Lo),
+  GC_RUN(0x0A0B, GC_Cn), GC_RUN(0x0A0F, GC_Lo),
+  GC_RUN(0x0A11, GC_Cn), GC_RUN(0x0A13, GC_Lo),
+  GC_RUN(0x0A29, GC_Cn), GC_RUN(0x0A2A, GC_Lo),
+  GC_RUN(0x0A31, GC_Cn), GC_RUN(0x0A32, GC_Lo),
+  GC_RUN(0x0A34, GC_Cn), GC_RUN(0x0A35, GC_Lo),
+  GC_RUN(0x0A37, GC_Cn), GC_RUN(0x0A38, GC_Lo),
+  GC_RUN(0x0A3A, GC_Cn), GC_RUN(0x0A3C, GC_Mn),
+  GC_RUN(0x0A3D, GC_Cn), GC_RUN(0x0A3E, GC_Mc),
+  GC_RUN(0x0A41, GC_Mn), GC_RUN(0x0A43, GC_Cn),
+  GC_RUN(0x0A47, GC_Mn), GC_RUN(0x0A49, GC_Cn),
+  GC_RUN(0x0A4B, GC_Mn), GC_RUN(0x0A4E, GC_Cn),
+  GC_RUN(0x0A51, GC_Mn), GC_RUN(0x0A52, GC_Cn),
+  GC_RUN(0x0A59, GC_Lo), GC_RUN(0x0A5D, GC_Cn),
+  GC_RUN(0x0A5E, GC_Lo), GC_RUN(0x0A5F, GC_Cn),
+  GC_RUN(0x0A66, GC_Nd), GC_RUN(0x0A70, GC_Mn),
+  GC_RUN(0x0A72, GC_Lo), GC_RUN(0x0A75, GC_Mn),
+  GC_RUN(0x0A76, GC_Po), GC_RUN(0x0A77, GC_Cn),
+  GC_RUN(0x0A81, GC_Mn), GC_RUN(0x0A83, GC_Mc),
+  GC_RUN(0x0A84, GC_Cn), GC_RUN(0x0A85, GC_Lo),
+  GC_RUN(0x0A8E, GC_Cn), GC_RUN(0x0A8F, GC_Lo),
+  GC_RUN(0x0A92, GC_Cn), GC_RUN(0x0A93, GC_Lo),
+  GC_RUN(0x0AA9, GC_Cn), GC_RUN(0x0AAA, GC_Lo),
+  GC_RUN(0x0AB1, GC_Cn), GC_RUN(0x0AB2, GC_Lo),
+  GC_RUN(0x0AB4, GC_Cn), GC_RUN(0x0AB5, GC_Lo),
+  GC_RUN(0x0ABA, GC_Cn), GC_RUN(0x0ABC, GC_Mn),
+  GC_RUN(0x0ABD, GC_Lo), GC_RUN(0x0ABE, GC_Mc),
+  GC_RUN(0x0AC1, GC_Mn), GC_RUN(0x0AC6, GC_Cn),
+  GC_RUN(0x0AC7, GC_Mn), GC_RUN(0x0AC9, GC_Mc),
+  GC_RUN(0x0ACA, GC_Cn), GC_RUN(0x0ACB, GC_Mc),
+  GC_RUN(0x0ACD, GC_Mn), GC_RUN(0x0ACE, GC_Cn),
+  GC_RUN(0x0AD0, GC_Lo), GC_RUN(0x0AD1, GC_Cn),
+  GC_RUN(0x0AE0, GC_Lo), GC_RUN(0x0AE2, GC_Mn),
+  GC_RUN(0x0AE4, GC_Cn), GC_RUN(0x0AE6, GC_Nd),
+  GC_RUN(0x0AF0, GC_Po), GC_RUN(0x0AF1, GC_Sc),
+  GC_RUN(0x0AF2, GC_Cn), GC_RUN(0x0AF9, GC_Lo),
+  GC_RUN(0x0AFA, GC_Mn), GC_RUN(0x0B00, GC_Cn),
+  GC_RUN(0x0B01, GC_Mn), GC_RUN(0x0B02, GC_Mc),
+  GC_RUN(0x0B04, GC_Cn), GC_RUN(0x0B05, GC_Lo),
+  GC_RUN(0x0B0D, GC_Cn), GC_RUN(0x0B0F, GC_Lo),
+  GC_RUN(0x0B11, GC_Cn), GC_RUN(0x0B13, GC_Lo),
+  GC_RUN(0x0B29, GC_Cn), GC_RUN(0x0B2A, GC_Lo),
+  GC_RUN(0x0B31, GC_Cn), GC_RUN(0x0B32, GC_Lo),
+  GC_RUN(0x0B34, GC_Cn), GC_RUN(0x0B35, GC_Lo),
+  GC_RUN(0x0B3A, GC_Cn), GC_RUN(0x0B3C, GC_Mn),
+  GC_RUN(0x0B3D, GC_Lo), GC_RUN(0x0B3E, GC_Mc),
+  GC_RUN(0x0B3F, GC_Mn), GC_RUN(0x0B40, GC_Mc),
+  GC_RUN(0x0B41, GC_Mn), GC_RUN(0x0B45, GC_Cn),
+  GC_RUN(0x0B47, GC_Mc), GC_RUN(0x0B49, GC_Cn),
+  GC_RUN(0x0B4B, GC_Mc), GC_RUN(0x0B4D, GC_Mn),
+  GC_RUN(0x0B4E, GC_Cn), GC_RUN(0x0B55, GC_Mn),
+  GC_RUN(0x0B57, GC_Mc), GC_RUN(0x0B58, GC_Cn),
+  GC_RUN(0x0B5C, GC_Lo), GC_RUN(0x0B5E, GC_Cn),
+  GC_RUN(0x0B5F, GC_Lo), GC_RUN(0x0B62, GC_Mn),
+  GC_RUN(0x0B64, GC_Cn), GC_RUN(0x0B66, GC_Nd),
+  GC_RUN(0x0B70, GC_So), GC_RUN(0x0B71, GC_Lo),
+  GC_RUN(0x0B72, GC_No), GC_RUN(0x0B78, GC_Cn),
+  GC_RUN(0x0B82, GC_Mn), GC_RUN(0x0B83, GC_Lo),
+  GC_RUN(0x0B84, GC_Cn), GC_RUN(0x0B85, GC_Lo),
+  GC_RUN(0x0B8B, GC_Cn), GC_RUN(0x0B8E, GC_Lo),
+  GC_RUN(0x0B91, GC_Cn), GC_RUN(0x0B92, GC_Lo),
+  GC_RUN(0x0B96, GC_Cn), GC_RUN(0x0B99, GC_Lo),
+  GC_RUN(0x0B9B, GC_Cn), GC_RUN(0x0B9C, GC_Lo),
+  GC_RUN(0x0B9D, GC_Cn), GC_RUN(0x0B9E, GC_Lo),
+  GC_RUN(0x0BA0, GC_Cn), GC_RUN(0x0BA3, GC_Lo),
+  GC_RUN(0x0BA5, GC_Cn), GC_RUN(0x0BA8, GC_Lo),
+  GC_RUN(0x0BAB, GC_Cn), GC_RUN(0x0BAE, GC_Lo),
+  GC_RUN(0x0BBA, GC_Cn), GC_RUN(0x0BBE, GC_Mc),
+  GC_RUN(0x0BC0, GC_Mn), GC_RUN(0x0BC1, GC_Mc),
+  GC_RUN(0x0BC3, GC_Cn), GC_RUN(0x0BC6, GC_Mc),
+  GC_RUN(0x0BC9, GC_Cn), GC_RUN(0x0BCA, GC_Mc),
+  GC_RUN(0x0BCD, GC_Mn), GC_RUN(0x0BCE, GC_Cn),
+  GC_RUN(0x0BD0, GC_Lo), GC_RUN(0x0BD1, GC_Cn),
+  GC_RUN(0x0BD7, GC_Mc), GC_RUN(0x0BD8, GC_Cn),
+  GC_RUN(0x0BE6, GC_Nd), GC_RUN(0x0BF0, GC_No),
+  GC_RUN(0x0BF3, GC_So), GC_RUN(0x0BF9, GC_Sc),
+  GC_RUN(0x0BFA, GC_So), GC_RUN(0x0BFB, GC_Cn),
+  GC_RUN(0x0C00, GC_Mn), GC_RUN(0x0C01, GC_Mc),
+  GC_RUN(0x0C04, GC_Mn), GC_RUN(0x0C05, GC_Lo),
+  GC_RUN(0x0C0D, GC_Cn), GC_RUN(0x0C0E, GC_Lo),
+  GC_RUN(0x0C11, GC_Cn), GC_RUN(0x0C12, GC_Lo),
+  GC_RUN(0x0C29, GC_Cn), GC_RUN(0x0C2A, GC_Lo),
+  GC_RUN(0x0C3A, GC_Cn), GC_RUN(0x0C3C, GC_Mn),
+  GC_RUN(0x0C3D, GC_Lo), GC_RUN(0x0C3E, GC_Mn),
+  GC_RUN(0x0C41, GC_Mc), GC_RUN(0x0C45, GC_Cn),
+  GC_RUN(0x0C46, GC_Mn), GC_RUN(0x0C49, GC_Cn),
+  GC_RUN(0x0C4A, GC_Mn), GC_RUN(0x0C4E, GC_Cn),
+  GC_RUN(0x0C55, GC_Mn), GC_RUN(0x0C57, GC_Cn),
+  GC_RUN(0x0C58, GC_Lo), GC_RUN(0x0C5B, GC_Cn),
+  GC_RUN(0x0C5D, GC_Lo), GC_RUN(0x0C5E, GC_Cn),
+  GC_RUN(0x0C60, GC_Lo), GC_RUN(0x0C62, GC_Mn),
+  GC_RUN(0x0C64, GC_Cn), GC_RUN(0x0C66, GC_Nd),
+  GC_RUN(0x0C70, GC_Cn), GC_RUN(0x0C77, GC_Po),
+  GC_RUN(0x0C78, GC_No), GC_RUN(0x0C7F, GC_So),
+  GC_RUN(0x0C80, GC_Lo), GC_RUN(0x0C81, GC_Mn),
+  GC_RUN(0x0C82, GC_Mc), GC_RUN(0x0C84, GC_Po),
+  GC_RUN(0x0C85, GC_Lo), GC_RUN(0x0C8D, GC_Cn),
+  GC_RUN(0x0C8E, GC_Lo), GC_RUN(0x0C91, GC_Cn),
+  GC_RUN(0x0C92, GC_Lo), GC_RUN(0x0CA9, GC_Cn),
+  GC_RUN(0x0CAA, GC_Lo), GC_RUN(0x0CB4, GC_Cn),
+  GC_RUN(0x0CB5, GC_Lo), GC_RUN(0x0CBA, GC_Cn),
+  GC_RUN(0x0CBC, GC_Mn), GC_RUN(0x0CBD, GC_Lo),
+  GC_RUN(0x0CBE, GC_Mc), GC_RUN(0x0CBF, GC_Mn),
+  GC_RUN(0x0CC0, GC_Mc), GC_RUN(0x0CC5, GC_Cn),
+  GC_RUN(0x0CC6, GC_Mn), GC_RUN(0x0CC7, GC_Mc),
+  GC_RUN(0x0CC9, GC_Cn), GC_RUN(0x0CCA, GC_Mc),
+  GC_RUN(0x0CCC, GC_Mn), GC_RUN(0x0CCE, GC_Cn),
+  GC_RUN(0x0CD5, GC_Mc), GC_RUN(0x0CD7, GC_Cn),
+  GC_RUN(0x0CDD, GC_Lo), GC_RUN(0x0CDF, GC_Cn),
+  GC_RUN(0x0CE0, GC_Lo), GC_RUN(0x0CE2, GC_Mn),
+  GC_RUN(0x0CE4, GC_Cn), GC_RUN(0x0CE6, GC_Nd),
+  GC_RUN(0x0CF0, GC_Cn), GC_RUN(0x0CF1, GC_Lo),
+  GC_RUN(0x0CF3, GC_Cn), GC_RUN(0x0D00, GC_Mn),
+  GC_RUN(0x0D02, GC_Mc), GC_RUN(0x0D04, GC_Lo),
+  GC_RUN(0x0D0D, GC_Cn), GC_RUN(0x0D0E, GC_Lo),
+  GC_RUN(0x0D11, GC_Cn), GC_RUN(0x0D12, GC_Lo),
+  GC_RUN(0x0D3B, GC_Mn), GC_RUN(0x0D3D, GC_Lo),
+  GC_RUN(0x0D3E, GC_Mc), GC_RUN(0x0D41, GC_Mn),
+  GC_RUN(0x0D45, GC_Cn), GC_RUN(0x0D46, GC_Mc),
+  GC_RUN(0x0D49, GC_Cn), GC_RUN(0x0D4A, GC_Mc),
+  GC_RUN(0x0D4D, GC_Mn), GC_RUN(0x0D4E, GC_Lo),
+  GC_RUN(0x0D4F, GC_So), GC_RUN(0x0D50, GC_Cn),
+  GC_RUN(0x0D54, GC_Lo), GC_RUN(0x0D57, GC_Mc),
+  GC_RUN(0x0D58, GC_No), GC_RUN(0x0D5F, GC_Lo),
+  GC_RUN(0x0D62, GC_Mn), GC_RUN(0x0D64, GC_Cn),
+  GC_RUN(0x0D66, GC_Nd), GC_RUN(0x0D70, GC_No),
+  GC_RUN(0x0D79, GC_So), GC_RUN(0x0D7A, GC_Lo),
+  GC_RUN(0x0D80, GC_Cn), GC_RUN(0x0D81, GC_Mn),
+  GC_RUN(0x0D82, GC_Mc), GC_RUN(0x0D84, GC_Cn),
+  GC_RUN(0x0D85, GC_Lo), GC_RUN(0x0D97, GC_Cn),
+  GC_RUN(0x0D9A, GC_Lo), GC_RUN(0x0DB2, GC_Cn),
+  GC_RUN(0x0DB3, GC_Lo), GC_RUN(0x0DBC, GC_Cn),
+  GC_RUN(0x0DBD, GC_Lo), GC_RUN(0x0DBE, GC_Cn),
+  GC_RUN(0x0DC0, GC_Lo), GC_RUN(0x0DC7, GC_Cn),
+  GC_RUN(0x0DCA, GC_Mn), GC_RUN(0x0DCB, GC_Cn),
+  GC_RUN(0x0DCF, GC_Mc), GC_RUN(0x0DD2, GC_Mn),
+  GC_RUN(0x0DD5, GC_Cn), GC_RUN(0x0DD6, GC_Mn),
+  GC_RUN(0x0DD7, GC_Cn), GC_RUN(0x0DD8, GC_Mc),
+  GC_RUN(0x0DE0, GC_Cn), GC_RUN(0x0DE6, GC_Nd),
+  GC_RUN(0x0DF0, GC_Cn), GC_RUN(0x0DF2, GC_Mc),
+  GC_RUN(0x0DF4, GC_Po), GC_RUN(0x0DF5, GC_Cn),
+  GC_RUN(0x0E01, GC_Lo), GC_RUN(0x0E31, GC_Mn),
+  GC_RUN(0x0E32, GC_Lo), GC_RUN(0x0E34, GC_Mn),
+  GC_RUN(0x0E3B, GC_Cn), GC_RUN(0x0E3F, GC_Sc),
+  GC_RUN(0x0E40, GC_Lo), GC_RUN(0x0E46, GC_Lm),
+  GC_RUN(0x0E47, GC_Mn), GC_RUN(0x0E4F, GC_Po),
+  GC_RUN(0x0E50, GC_Nd), GC_RUN(0x0E5A, GC_Po),
+  GC_RUN(0x0E5C, GC_Cn), GC_RUN(0x0E81, GC_Lo),
+  GC_RUN(0x0E83, GC_Cn), GC_RUN(0x0E84, GC_Lo),
+  GC_RUN(0x0E85, GC_Cn), GC_RUN(0x0E86, GC_Lo),
+  GC_RUN(0x0E8B, GC_Cn), GC_RUN(0x0E8C, GC_Lo),
+  GC_RUN(0x0EA4, GC_Cn), GC_RUN(0x0EA5, GC_Lo),
+  GC_RUN(0x0EA6, GC_Cn), GC_RUN(0x0EA7, GC_Lo),
+  GC_RUN(0x0EB1, GC_Mn), GC_RUN(0x0EB2, GC_Lo),
+  GC_RUN(0x0EB4, GC_Mn), GC_RUN(0x0EBD, GC_Lo),
+  GC_RUN(0x0EBE, GC_Cn), GC_RUN(0x0EC0, GC_Lo),
+  GC_RUN(0x0EC5, GC_Cn), GC_RUN(0x0EC6, GC_Lm),
+  GC_RUN(0x0EC7, GC_Cn), GC_RUN(0x0EC8, GC_Mn),
+  GC_RUN(0x0ECE, GC_Cn), GC_RUN(0x0ED0, GC_Nd),
+  GC_RUN(0x0EDA, GC_Cn), GC_RUN(0x0EDC, GC_Lo),
+  GC_RUN(0x0EE0, GC_Cn), GC_RUN(0x0F00, GC_Lo),
+  GC_RUN(0x0F01, GC_So), GC_RUN(0x0F04, GC_Po),
+  GC_RUN(0x0F13, GC_So), GC_RUN(0x0F14, GC_Po),
+  GC_RUN(0x0F15, GC_So), GC_RUN(0x0F18, GC_Mn),
+  GC_RUN(0x0F1A, GC_So), GC_RUN(0x0F20, GC_Nd),
+  GC_RUN(0x0F2A, GC_No), GC_RUN(0x0F34, GC_So),
+  GC_RUN(0x0F35, GC_Mn), GC_RUN(0x0F36, GC_So),
+  GC_RUN(0x0F37, GC_Mn), GC_RUN(0x0F38, GC_So),
+  GC_RUN(0x0F39, GC_Mn), GC_RUN(0x0F3A, GC_Ps),
+  GC_RUN(0x0F3B, GC_Pe), GC_RUN(0x0F3C, GC_Ps),
+  GC_RUN(0x0F3D, GC_Pe), GC_RUN(0x0F3E, GC_Mc),
+  GC_RUN(0x0F40, GC_Lo), GC_RUN(0x0F48, GC_Cn),
+  GC_RUN(0x0F49, GC_Lo), GC_RUN(0x0F6D, GC_Cn),
+  GC_RUN(0x0F71, GC_Mn), GC_RUN(0x0F7F, GC_Mc),
+  GC_RUN(0x0F80, GC_Mn), GC_RUN(0x0F85, GC_Po),
+  GC_RUN(0x0F86, GC_Mn), GC_RUN(0x0F88, GC_Lo),
+  GC_RUN(0x0F8D, GC_Mn), GC_RUN(0x0F98, GC_Cn),
+  GC_RUN(0x0F99, GC_Mn), GC_RUN(0x0FBD, GC_Cn),
+  GC_RUN(0x0FBE, GC_So), GC_RUN(0x0FC6, GC_Mn),
+  GC_RUN(0x0FC7, GC_So), GC_RUN(0x0FCD, GC_Cn),
+  GC_RUN(0x0FCE, GC_So), GC_RUN(0x0FD0, GC_Po),
+  GC_RUN(0x0FD5, GC_So), GC_RUN(0x0FD9, GC_Po),
+  GC_RUN(0x0FDB, GC_Cn), GC_RUN(0x1000, GC_Lo),
+  GC_RUN(0x102B, GC_Mc), GC_RUN(0x102D, GC_Mn),
+  GC_RUN(0x1031, GC_Mc), GC_RUN(0x1032, GC_Mn),
+  GC_RUN(0x1038, GC_Mc), GC_RUN(0x1039, GC_Mn),
+  GC_RUN(0x103B, GC_Mc), GC_RUN(0x103D, GC_Mn),
+  GC_RUN(0x103F, GC_Lo), GC_RUN(0x1040, GC_Nd),
+  GC_RUN(0x104A, GC_Po), GC_RUN(0x1050, GC_Lo),
+  GC_RUN(0x1056, GC_Mc), GC_RUN(0x1058, GC_Mn),
+  GC_RUN(0x105A, GC_Lo), GC_RUN(0x105E, GC_Mn),
+  GC_RUN(0x1061, GC_Lo), GC_RUN(0x1062, GC_Mc),
+  GC_RUN(0x1065, GC_Lo), GC_RUN(0x1067, GC_Mc),
+  GC_RUN(0x106E, GC_Lo), GC_RUN(0x1071, GC_Mn),
+  GC_RUN(0x1075, GC_Lo), GC_RUN(0x1082, GC_Mn),
+  GC_RUN(0x1083, GC_Mc), GC_RUN(0x1085, GC_Mn),
+  GC_RUN(0x1087, GC_Mc), GC_RUN(0x108D, GC_Mn),
+  GC_RUN(0x108E, GC_Lo), GC_RUN(0x108F, GC_Mc),
+  GC_RUN(0x1090, GC_Nd), GC_RUN(0x109A, GC_Mc),
+  GC_RUN(0x109D, GC_Mn), GC_RUN(0x109E, GC_So),
+  GC_RUN(0x10A0, GC_Lu), GC_RUN(0x10C6, GC_Cn),
+  GC_RUN(0x10C7, GC_Lu), GC_RUN(0x10C8, GC_Cn),
+  GC_RUN(0x10CD, GC_Lu), GC_RUN(0x10CE, GC_Cn),
+  GC_RUN(0x10D0, GC_Ll), GC_RUN(0x10FB, GC_Po),
+  GC_RUN(0x10FC, GC_Lm), GC_RUN(0x10FD, GC_Ll),
+  GC_RUN(0x1100, GC_Lo), GC_RUN(0x1249, GC_Cn),
+  GC_RUN(0x124A, GC_Lo), GC_RUN(0x124E, GC_Cn),
+  GC_RUN(0x1250, GC_Lo), GC_RUN(0x1257, GC_Cn),
+  GC_RUN(0x1258, GC_Lo), GC_RUN(0x1259, GC_Cn),
+  GC_RUN(0x125A, GC_Lo), GC_RUN(0x125E, GC_Cn),
+  GC_RUN(0x1260, GC_Lo), GC_RUN(0x1289, GC_Cn),
+  GC_RUN(0x128A, GC_Lo), GC_RUN(0x128E, GC_Cn),
+  GC_RUN(0x1290, GC_Lo), GC_RUN(0x12B1, GC_Cn),
+  GC_RUN(0x12B2, GC_Lo), GC_RUN(0x12B6, GC_Cn),
+  GC_RUN(0x12B8, GC_Lo), GC_RUN(0x12BF, GC_Cn),
+  GC_RUN(0x12C0, GC_Lo), GC_RUN(0x12C1, GC_Cn),
+  GC_RUN(0x12C2, GC_Lo), GC_RUN(0x12C6, GC_Cn),
+  GC_RUN(0x12C8, GC_Lo), GC_RUN(0x12D7, GC_Cn),
+  GC_RUN(0x12D8, GC_Lo), GC_RUN(0x1311, GC_Cn),
+  GC_RUN(0x1312, GC_Lo), GC_RUN(0x1316, GC_Cn),
+  GC_RUN(0x1318, GC_Lo), GC_RUN(0x135B, GC_Cn),
+  GC_RUN(0x135D, GC_Mn), GC_RUN(0x1360, GC_Po),
+  GC_RUN(0x1369, GC_No), GC_RUN(0x137D, GC_Cn),
+  GC_RUN(0x1380, GC_Lo), GC_RUN(0x1390, GC_So),
+  GC_RUN(0x139A, GC_Cn), GC_RUN(0x13A0, GC_Lu),
+  GC_RUN(0x13F6, GC_Cn), GC_RUN(0x13F8, GC_Ll),
+  GC_RUN(0x13FE, GC_Cn), GC_RUN(0x1400, GC_Pd),
+  GC_RUN(0x1401, GC_Lo), GC_RUN(0x166D, GC_So),
+  GC_RUN(0x166E, GC_Po), GC_RUN(0x166F, GC_Lo),
+  GC_RUN(0x1680, GC_Zs), GC_RUN(0x1681, GC_Lo),
+  GC_RUN(0x169B, GC_Ps), GC_RUN(0x169C, GC_Pe),
+  GC_RUN(0x169D, GC_Cn), GC_RUN(0x16A0, GC_Lo),
+  GC_RUN(0x16EB, GC_Po), GC_RUN(0x16EE, GC_Nl),
+  GC_RUN(0x16F1, GC_Lo), GC_RUN(0x16F9, GC_Cn),
+  GC_RUN(0x1700, GC_Lo), GC_RUN(0x1712, GC_Mn),
+  GC_RUN(0x1715, GC_Mc), GC_RUN(0x1716, GC_Cn),
+  GC_RUN(0x171F, GC_Lo), GC_RUN(0x1732, GC_Mn),
+  GC_RUN(0x1734, GC_Mc), GC_RUN(0x1735, GC_Po),
+  GC_RUN(0x1737, GC_Cn), GC_RUN(0x1740, GC_Lo),
+  GC_RUN(0x1752, GC_Mn), GC_RUN(0x1754, GC_Cn),
+  GC_RUN(0x1760, GC_Lo), GC_RUN(0x176D, GC_Cn),
+  GC_RUN(0x176E, GC_Lo), GC_RUN(0x1771, GC_Cn),
+  GC_RUN(0x1772, GC_Mn), GC_RUN(0x1774, GC_Cn),
+  GC_RUN(0x1780, GC_Lo), GC_RUN(0x17B4, GC_Mn),
+  GC_RUN(0x17B6, GC_Mc), GC_RUN(0x17B7, GC_Mn),
+  GC_RUN(0x17BE, GC_Mc), GC_RUN(0x17C6, GC_Mn),
+  GC_RUN(0x17C7, GC_Mc), GC_RUN(0x17C9, GC_Mn),
+  GC_RUN(0x17D4, GC_Po), GC_RUN(0x17D7, GC_Lm),
+  GC_RUN(0x17D8, GC_Po), GC_RUN(0x17DB, GC_Sc),
+  GC_RUN(0x17DC, GC_Lo), GC_RUN(0x17DD, GC_Mn),
+  GC_RUN(0x17DE, GC_Cn), GC_RUN(0x17E0, GC_Nd),
+  GC_RUN(0x17EA, GC_Cn), GC_RUN(0x17F0, GC_No),
+  GC_RUN(0x17FA, GC_Cn), GC_RUN(0x1800, GC_Po),
+  GC_RUN(0x1806, GC_Pd), GC_RUN(0x1807, GC_Po),
+  GC_RUN(0x180B, GC_Mn), GC_RUN(0x180E, GC_Cf),
+  GC_RUN(0x180F, GC_Mn), GC_RUN(0x1810, GC_Nd),
+  GC_RUN(0x181A, GC_Cn), GC_RUN(0x1820, GC_Lo),
+  GC_RUN(0x1843, GC_Lm), GC_RUN(0x1844, GC_Lo),
+  GC_RUN(0x1879, GC_Cn), GC_RUN(0x1880, GC_Lo),
+  GC_RUN(0x1885, GC_Mn), GC_RUN(0x1887, GC_Lo),
+  GC_RUN(0x18A9, GC_Mn), GC_RUN(0x18AA, GC_Lo),
+  GC_RUN(0x18AB, GC_Cn), GC_RUN(0x18B0, GC_Lo),
+  GC_RUN(0x18F6, GC_Cn), GC_RUN(0x1900, GC_Lo),
+  GC_RUN(0x191F, GC_Cn), GC_RUN(0x1920, GC_Mn),
+  GC_RUN(0x1923, GC_Mc), GC_RUN(0x1927, GC_Mn),
+  GC_RUN(0x1929, GC_Mc), GC_RUN(0x192C, GC_Cn),
+  GC_RUN(0x1930, GC_Mc), GC_RUN(0x1932, GC_Mn),
+  GC_RUN(0x1933, GC_Mc), GC_RUN(0x1939, GC_Mn),
+  GC_RUN(0x193C, GC_Cn), GC_RUN(0x1940, GC_So),
+  GC_RUN(0x1941, GC_Cn), GC_RUN(0x1944, GC_Po),
+  GC_RUN(0x1946, GC_Nd), GC_RUN(0x1950, GC_Lo),
+  GC_RUN(0x196E, GC_Cn), GC_RUN(0x1970, GC_Lo),
+  GC_RUN(0x1975, GC_Cn), GC_RUN(0x1980, GC_Lo),
+  GC_RUN(0x19AC, GC_Cn), GC_RUN(0x19B0, GC_Lo),
+  GC_RUN(0x19CA, GC_Cn), GC_RUN(0x19D0, GC_Nd),
+  GC_RUN(0x19DA, GC_No), GC_RUN(0x19DB, GC_Cn),
+  GC_RUN(0x19DE, GC_So), GC_RUN(0x1A00, GC_Lo),
+  GC_RUN(0x1A17, GC_Mn), GC_RUN(0x1A19, GC_Mc),
+  GC_RUN(0x1A1B, GC_Mn), GC_RUN(0x1A1C, GC_Cn),
+  GC_RUN(0x1A1E, GC_Po), GC_RUN(0x1A20, GC_Lo),
+  GC_RUN(0x1A55, GC_Mc), GC_RUN(0x1A56, GC_Mn),
+  GC_RUN(0x1A57, GC_Mc), GC_RUN(0x1A58, GC_Mn),
+  GC_RUN(0x1A5F, GC_Cn), GC_RUN(0x1A60, GC_Mn),
+  GC_RUN(0x1A61, GC_Mc), GC_RUN(0x1A62, GC_Mn),
+  GC_RUN(0x1A63, GC_Mc), GC_RUN(0x1A65, GC_Mn),
+  GC_RUN(0x1A6D, GC_Mc), GC_RUN(0x1A73, GC_Mn),
+  GC_RUN(0x1A7D, GC_Cn), GC_RUN(0x1A7F, GC_Mn),
+  GC_RUN(0x1A80, GC_Nd), GC_RUN(0x1A8A, GC_Cn),
+  GC_RUN(0x1A90, GC_Nd), GC_RUN(0x1A9A, GC_Cn),
+  GC_RUN(0x1AA0, GC_Po), GC_RUN(0x1AA7, GC_Lm),
+  GC_RUN(0x1AA8, GC_Po), GC_RUN(0x1AAE, GC_Cn),
+  GC_RUN(0x1AB0, GC_Mn), GC_RUN(0x1ABE, GC_Me),
+  GC_RUN(0x1ABF, GC_Mn), GC_RUN(0x1ACF, GC_Cn),
+  GC_RUN(0x1B00, GC_Mn), GC_RUN(0x1B04, GC_Mc),
+  GC_RUN(0x1B05, GC_Lo), GC_RUN(0x1B34, GC_Mn),
+  GC_RUN(0x1B35, GC_Mc), GC_RUN(0x1B36, GC_Mn),
+  GC_RUN(0x1B3B, GC_Mc), GC_RUN(0x1B3C, GC_Mn),
+  GC_RUN(0x1B3D, GC_Mc), GC_RUN(0x1B42, GC_Mn),
+  GC_RUN(0x1B43, GC_Mc), GC_RUN(0x1B45, GC_Lo),
+  GC_RUN(0x1B4D, GC_Cn), GC_RUN(0x1B50, GC_Nd),
+  GC_RUN(0x1B5A, GC_Po), GC_RUN(0x1B61, GC_So),
+  GC_RUN(0x1B6B, GC_Mn), GC_RUN(0x1B74, GC_So),
+  GC_RUN(0x1B7D, GC_Po), GC_RUN(0x1B7F, GC_Cn),
+  GC_RUN(0x1B80, GC_Mn), GC_RUN(0x1B82, GC_Mc),
+  GC_RUN(0x1B83, GC_Lo), GC_RUN(0x1BA1, GC_Mc),
+  GC_RUN(0x1BA2, GC_Mn), GC_RUN(0x1BA6, GC_Mc),
+  GC_RUN(0x1BA8, GC_Mn), GC_RUN(0x1BAA, GC_Mc),
+  GC_RUN(0x1BAB, GC_Mn), GC_RUN(0x1BAE, GC_Lo),
+  GC_RUN(0x1BB0, GC_Nd), GC_RUN(0x1BBA, GC_Lo),
+  GC_RUN(0x1BE6, GC_Mn), GC_RUN(0x1BE7, GC_Mc),
+  GC_RUN(0x1BE8, GC_Mn), GC_RUN(0x1BEA, GC_Mc),
+  GC_RUN(0x1BED, GC_Mn), GC_RUN(0x1BEE, GC_Mc),
+  GC_RUN(0x1BEF, GC_Mn), GC_RUN(0x1BF2, GC_Mc),
+  GC_RUN(0x1BF4, GC_Cn), GC_RUN(0x1BFC, GC_Po),
+  GC_RUN(0x1C00, GC_Lo), GC_RUN(0x1C24, GC_Mc),
+  GC_RUN(0x1C2C, GC_Mn), GC_RUN(0x1C34, GC_Mc),
+  GC_RUN(0x1C36, GC_Mn), GC_RUN(0x1C38, GC_Cn),
+  GC_RUN(0x1C3B, GC_Po), GC_RUN(0x1C40, GC_Nd),
+  GC_RUN(0x1C4A, GC_Cn), GC_RUN(0x1C4D, GC_Lo),
+  GC_RUN(0x1C50, GC_Nd), GC_RUN(0x1C5A, GC_Lo),
+  GC_RUN(0x1C78, GC_Lm), GC_RUN(0x1C7E, GC_Po),
+  GC_RUN(0x1C80, GC_Ll), GC_RUN(0x1C89, GC_Cn),
+  GC_RUN(0x1C90, GC_Lu), GC_RUN(0x1CBB, GC_Cn),
+  GC_RUN(0x1CBD, GC_Lu), GC_RUN(0x1CC0, GC_Po),
+  GC_RUN(0x1CC8, GC_Cn), GC_RUN(0x1CD0, GC_Mn),
+  GC_RUN(0x1CD3, GC_Po), GC_RUN(0x1CD4, GC_Mn),
+  GC_RUN(0x1CE1, GC_Mc), GC_RUN(0x1CE2, GC_Mn),
+  GC_RUN(0x1CE9, GC_Lo), GC_RUN(0x1CED, GC_Mn),
+  GC_RUN(0x1CEE, GC_Lo), GC_RUN(0x1CF4, GC_Mn),
+  GC_RUN(0x1CF5, GC_Lo), GC_RUN(0x1CF7, GC_Mc),
+  GC_RUN(0x1CF8, GC_Mn), GC_RUN(0x1CFA, GC_Lo),
+  GC_RUN(0x1CFB, GC_Cn), GC_RUN(0x1D00, GC_Ll),
+  GC_RUN(0x1D2C, GC_Lm), GC_RUN(0x1D6B, GC_Ll),
+  GC_RUN(0x1D78, GC_Lm), GC_RUN(0x1D79, GC_Ll),
+  GC_RUN(0x1D9B, GC_Lm), GC_RUN(0x1DC0, GC_Mn),
+  GC_RUN(0x1E00, GC_Lu), GC_RUN(0x1E01, GC_Ll),
+  GC_RUN(0x1E02, GC_Lu), GC_RUN(0x1E03, GC_Ll),
+  GC_RUN(0x1E04, GC_Lu), GC_RUN(0x1E05, GC_Ll),
+  GC_RUN(0x1E06, GC_Lu), GC_RUN(0x1E07, GC_Ll),
+  GC_RUN(0x1E08, GC_Lu), GC_RUN(0x1E09, GC_Ll),
+  GC_RUN(0x1E0A, GC_Lu), GC_RUN(0x1E0B, GC_Ll),
+  GC_RUN(0x1E0C, GC_Lu), GC_RUN(0x1E0D, GC_Ll),
+  GC_RUN(0x1E0E, GC_Lu), GC_RUN(0x1E0F, GC_Ll),
+  GC_RUN(0x1E10, GC_Lu), GC_RUN(0x1E11, GC_Ll),
+  GC_RUN(0x1E12, GC_Lu), GC_RUN(0x1E13, GC_Ll),
+  GC_RUN(0x1E14, GC_Lu), GC_RUN(0x1E15, GC_Ll),
+  GC_RUN(0x1E16, GC_Lu), GC_RUN(0x1E17, GC_Ll),
+  GC_RUN(0x1E18, GC_Lu), GC_RUN(0x1E19, GC_Ll),
+  GC_RUN(0x1E1A, GC_Lu), GC_RUN(0x1E1B, GC_Ll),
+  GC_RUN(0x1E1C, GC_Lu), GC_RUN(0x1E1D, GC_Ll),
+  GC_RUN(0x1E1E, GC_Lu), GC_RUN(0x1E1F, GC_Ll),
+  GC_RUN(0x1E20, GC_Lu), GC_RUN(0x1E21, GC_Ll),
+  GC_RUN(0x1E22, GC_Lu), GC_RUN(0x1E23, GC_Ll),
+  GC_RUN(0x1E24, GC_Lu), GC_RUN(0x1E25, GC_Ll),
+  GC_RUN(0x1E26, GC_Lu), GC_RUN(0x1E27, GC_Ll),
+  GC_RUN(0x1E28, GC_Lu), GC_RUN(0x1E29, GC_Ll),
+  GC_RUN(0x1E2A, GC_Lu), GC_RUN(0x1E2B, GC_Ll),
+  GC_RUN(0x1E2C, GC_Lu), GC_RUN(0x1E2D, GC_Ll),
+  GC_RUN(0x1E2E, GC_Lu), GC_RUN(0x1E2F, GC_Ll),
+  GC_RUN(0x1E30, GC_Lu), GC_RUN(0x1E31, GC_Ll),
+  GC_RUN(0x1E32, GC_Lu), GC_RUN(0x1E33, GC_Ll),
+  GC_RUN(0x1E34, GC_Lu), GC_RUN(0x1E35, GC_Ll),
+  GC_RUN(0x1E36, GC_Lu), GC_RUN(0x1E37, GC_Ll),
+  GC_RUN(0x1E38, GC_Lu), GC_RUN(0x1E39, GC_Ll),
+  GC_RUN(0x1E3A, GC_Lu), GC_RUN(0x1E3B, GC_Ll),
+  GC_RUN(0x1E3C, GC_Lu), GC_RUN(0x1E3D, GC_Ll),
+  GC_RUN(0x1E3E, GC_Lu), GC_RUN(0x1E3F, GC_Ll),
+  GC_RUN(0x1E40, GC_Lu), GC_RUN(0x1E41, GC_Ll),
+  GC_RUN(0x1E42, GC_Lu), GC_RUN(0x1E43, GC_Ll),
+  GC_RUN(0x1E44, GC_Lu), GC_RUN(0x1E45, GC_Ll),
+  GC_RUN(0x1E46, GC_Lu), GC_RUN(0x1E47, GC_Ll),
+  GC_RUN(0x1E48, GC_Lu), GC_RUN(0x1E49, GC_Ll),
+  GC_RUN(0x1E4A, GC_Lu), GC_RUN(0x1E4B, GC_Ll),
+  GC_RUN(0x1E4C, GC_Lu), GC_RUN(0x1E4D, GC_Ll),
+  GC_RUN(0x1E4E, GC_Lu), GC_RUN(0x1E4F, GC_Ll),
+  GC_RUN(0x1E50, GC_Lu), GC_RUN(0x1E51, GC_Ll),
+  GC_RUN(0x1E52, GC_Lu), GC_RUN(0x1E53, GC_Ll),
+  GC_RUN(0x1E54, GC_Lu), GC_RUN(0x1E55, GC_Ll),
+  GC_RUN(0x1E56, GC_Lu), GC_RUN(0x1E57, GC_Ll),
+  GC_RUN(0x1E58, GC_Lu), GC_RUN(0x1E59, GC_Ll),
+  GC_RUN(0x1E5A, GC_Lu), GC_RUN(0x1E5B, GC_Ll),
+  GC_RUN(0x1E5C, GC_Lu), GC_RUN(0x1E5D, GC_Ll),
+  GC_RUN(0x1E5E, GC_Lu), GC_RUN(0x1E5F, GC_Ll),
+  GC_RUN(0x1E60, GC_Lu), GC_RUN(0x1E61, GC_Ll),
+  GC_RUN(0x1E62, GC_Lu), GC_RUN(0x1E63, GC_Ll),
+  GC_RUN(0x1E64, GC_Lu), GC_RUN(0x1E65, GC_Ll),
+  GC_RUN(0x1E66, GC_Lu), GC_RUN(0x1E67, GC_Ll),
+  GC_RUN(0x1E68, GC_Lu), GC_RUN(0x1E69, GC_Ll),
+  GC_RUN(0x1E6A, GC_Lu), GC_RUN(0x1E6B, GC_Ll),
+  GC_RUN(0x1E6C, GC_Lu), GC_RUN(0x1E6D, GC_Ll),
+  GC_RUN(0x1E6E, GC_Lu), GC_RUN(0x1E6F, GC_Ll),
+  GC_RUN(0x1E70, GC_Lu), GC_RUN(0x1E71, GC_Ll),
+  GC_RUN(0x1E72, GC_Lu), GC_RUN(0x1E73, GC_Ll),
+  GC_RUN(0x1E74, GC_Lu), GC_RUN(0x1E75, GC_Ll),
+  GC_RUN(0x1E76, GC_Lu), GC_RUN(0x1E77, GC_Ll),
+  GC_RUN(0x1E78, GC_Lu), GC_RUN(0x1E79, GC_Ll),
+  GC_RUN(0x1E7A, GC_Lu), GC_RUN(0x1E7B, GC_Ll),
+  GC_RUN(0x1E7C, GC_Lu), GC_RUN(0x1E7D, GC_Ll),
+  GC_RUN(0x1E7E, GC_Lu), GC_RUN(0x1E7F, GC_Ll),
+  GC_RUN(0x1E80, GC_Lu), GC_RUN(0x1E81, GC_Ll),
+  GC_RUN(0x1E82, GC_Lu), GC_RUN(0x1E83, GC_Ll),
+  GC_RUN(0x1E84, GC_Lu), GC_RUN(0x1E85, GC_Ll),
+  GC_RUN(0x1E86, GC_Lu), GC_RUN(0x1E87, GC_Ll),
+  GC_RUN(0x1E88, GC_Lu), GC_RUN(0x1E89, GC_Ll),
+  GC_RUN(0x1E8A, GC_Lu), GC_RUN(0x1E8B, GC_Ll),
+  GC_RUN(0x1E8C, GC_Lu), GC_RUN(0x1E8D, GC_Ll),
+  GC_RUN(0x1E8E, GC_Lu), GC_RUN(0x1E8F, GC_Ll),
+  GC_RUN(0x1E90, GC_Lu), GC_RUN(0x1E91, GC_Ll),
+  GC_RUN(0x1E92, GC_Lu), GC_RUN(0x1E93, GC_Ll),
+  GC_RUN(0x1E94, GC_Lu), GC_RUN(0x1E95, GC_Ll),
+  GC_RUN(0x1E9E, GC_Lu), GC_RUN(0x1E9F, GC_Ll),
+  GC_RUN(0x1EA0, GC_Lu), GC_RUN(0x1EA1, GC_Ll),
+  GC_RUN(0x1EA2, GC_Lu), GC_RUN(0x1EA3, GC_Ll),
+  GC_RUN(0x1EA4, GC_Lu), GC_RUN(0x1EA5, GC_Ll),
+  GC_RUN(0x1EA6, GC_Lu), GC_RUN(0x1EA7, GC_Ll),
+  GC_RUN(0x1EA8, GC_Lu), GC_RUN(0x1EA9, GC_Ll),
+  GC_RUN(0x1EAA, GC_Lu), GC_RUN(0x1EAB, GC_Ll),
+  GC_RUN(0x1EAC, GC_Lu), GC_RUN(0x1EAD, GC_Ll),
+  GC_RUN(0x1EAE, GC_Lu), GC_RUN(0x1EAF, GC_Ll),
+  GC_RUN(0x1EB0, GC_Lu), GC_RUN(0x1EB1, GC_Ll),
+  GC_RUN(0x1EB2, GC_Lu), GC_RUN(0x1EB3, GC_Ll),
+  GC_RUN(0x1EB4, GC_Lu), GC_RUN(0x1EB5, GC_Ll),
+  GC_RUN(0x1EB6, GC_Lu), GC_RUN(0x1EB7, GC_Ll),
+  GC_RUN(0x1EB8, GC_Lu), GC_RUN(0x1EB9, GC_Ll),
+  GC_RUN(0x1EBA, GC_Lu), GC_RUN(0x1EBB, GC_Ll),
+  GC_RUN(0x1EBC, GC_Lu), GC_RUN(0x1EBD, GC_Ll),
+  GC_RUN(0x1EBE, GC_Lu), GC_RUN(0x1EBF, GC_Ll),
+  GC_RUN(0x1EC0, GC_Lu), GC_RUN(0x1EC1, GC_Ll),
+  GC_RUN(0x1EC2, GC_Lu), GC_RUN(0x1EC3, GC_Ll),
+  GC_RUN(0x1EC4, GC_Lu), GC_RUN(0x1EC5, GC_Ll),
+  GC_RUN(0x1EC6, GC_Lu), GC_RUN(0x1EC7, GC_Ll),
+  GC_RUN(0x1EC8, GC_Lu), GC_RUN(0x1EC9, GC_Ll),
+  GC_RUN(0x1ECA, GC_Lu), GC_RUN(0x1ECB, GC_Ll),
+  GC_RUN(0x1ECC, GC_Lu), GC_RUN(0x1ECD, GC_Ll),
+  GC_RUN(0x1ECE, GC_Lu), GC_RUN(0x1ECF, GC_Ll),
+  GC_RUN(0x1ED0, GC_Lu), GC_RUN(0x1ED1, GC_Ll),
+  GC_RUN(0x1ED2, GC_Lu), GC_RUN(0x1ED3, GC_Ll),
+  GC_RUN(0x1ED4, GC_Lu), GC_RUN(0x1ED5, GC_Ll),
+  GC_RUN(0x1ED6, GC_Lu), GC_RUN(0x1ED7, GC_Ll),
+  GC_RUN(0x1ED8, GC_Lu), GC_RUN(0x1ED9, GC_Ll),
+  GC_RUN(0x1EDA, GC_Lu), GC_RUN(0x1EDB, GC_Ll),
+  GC_RUN(0x1EDC, GC_Lu), GC_RUN(0x1EDD, GC_Ll),
+  GC_RUN(0x1EDE, GC_Lu), GC_RUN(0x1EDF, GC_Ll),
+  GC_RUN(0x1EE0, GC_Lu), GC_RUN(0x1EE1, GC_Ll),
+  GC_RUN(0x1EE2, GC_Lu), GC_RUN(0x1EE3, GC_Ll),
+  GC_RUN(0x1EE4, GC_Lu), GC_RUN(0x1EE5, GC_Ll),
+  GC_RUN(0x1EE6, GC_Lu), GC_RUN(0x1EE7, GC_Ll),
+  GC_RUN(0x1EE8, GC_Lu), GC_RUN(0x1EE9, GC_Ll),
+  GC_RUN(0x1EEA, GC_Lu), GC_RUN(0x1EEB, GC_Ll),
+  GC_RUN(0x1EEC, GC_Lu), GC_RUN(0x1EED, GC_Ll),
+  GC_RUN(0x1EEE, GC_Lu), GC_RUN(0x1EEF, GC_Ll),
+  GC_RUN(0x1EF0, GC_Lu), GC_RUN(0x1EF1, GC_Ll),
+  GC_RUN(0x1EF2, GC_Lu), GC_RUN(0x1EF3, GC_Ll),
+  GC_RUN(0x1EF4, GC_Lu), GC_RUN(0x1EF5, GC_Ll),
+  GC_RUN(0x1EF6, GC_Lu), GC_RUN(0x1EF7, GC_Ll),
+  GC_RUN(0x1EF8, GC_Lu), GC_RUN(0x1EF9, GC_Ll),
+  GC_RUN(0x1EFA, GC_Lu), GC_RUN(0x1EFB, GC_Ll),
+  GC_RUN(0x1EFC, GC_Lu), GC_RUN(0x1EFD, GC_Ll),
+  GC_RUN(0x1EFE, GC_Lu), GC_RUN(0x1EFF, GC_Ll),
+  GC_RUN(0x1F08, GC_Lu), GC_RUN(0x1F10, GC_Ll),
+  GC_RUN(0x1F16, GC_Cn), GC_RUN(0x1F18, GC_Lu),
+  GC_RUN(0x1F1E, GC_Cn), GC_RUN(0x1F20, GC_Ll),
+  GC_RUN(0x1F28, GC_Lu), GC_RUN(0x1F30, GC_Ll),
+  GC_RUN(0x1F38, GC_Lu), GC_RUN(0x1F40, GC_Ll),
+  GC_RUN(0x1F46, GC_Cn), GC_RUN(0x1F48, GC_Lu),
+  GC_RUN(0x1F4E, GC_Cn), GC_RUN(0x1F50, GC_Ll),
+  GC_RUN(0x1F58, GC_Cn), GC_RUN(0x1F59, GC_Lu),
+  GC_RUN(0x1F5A, GC_Cn), GC_RUN(0x1F5B, GC_Lu),
+  GC_RUN(0x1F5C, GC_Cn), GC_RUN(0x1F5D, GC_Lu),
+  GC_RUN(0x1F5E, GC_Cn), GC_RUN(0x1F5F, GC_Lu),
+  GC_RUN(0x1F60, GC_Ll), GC_RUN(0x1F68, GC_Lu),
+  GC_RUN(0x1F70, GC_Ll), GC_RUN(0x1F7E, GC_Cn),
+  GC_RUN(0x1F80, GC_Ll), GC_RUN(0x1F88, GC_Lt),
+  GC_RUN(0x1F90, GC_Ll), GC_RUN(0x1F98, GC_Lt),
+  GC_RUN(0x1FA0, GC_Ll), GC_RUN(0x1FA8, GC_Lt),
+  GC_RUN(0x1FB0, GC_Ll), GC_RUN(0x1FB5, GC_Cn),
+  GC_RUN(0x1FB6, GC_Ll), GC_RUN(0x1FB8, GC_Lu),
+  GC_RUN(0x1FBC, GC_Lt), GC_RUN(0x1FBD, GC_Sk),
+  GC_RUN(0x1FBE, GC_Ll), GC_RUN(0x1FBF, GC_Sk),
+  GC_RUN(0x1FC2, GC_Ll), GC_RUN(0x1FC5, GC_Cn),
+  GC_RUN(0x1FC6, GC_Ll), GC_RUN(0x1FC8, GC_Lu),
+  GC_RUN(0x1FCC, GC_Lt), GC_RUN(0x1FCD, GC_Sk),
+  GC_RUN(0x1FD0, GC_Ll), GC_RUN(0x1FD4, GC_Cn),
+  GC_RUN(0x1FD6, GC_Ll), GC_RUN(0x1FD8, GC_Lu),
+  GC_RUN(0x1FDC, GC_Cn), GC_RUN(0x1FDD, GC_Sk),
+  GC_RUN(0x1FE0, GC_Ll), GC_RUN(0x1FE8, GC_Lu),
+  GC_RUN(0x1FED, GC_Sk), GC_RUN(0x1FF0, GC_Cn),
+  GC_RUN(0x1FF2, GC_Ll), GC_RUN(0x1FF5, GC_Cn),
+  GC_RUN(0x1FF6, GC_Ll), GC_RUN(0x1FF8, GC_Lu),
+  GC_RUN(0x1FFC, GC_Lt), GC_RUN(0x1FFD, GC_Sk),
+  GC_RUN(0x1FFF, GC_Cn), GC_RUN(0x2000, GC_Zs),
+  GC_RUN(0x200B, GC_Cf), GC_RUN(0x2010, GC_Pd),
+  GC_RUN(0x2016, GC_Po), GC_RUN(0x2018, GC_Pi),
+  GC_RUN(0x2019, GC_Pf), GC_RUN(0x201A, GC_Ps),
+  GC_RUN(0x201B, GC_Pi), GC_RUN(0x201D, GC_Pf),
+  GC_RUN(0x201E, GC_Ps), GC_RUN(0x201F, GC_Pi),
+  GC_RUN(0x2020, GC_Po), GC_RUN(0x2028, GC_Zl),
+  GC_RUN(0x2029, GC_Zp), GC_RUN(0x202A, GC_Cf),
+  GC_RUN(0x202F, GC_Zs), GC_RUN(0x2030, GC_Po),
+  GC_RUN(0x2039, GC_Pi), GC_RUN(0x203A, GC_Pf),
+  GC_RUN(0x203B, GC_Po), GC_RUN(0x203F, GC_Pc),
+  GC_RUN(0x2041, GC_Po), GC_RUN(0x2044, GC_Sm),
+  GC_RUN(0x2045, GC_Ps), GC_RUN(0x2046, GC_Pe),
+  GC_RUN(0x2047, GC_Po), GC_RUN(0x2052, GC_Sm),
+  GC_RUN(0x2053, GC_Po), GC_RUN(0x2054, GC_Pc),
+  GC_RUN(0x2055, GC_Po), GC_RUN(0x205F, GC_Zs),
+  GC_RUN(0x2060, GC_Cf), GC_RUN(0x2065, GC_Cn),
+  GC_RUN(0x2066, GC_Cf), GC_RUN(0x2070, GC_No),
+  GC_RUN(0x2071, GC_Lm), GC_RUN(0x2072, GC_Cn),
+  GC_RUN(0x2074, GC_No), GC_RUN(0x207A, GC_Sm),
+  GC_RUN(0x207D, GC_Ps), GC_RUN(0x207E, GC_Pe),
+  GC_RUN(0x207F, GC_Lm), GC_RUN(0x2080, GC_No),
+  GC_RUN(0x208A, GC_Sm), GC_RUN(0x208D, GC_Ps),
+  GC_RUN(0x208E, GC_Pe), GC_RUN(0x208F, GC_Cn),
+  GC_RUN(0x2090, GC_Lm), GC_RUN(0x209D, GC_Cn),
+  GC_RUN(0x20A0, GC_Sc), GC_RUN(0x20C1, GC_Cn),
+  GC_RUN(0x20D0, GC_Mn), GC_RUN(0x20DD, GC_Me),
+  GC_RUN(0x20E1, GC_Mn), GC_RUN(0x20E2, GC_Me),
+  GC_RUN(0x20E5, GC_Mn), GC_RUN(0x20F1, GC_Cn),
+  GC_RUN(0x2100, GC_So), GC_RUN(0x2102, GC_Lu),
+  GC_RUN(0x2103, GC_So), GC_RUN(0x2107, GC_Lu),
+  GC_RUN(0x2108, GC_So), GC_RUN(0x210A, GC_Ll),
+  GC_RUN(0x210B, GC_Lu), GC_RUN(0x210E, GC_Ll),
+  GC_RUN(0x2110, GC_Lu), GC_RUN(0x2113, GC_Ll),
+  GC_RUN(0x2114, GC_So), GC_RUN(0x2115, GC_Lu),
+  GC_RUN(0x2116, GC_So), GC_RUN(0x2118, GC_Sm),
+  GC_RUN(0x2119, GC_Lu), GC_RUN(0x211E, GC_So),
+  GC_RUN(0x2124, GC_Lu), GC_RUN(0x2125, GC_So),
+  GC_RUN(0x2126, GC_Lu), GC_RUN(0x2127, GC_So),
+  GC_RUN(0x2128, GC_Lu), GC_RUN(0x2129, GC_So),
+  GC_RUN(0x212A, GC_Lu), GC_RUN(0x212E, GC_So),
+  GC_RUN(0x212F, GC_Ll), GC_RUN(0x2130, GC_Lu),
+  GC_RUN(0x2134, GC_Ll), GC_RUN(0x2135, GC_Lo),
+  GC_RUN(0x2139, GC_Ll), GC_RUN(0x213A, GC_So),
+  GC_RUN(0x213C, GC_Ll), GC_RUN(0x213E, GC_Lu),
+  GC_RUN(0x2140, GC_Sm), GC_RUN(0x2145, GC_Lu),
+  GC_RUN(0x2146, GC_Ll), GC_RUN(0x214A, GC_So),
+  GC_RUN(0x214B, GC_Sm), GC_RUN(0x214C, GC_So),
+  GC_RUN(0x214E, GC_Ll), GC_RUN(0x214F, GC_So),
+  GC_RUN(0x2150, GC_No), GC_RUN(0x2160, GC_Nl),
+  GC_RUN(0x2183, GC_Lu), GC_RUN(0x2184, GC_Ll),
+  GC_RUN(0x2185, GC_Nl), GC_RUN(0x2189, GC_No),
+  GC_RUN(0x218A, GC_So), GC_RUN(0x218C, GC_Cn),
+  GC_RUN(0x2190, GC_Sm), GC_RUN(0x2195, GC_So),
+  GC_RUN(0x219A, GC_Sm), GC_RUN(0x219C, GC_So),
+  GC_RUN(0x21A0, GC_Sm), GC_RUN(0x21A1, GC_So),
+  GC_RUN(0x21A3, GC_Sm), GC_RUN(0x21A4, GC_So),
+  GC_RUN(0x21A6, GC_Sm), GC_RUN(0x21A7, GC_So),
+  GC_RUN(0x21AE, GC_Sm), GC_RUN(0x21AF, GC_So),
+  GC_RUN(0x21CE, GC_Sm), GC_RUN(0x21D0, GC_So),
+  GC_RUN(0x21D2, GC_Sm), GC_RUN(0x21D3, GC_So),
+  GC_RUN(0x21D4, GC_Sm), GC_RUN(0x21D5, GC_So),
+  GC_RUN(0x21F4, GC_Sm), GC_RUN(0x2300, GC_So),
+  GC_RUN(0x2308, GC_Ps), GC_RUN(0x2309, GC_Pe),
+  GC_RUN(0x230A, GC_Ps), GC_RUN(0x230B, GC_Pe),
+  GC_RUN(0x230C, GC_So), GC_RUN(0x2320, GC_Sm),
+  GC_RUN(0x2322, GC_So), GC_RUN(0x2329, GC_Ps),
+  GC_RUN(0x232A, GC_Pe), GC_RUN(0x232B, GC_So),
+  GC_RUN(0x237C, GC_Sm), GC_RUN(0x237D, GC_So),
+  GC_RUN(0x239B, GC_Sm), GC_RUN(0x23B4, GC_So),
+  GC_RUN(0x23DC, GC_Sm), GC_RUN(0x23E2, GC_So),
+  GC_RUN(0x2427, GC_Cn), GC_RUN(0x2440, GC_So),
+  GC_RUN(0x244B, GC_Cn), GC_RUN(0x2460, GC_No),
+  GC_RUN(0x249C, GC_So), GC_RUN(0x24EA, GC_No),
+  GC_RUN(0x2500, GC_So), GC_RUN(0x25B7, GC_Sm),
+  GC_RUN(0x25B8, GC_So), GC_RUN(0x25C1, GC_Sm),
+  GC_RUN(0x25C2, GC_So), GC_RUN(0x25F8, GC_Sm),
+  GC_RUN(0x2600, GC_So), GC_RUN(0x266F, GC_Sm),
+  GC_RUN(0x2670, GC_So), GC_RUN(0x2768, GC_Ps),
+  GC_RUN(0x2769, GC_Pe), GC_RUN(0x276A, GC_Ps),
+  GC_RUN(0x276B, GC_Pe), GC_RUN(0x276C, GC_Ps),
+  GC_RUN(0x276D, GC_Pe), GC_RUN(0x276E, GC_Ps),
+  GC_RUN(0x276F, GC_Pe), GC_RUN(0x2770, GC_Ps),
+  GC_RUN(0x2771, GC_Pe), GC_RUN(0x2772, GC_Ps),
+  GC_RUN(0x2773, GC_Pe), GC_RUN(0x2774, GC_Ps),
+  GC_RUN(0x2775, GC_Pe), GC_RUN(0x2776, GC_No),
+  GC_RUN(0x2794, GC_So), GC_RUN(0x27C0, GC_Sm),
+  GC_RUN(0x27C5, GC_Ps), GC_RUN(0x27C6, GC_Pe),
+  GC_RUN(0x27C7, GC_Sm), GC_RUN(0x27E6, GC_Ps),
+  GC_RUN(0x27E7, GC_Pe), GC_RUN(0x27E8, GC_Ps),
+  GC_RUN(0x27E9, GC_Pe), GC_RUN(0x27EA, GC_Ps),
+  GC_RUN(0x27EB, GC_Pe), GC_RUN(0x27EC, GC_Ps),
+  GC_RUN(0x27ED, GC_Pe), GC_RUN(0x27EE, GC_Ps),
+  GC_RUN(0x27EF, GC_Pe), GC_RUN(0x27F0, GC_Sm),
+  GC_RUN(0x2800, GC_So), GC_RUN(0x2900, GC_Sm),
+  GC_RUN(0x2983, GC_Ps), GC_RUN(0x2984, GC_Pe),
+  GC_RUN(0x2985, GC_Ps), GC_RUN(0x2986, GC_Pe),
+  GC_RUN(0x2987, GC_Ps), GC_RUN(0x2988, GC_Pe),
+  GC_RUN(0x2989, GC_Ps), GC_RUN(0x298A, GC_Pe),
+  GC_RUN(0x298B, GC_Ps), GC_RUN(0x298C, GC_Pe),
+  GC_RUN(0x298D, GC_Ps), GC_RUN(0x298E, GC_Pe),
+  GC_RUN(0x298F, GC_Ps), GC_RUN(0x2990, GC_Pe),
+  GC_RUN(0x2991, GC_Ps), GC_RUN(0x2992, GC_Pe),
+  GC_RUN(0x2993, GC_Ps), GC_RUN(0x2994, GC_Pe),
+  GC_RUN(0x2995, GC_Ps), GC_RUN(0x2996, GC_Pe),
+  GC_RUN(0x2997, GC_Ps), GC_RUN(0x2998, GC_Pe),
+  GC_RUN(0x2999, GC_Sm), GC_RUN(0x29D8, GC_Ps),
+  GC_RUN(0x29D9, GC_Pe), GC_RUN(0x29DA, GC_Ps),
+  GC_RUN(0x29DB, GC_Pe), GC_RUN(0x29DC, GC_Sm),
+  GC_RUN(0x29FC, GC_Ps), GC_RUN(0x29FD, GC_Pe),
+  GC_RUN(0x29FE, GC_Sm), GC_RUN(0x2B00, GC_So),
+  GC_RUN(0x2B30, GC_Sm), GC_RUN(0x2B45, GC_So),
+  GC_RUN(0x2B47, GC_Sm), GC_RUN(0x2B4D, GC_So),
+  GC_RUN(0x2B74, GC_Cn), GC_RUN(0x2B76, GC_So),
+  GC_RUN(0x2B96, GC_Cn), GC_RUN(0x2B97, GC_So),
+  GC_RUN(0x2C00, GC_Lu), GC_RUN(0x2C30, GC_Ll),
+  GC_RUN(0x2C60, GC_Lu), GC_RUN(0x2C61, GC_Ll),
+  GC_RUN(0x2C62, GC_Lu), GC_RUN(0x2C65, GC_Ll),
+  GC_RUN(0x2C67, GC_Lu), GC_RUN(0x2C68, GC_Ll),
+  GC_RUN(0x2C69, GC_Lu), GC_RUN(0x2C6A, GC_Ll),
+  GC_RUN(0x2C6B, GC_Lu), GC_RUN(0x2C6C, GC_Ll),
+  GC_RUN(0x2C6D, GC_Lu), GC_RUN(0x2C71, GC_Ll),
+  GC_RUN(0x2C72, GC_Lu), GC_RUN(0x2C73, GC_Ll),
+  GC_RUN(0x2C75, GC_Lu), GC_RUN(0x2C76, GC_Ll),
+  GC_RUN(0x2C7C, GC_Lm), GC_RUN(0x2C7E, GC_Lu),
+  GC_RUN(0x2C81, GC_Ll), GC_RUN(0x2C82, GC_Lu),
+  GC_RUN(0x2C83, GC_Ll), GC_RUN(0x2C84, GC_Lu),
+  GC_RUN(0x2C85, GC_Ll), GC_RUN(0x2C86, GC_Lu),
+  GC_RUN(0x2C87, GC_Ll), GC_RUN(0x2C88, GC_Lu),
+  GC_RUN(0x2C89, GC_Ll), GC_RUN(0x2C8A, GC_Lu),
+  GC_RUN(0x2C8B, GC_Ll), GC_RUN(0x2C8C, GC_Lu),
+  GC_RUN(0x2C8D, GC_Ll), GC_RUN(0x2C8E, GC_Lu),
+  GC_RUN(0x2C8F, GC_Ll), GC_RUN(0x2C90, GC_Lu),
+  GC_RUN(0x2C91, GC_Ll), GC_RUN(0x2C92, GC_Lu),
+  GC_RUN(0x2C93, GC_Ll), GC_RUN(0x2C94, GC_Lu),
+  GC_RUN(0x2C95, GC_Ll), GC_RUN(0x2C96, GC_Lu),
+  GC_RUN(0x2C97, GC_Ll), GC_RUN(0x2C98, GC_Lu),
+  GC_RUN(0x2C99, GC_Ll), GC_RUN(0x2C9A, GC_Lu),
+  GC_RUN(0x2C9B, GC_Ll), GC_RUN(0x2C9C, GC_Lu),
+  GC_RUN(0x2C9D, GC_Ll), GC_RUN(0x2C9E, GC_Lu),
+  GC_RUN(0x2C9F, GC_Ll), GC_RUN(0x2CA0, GC_Lu),
+  GC_RUN(0x2CA1, GC_Ll), GC_RUN(0x2CA2, GC_Lu),
+  GC_RUN(0x2CA3, GC_Ll), GC_RUN(0x2CA4, GC_Lu),
+  GC_RUN(0x2CA5, GC_Ll), GC_RUN(0x2CA6, GC_Lu),
+  GC_RUN(0x2CA7, GC_Ll), GC_RUN(0x2CA8, GC_Lu),
+  GC_RUN(0x2CA9, GC_Ll), GC_RUN(0x2CAA, GC_Lu),
+  GC_RUN(0x2CAB, GC_Ll), GC_RUN(0x2CAC, GC_Lu),
+  GC_RUN(0x2CAD, GC_Ll), GC_RUN(0x2CAE, GC_Lu),
+  GC_RUN(0x2CAF, GC_Ll), GC_RUN(0x2CB0, GC_Lu),
+  GC_RUN(0x2CB1, GC_Ll), GC_RUN(0x2CB2, GC_Lu),
+  GC_RUN(0x2CB3, GC_Ll), GC_RUN(0x2CB4, GC_Lu),
+  GC_RUN(0x2CB5, GC_Ll), GC_RUN(0x2CB6, GC_Lu),
+  GC_RUN(0x2CB7, GC_Ll), GC_RUN(0x2CB8, GC_Lu),
+  GC_RUN(0x2CB9, GC_Ll), GC_RUN(0x2CBA, GC_Lu),
+  GC_RUN(0x2CBB, GC_Ll), GC_RUN(0x2CBC, GC_Lu),
+  GC_RUN(0x2CBD, GC_Ll), GC_RUN(0x2CBE, GC_Lu),
+  GC_RUN(0x2CBF, GC_Ll), GC_RUN(0x2CC0, GC_Lu),
+  GC_RUN(0x2CC1, GC_Ll), GC_RUN(0x2CC2, GC_Lu),
+  GC_RUN(0x2CC3, GC_Ll), GC_RUN(0x2CC4, GC_Lu),
+  GC_RUN(0x2CC5, GC_Ll), GC_RUN(0x2CC6, GC_Lu),
+  GC_RUN(0x2CC7, GC_Ll), GC_RUN(0x2CC8, GC_Lu),
+  GC_RUN(0x2CC9, GC_Ll), GC_RUN(0x2CCA, GC_Lu),
+  GC_RUN(0x2CCB, GC_Ll), GC_RUN(0x2CCC, GC_Lu),
+  GC_RUN(0x2CCD, GC_Ll), GC_RUN(0x2CCE, GC_Lu),
+  GC_RUN(0x2CCF, GC_Ll), GC_RUN(0x2CD0, GC_Lu),
+  GC_RUN(0x2CD1, GC_Ll), GC_RUN(0x2CD2, GC_Lu),
+  GC_RUN(0x2CD3, GC_Ll), GC_RUN(0x2CD4, GC_Lu),
+  GC_RUN(0x2CD5, GC_Ll), GC_RUN(0x2CD6, GC_Lu),
+  GC_RUN(0x2CD7, GC_Ll), GC_RUN(0x2CD8, GC_Lu),
+  GC_RUN(0x2CD9, GC_Ll), GC_RUN(0x2CDA, GC_Lu),
+  GC_RUN(0x2CDB, GC_Ll), GC_RUN(0x2CDC, GC_Lu),
+  GC_RUN(0x2CDD, GC_Ll), GC_RUN(0x2CDE, GC_Lu),
+  GC_RUN(0x2CDF, GC_Ll), GC_RUN(0x2CE0, GC_Lu),
+  GC_RUN(0x2CE1, GC_Ll), GC_RUN(0x2CE2, GC_Lu),
+  GC_RUN(0x2CE3, GC_Ll), GC_RUN(0x2CE5, GC_So),
+  GC_RUN(0x2CEB, GC_Lu), GC_RUN(0x2CEC, GC_Ll),
+  GC_RUN(0x2CED, GC_Lu), GC_RUN(0x2CEE, GC_Ll),
+  GC_RUN(0x2CEF, GC_Mn), GC_RUN(0x2CF2, GC_Lu),
+  GC_RUN(0x2CF3, GC_Ll), GC_RUN(0x2CF4, GC_Cn),
+  GC_RUN(0x2CF9, GC_Po), GC_RUN(0x2CFD, GC_No),
+  GC_RUN(0x2CFE, GC_Po), GC_RUN(0x2D00, GC_Ll),
+  GC_RUN(0x2D26, GC_Cn), GC_RUN(0x2D27, GC_Ll),
+  GC_RUN(0x2D28, GC_Cn), GC_RUN(0x2D2D, GC_Ll),
+  GC_RUN(0x2D2E, GC_Cn), GC_RUN(0x2D30, GC_Lo),
+  GC_RUN(0x2D68, GC_Cn), GC_RUN(0x2D6F, GC_Lm),
+  GC_RUN(0x2D70, GC_Po), GC_RUN(0x2D71, GC_Cn),
+  GC_RUN(0x2D7F, GC_Mn), GC_RUN(0x2D80, GC_Lo),
+  GC_RUN(0x2D97, GC_Cn), GC_RUN(0x2DA0, GC_Lo),
+  GC_RUN(0x2DA7, GC_Cn), GC_RUN(0x2DA8, GC_Lo),
+  GC_RUN(0x2DAF, GC_Cn), GC_RUN(0x2DB0, GC_Lo),
+  GC_RUN(0x2DB7, GC_Cn), GC_RUN(0x2DB8, GC_Lo),
+  GC_RUN(0x2DBF, GC_Cn), GC_RUN(0x2DC0, GC_Lo),
+  GC_RUN(0x2DC7, GC_Cn), GC_RUN(0x2DC8, GC_Lo),
+  GC_RUN(0x2DCF, GC_Cn), GC_RUN(0x2DD0, GC_Lo),
+  GC_RUN(0x2DD7, GC_Cn), GC_RUN(0x2DD8, GC_Lo),
+  GC_RUN(0x2DDF, GC_Cn), GC_RUN(0x2DE0, GC_Mn),
+  GC_RUN(0x2E00, GC_Po), GC_RUN(0x2E02, GC_Pi),
+  GC_RUN(0x2E03, GC_Pf), GC_RUN(0x2E04, GC_Pi),
+  GC_RUN(0x2E05, GC_Pf), GC_RUN(0x2E06, GC_Po),
+  GC_RUN(0x2E09, GC_Pi), GC_RUN(0x2E0A, GC_Pf),
+  GC_RUN(0x2E0B, GC_Po), GC_RUN(0x2E0C, GC_Pi),
+  GC_RUN(0x2E0D, GC_Pf), GC_RUN(0x2E0E, GC_Po),
+  GC_RUN(0x2E17, GC_Pd), GC_RUN(0x2E18, GC_Po),
+  GC_RUN(0x2E1A, GC_Pd), GC_RUN(0x2E1B, GC_Po),
+  GC_RUN(0x2E1C, GC_Pi), GC_RUN(0x2E1D, GC_Pf),
+  GC_RUN(0x2E1E, GC_Po), GC_RUN(0x2E20, GC_Pi),
+  GC_RUN(0x2E21, GC_Pf), GC_RUN(0x2E22, GC_Ps),
+  GC_RUN(0x2E23, GC_Pe), GC_RUN(0x2E24, GC_Ps),
+  GC_RUN(0x2E25, GC_Pe), GC_RUN(0x2E26, GC_Ps),
+  GC_RUN(0x2E27, GC_Pe), GC_RUN(0x2E28, GC_Ps),
+  GC_RUN(0x2E29, GC_Pe), GC_RUN(0x2E2A, GC_Po),
+  GC_RUN(0x2E2F, GC_Lm), GC_RUN(0x2E30, GC_Po),
+  GC_RUN(0x2E3A, GC_Pd), GC_RUN(0x2E3C, GC_Po),
+  GC_RUN(0x2E40, GC_Pd), GC_RUN(0x2E41, GC_Po),
+  GC_RUN(0x2E42, GC_Ps), GC_RUN(0x2E43, GC_Po),
+  GC_RUN(0x2E50, GC_So), GC_RUN(0x2E52, GC_Po),
+  GC_RUN(0x2E55, GC_Ps), GC_RUN(0x2E56, GC_Pe),
+  GC_RUN(0x2E57, GC_Ps), GC_RUN(0x2E58, GC_Pe),
+  GC_RUN(0x2E59, GC_Ps), GC_RUN(0x2E5A, GC_Pe),
+  GC_RUN(0x2E5B, GC_Ps), GC_RUN(0x2E5C, GC_Pe),
+  GC_RUN(0x2E5D, GC_Pd), GC_RUN(0x2E5E, GC_Cn),
+  GC_RUN(0x2E80, GC_So), GC_RUN(0x2E9A, GC_Cn),
+  GC_RUN(0x2E9B, GC_So), GC_RUN(0x2EF4, GC_Cn),
+  GC_RUN(0x2F00, GC_So), GC_RUN(0x2FD6, GC_Cn),
+  GC_RUN(0x2FF0, GC_So), GC_RUN(0x2FFC, GC_Cn),
+  GC_RUN(0x3000, GC_Zs), GC_RUN(0x3001, GC_Po),
+  GC_RUN(0x3004, GC_So), GC_RUN(0x3005, GC_Lm),
+  GC_RUN(0x3006, GC_Lo), GC_RUN(0x3007, GC_Nl),
+  GC_RUN(0x3008, GC_Ps), GC_RUN(0x3009, GC_Pe),
+  GC_RUN(0x300A, GC_Ps), GC_RUN(0x300B, GC_Pe),
+  GC_RUN(0x300C, GC_Ps), GC_RUN(0x300D, GC_Pe),
+  GC_RUN(0x300E, GC_Ps), GC_RUN(0x300F, GC_Pe),
+  GC_RUN(0x3010, GC_Ps), GC_RUN(0x3011, GC_Pe),
+  GC_RUN(0x3012, GC_So), GC_RUN(0x3014, GC_Ps),
+  GC_RUN(0x3015, GC_Pe), GC_RUN(0x3016, GC_Ps),
+  GC_RUN(0x3017, GC_Pe), GC_RUN(0x3018, GC_Ps),
+  GC_RUN(0x3019, GC_Pe), GC_RUN(0x301A, GC_Ps),
+  GC_RUN(0x301B, GC_Pe), GC_RUN(0x301C, GC_Pd),
+  GC_RUN(0x301D, GC_Ps), GC_RUN(0x301E, GC_Pe),
+  GC_RUN(0x3020, GC_So), GC_RUN(0x3021, GC_Nl),
+  GC_RUN(0x302A, GC_Mn), GC_RUN(0x302E, GC_Mc),
+  GC_RUN(0x3030, GC_Pd), GC_RUN(0x3031, GC_Lm),
+  GC_RUN(0x3036, GC_So), GC_RUN(0x3038, GC_Nl),
+  GC_RUN(0x303B, GC_Lm), GC_RUN(0x303C, GC_Lo),
+  GC_RUN(0x303D, GC_Po), GC_RUN(0x303E, GC_So),
+  GC_RUN(0x3040, GC_Cn), GC_RUN(0x3041, GC_Lo),
+  GC_RUN(0x3097, GC_Cn), GC_RUN(0x3099, GC_Mn),
+  GC_RUN(0x309B, GC_Sk), GC_RUN(0x309D, GC_Lm),
+  GC_RUN(0x309F, GC_Lo), GC_RUN(0x30A0, GC_Pd),
+  GC_RUN(0x30A1, GC_Lo), GC_RUN(0x30FB, GC_Po),
+  GC_RUN(0x30FC, GC_Lm), GC_RUN(0x30FF, GC_Lo),
+  GC_RUN(0x3100, GC_Cn), GC_RUN(0x3105, GC_Lo),
+  GC_RUN(0x3130, GC_Cn), GC_RUN(0x3131, GC_Lo),
+  GC_RUN(0x318F, GC_Cn), GC_RUN(0x3190, GC_So),
+  GC_RUN(0x3192, GC_No), GC_RUN(0x3196, GC_So),
+  GC_RUN(0x31A0, GC_Lo), GC_RUN(0x31C0, GC_So),
+  GC_RUN(0x31E4, GC_Cn), GC_RUN(0x31F0, GC_Lo),
+  GC_RUN(0x3200, GC_So), GC_RUN(0x321F, GC_Cn),
+  GC_RUN(0x3220, GC_No), GC_RUN(0x322A, GC_So),
+  GC_RUN(0x3248, GC_No), GC_RUN(0x3250, GC_So),
+  GC_RUN(0x3251, GC_No), GC_RUN(0x3260, GC_So),
+  GC_RUN(0x3280, GC_No), GC_RUN(0x328A, GC_So),
+  GC_RUN(0x32B1, GC_No), GC_RUN(0x32C0, GC_So),
+  GC_RUN(0x3400, GC_Lo), GC_RUN(0x4DC0, GC_So),
+  GC_RUN(0x4E00, GC_Lo), GC_RUN(0xA015, GC_Lm),
+  GC_RUN(0xA016, GC_Lo), GC_RUN(0xA48D, GC_Cn),
+  GC_RUN(0xA490, GC_So), GC_RUN(0xA4C7, GC_Cn),
+  GC_RUN(0xA4D0, GC_Lo), GC_RUN(0xA4F8, GC_Lm),
+  GC_RUN(0xA4FE, GC_Po), GC_RUN(0xA500, GC_Lo),
+  GC_RUN(0xA60C, GC_Lm), GC_RUN(0xA60D, GC_Po),
+  GC_RUN(0xA610, GC_Lo), GC_RUN(0xA620, GC_Nd),
+  GC_RUN(0xA62A, GC_Lo), GC_RUN(0xA62C, GC_Cn),
+  GC_RUN(0xA640, GC_Lu), GC_RUN(0xA641, GC_Ll),
+  GC_RUN(0xA642, GC_Lu), GC_RUN(0xA643, GC_Ll),
+  GC_RUN(0xA644, GC_Lu), GC_RUN(0xA645, GC_Ll),
+  GC_RUN(0xA646, GC_Lu), GC_RUN(0xA647, GC_Ll),
+  GC_RUN(0xA648, GC_Lu), GC_RUN(0xA649, GC_Ll),
+  GC_RUN(0xA64A, GC_Lu), GC_RUN(0xA64B, GC_Ll),
+  GC_RUN(0xA64C, GC_Lu), GC_RUN(0xA64D, GC_Ll),
+  GC_RUN(0xA64E, GC_Lu), GC_RUN(0xA64F, GC_Ll),
+  GC_RUN(0xA650, GC_Lu), GC_RUN(0xA651, GC_Ll),
+  GC_RUN(0xA652, GC_Lu), GC_RUN(0xA653, GC_Ll),
+  GC_RUN(0xA654, GC_Lu), GC_RUN(0xA655, GC_Ll),
+  GC_RUN(0xA656, GC_Lu), GC_RUN(0xA657, GC_Ll),
+  GC_RUN(0xA658, GC_Lu), GC_RUN(0xA659, GC_Ll),
+  GC_RUN(0xA65A, GC_Lu), GC_RUN(0xA65B, GC_Ll),
+  GC_RUN(0xA65C, GC_Lu), GC_RUN(0xA65D, GC_Ll),
+  GC_RUN(0xA65E, GC_Lu), GC_RUN(0xA65F, GC_Ll),
+  GC_RUN(0xA660, GC_Lu), GC_RUN(0xA661, GC_Ll),
+  GC_RUN(0xA662, GC_Lu), GC_RUN(0xA663, GC_Ll),
+  GC_RUN(0xA664, GC_Lu), GC_RUN(0xA665, GC_Ll),
+  GC_RUN(0xA666, GC_Lu), GC_RUN(0xA667, GC_Ll),
+  GC_RUN(0xA668, GC_Lu), GC_RUN(0xA669, GC_Ll),
+  GC_RUN(0xA66A, GC_Lu), GC_RUN(0xA66B, GC_Ll),
+  GC_RUN(0xA66C, GC_Lu), GC_RUN(0xA66D, GC_Ll),
+  GC_RUN(0xA66E, GC_Lo), GC_RUN(0xA66F, GC_Mn),
+  GC_RUN(0xA670, GC_Me), GC_RUN(0xA673, GC_Po),
+  GC_RUN(0xA674, GC_Mn), GC_RUN(0xA67E, GC_Po),
+  GC_RUN(0xA67F, GC_Lm), GC_RUN(0xA680, GC_Lu),
+  GC_RUN(0xA681, GC_Ll), GC_RUN(0xA682, GC_Lu),
+  GC_RUN(0xA683, GC_Ll), GC_RUN(0xA684, GC_Lu),
+  GC_RUN(0xA685, GC_Ll), GC_RUN(0xA686, GC_Lu),
+  GC_RUN(0xA687, GC_Ll), GC_RUN(0xA688, GC_Lu),
+  GC_RUN(0xA689, GC_Ll), GC_RUN(0xA68A, GC_Lu),
+  GC_RUN(0xA68B, GC_Ll), GC_RUN(0xA68C, GC_Lu),
+  GC_RUN(0xA68D, GC_Ll), GC_RUN(0xA68E, GC_Lu),
+  GC_RUN(0xA68F, GC_Ll), GC_RUN(0xA690, GC_Lu),
+  GC_RUN(0xA691, GC_Ll), GC_RUN(0xA692, GC_Lu),
+  GC_RUN(0xA693, GC_Ll), GC_RUN(0xA694, GC_Lu),
+  GC_RUN(0xA695, GC_Ll), GC_RUN(0xA696, GC_Lu),
+  GC_RUN(0xA697, GC_Ll), GC_RUN(0xA698, GC_Lu),
+  GC_RUN(0xA699, GC_Ll), GC_RUN(0xA69A, GC_Lu),
+  GC_RUN(0xA69B, GC_Ll), GC_RUN(0xA69C, GC_Lm),
+  GC_RUN(0xA69E, GC_Mn), GC_RUN(0xA6A0, GC_Lo),
+  GC_RUN(0xA6E6, GC_Nl), GC_RUN(0xA6F0, GC_Mn),
+  GC_RUN(0xA6F2, GC_Po), GC_RUN(0xA6F8, GC_Cn),
+  GC_RUN(0xA700, GC_Sk), GC_RUN(0xA717, GC_Lm),
+  GC_RUN(0xA720, GC_Sk), GC_RUN(0xA722, GC_Lu),
+  GC_RUN(0xA723, GC_Ll), GC_RUN(0xA724, GC_Lu),
+  GC_RUN(0xA725, GC_Ll), GC_RUN(0xA726, GC_Lu),
+  GC_RUN(0xA727, GC_Ll), GC_RUN(0xA728, GC_Lu),
+  GC_RUN(0xA729, GC_Ll), GC_RUN(0xA72A, GC_Lu),
+  GC_RUN(0xA72B, GC_Ll), GC_RUN(0xA72C, GC_Lu),
+  GC_RUN(0xA72D, GC_Ll), GC_RUN(0xA72E, GC_Lu),
+  GC_RUN(0xA72F, GC_Ll), GC_RUN(0xA732, GC_Lu),
+  GC_RUN(0xA733, GC_Ll), GC_RUN(0xA734, GC_Lu),
+  GC_RUN(0xA735, GC_Ll), GC_RUN(0xA736, GC_Lu),
+  GC_RUN(0xA737, GC_Ll), GC_RUN(0xA738, GC_Lu),
+  GC_RUN(0xA739, GC_Ll), GC_RUN(0xA73A, GC_Lu),
+  GC_RUN(0xA73B, GC_Ll), GC_RUN(0xA73C, GC_Lu),
+  GC_RUN(0xA73D, GC_Ll), GC_RUN(0xA73E, GC_Lu),
+  GC_RUN(0xA73F, GC_Ll), GC_RUN(0xA740, GC_Lu),
+  GC_RUN(0xA741, GC_Ll), GC_RUN(0xA742, GC_Lu),
+  GC_RUN(0xA743, GC_Ll), GC_RUN(0xA744, GC_Lu),
+  GC_RUN(0xA745, GC_Ll), GC_RUN(0xA746, GC_Lu),
+  GC_RUN(0xA747, GC_Ll), GC_RUN(0xA748, GC_Lu),
+  GC_RUN(0xA749, GC_Ll), GC_RUN(0xA74A, GC_Lu),
+  GC_RUN(0xA74B, GC_Ll), GC_RUN(0xA74C, GC_Lu),
+  GC_RUN(0xA74D, GC_Ll), GC_RUN(0xA74E, GC_Lu),
+  GC_RUN(0xA74F, GC_Ll), GC_RUN(0xA750, GC_Lu),
+  GC_RUN(0xA751, GC_Ll), GC_RUN(0xA752, GC_Lu),
+  GC_RUN(0xA753, GC_Ll), GC_RUN(0xA754, GC_Lu),
+  GC_RUN(0xA755, GC_Ll), GC_RUN(0xA756, GC_Lu),
+  GC_RUN(0xA757, GC_Ll), GC_RUN(0xA758, GC_Lu),
+  GC_RUN(0xA759, GC_Ll), GC_RUN(0xA75A, GC_Lu),
+  GC_RUN(0xA75B, GC_Ll), GC_RUN(0xA75C, GC_Lu),
+  GC_RUN(0xA75D, GC_Ll), GC_RUN(0xA75E, GC_Lu),
+  GC_RUN(0xA75F, GC_Ll), GC_RUN(0xA760, GC_Lu),
+  GC_RUN(0xA761, GC_Ll), GC_RUN(0xA762, GC_Lu),
+  GC_RUN(0xA763, GC_Ll), GC_RUN(0xA764, GC_Lu),
+  GC_RUN(0xA765, GC_Ll), GC_RUN(0xA766, GC_Lu),
+  GC_RUN(0xA767, GC_Ll), GC_RUN(0xA768, GC_Lu),
+  GC_RUN(0xA769, GC_Ll), GC_RUN(0xA76A, GC_Lu),
+  GC_RUN(0xA76B, GC_Ll), GC_RUN(0xA76C, GC_Lu),
+  GC_RUN(0xA76D, GC_Ll), GC_RUN(0xA76E, GC_Lu),
+  GC_RUN(0xA76F, GC_Ll), GC_RUN(0xA770, GC_Lm),
+  GC_RUN(0xA771, GC_Ll), GC_RUN(0xA779, GC_Lu),
+  GC_RUN(0xA77A, GC_Ll), GC_RUN(0xA77B, GC_Lu),
+  GC_RUN(0xA77C, GC_Ll), GC_RUN(0xA77D, GC_Lu),
+  GC_RUN(0xA77F, GC_Ll), GC_RUN(0xA780, GC_Lu),
+  GC_RUN(0xA781, GC_Ll), GC_RUN(0xA782, GC_Lu),
+  GC_RUN(0xA783, GC_Ll), GC_RUN(0xA784, GC_Lu),
+  GC_RUN(0xA785, GC_Ll), GC_RUN(0xA786, GC_Lu),
+  GC_RUN(0xA787, GC_Ll), GC_RUN(0xA788, GC_Lm),
+  GC_RUN(0xA789, GC_Sk), GC_RUN(0xA78B, GC_Lu),
+  GC_RUN(0xA78C, GC_Ll), GC_RUN(0xA78D, GC_Lu),
+  GC_RUN(0xA78E, GC_Ll), GC_RUN(0xA78F, GC_Lo),
+  GC_RUN(0xA790, GC_Lu), GC_RUN(0xA791, GC_Ll),
+  GC_RUN(0xA792, GC_Lu), GC_RUN(0xA793, GC_Ll),
+  GC_RUN(0xA796, GC_Lu), GC_RUN(0xA797, GC_Ll),
+  GC_RUN(0xA798, GC_Lu), GC_RUN(0xA799, GC_Ll),
+  GC_RUN(0xA79A, GC_Lu), GC_RUN(0xA79B, GC_Ll),
+  GC_RUN(0xA79C, GC_Lu), GC_RUN(0xA79D, GC_Ll),
+  GC_RUN(0xA79E, GC_Lu), GC_RUN(0xA79F, GC_Ll),
+  GC_RUN(0xA7A0, GC_Lu), GC_RUN(0xA7A1, GC_Ll),
+  GC_RUN(0xA7A2, GC_Lu), GC_RUN(0xA7A3, GC_Ll),
+  GC_RUN(0xA7A4, GC_Lu), GC_RUN(0xA7A5, GC_Ll),
+  GC_RUN(0xA7A6, GC_Lu), GC_RUN(0xA7A7, GC_Ll),
+  GC_RUN(0xA7A8, GC_Lu), GC_RUN(0xA7A9, GC_Ll),
+  GC_RUN(0xA7AA, GC_Lu), GC_RUN(0xA7AF, GC_Ll),
+  GC_RUN(0xA7B0, GC_Lu), GC_RUN(0xA7B5, GC_Ll),
+  GC_RUN(0xA7B6, GC_Lu), GC_RUN(0xA7B7, GC_Ll),
+  GC_RUN(0xA7B8, GC_Lu), GC_RUN(0xA7B9, GC_Ll),
+  GC_RUN(0xA7BA, GC_Lu), GC_RUN(0xA7BB, GC_Ll),
+  GC_RUN(0xA7BC, GC_Lu), GC_RUN(0xA7BD, GC_Ll),
+  GC_RUN(0xA7BE, GC_Lu), GC_RUN(0xA7BF, GC_Ll),
+  GC_RUN(0xA7C0, GC_Lu), GC_RUN(0xA7C1, GC_Ll),
+  GC_RUN(0xA7C2, GC_Lu), GC_RUN(0xA7C3, GC_Ll),
+  GC_RUN(0xA7C4, GC_Lu), GC_RUN(0xA7C8, GC_Ll),
+  GC_RUN(0xA7C9, GC_Lu), GC_RUN(0xA7CA, GC_Ll),
+  GC_RUN(0xA7CB, GC_Cn), GC_RUN(0xA7D0, GC_Lu),
+  GC_RUN(0xA7D1, GC_Ll), GC_RUN(0xA7D2, GC_Cn),
+  GC_RUN(0xA7D3, GC_Ll), GC_RUN(0xA7D4, GC_Cn),
+  GC_RUN(0xA7D5, GC_Ll), GC_RUN(0xA7D6, GC_Lu),
+  GC_RUN(0xA7D7, GC_Ll), GC_RUN(0xA7D8, GC_Lu),
+  GC_RUN(0xA7D9, GC_Ll), GC_RUN(0xA7DA, GC_Cn),
+  GC_RUN(0xA7F2, GC_Lm), GC_RUN(0xA7F5, GC_Lu),
+  GC_RUN(0xA7F6, GC_Ll), GC_RUN(0xA7F7, GC_Lo),
+  GC_RUN(0xA7F8, GC_Lm), GC_RUN(0xA7FA, GC_Ll),
+  GC_RUN(0xA7FB, GC_Lo), GC_RUN(0xA802, GC_Mn),
+  GC_RUN(0xA803, GC_Lo), GC_RUN(0xA806, GC_Mn),
+  GC_RUN(0xA807, GC_Lo), GC_RUN(0xA80B, GC_Mn),
+  GC_RUN(0xA80C, GC_Lo), GC_RUN(0xA823, GC_Mc),
+  GC_RUN(0xA825, GC_Mn), GC_RUN(0xA827, GC_Mc),
+  GC_RUN(0xA828, GC_So), GC_RUN(0xA82C, GC_Mn),
+  GC_RUN(0xA82D, GC_Cn), GC_RUN(0xA830, GC_No),
+  GC_RUN(0xA836, GC_So), GC_RUN(0xA838, GC_Sc),
+  GC_RUN(0xA839, GC_So), GC_RUN(0xA83A, GC_Cn),
+  GC_RUN(0xA840, GC_Lo), GC_RUN(0xA874, GC_Po),
+  GC_RUN(0xA878, GC_Cn), GC_RUN(0xA880, GC_Mc),
+  GC_RUN(0xA882, GC_Lo), GC_RUN(0xA8B4, GC_Mc),
+  GC_RUN(0xA8C4, GC_Mn), GC_RUN(0xA8C6, GC_Cn),
+  GC_RUN(0xA8CE, GC_Po), GC_RUN(0xA8D0, GC_Nd),
+  GC_RUN(0xA8DA, GC_Cn), GC_RUN(0xA8E0, GC_Mn),
+  GC_RUN(0xA8F2, GC_Lo), GC_RUN(0xA8F8, GC_Po),
+  GC_RUN(0xA8FB, GC_Lo), GC_RUN(0xA8FC, GC_Po),
+  GC_RUN(0xA8FD, GC_Lo), GC_RUN(0xA8FF, GC_Mn),
+  GC_RUN(0xA900, GC_Nd), GC_RUN(0xA90A, GC_Lo),
+  GC_RUN(0xA926, GC_Mn), GC_RUN(0xA92E, GC_Po),
+  GC_RUN(0xA930, GC_Lo), GC_RUN(0xA947, GC_Mn),
+  GC_RUN(0xA952, GC_Mc), GC_RUN(0xA954, GC_Cn),
+  GC_RUN(0xA95F, GC_Po), GC_RUN(0xA960, GC_Lo),
+  GC_RUN(0xA97D, GC_Cn), GC_RUN(0xA980, GC_Mn),
+  GC_RUN(0xA983, GC_Mc), GC_RUN(0xA984, GC_Lo),
+  GC_RUN(0xA9B3, GC_Mn), GC_RUN(0xA9B4, GC_Mc),
+  GC_RUN(0xA9B6, GC_Mn), GC_RUN(0xA9BA, GC_Mc),
+  GC_RUN(0xA9BC, GC_Mn), GC_RUN(0xA9BE, GC_Mc),
+  GC_RUN(0xA9C1, GC_Po), GC_RUN(0xA9CE, GC_Cn),
+  GC_RUN(0xA9CF, GC_Lm), GC_RUN(0xA9D0, GC_Nd),
+  GC_RUN(0xA9DA, GC_Cn), GC_RUN(0xA9DE, GC_Po),
+  GC_RUN(0xA9E0, GC_Lo), GC_RUN(0xA9E5, GC_Mn),
+  GC_RUN(0xA9E6, GC_Lm), GC_RUN(0xA9E7, GC_Lo),
+  GC_RUN(0xA9F0, GC_Nd), GC_RUN(0xA9FA, GC_Lo),
+  GC_RUN(0xA9FF, GC_Cn), GC_RUN(0xAA00, GC_Lo),
+  GC_RUN(0xAA29, GC_Mn), GC_RUN(0xAA2F, GC_Mc),
+  GC_RUN(0xAA31, GC_Mn), GC_RUN(0xAA33, GC_Mc),
+  GC_RUN(0xAA35, GC_Mn), GC_RUN(0xAA37, GC_Cn),
+  GC_RUN(0xAA40, GC_Lo), GC_RUN(0xAA43, GC_Mn),
+  GC_RUN(0xAA44, GC_Lo), GC_RUN(0xAA4C, GC_Mn),
+  GC_RUN(0xAA4D, GC_Mc), GC_RUN(0xAA4E, GC_Cn),
+  GC_RUN(0xAA50, GC_Nd), GC_RUN(0xAA5A, GC_Cn),
+  GC_RUN(0xAA5C, GC_Po), GC_RUN(0xAA60, GC_Lo),
+  GC_RUN(0xAA70, GC_Lm), GC_RUN(0xAA71, GC_Lo),
+  GC_RUN(0xAA77, GC_So), GC_RUN(0xAA7A, GC_Lo),
+  GC_RUN(0xAA7B, GC_Mc), GC_RUN(0xAA7C, GC_Mn),
+  GC_RUN(0xAA7D, GC_Mc), GC_RUN(0xAA7E, GC_Lo),
+  GC_RUN(0xAAB0, GC_Mn), GC_RUN(0xAAB1, GC_Lo),
+  GC_RUN(0xAAB2, GC_Mn), GC_RUN(0xAAB5, GC_Lo),
+  GC_RUN(0xAAB7, GC_Mn), GC_RUN(0xAAB9, GC_Lo),
+  GC_RUN(0xAABE, GC_Mn), GC_RUN(0xAAC0, GC_Lo),
+  GC_RUN(0xAAC1, GC_Mn), GC_RUN(0xAAC2, GC_Lo),
+  GC_RUN(0xAAC3, GC_Cn), GC_RUN(0xAADB, GC_Lo),
+  GC_RUN(0xAADD, GC_Lm), GC_RUN(0xAADE, GC_Po),
+  GC_RUN(0xAAE0, GC_Lo), GC_RUN(0xAAEB, GC_Mc),
+  GC_RUN(0xAAEC, GC_Mn), GC_RUN(0xAAEE, GC_Mc),
+  GC_RUN(0xAAF0, GC_Po), GC_RUN(0xAAF2, GC_Lo),
+  GC_RUN(0xAAF3, GC_Lm), GC_RUN(0xAAF5, GC_Mc),
+  GC_RUN(0xAAF6, GC_Mn), GC_RUN(0xAAF7, GC_Cn),
+  GC_RUN(0xAB01, GC_Lo), GC_RUN(0xAB07, GC_Cn),
+  GC_RUN(0xAB09, GC_Lo), GC_RUN(0xAB0F, GC_Cn),
+  GC_RUN(0xAB11, GC_Lo), GC_RUN(0xAB17, GC_Cn),
+  GC_RUN(0xAB20, GC_Lo), GC_RUN(0xAB27, GC_Cn),
+  GC_RUN(0xAB28, GC_Lo), GC_RUN(0xAB2F, GC_Cn),
+  GC_RUN(0xAB30, GC_Ll), GC_RUN(0xAB5B, GC_Sk),
+  GC_RUN(0xAB5C, GC_Lm), GC_RUN(0xAB60, GC_Ll),
+  GC_RUN(0xAB69, GC_Lm), GC_RUN(0xAB6A, GC_Sk),
+  GC_RUN(0xAB6C, GC_Cn), GC_RUN(0xAB70, GC_Ll),
+  GC_RUN(0xABC0, GC_Lo), GC_RUN(0xABE3, GC_Mc),
+  GC_RUN(0xABE5, GC_Mn), GC_RUN(0xABE6, GC_Mc),
+  GC_RUN(0xABE8, GC_Mn), GC_RUN(0xABE9, GC_Mc),
+  GC_RUN(0xABEB, GC_Po), GC_RUN(0xABEC, GC_Mc),
+  GC_RUN(0xABED, GC_Mn), GC_RUN(0xABEE, GC_Cn),
+  GC_RUN(0xABF0, GC_Nd), GC_RUN(0xABFA, GC_Cn),
+  GC_RUN(0xAC00, GC_Lo), GC_RUN(0xD7A4, GC_Cn),
+  GC_RUN(0xD7B0, GC_Lo), GC_RUN(0xD7C7, GC_Cn),
+  GC_RUN(0xD7CB, GC_Lo), GC_RUN(0xD7FC, GC_Cn),
+  GC_RUN(0xD800, GC_Cs), GC_RUN(0xE000, GC_Co),
+  GC_RUN(0xF900, GC_Lo), GC_RUN(0xFA6E, GC_Cn),
+  GC_RUN(0xFA70, GC_Lo), GC_RUN(0xFADA, GC_Cn),
+  GC_RUN(0xFB00, GC_Ll), GC_RUN(0xFB07, GC_Cn),
+  GC_RUN(0xFB13, GC_Ll), GC_RUN(0xFB18, GC_Cn),
+  GC_RUN(0xFB1D, GC_Lo), GC_RUN(0xFB1E, GC_Mn),
+  GC_RUN(0xFB1F, GC_Lo), GC_RUN(0xFB29, GC_Sm),
+  GC_RUN(0xFB2A, GC_Lo), GC_RUN(0xFB37, GC_Cn),
+  GC_RUN(0xFB38, GC_Lo), GC_RUN(0xFB3D, GC_Cn),
+  GC_RUN(0xFB3E, GC_Lo), GC_RUN(0xFB3F, GC_Cn),
+  GC_RUN(0xFB40, GC_Lo), GC_RUN(0xFB42, GC_Cn),
+  GC_RUN(0xFB43, GC_Lo), GC_RUN(0xFB45, GC_Cn),
+  GC_RUN(0xFB46, GC_Lo), GC_RUN(0xFBB2, GC_Sk),
+  GC_RUN(0xFBC3, GC_Cn), GC_RUN(0xFBD3, GC_Lo),
+  GC_RUN(0xFD3E, GC_Pe), GC_RUN(0xFD3F, GC_Ps),
+  GC_RUN(0xFD40, GC_So), GC_RUN(0xFD50, GC_Lo),
+  GC_RUN(0xFD90, GC_Cn), GC_RUN(0xFD92, GC_Lo),
+  GC_RUN(0xFDC8, GC_Cn), GC_RUN(0xFDCF, GC_So),
+  GC_RUN(0xFDD0, GC_Cn), GC_RUN(0xFDF0, GC_Lo),
+  GC_RUN(0xFDFC, GC_Sc), GC_RUN(0xFDFD, GC_So),
+  GC_RUN(0xFE00, GC_Mn), GC_RUN(0xFE10, GC_Po),
+  GC_RUN(0xFE17, GC_Ps), GC_RUN(0xFE18, GC_Pe),
+  GC_RUN(0xFE19, GC_Po), GC_RUN(0xFE1A, GC_Cn),
+  GC_RUN(0xFE20, GC_Mn), GC_RUN(0xFE30, GC_Po),
+  GC_RUN(0xFE31, GC_Pd), GC_RUN(0xFE33, GC_Pc),
+  GC_RUN(0xFE35, GC_Ps), GC_RUN(0xFE36, GC_Pe),
+  GC_RUN(0xFE37, GC_Ps), GC_RUN(0xFE38, GC_Pe),
+  GC_RUN(0xFE39, GC_Ps), GC_RUN(0xFE3A, GC_Pe),
+  GC_RUN(0xFE3B, GC_Ps), GC_RUN(0xFE3C, GC_Pe),
+  GC_RUN(0xFE3D, GC_Ps), GC_RUN(0xFE3E, GC_Pe),
+  GC_RUN(0xFE3F, GC_Ps), GC_RUN(0xFE40, GC_Pe),
+  GC_RUN(0xFE41, GC_Ps), GC_RUN(0xFE42, GC_Pe),
+  GC_RUN(0xFE43, GC_Ps), GC_RUN(0xFE44, GC_Pe),
+  GC_RUN(0xFE45, GC_Po), GC_RUN(0xFE47, GC_Ps),
+  GC_RUN(0xFE48, GC_Pe), GC_RUN(0xFE49, GC_Po),
+  GC_RUN(0xFE4D, GC_Pc), GC_RUN(0xFE50, GC_Po),
+  GC_RUN(0xFE53, GC_Cn), GC_RUN(0xFE54, GC_Po),
+  GC_RUN(0xFE58, GC_Pd), GC_RUN(0xFE59, GC_Ps),
+  GC_RUN(0xFE5A, GC_Pe), GC_RUN(0xFE5B, GC_Ps),
+  GC_RUN(0xFE5C, GC_Pe), GC_RUN(0xFE5D, GC_Ps),
+  GC_RUN(0xFE5E, GC_Pe), GC_RUN(0xFE5F, GC_Po),
+  GC_RUN(0xFE62, GC_Sm), GC_RUN(0xFE63, GC_Pd),
+  GC_RUN(0xFE64, GC_Sm), GC_RUN(0xFE67, GC_Cn),
+  GC_RUN(0xFE68, GC_Po), GC_RUN(0xFE69, GC_Sc),
+  GC_RUN(0xFE6A, GC_Po), GC_RUN(0xFE6C, GC_Cn),
+  GC_RUN(0xFE70, GC_Lo), GC_RUN(0xFE75, GC_Cn),
+  GC_RUN(0xFE76, GC_Lo), GC_RUN(0xFEFD, GC_Cn),
+  GC_RUN(0xFEFF, GC_Cf), GC_RUN(0xFF00, GC_Cn),
+  GC_RUN(0xFF01, GC_Po), GC_RUN(0xFF04, GC_Sc),
+  GC_RUN(0xFF05, GC_Po), GC_RUN(0xFF08, GC_Ps),
+  GC_RUN(0xFF09, GC_Pe), GC_RUN(0xFF0A, GC_Po),
+  GC_RUN(0xFF0B, GC_Sm), GC_RUN(0xFF0C, GC_Po),
+  GC_RUN(0xFF0D, GC_Pd), GC_RUN(0xFF0E, GC_Po),
+  GC_RUN(0xFF10, GC_Nd), GC_RUN(0xFF1A, GC_Po),
+  GC_RUN(0xFF1C, GC_Sm), GC_RUN(0xFF1F, GC_Po),
+  GC_RUN(0xFF21, GC_Lu), GC_RUN(0xFF3B, GC_Ps),
+  GC_RUN(0xFF3C, GC_Po), GC_RUN(0xFF3D, GC_Pe),
+  GC_RUN(0xFF3E, GC_Sk), GC_RUN(0xFF3F, GC_Pc),
+  GC_RUN(0xFF40, GC_Sk), GC_RUN(0xFF41, GC_Ll),
+  GC_RUN(0xFF5B, GC_Ps), GC_RUN(0xFF5C, GC_Sm),
+  GC_RUN(0xFF5D, GC_Pe), GC_RUN(0xFF5E, GC_Sm),
+  GC_RUN(0xFF5F, GC_Ps), GC_RUN(0xFF60, GC_Pe),
+  GC_RUN(0xFF61, GC_Po), GC_RUN(0xFF62, GC_Ps),
+  GC_RUN(0xFF63, GC_Pe), GC_RUN(0xFF64, GC_Po),
+  GC_RUN(0xFF66, GC_Lo), GC_RUN(0xFF70, GC_Lm),
+  GC_RUN(0xFF71, GC_Lo), GC_RUN(0xFF9E, GC_Lm),
+  GC_RUN(0xFFA0, GC_Lo), GC_RUN(0xFFBF, GC_Cn),
+  GC_RUN(0xFFC2, GC_Lo), GC_RUN(0xFFC8, GC_Cn),
+  GC_RUN(0xFFCA, GC_Lo), GC_RUN(0xFFD0, GC_Cn),
+  GC_RUN(0xFFD2, GC_Lo), GC_RUN(0xFFD8, GC_Cn),
+  GC_RUN(0xFFDA, GC_Lo), GC_RUN(0xFFDD, GC_Cn),
+  GC_RUN(0xFFE0, GC_Sc), GC_RUN(0xFFE2, GC_Sm),
+  GC_RUN(0xFFE3, GC_Sk), GC_RUN(0xFFE4, GC_So),
+  GC_RUN(0xFFE5, GC_Sc), GC_RUN(0xFFE7, GC_Cn),
+  GC_RUN(0xFFE8, GC_So), GC_RUN(0xFFE9, GC_Sm),
+  GC_RUN(0xFFED, GC_So), GC_RUN(0xFFEF, GC_Cn),
+  GC_RUN(0xFFF9, GC_Cf), GC_RUN(0xFFFC, GC_So),
+  GC_RUN(0xFFFE, GC_Cn), GC_RUN(0x10000, GC_Lo),
+  GC_RUN(0x1000C, GC_Cn), GC_RUN(0x1000D, GC_Lo),
+  GC_RUN(0x10027, GC_Cn), GC_RUN(0x10028, GC_Lo),
+  GC_RUN(0x1003B, GC_Cn), GC_RUN(0x1003C, GC_Lo),
+  GC_RUN(0x1003E, GC_Cn), GC_RUN(0x1003F, GC_Lo),
+  GC_RUN(0x1004E, GC_Cn), GC_RUN(0x10050, GC_Lo),
+  GC_RUN(0x1005E, GC_Cn), GC_RUN(0x10080, GC_Lo),
+  GC_RUN(0x100FB, GC_Cn), GC_RUN(0x10100, GC_Po),
+  GC_RUN(0x10103, GC_Cn), GC_RUN(0x10107, GC_No),
+  GC_RUN(0x10134, GC_Cn), GC_RUN(0x10137, GC_So),
+  GC_RUN(0x10140, GC_Nl), GC_RUN(0x10175, GC_No),
+  GC_RUN(0x10179, GC_So), GC_RUN(0x1018A, GC_No),
+  GC_RUN(0x1018C, GC_So), GC_RUN(0x1018F, GC_Cn),
+  GC_RUN(0x10190, GC_So), GC_RUN(0x1019D, GC_Cn),
+  GC_RUN(0x101A0, GC_So), GC_RUN(0x101A1, GC_Cn),
+  GC_RUN(0x101D0, GC_So), GC_RUN(0x101FD, GC_Mn),
+  GC_RUN(0x101FE, GC_Cn), GC_RUN(0x10280, GC_Lo),
+  GC_RUN(0x1029D, GC_Cn), GC_RUN(0x102A0, GC_Lo),
+  GC_RUN(0x102D1, GC_Cn), GC_RUN(0x102E0, GC_Mn),
+  GC_RUN(0x102E1, GC_No), GC_RUN(0x102FC, GC_Cn),
+  GC_RUN(0x10300, GC_Lo), GC_RUN(0x10320, GC_No),
+  GC_RUN(0x10324, GC_Cn), GC_RUN(0x1032D, GC_Lo),
+  GC_RUN(0x10341, GC_Nl), GC_RUN(0x10342, GC_Lo),
+  GC_RUN(0x1034A, GC_Nl), GC_RUN(0x1034B, GC_Cn),
+  GC_RUN(0x10350, GC_Lo), GC_RUN(0x10376, GC_Mn),
+  GC_RUN(0x1037B, GC_Cn), GC_RUN(0x10380, GC_Lo),
+  GC_RUN(0x1039E, GC_Cn), GC_RUN(0x1039F, GC_Po),
+  GC_RUN(0x103A0, GC_Lo), GC_RUN(0x103C4, GC_Cn),
+  GC_RUN(0x103C8, GC_Lo), GC_RUN(0x103D0, GC_Po),
+  GC_RUN(0x103D1, GC_Nl), GC_RUN(0x103D6, GC_Cn),
+  GC_RUN(0x10400, GC_Lu), GC_RUN(0x10428, GC_Ll),
+  GC_RUN(0x10450, GC_Lo), GC_RUN(0x1049E, GC_Cn),
+  GC_RUN(0x104A0, GC_Nd), GC_RUN(0x104AA, GC_Cn),
+  GC_RUN(0x104B0, GC_Lu), GC_RUN(0x104D4, GC_Cn),
+  GC_RUN(0x104D8, GC_Ll), GC_RUN(0x104FC, GC_Cn),
+  GC_RUN(0x10500, GC_Lo), GC_RUN(0x10528, GC_Cn),
+  GC_RUN(0x10530, GC_Lo), GC_RUN(0x10564, GC_Cn),
+  GC_RUN(0x1056F, GC_Po), GC_RUN(0x10570, GC_Lu),
+  GC_RUN(0x1057B, GC_Cn), GC_RUN(0x1057C, GC_Lu),
+  GC_RUN(0x1058B, GC_Cn), GC_RUN(0x1058C, GC_Lu),
+  GC_RUN(0x10593, GC_Cn), GC_RUN(0x10594, GC_Lu),
+  GC_RUN(0x10596, GC_Cn), GC_RUN(0x10597, GC_Ll),
+  GC_RUN(0x105A2, GC_Cn), GC_RUN(0x105A3, GC_Ll),
+  GC_RUN(0x105B2, GC_Cn), GC_RUN(0x105B3, GC_Ll),
+  GC_RUN(0x105BA, GC_Cn), GC_RUN(0x105BB, GC_Ll),
+  GC_RUN(0x105BD, GC_Cn), GC_RUN(0x10600, GC_Lo),
+  GC_RUN(0x10737, GC_Cn), GC_RUN(0x10740, GC_Lo),
+  GC_RUN(0x10756, GC_Cn), GC_RUN(0x10760, GC_Lo),
+  GC_RUN(0x10768, GC_Cn), GC_RUN(0x10780, GC_Lm),
+  GC_RUN(0x10786, GC_Cn), GC_RUN(0x10787, GC_Lm),
+  GC_RUN(0x107B1, GC_Cn), GC_RUN(0x107B2, GC_Lm),
+  GC_RUN(0x107BB, GC_Cn), GC_RUN(0x10800, GC_Lo),
+  GC_RUN(0x10806, GC_Cn), GC_RUN(0x10808, GC_Lo),
+  GC_RUN(0x10809, GC_Cn), GC_RUN(0x1080A, GC_Lo),
+  GC_RUN(0x10836, GC_Cn), GC_RUN(0x10837, GC_Lo),
+  GC_RUN(0x10839, GC_Cn), GC_RUN(0x1083C, GC_Lo),
+  GC_RUN(0x1083D, GC_Cn), GC_RUN(0x1083F, GC_Lo),
+  GC_RUN(0x10856, GC_Cn), GC_RUN(0x10857, GC_Po),
+  GC_RUN(0x10858, GC_No), GC_RUN(0x10860, GC_Lo),
+  GC_RUN(0x10877, GC_So), GC_RUN(0x10879, GC_No),
+  GC_RUN(0x10880, GC_Lo), GC_RUN(0x1089F, GC_Cn),
+  GC_RUN(0x108A7, GC_No), GC_RUN(0x108B0, GC_Cn),
+  GC_RUN(0x108E0, GC_Lo), GC_RUN(0x108F3, GC_Cn),
+  GC_RUN(0x108F4, GC_Lo), GC_RUN(0x108F6, GC_Cn),
+  GC_RUN(0x108FB, GC_No), GC_RUN(0x10900, GC_Lo),
+  GC_RUN(0x10916, GC_No), GC_RUN(0x1091C, GC_Cn),
+  GC_RUN(0x1091F, GC_Po), GC_RUN(0x10920, GC_Lo),
+  GC_RUN(0x1093A, GC_Cn), GC_RUN(0x1093F, GC_Po),
+  GC_RUN(0x10940, GC_Cn), GC_RUN(0x10980, GC_Lo),
+  GC_RUN(0x109B8, GC_Cn), GC_RUN(0x109BC, GC_No),
+  GC_RUN(0x109BE, GC_Lo), GC_RUN(0x109C0, GC_No),
+  GC_RUN(0x109D0, GC_Cn), GC_RUN(0x109D2, GC_No),
+  GC_RUN(0x10A00, GC_Lo), GC_RUN(0x10A01, GC_Mn),
+  GC_RUN(0x10A04, GC_Cn), GC_RUN(0x10A05, GC_Mn),
+  GC_RUN(0x10A07, GC_Cn), GC_RUN(0x10A0C, GC_Mn),
+  GC_RUN(0x10A10, GC_Lo), GC_RUN(0x10A14, GC_Cn),
+  GC_RUN(0x10A15, GC_Lo), GC_RUN(0x10A18, GC_Cn),
+  GC_RUN(0x10A19, GC_Lo), GC_RUN(0x10A36, GC_Cn),
+  GC_RUN(0x10A38, GC_Mn), GC_RUN(0x10A3B, GC_Cn),
+  GC_RUN(0x10A3F, GC_Mn), GC_RUN(0x10A40, GC_No),
+  GC_RUN(0x10A49, GC_Cn), GC_RUN(0x10A50, GC_Po),
+  GC_RUN(0x10A59, GC_Cn), GC_RUN(0x10A60, GC_Lo),
+  GC_RUN(0x10A7D, GC_No), GC_RUN(0x10A7F, GC_Po),
+  GC_RUN(0x10A80, GC_Lo), GC_RUN(0x10A9D, GC_No),
+  GC_RUN(0x10AA0, GC_Cn), GC_RUN(0x10AC0, GC_Lo),
+  GC_RUN(0x10AC8, GC_So), GC_RUN(0x10AC9, GC_Lo),
+  GC_RUN(0x10AE5, GC_Mn), GC_RUN(0x10AE7, GC_Cn),
+  GC_RUN(0x10AEB, GC_No), GC_RUN(0x10AF0, GC_Po),
+  GC_RUN(0x10AF7, GC_Cn), GC_RUN(0x10B00, GC_Lo),
+  GC_RUN(0x10B36, GC_Cn), GC_RUN(0x10B39, GC_Po),
+  GC_RUN(0x10B40, GC_Lo), GC_RUN(0x10B56, GC_Cn),
+  GC_RUN(0x10B58, GC_No), GC_RUN(0x10B60, GC_Lo),
+  GC_RUN(0x10B73, GC_Cn), GC_RUN(0x10B78, GC_No),
+  GC_RUN(0x10B80, GC_Lo), GC_RUN(0x10B92, GC_Cn),
+  GC_RUN(0x10B99, GC_Po), GC_RUN(0x10B9D, GC_Cn),
+  GC_RUN(0x10BA9, GC_No), GC_RUN(0x10BB0, GC_Cn),
+  GC_RUN(0x10C00, GC_Lo), GC_RUN(0x10C49, GC_Cn),
+  GC_RUN(0x10C80, GC_Lu), GC_RUN(0x10CB3, GC_Cn),
+  GC_RUN(0x10CC0, GC_Ll), GC_RUN(0x10CF3, GC_Cn),
+  GC_RUN(0x10CFA, GC_No), GC_RUN(0x10D00, GC_Lo),
+  GC_RUN(0x10D24, GC_Mn), GC_RUN(0x10D28, GC_Cn),
+  GC_RUN(0x10D30, GC_Nd), GC_RUN(0x10D3A, GC_Cn),
+  GC_RUN(0x10E60, GC_No), GC_RUN(0x10E7F, GC_Cn),
+  GC_RUN(0x10E80, GC_Lo), GC_RUN(0x10EAA, GC_Cn),
+  GC_RUN(0x10EAB, GC_Mn), GC_RUN(0x10EAD, GC_Pd),
+  GC_RUN(0x10EAE, GC_Cn), GC_RUN(0x10EB0, GC_Lo),
+  GC_RUN(0x10EB2, GC_Cn), GC_RUN(0x10F00, GC_Lo),
+  GC_RUN(0x10F1D, GC_No), GC_RUN(0x10F27, GC_Lo),
+  GC_RUN(0x10F28, GC_Cn), GC_RUN(0x10F30, GC_Lo),
+  GC_RUN(0x10F46, GC_Mn), GC_RUN(0x10F51, GC_No),
+  GC_RUN(0x10F55, GC_Po), GC_RUN(0x10F5A, GC_Cn),
+  GC_RUN(0x10F70, GC_Lo), GC_RUN(0x10F82, GC_Mn),
+  GC_RUN(0x10F86, GC_Po), GC_RUN(0x10F8A, GC_Cn),
+  GC_RUN(0x10FB0, GC_Lo), GC_RUN(0x10FC5, GC_No),
+  GC_RUN(0x10FCC, GC_Cn), GC_RUN(0x10FE0, GC_Lo),
+  GC_RUN(0x10FF7, GC_Cn), GC_RUN(0x11000, GC_Mc),
+  GC_RUN(0x11001, GC_Mn), GC_RUN(0x11002, GC_Mc),
+  GC_RUN(0x11003, GC_Lo), GC_RUN(0x11038, GC_Mn),
+  GC_RUN(0x11047, GC_Po), GC_RUN(0x1104E, GC_Cn),
+  GC_RUN(0x11052, GC_No), GC_RUN(0x11066, GC_Nd),
+  GC_RUN(0x11070, GC_Mn), GC_RUN(0x11071, GC_Lo),
+  GC_RUN(0x11073, GC_Mn), GC_RUN(0x11075, GC_Lo),
+  GC_RUN(0x11076, GC_Cn), GC_RUN(0x1107F, GC_Mn),
+  GC_RUN(0x11082, GC_Mc), GC_RUN(0x11083, GC_Lo),
+  GC_RUN(0x110B0, GC_Mc), GC_RUN(0x110B3, GC_Mn),
+  GC_RUN(0x110B7, GC_Mc), GC_RUN(0x110B9, GC_Mn),
+  GC_RUN(0x110BB, GC_Po), GC_RUN(0x110BD, GC_Cf),
+  GC_RUN(0x110BE, GC_Po), GC_RUN(0x110C2, GC_Mn),
+  GC_RUN(0x110C3, GC_Cn), GC_RUN(0x110CD, GC_Cf),
+  GC_RUN(0x110CE, GC_Cn), GC_RUN(0x110D0, GC_Lo),
+  GC_RUN(0x110E9, GC_Cn), GC_RUN(0x110F0, GC_Nd),
+  GC_RUN(0x110FA, GC_Cn), GC_RUN(0x11100, GC_Mn),
+  GC_RUN(0x11103, GC_Lo), GC_RUN(0x11127, GC_Mn),
+  GC_RUN(0x1112C, GC_Mc), GC_RUN(0x1112D, GC_Mn),
+  GC_RUN(0x11135, GC_Cn), GC_RUN(0x11136, GC_Nd),
+  GC_RUN(0x11140, GC_Po), GC_RUN(0x11144, GC_Lo),
+  GC_RUN(0x11145, GC_Mc), GC_RUN(0x11147, GC_Lo),
+  GC_RUN(0x11148, GC_Cn), GC_RUN(0x11150, GC_Lo),
+  GC_RUN(0x11173, GC_Mn), GC_RUN(0x11174, GC_Po),
+  GC_RUN(0x11176, GC_Lo), GC_RUN(0x11177, GC_Cn),
+  GC_RUN(0x11180, GC_Mn), GC_RUN(0x11182, GC_Mc),
+  GC_RUN(0x11183, GC_Lo), GC_RUN(0x111B3, GC_Mc),
+  GC_RUN(0x111B6, GC_Mn), GC_RUN(0x111BF, GC_Mc),
+  GC_RUN(0x111C1, GC_Lo), GC_RUN(0x111C5, GC_Po),
+  GC_RUN(0x111C9, GC_Mn), GC_RUN(0x111CD, GC_Po),
+  GC_RUN(0x111CE, GC_Mc), GC_RUN(0x111CF, GC_Mn),
+  GC_RUN(0x111D0, GC_Nd), GC_RUN(0x111DA, GC_Lo),
+  GC_RUN(0x111DB, GC_Po), GC_RUN(0x111DC, GC_Lo),
+  GC_RUN(0x111DD, GC_Po), GC_RUN(0x111E0, GC_Cn),
+  GC_RUN(0x111E1, GC_No), GC_RUN(0x111F5, GC_Cn),
+  GC_RUN(0x11200, GC_Lo), GC_RUN(0x11212, GC_Cn),
+  GC_RUN(0x11213, GC_Lo), GC_RUN(0x1122C, GC_Mc),
+  GC_RUN(0x1122F, GC_Mn), GC_RUN(0x11232, GC_Mc),
+  GC_RUN(0x11234, GC_Mn), GC_RUN(0x11235, GC_Mc),
+  GC_RUN(0x11236, GC_Mn), GC_RUN(0x11238, GC_Po),
+  GC_RUN(0x1123E, GC_Mn), GC_RUN(0x1123F, GC_Cn),
+  GC_RUN(0x11280, GC_Lo), GC_RUN(0x11287, GC_Cn),
+  GC_RUN(0x11288, GC_Lo), GC_RUN(0x11289, GC_Cn),
+  GC_RUN(0x1128A, GC_Lo), GC_RUN(0x1128E, GC_Cn),
+  GC_RUN(0x1128F, GC_Lo), GC_RUN(0x1129E, GC_Cn),
+  GC_RUN(0x1129F, GC_Lo), GC_RUN(0x112A9, GC_Po),
+  GC_RUN(0x112AA, GC_Cn), GC_RUN(0x112B0, GC_Lo),
+  GC_RUN(0x112DF, GC_Mn), GC_RUN(0x112E0, GC_Mc),
+  GC_RUN(0x112E3, GC_Mn), GC_RUN(0x112EB, GC_Cn),
+  GC_RUN(0x112F0, GC_Nd), GC_RUN(0x112FA, GC_Cn),
+  GC_RUN(0x11300, GC_Mn), GC_RUN(0x11302, GC_Mc),
+  GC_RUN(0x11304, GC_Cn), GC_RUN(0x11305, GC_Lo),
+  GC_RUN(0x1130D, GC_Cn), GC_RUN(0x1130F, GC_Lo),
+  GC_RUN(0x11311, GC_Cn), GC_RUN(0x11313, GC_Lo),
+  GC_RUN(0x11329, GC_Cn), GC_RUN(0x1132A, GC_Lo),
+  GC_RUN(0x11331, GC_Cn), GC_RUN(0x11332, GC_Lo),
+  GC_RUN(0x11334, GC_Cn), GC_RUN(0x11335, GC_Lo),
+  GC_RUN(0x1133A, GC_Cn), GC_RUN(0x1133B, GC_Mn),
+  GC_RUN(0x1133D, GC_Lo), GC_RUN(0x1133E, GC_Mc),
+  GC_RUN(0x11340, GC_Mn), GC_RUN(0x11341, GC_Mc),
+  GC_RUN(0x11345, GC_Cn), GC_RUN(0x11347, GC_Mc),
+  GC_RUN(0x11349, GC_Cn), GC_RUN(0x1134B, GC_Mc),
+  GC_RUN(0x1134E, GC_Cn), GC_RUN(0x11350, GC_Lo),
+  GC_RUN(0x11351, GC_Cn), GC_RUN(0x11357, GC_Mc),
+  GC_RUN(0x11358, GC_Cn), GC_RUN(0x1135D, GC_Lo),
+  GC_RUN(0x11362, GC_Mc), GC_RUN(0x11364, GC_Cn),
+  GC_RUN(0x11366, GC_Mn), GC_RUN(0x1136D, GC_Cn),
+  GC_RUN(0x11370, GC_Mn), GC_RUN(0x11375, GC_Cn),
+  GC_RUN(0x11400, GC_Lo), GC_RUN(0x11435, GC_Mc),
+  GC_RUN(0x11438, GC_Mn), GC_RUN(0x11440, GC_Mc),
+  GC_RUN(0x11442, GC_Mn), GC_RUN(0x11445, GC_Mc),
+  GC_RUN(0x11446, GC_Mn), GC_RUN(0x11447, GC_Lo),
+  GC_RUN(0x1144B, GC_Po), GC_RUN(0x11450, GC_Nd),
+  GC_RUN(0x1145A, GC_Po), GC_RUN(0x1145C, GC_Cn),
+  GC_RUN(0x1145D, GC_Po), GC_RUN(0x1145E, GC_Mn),
+  GC_RUN(0x1145F, GC_Lo), GC_RUN(0x11462, GC_Cn),
+  GC_RUN(0x11480, GC_Lo), GC_RUN(0x114B0, GC_Mc),
+  GC_RUN(0x114B3, GC_Mn), GC_RUN(0x114B9, GC_Mc),
+  GC_RUN(0x114BA, GC_Mn), GC_RUN(0x114BB, GC_Mc),
+  GC_RUN(0x114BF, GC_Mn), GC_RUN(0x114C1, GC_Mc),
+  GC_RUN(0x114C2, GC_Mn), GC_RUN(0x114C4, GC_Lo),
+  GC_RUN(0x114C6, GC_Po), GC_RUN(0x114C7, GC_Lo),
+  GC_RUN(0x114C8, GC_Cn), GC_RUN(0x114D0, GC_Nd),
+  GC_RUN(0x114DA, GC_Cn), GC_RUN(0x11580, GC_Lo),
+  GC_RUN(0x115AF, GC_Mc), GC_RUN(0x115B2, GC_Mn),
+  GC_RUN(0x115B6, GC_Cn), GC_RUN(0x115B8, GC_Mc),
+  GC_RUN(0x115BC, GC_Mn), GC_RUN(0x115BE, GC_Mc),
+  GC_RUN(0x115BF, GC_Mn), GC_RUN(0x115C1, GC_Po),
+  GC_RUN(0x115D8, GC_Lo), GC_RUN(0x115DC, GC_Mn),
+  GC_RUN(0x115DE, GC_Cn), GC_RUN(0x11600, GC_Lo),
+  GC_RUN(0x11630, GC_Mc), GC_RUN(0x11633, GC_Mn),
+  GC_RUN(0x1163B, GC_Mc), GC_RUN(0x1163D, GC_Mn),
+  GC_RUN(0x1163E, GC_Mc), GC_RUN(0x1163F, GC_Mn),
+  GC_RUN(0x11641, GC_Po), GC_RUN(0x11644, GC_Lo),
+  GC_RUN(0x11645, GC_Cn), GC_RUN(0x11650, GC_Nd),
+  GC_RUN(0x1165A, GC_Cn), GC_RUN(0x11660, GC_Po),
+  GC_RUN(0x1166D, GC_Cn), GC_RUN(0x11680, GC_Lo),
+  GC_RUN(0x116AB, GC_Mn), GC_RUN(0x116AC, GC_Mc),
+  GC_RUN(0x116AD, GC_Mn), GC_RUN(0x116AE, GC_Mc),
+  GC_RUN(0x116B0, GC_Mn), GC_RUN(0x116B6, GC_Mc),
+  GC_RUN(0x116B7, GC_Mn), GC_RUN(0x116B8, GC_Lo),
+  GC_RUN(0x116B9, GC_Po), GC_RUN(0x116BA, GC_Cn),
+  GC_RUN(0x116C0, GC_Nd), GC_RUN(0x116CA, GC_Cn),
+  GC_RUN(0x11700, GC_Lo), GC_RUN(0x1171B, GC_Cn),
+  GC_RUN(0x1171D, GC_Mn), GC_RUN(0x11720, GC_Mc),
+  GC_RUN(0x11722, GC_Mn), GC_RUN(0x11726, GC_Mc),
+  GC_RUN(0x11727, GC_Mn), GC_RUN(0x1172C, GC_Cn),
+  GC_RUN(0x11730, GC_Nd), GC_RUN(0x1173A, GC_No),
+  GC_RUN(0x1173C, GC_Po), GC_RUN(0x1173F, GC_So),
+  GC_RUN(0x11740, GC_Lo), GC_RUN(0x11747, GC_Cn),
+  GC_RUN(0x11800, GC_Lo), GC_RUN(0x1182C, GC_Mc),
+  GC_RUN(0x1182F, GC_Mn), GC_RUN(0x11838, GC_Mc),
+  GC_RUN(0x11839, GC_Mn), GC_RUN(0x1183B, GC_Po),
+  GC_RUN(0x1183C, GC_Cn), GC_RUN(0x118A0, GC_Lu),
+  GC_RUN(0x118C0, GC_Ll), GC_RUN(0x118E0, GC_Nd),
+  GC_RUN(0x118EA, GC_No), GC_RUN(0x118F3, GC_Cn),
+  GC_RUN(0x118FF, GC_Lo), GC_RUN(0x11907, GC_Cn),
+  GC_RUN(0x11909, GC_Lo), GC_RUN(0x1190A, GC_Cn),
+  GC_RUN(0x1190C, GC_Lo), GC_RUN(0x11914, GC_Cn),
+  GC_RUN(0x11915, GC_Lo), GC_RUN(0x11917, GC_Cn),
+  GC_RUN(0x11918, GC_Lo), GC_RUN(0x11930, GC_Mc),
+  GC_RUN(0x11936, GC_Cn), GC_RUN(0x11937, GC_Mc),
+  GC_RUN(0x11939, GC_Cn), GC_RUN(0x1193B, GC_Mn),
+  GC_RUN(0x1193D, GC_Mc), GC_RUN(0x1193E, GC_Mn),
+  GC_RUN(0x1193F, GC_Lo), GC_RUN(0x11940, GC_Mc),
+  GC_RUN(0x11941, GC_Lo), GC_RUN(0x11942, GC_Mc),
+  GC_RUN(0x11943, GC_Mn), GC_RUN(0x11944, GC_Po),
+  GC_RUN(0x11947, GC_Cn), GC_RUN(0x11950, GC_Nd),
+  GC_RUN(0x1195A, GC_Cn), GC_RUN(0x119A0, GC_Lo),
+  GC_RUN(0x119A8, GC_Cn), GC_RUN(0x119AA, GC_Lo),
+  GC_RUN(0x119D1, GC_Mc), GC_RUN(0x119D4, GC_Mn),
+  GC_RUN(0x119D8, GC_Cn), GC_RUN(0x119DA, GC_Mn),
+  GC_RUN(0x119DC, GC_Mc), GC_RUN(0x119E0, GC_Mn),
+  GC_RUN(0x119E1, GC_Lo), GC_RUN(0x119E2, GC_Po),
+  GC_RUN(0x119E3, GC_Lo), GC_RUN(0x119E4, GC_Mc),
+  GC_RUN(0x119E5, GC_Cn), GC_RUN(0x11A00, GC_Lo),
+  GC_RUN(0x11A01, GC_Mn), GC_RUN(0x11A0B, GC_Lo),
+  GC_RUN(0x11A33, GC_Mn), GC_RUN(0x11A39, GC_Mc),
+  GC_RUN(0x11A3A, GC_Lo), GC_RUN(0x11A3B, GC_Mn),
+  GC_RUN(0x11A3F, GC_Po), GC_RUN(0x11A47, GC_Mn),
+  GC_RUN(0x11A48, GC_Cn), GC_RUN(0x11A50, GC_Lo),
+  GC_RUN(0x11A51, GC_Mn), GC_RUN(0x11A57, GC_Mc),
+  GC_RUN(0x11A59, GC_Mn), GC_RUN(0x11A5C, GC_Lo),
+  GC_RUN(0x11A8A, GC_Mn), GC_RUN(0x11A97, GC_Mc),
+  GC_RUN(0x11A98, GC_Mn), GC_RUN(0x11A9A, GC_Po),
+  GC_RUN(0x11A9D, GC_Lo), GC_RUN(0x11A9E, GC_Po),
+  GC_RUN(0x11AA3, GC_Cn), GC_RUN(0x11AB0, GC_Lo),
+  GC_RUN(0x11AF9, GC_Cn), GC_RUN(0x11C00, GC_Lo),
+  GC_RUN(0x11C09, GC_Cn), GC_RUN(0x11C0A, GC_Lo),
+  GC_RUN(0x11C2F, GC_Mc), GC_RUN(0x11C30, GC_Mn),
+  GC_RUN(0x11C37, GC_Cn), GC_RUN(0x11C38, GC_Mn),
+  GC_RUN(0x11C3E, GC_Mc), GC_RUN(0x11C3F, GC_Mn),
+  GC_RUN(0x11C40, GC_Lo), GC_RUN(0x11C41, GC_Po),
+  GC_RUN(0x11C46, GC_Cn), GC_RUN(0x11C50, GC_Nd),
+  GC_RUN(0x11C5A, GC_No), GC_RUN(0x11C6D, GC_Cn),
+  GC_RUN(0x11C70, GC_Po), GC_RUN(0x11C72, GC_Lo),
+  GC_RUN(0x11C90, GC_Cn), GC_RUN(0x11C92, GC_Mn),
+  GC_RUN(0x11CA8, GC_Cn), GC_RUN(0x11CA9, GC_Mc),
+  GC_RUN(0x11CAA, GC_Mn), GC_RUN(0x11CB1, GC_Mc),
+  GC_RUN(0x11CB2, GC_Mn), GC_RUN(0x11CB4, GC_Mc),
+  GC_RUN(0x11CB5, GC_Mn), GC_RUN(0x11CB7, GC_Cn),
+  GC_RUN(0x11D00, GC_Lo), GC_RUN(0x11D07, GC_Cn),
+  GC_RUN(0x11D08, GC_Lo), GC_RUN(0x11D0A, GC_Cn),
+  GC_RUN(0x11D0B, GC_Lo), GC_RUN(0x11D31, GC_Mn),
+  GC_RUN(0x11D37, GC_Cn), GC_RUN(0x11D3A, GC_Mn),
+  GC_RUN(0x11D3B, GC_Cn), GC_RUN(0x11D3C, GC_Mn),
+  GC_RUN(0x11D3E, GC_Cn), GC_RUN(0x11D3F, GC_Mn),
+  GC_RUN(0x11D46, GC_Lo), GC_RUN(0x11D47, GC_Mn),
+  GC_RUN(0x11D48, GC_Cn), GC_RUN(0x11D50, GC_Nd),
+  GC_RUN(0x11D5A, GC_Cn), GC_RUN(0x11D60, GC_Lo),
+  GC_RUN(0x11D66, GC_Cn), GC_RUN(0x11D67, GC_Lo),
+  GC_RUN(0x11D69, GC_Cn), GC_RUN(0x11D6A, GC_Lo),
+  GC_RUN(0x11D8A, GC_Mc), GC_RUN(0x11D8F, GC_Cn),
+  GC_RUN(0x11D90, GC_Mn), GC_RUN(0x11D92, GC_Cn),
+  GC_RUN(0x11D93, GC_Mc), GC_RUN(0x11D95, GC_Mn),
+  GC_RUN(0x11D96, GC_Mc), GC_RUN(0x11D97, GC_Mn),
+  GC_RUN(0x11D98, GC_Lo), GC_RUN(0x11D99, GC_Cn),
+  GC_RUN(0x11DA0, GC_Nd), GC_RUN(0x11DAA, GC_Cn),
+  GC_RUN(0x11EE0, GC_Lo), GC_RUN(0x11EF3, GC_Mn),
+  GC_RUN(0x11EF5, GC_Mc), GC_RUN(0x11EF7, GC_Po),
+  GC_RUN(0x11EF9, GC_Cn), GC_RUN(0x11FB0, GC_Lo),
+  GC_RUN(0x11FB1, GC_Cn), GC_RUN(0x11FC0, GC_No),
+  GC_RUN(0x11FD5, GC_So), GC_RUN(0x11FDD, GC_Sc),
+  GC_RUN(0x11FE1, GC_So), GC_RUN(0x11FF2, GC_Cn),
+  GC_RUN(0x11FFF, GC_Po), GC_RUN(0x12000, GC_Lo),
+  GC_RUN(0x1239A, GC_Cn), GC_RUN(0x12400, GC_Nl),
+  GC_RUN(0x1246F, GC_Cn), GC_RUN(0x12470, GC_Po),
+  GC_RUN(0x12475, GC_Cn), GC_RUN(0x12480, GC_Lo),
+  GC_RUN(0x12544, GC_Cn), GC_RUN(0x12F90, GC_Lo),
+  GC_RUN(0x12FF1, GC_Po), GC_RUN(0x12FF3, GC_Cn),
+  GC_RUN(0x13000, GC_Lo), GC_RUN(0x1342F, GC_Cn),
+  GC_RUN(0x13430, GC_Cf), GC_RUN(0x13439, GC_Cn),
+  GC_RUN(0x14400, GC_Lo), GC_RUN(0x14647, GC_Cn),
+  GC_RUN(0x16800, GC_Lo), GC_RUN(0x16A39, GC_Cn),
+  GC_RUN(0x16A40, GC_Lo), GC_RUN(0x16A5F, GC_Cn),
+  GC_RUN(0x16A60, GC_Nd), GC_RUN(0x16A6A, GC_Cn),
+  GC_RUN(0x16A6E, GC_Po), GC_RUN(0x16A70, GC_Lo),
+  GC_RUN(0x16ABF, GC_Cn), GC_RUN(0x16AC0, GC_Nd),
+  GC_RUN(0x16ACA, GC_Cn), GC_RUN(0x16AD0, GC_Lo),
+  GC_RUN(0x16AEE, GC_Cn), GC_RUN(0x16AF0, GC_Mn),
+  GC_RUN(0x16AF5, GC_Po), GC_RUN(0x16AF6, GC_Cn),
+  GC_RUN(0x16B00, GC_Lo), GC_RUN(0x16B30, GC_Mn),
+  GC_RUN(0x16B37, GC_Po), GC_RUN(0x16B3C, GC_So),
+  GC_RUN(0x16B40, GC_Lm), GC_RUN(0x16B44, GC_Po),
+  GC_RUN(0x16B45, GC_So), GC_RUN(0x16B46, GC_Cn),
+  GC_RUN(0x16B50, GC_Nd), GC_RUN(0x16B5A, GC_Cn),
+  GC_RUN(0x16B5B, GC_No), GC_RUN(0x16B62, GC_Cn),
+  GC_RUN(0x16B63, GC_Lo), GC_RUN(0x16B78, GC_Cn),
+  GC_RUN(0x16B7D, GC_Lo), GC_RUN(0x16B90, GC_Cn),
+  GC_RUN(0x16E40, GC_Lu), GC_RUN(0x16E60, GC_Ll),
+  GC_RUN(0x16E80, GC_No), GC_RUN(0x16E97, GC_Po),
+  GC_RUN(0x16E9B, GC_Cn), GC_RUN(0x16F00, GC_Lo),
+  GC_RUN(0x16F4B, GC_Cn), GC_RUN(0x16F4F, GC_Mn),
+  GC_RUN(0x16F50, GC_Lo), GC_RUN(0x16F51, GC_Mc),
+  GC_RUN(0x16F88, GC_Cn), GC_RUN(0x16F8F, GC_Mn),
+  GC_RUN(0x16F93, GC_Lm), GC_RUN(0x16FA0, GC_Cn),
+  GC_RUN(0x16FE0, GC_Lm), GC_RUN(0x16FE2, GC_Po),
+  GC_RUN(0x16FE3, GC_Lm), GC_RUN(0x16FE4, GC_Mn),
+  GC_RUN(0x16FE5, GC_Cn), GC_RUN(0x16FF0, GC_Mc),
+  GC_RUN(0x16FF2, GC_Cn), GC_RUN(0x17000, GC_Lo),
+  GC_RUN(0x187F8, GC_Cn), GC_RUN(0x18800, GC_Lo),
+  GC_RUN(0x18CD6, GC_Cn), GC_RUN(0x18D00, GC_Lo),
+  GC_RUN(0x18D09, GC_Cn), GC_RUN(0x1AFF0, GC_Lm),
+  GC_RUN(0x1AFF4, GC_Cn), GC_RUN(0x1AFF5, GC_Lm),
+  GC_RUN(0x1AFFC, GC_Cn), GC_RUN(0x1AFFD, GC_Lm),
+  GC_RUN(0x1AFFF, GC_Cn), GC_RUN(0x1B000, GC_Lo),
+  GC_RUN(0x1B123, GC_Cn), GC_RUN(0x1B150, GC_Lo),
+  GC_RUN(0x1B153, GC_Cn), GC_RUN(0x1B164, GC_Lo),
+  GC_RUN(0x1B168, GC_Cn), GC_RUN(0x1B170, GC_Lo),
+  GC_RUN(0x1B2FC, GC_Cn), GC_RUN(0x1BC00, GC_Lo),
+  GC_RUN(0x1BC6B, GC_Cn), GC_RUN(0x1BC70, GC_Lo),
+  GC_RUN(0x1BC7D, GC_Cn), GC_RUN(0x1BC80, GC_Lo),
+  GC_RUN(0x1BC89, GC_Cn), GC_RUN(0x1BC90, GC_Lo),
+  GC_RUN(0x1BC9A, GC_Cn), GC_RUN(0x1BC9C, GC_So),
+  GC_RUN(0x1BC9D, GC_Mn), GC_RUN(0x1BC9F, GC_Po),
+  GC_RUN(0x1BCA0, GC_Cf), GC_RUN(0x1BCA4, GC_Cn),
+  GC_RUN(0x1CF00, GC_Mn), GC_RUN(0x1CF2E, GC_Cn),
+  GC_RUN(0x1CF30, GC_Mn), GC_RUN(0x1CF47, GC_Cn),
+  GC_RUN(0x1CF50, GC_So), GC_RUN(0x1CFC4, GC_Cn),
+  GC_RUN(0x1D000, GC_So), GC_RUN(0x1D0F6, GC_Cn),
+  GC_RUN(0x1D100, GC_So), GC_RUN(0x1D127, GC_Cn),
+  GC_RUN(0x1D129, GC_So), GC_RUN(0x1D165, GC_Mc),
+  GC_RUN(0x1D167, GC_Mn), GC_RUN(0x1D16A, GC_So),
+  GC_RUN(0x1D16D, GC_Mc), GC_RUN(0x1D173, GC_Cf),
+  GC_RUN(0x1D17B, GC_Mn), GC_RUN(0x1D183, GC_So),
+  GC_RUN(0x1D185, GC_Mn), GC_RUN(0x1D18C, GC_So),
+  GC_RUN(0x1D1AA, GC_Mn), GC_RUN(0x1D1AE, GC_So),
+  GC_RUN(0x1D1EB, GC_Cn), GC_RUN(0x1D200, GC_So),
+  GC_RUN(0x1D242, GC_Mn), GC_RUN(0x1D245, GC_So),
+  GC_RUN(0x1D246, GC_Cn), GC_RUN(0x1D2E0, GC_No),
+  GC_RUN(0x1D2F4, GC_Cn), GC_RUN(0x1D300, GC_So),
+  GC_RUN(0x1D357, GC_Cn), GC_RUN(0x1D360, GC_No),
+  GC_RUN(0x1D379, GC_Cn), GC_RUN(0x1D400, GC_Lu),
+  GC_RUN(0x1D41A, GC_Ll), GC_RUN(0x1D434, GC_Lu),
+  GC_RUN(0x1D44E, GC_Ll), GC_RUN(0x1D455, GC_Cn),
+  GC_RUN(0x1D456, GC_Ll), GC_RUN(0x1D468, GC_Lu),
+  GC_RUN(0x1D482, GC_Ll), GC_RUN(0x1D49C, GC_Lu),
+  GC_RUN(0x1D49D, GC_Cn), GC_RUN(0x1D49E, GC_Lu),
+  GC_RUN(0x1D4A0, GC_Cn), GC_RUN(0x1D4A2, GC_Lu),
+  GC_RUN(0x1D4A3, GC_Cn), GC_RUN(0x1D4A5, GC_Lu),
+  GC_RUN(0x1D4A7, GC_Cn), GC_RUN(0x1D4A9, GC_Lu),
+  GC_RUN(0x1D4AD, GC_Cn), GC_RUN(0x1D4AE, GC_Lu),
+  GC_RUN(0x1D4B6, GC_Ll), GC_RUN(0x1D4BA, GC_Cn),
+  GC_RUN(0x1D4BB, GC_Ll), GC_RUN(0x1D4BC, GC_Cn),
+  GC_RUN(0x1D4BD, GC_Ll), GC_RUN(0x1D4C4, GC_Cn),
+  GC_RUN(0x1D4C5, GC_Ll), GC_RUN(0x1D4D0, GC_Lu),
+  GC_RUN(0x1D4EA, GC_Ll), GC_RUN(0x1D504, GC_Lu),
+  GC_RUN(0x1D506, GC_Cn), GC_RUN(0x1D507, GC_Lu),
+  GC_RUN(0x1D50B, GC_Cn), GC_RUN(0x1D50D, GC_Lu),
+  GC_RUN(0x1D515, GC_Cn), GC_RUN(0x1D516, GC_Lu),
+  GC_RUN(0x1D51D, GC_Cn), GC_RUN(0x1D51E, GC_Ll),
+  GC_RUN(0x1D538, GC_Lu), GC_RUN(0x1D53A, GC_Cn),
+  GC_RUN(0x1D53B, GC_Lu), GC_RUN(0x1D53F, GC_Cn),
+  GC_RUN(0x1D540, GC_Lu), GC_RUN(0x1D545, GC_Cn),
+  GC_RUN(0x1D546, GC_Lu), GC_RUN(0x1D547, GC_Cn),
+  GC_RUN(0x1D54A, GC_Lu), GC_RUN(0x1D551, GC_Cn),
+  GC_RUN(0x1D552, GC_Ll), GC_RUN(0x1D56C, GC_Lu),
+  GC_RUN(0x1D586, GC_Ll), GC_RUN(0x1D5A0, GC_Lu),
+  GC_RUN(0x1D5BA, GC_Ll), GC_RUN(0x1D5D4, GC_Lu),
+  GC_RUN(0x1D5EE, GC_Ll), GC_RUN(0x1D608, GC_Lu),
+  GC_RUN(0x1D622, GC_Ll), GC_RUN(0x1D63C, GC_Lu),
+  GC_RUN(0x1D656, GC_Ll), GC_RUN(0x1D670, GC_Lu),
+  GC_RUN(0x1D68A, GC_Ll), GC_RUN(0x1D6A6, GC_Cn),
+  GC_RUN(0x1D6A8, GC_Lu), GC_RUN(0x1D6C1, GC_Sm),
+  GC_RUN(0x1D6C2, GC_Ll), GC_RUN(0x1D6DB, GC_Sm),
+  GC_RUN(0x1D6DC, GC_Ll), GC_RUN(0x1D6E2, GC_Lu),
+  GC_RUN(0x1D6FB, GC_Sm), GC_RUN(0x1D6FC, GC_Ll),
+  GC_RUN(0x1D715, GC_Sm), GC_RUN(0x1D716, GC_Ll),
+  GC_RUN(0x1D71C, GC_Lu), GC_RUN(0x1D735, GC_Sm),
+  GC_RUN(0x1D736, GC_Ll), GC_RUN(0x1D74F, GC_Sm),
+  GC_RUN(0x1D750, GC_Ll), GC_RUN(0x1D756, GC_Lu),
+  GC_RUN(0x1D76F, GC_Sm), GC_RUN(0x1D770, GC_Ll),
+  GC_RUN(0x1D789, GC_Sm), GC_RUN(0x1D78A, GC_Ll),
+  GC_RUN(0x1D790, GC_Lu), GC_RUN(0x1D7A9, GC_Sm),
+  GC_RUN(0x1D7AA, GC_Ll), GC_RUN(0x1D7C3, GC_Sm),
+  GC_RUN(0x1D7C4, GC_Ll), GC_RUN(0x1D7CA, GC_Lu),
+  GC_RUN(0x1D7CB, GC_Ll), GC_RUN(0x1D7CC, GC_Cn),
+  GC_RUN(0x1D7CE, GC_Nd), GC_RUN(0x1D800, GC_So),
+  GC_RUN(0x1DA00, GC_Mn), GC_RUN(0x1DA37, GC_So),
+  GC_RUN(0x1DA3B, GC_Mn), GC_RUN(0x1DA6D, GC_So),
+  GC_RUN(0x1DA75, GC_Mn), GC_RUN(0x1DA76, GC_So),
+  GC_RUN(0x1DA84, GC_Mn), GC_RUN(0x1DA85, GC_So),
+  GC_RUN(0x1DA87, GC_Po), GC_RUN(0x1DA8C, GC_Cn),
+  GC_RUN(0x1DA9B, GC_Mn), GC_RUN(0x1DAA0, GC_Cn),
+  GC_RUN(0x1DAA1, GC_Mn), GC_RUN(0x1DAB0, GC_Cn),
+  GC_RUN(0x1DF00, GC_Ll), GC_RUN(0x1DF0A, GC_Lo),
+  GC_RUN(0x1DF0B, GC_Ll), GC_RUN(0x1DF1F, GC_Cn),
+  GC_RUN(0x1E000, GC_Mn), GC_RUN(0x1E007, GC_Cn),
+  GC_RUN(0x1E008, GC_Mn), GC_RUN(0x1E019, GC_Cn),
+  GC_RUN(0x1E01B, GC_Mn), GC_RUN(0x1E022, GC_Cn),
+  GC_RUN(0x1E023, GC_Mn), GC_RUN(0x1E025, GC_Cn),
+  GC_RUN(0x1E026, GC_Mn), GC_RUN(0x1E02B, GC_Cn),
+  GC_RUN(0x1E100, GC_Lo), GC_RUN(0x1E12D, GC_Cn),
+  GC_RUN(0x1E130, GC_Mn), GC_RUN(0x1E137, GC_Lm),
+  GC_RUN(0x1E13E, GC_Cn), GC_RUN(0x1E140, GC_Nd),
+  GC_RUN(0x1E14A, GC_Cn), GC_RUN(0x1E14E, GC_Lo),
+  GC_RUN(0x1E14F, GC_So), GC_RUN(0x1E150, GC_Cn),
+  GC_RUN(0x1E290, GC_Lo), GC_RUN(0x1E2AE, GC_Mn),
+  GC_RUN(0x1E2AF, GC_Cn), GC_RUN(0x1E2C0, GC_Lo),
+  GC_RUN(0x1E2EC, GC_Mn), GC_RUN(0x1E2F0, GC_Nd),
+  GC_RUN(0x1E2FA, GC_Cn), GC_RUN(0x1E2FF, GC_Sc),
+  GC_RUN(0x1E300, GC_Cn), GC_RUN(0x1E7E0, GC_Lo),
+  GC_RUN(0x1E7E7, GC_Cn), GC_RUN(0x1E7E8, GC_Lo),
+  GC_RUN(0x1E7EC, GC_Cn), GC_RUN(0x1E7ED, GC_Lo),
+  GC_RUN(0x1E7EF, GC_Cn), GC_RUN(0x1E7F0, GC_Lo),
+  GC_RUN(0x1E7FF, GC_Cn), GC_RUN(0x1E800, GC_Lo),
+  GC_RUN(0x1E8C5, GC_Cn), GC_RUN(0x1E8C7, GC_No),
+  GC_RUN(0x1E8D0, GC_Mn), GC_RUN(0x1E8D7, GC_Cn),
+  GC_RUN(0x1E900, GC_Lu), GC_RUN(0x1E922, GC_Ll),
+  GC_RUN(0x1E944, GC_Mn), GC_RUN(0x1E94B, GC_Lm),
+  GC_RUN(0x1E94C, GC_Cn), GC_RUN(0x1E950, GC_Nd),
+  GC_RUN(0x1E95A, GC_Cn), GC_RUN(0x1E95E, GC_Po),
+  GC_RUN(0x1E960, GC_Cn), GC_RUN(0x1EC71, GC_No),
+  GC_RUN(0x1ECAC, GC_So), GC_RUN(0x1ECAD, GC_No),
+  GC_RUN(0x1ECB0, GC_Sc), GC_RUN(0x1ECB1, GC_No),
+  GC_RUN(0x1ECB5, GC_Cn), GC_RUN(0x1ED01, GC_No),
+  GC_RUN(0x1ED2E, GC_So), GC_RUN(0x1ED2F, GC_No),
+  GC_RUN(0x1ED3E, GC_Cn), GC_RUN(0x1EE00, GC_Lo),
+  GC_RUN(0x1EE04, GC_Cn), GC_RUN(0x1EE05, GC_Lo),
+  GC_RUN(0x1EE20, GC_Cn), GC_RUN(0x1EE21, GC_Lo),
+  GC_RUN(0x1EE23, GC_Cn), GC_RUN(0x1EE24, GC_Lo),
+  GC_RUN(0x1EE25, GC_Cn), GC_RUN(0x1EE27, GC_Lo),
+  GC_RUN(0x1EE28, GC_Cn), GC_RUN(0x1EE29, GC_Lo),
+  GC_RUN(0x1EE33, GC_Cn), GC_RUN(0x1EE34, GC_Lo),
+  GC_RUN(0x1EE38, GC_Cn), GC_RUN(0x1EE39, GC_Lo),
+  GC_RUN(0x1EE3A, GC_Cn), GC_RUN(0x1EE3B, GC_Lo),
+  GC_RUN(0x1EE3C, GC_Cn), GC_RUN(0x1EE42, GC_Lo),
+  GC_RUN(0x1EE43, GC_Cn), GC_RUN(0x1EE47, GC_Lo),
+  GC_RUN(0x1EE48, GC_Cn), GC_RUN(0x1EE49, GC_Lo),
+  GC_RUN(0x1EE4A, GC_Cn), GC_RUN(0x1EE4B, GC_Lo),
+  GC_RUN(0x1EE4C, GC_Cn), GC_RUN(0x1EE4D, GC_Lo),
+  GC_RUN(0x1EE50, GC_Cn), GC_RUN(0x1EE51, GC_Lo),
+  GC_RUN(0x1EE53, GC_Cn), GC_RUN(0x1EE54, GC_Lo),
+  GC_RUN(0x1EE55, GC_Cn), GC_RUN(0x1EE57, GC_Lo),
+  GC_RUN(0x1EE58, GC_Cn), GC_RUN(0x1EE59, GC_Lo),
+  GC_RUN(0x1EE5A, GC_Cn), GC_RUN(0x1EE5B, GC_Lo),
+  GC_RUN(0x1EE5C, GC_Cn), GC_RUN(0x1EE5D, GC_Lo),
+  GC_RUN(0x1EE5E, GC_Cn), GC_RUN(0x1EE5F, GC_Lo),
+  GC_RUN(0x1EE60, GC_Cn), GC_RUN(0x1EE61, GC_Lo),
+  GC_RUN(0x1EE63, GC_Cn), GC_RUN(0x1EE64, GC_Lo),
+  GC_RUN(0x1EE65, GC_Cn), GC_RUN(0x1EE67, GC_Lo),
+  GC_RUN(0x1EE6B, GC_Cn), GC_RUN(0x1EE6C, GC_Lo),
+  GC_RUN(0x1EE73, GC_Cn), GC_RUN(0x1EE74, GC_Lo),
+  GC_RUN(0x1EE78, GC_Cn), GC_RUN(0x1EE79, GC_Lo),
+  GC_RUN(0x1EE7D, GC_Cn), GC_RUN(0x1EE7E, GC_Lo),
+  GC_RUN(0x1EE7F, GC_Cn), GC_RUN(0x1EE80, GC_Lo),
+  GC_RUN(0x1EE8A, GC_Cn), GC_RUN(0x1EE8B, GC_Lo),
+  GC_RUN(0x1EE9C, GC_Cn), GC_RUN(0x1EEA1, GC_Lo),
+  GC_RUN(0x1EEA4, GC_Cn), GC_RUN(0x1EEA5, GC_Lo),
+  GC_RUN(0x1EEAA, GC_Cn), GC_RUN(0x1EEAB, GC_Lo),
+  GC_RUN(0x1EEBC, GC_Cn), GC_RUN(0x1EEF0, GC_Sm),
+  GC_RUN(0x1EEF2, GC_Cn), GC_RUN(0x1F000, GC_So),
+  GC_RUN(0x1F02C, GC_Cn), GC_RUN(0x1F030, GC_So),
+  GC_RUN(0x1F094, GC_Cn), GC_RUN(0x1F0A0, GC_So),
+  GC_RUN(0x1F0AF, GC_Cn), GC_RUN(0x1F0B1, GC_So),
+  GC_RUN(0x1F0C0, GC_Cn), GC_RUN(0x1F0C1, GC_So),
+  GC_RUN(0x1F0D0, GC_Cn), GC_RUN(0x1F0D1, GC_So),
+  GC_RUN(0x1F0F6, GC_Cn), GC_RUN(0x1F100, GC_No),
+  GC_RUN(0x1F10D, GC_So), GC_RUN(0x1F1AE, GC_Cn),
+  GC_RUN(0x1F1E6, GC_So), GC_RUN(0x1F203, GC_Cn),
+  GC_RUN(0x1F210, GC_So), GC_RUN(0x1F23C, GC_Cn),
+  GC_RUN(0x1F240, GC_So), GC_RUN(0x1F249, GC_Cn),
+  GC_RUN(0x1F250, GC_So), GC_RUN(0x1F252, GC_Cn),
+  GC_RUN(0x1F260, GC_So), GC_RUN(0x1F266, GC_Cn),
+  GC_RUN(0x1F300, GC_So), GC_RUN(0x1F3FB, GC_Sk),
+  GC_RUN(0x1F400, GC_So), GC_RUN(0x1F6D8, GC_Cn),
+  GC_RUN(0x1F6DD, GC_So), GC_RUN(0x1F6ED, GC_Cn),
+  GC_RUN(0x1F6F0, GC_So), GC_RUN(0x1F6FD, GC_Cn),
+  GC_RUN(0x1F700, GC_So), GC_RUN(0x1F774, GC_Cn),
+  GC_RUN(0x1F780, GC_So), GC_RUN(0x1F7D9, GC_Cn),
+  GC_RUN(0x1F7E0, GC_So), GC_RUN(0x1F7EC, GC_Cn),
+  GC_RUN(0x1F7F0, GC_So), GC_RUN(0x1F7F1, GC_Cn),
+  GC_RUN(0x1F800, GC_So), GC_RUN(0x1F80C, GC_Cn),
+  GC_RUN(0x1F810, GC_So), GC_RUN(0x1F848, GC_Cn),
+  GC_RUN(0x1F850, GC_So), GC_RUN(0x1F85A, GC_Cn),
+  GC_RUN(0x1F860, GC_So), GC_RUN(0x1F888, GC_Cn),
+  GC_RUN(0x1F890, GC_So), GC_RUN(0x1F8AE, GC_Cn),
+  GC_RUN(0x1F8B0, GC_So), GC_RUN(0x1F8B2, GC_Cn),
+  GC_RUN(0x1F900, GC_So), GC_RUN(0x1FA54, GC_Cn),
+  GC_RUN(0x1FA60, GC_So), GC_RUN(0x1FA6E, GC_Cn),
+  GC_RUN(0x1FA70, GC_So), GC_RUN(0x1FA75, GC_Cn),
+  GC_RUN(0x1FA78, GC_So), GC_RUN(0x1FA7D, GC_Cn),
+  GC_RUN(0x1FA80, GC_So), GC_RUN(0x1FA87, GC_Cn),
+  GC_RUN(0x1FA90, GC_So), GC_RUN(0x1FAAD, GC_Cn),
+  GC_RUN(0x1FAB0, GC_So), GC_RUN(0x1FABB, GC_Cn),
+  GC_RUN(0x1FAC0, GC_So), GC_RUN(0x1FAC6, GC_Cn),
+  GC_RUN(0x1FAD0, GC_So), GC_RUN(0x1FADA, GC_Cn),
+  GC_RUN(0x1FAE0, GC_So), GC_RUN(0x1FAE8, GC_Cn),
+  GC_RUN(0x1FAF0, GC_So), GC_RUN(0x1FAF7, GC_Cn),
+  GC_RUN(0x1FB00, GC_So), GC_RUN(0x1FB93, GC_Cn),
+  GC_RUN(0x1FB94, GC_So), GC_RUN(0x1FBCB, GC_Cn),
+  GC_RUN(0x1FBF0, GC_Nd), GC_RUN(0x1FBFA, GC_Cn),
+  GC_RUN(0x20000, GC_Lo), GC_RUN(0x2A6E0, GC_Cn),
+  GC_RUN(0x2A700, GC_Lo), GC_RUN(0x2B739, GC_Cn),
+  GC_RUN(0x2B740, GC_Lo), GC_RUN(0x2B81E, GC_Cn),
+  GC_RUN(0x2B820, GC_Lo), GC_RUN(0x2CEA2, GC_Cn),
+  GC_RUN(0x2CEB0, GC_Lo), GC_RUN(0x2EBE1, GC_Cn),
+  GC_RUN(0x2F800, GC_Lo), GC_RUN(0x2FA1E, GC_Cn),
+  GC_RUN(0x30000, GC_Lo), GC_RUN(0x3134B, GC_Cn),
+  GC_RUN(0xE0001, GC_Cf), GC_RUN(0xE0002, GC_Cn),
+  GC_RUN(0xE0020, GC_Cf), GC_RUN(0xE0080, GC_Cn),
+  GC_RUN(0xE0100, GC_Mn), GC_RUN(0xE01F0, GC_Cn),
+  GC_RUN(0xF0000, GC_Co), GC_RUN(0xFFFFE, GC_Cn),
+  GC_RUN(0x100000, GC_Co), GC_RUN(0x10FFFE, GC_Cn)
+};
+
+/* Common case folding (1426 entries): code point, folded code point */
+constexpr u32 FoldSimple[][2] = {
+  {0x0041, 0x0061}, {0x0042, 0x0062}, {0x0043, 0x0063},
+  {0x0044, 0x0064}, {0x0045, 0x0065}, {0x0046, 0x0066},
+  {0x0047, 0x0067}, {0x0048, 0x0068}, {0x0049, 0x0069},
+  {0x004A, 0x006A}, {0x004B, 0x006B}, {0x004C, 0x006C},
+  {0x004D, 0x006D}, {0x004E, 0x006E}, {0x004F, 0x006F},
+  {0x0050, 0x0070}, {0x0051, 0x0071}, {0x0052, 0x0072},
+  {0x0053, 0x0073}, {0x0054, 0x0074}, {0x0055, 0x0075},
+  {0x0056, 0x0076}, {0x0057, 0x0077}, {0x0058, 0x0078},
+  {0x0059, 0x0079}, {0x005A, 0x007A}, {0x00B5, 0x03BC},
+  {0x00C0, 0x00E0}, {0x00C1, 0x00E1}, {0x00C2, 0x00E2},
+  {0x00C3, 0x00E3}, {0x00C4, 0x00E4}, {0x00C5, 0x00E5},
+  {0x00C6, 0x00E6}, {0x00C7, 0x00E7}, {0x00C8, 0x00E8},
+  {0x00C9, 0x00E9}, {0x00CA, 0x00EA}, {0x00CB, 0x00EB},
+  {0x00CC, 0x00EC}, {0x00CD, 0x00ED}, {0x00CE, 0x00EE},
+  {0x00CF, 0x00EF}, {0x00D0, 0x00F0}, {0x00D1, 0x00F1},
+  {0x00D2, 0x00F2}, {0x00D3, 0x00F3}, {0x00D4, 0x00F4},
+  {0x00D5, 0x00F5}, {0x00D6, 0x00F6}, {0x00D8, 0x00F8},
+  {0x00D9, 0x00F9}, {0x00DA, 0x00FA}, {0x00DB, 0x00FB},
+  {0x00DC, 0x00FC}, {0x00DD, 0x00FD}, {0x00DE, 0x00FE},
+  {0x0100, 0x0101}, {0x0102, 0x0103}, {0x0104, 0x0105},
+  {0x0106, 0x0107}, {0x0108, 0x0109}, {0x010A, 0x010B},
+  {0x010C, 0x010D}, {0x010E, 0x010F}, {0x0110, 0x0111},
+  {0x0112, 0x0113}, {0x0114, 0x0115}, {0x0116, 0x0117},
+  {0x0118, 0x0119}, {0x011A, 0x011B}, {0x011C, 0x011D},
+  {0x011E, 0x011F}, {0x0120, 0x0121}, {0x0122, 0x0123},
+  {0x0124, 0x0125}, {0x0126, 0x0127}, {0x0128, 0x0129},
+  {0x012A, 0x012B}, {0x012C, 0x012D}, {0x012E, 0x012F},
+  {0x0132, 0x0133}, {0x0134, 0x0135}, {0x0136, 0x0137},
+  {0x0139, 0x013A}, {0x013B, 0x013C}, {0x013D, 0x013E},
+  {0x013F, 0x0140}, {0x0141, 0x0142}, {0x0143, 0x0144},
+  {0x0145, 0x0146}, {0x0147, 0x0148}, {0x014A, 0x014B},
+  {0x014C, 0x014D}, {0x014E, 0x014F}, {0x0150, 0x0151},
+  {0x0152, 0x0153}, {0x0154, 0x0155}, {0x0156, 0x0157},
+  {0x0158, 0x0159}, {0x015A, 0x015B}, {0x015C, 0x015D},
+  {0x015E, 0x015F}, {0x0160, 0x0161}, {0x0162, 0x0163},
+  {0x0164, 0x0165}, {0x0166, 0x0167}, {0x0168, 0x0169},
+  {0x016A, 0x016B}, {0x016C, 0x016D}, {0x016E, 0x016F},
+  {0x0170, 0x0171}, {0x0172, 0x0173}, {0x0174, 0x0175},
+  {0x0176, 0x0177}, {0x0178, 0x00FF}, {0x0179, 0x017A},
+  {0x017B, 0x017C}, {0x017D, 0x017E}, {0x017F, 0x0073},
+  {0x0181, 0x0253}, {0x0182, 0x0183}, {0x0184, 0x0185},
+  {0x0186, 0x0254}, {0x0187, 0x0188}, {0x0189, 0x0256},
+  {0x018A, 0x0257}, {0x018B, 0x018C}, {0x018E, 0x01DD},
+  {0x018F, 0x0259}, {0x0190, 0x025B}, {0x0191, 0x0192},
+  {0x0193, 0x0260}, {0x0194, 0x0263}, {0x0196, 0x0269},
+  {0x0197, 0x0268}, {0x0198, 0x0199}, {0x019C, 0x026F},
+  {0x019D, 0x0272}, {0x019F, 0x0275}, {0x01A0, 0x01A1},
+  {0x01A2, 0x01A3}, {0x01A4, 0x01A5}, {0x01A6, 0x0280},
+  {0x01A7, 0x01A8}, {0x01A9, 0x0283}, {0x01AC, 0x01AD},
+  {0x01AE, 0x0288}, {0x01AF, 0x01B0}, {0x01B1, 0x028A},
+  {0x01B2, 0x028B}, {0x01B3, 0x01B4}, {0x01B5, 0x01B6},
+  {0x01B7, 0x0292}, {0x01B8, 0x01B9}, {0x01BC, 0x01BD},
+  {0x01C4, 0x01C6}, {0x01C5, 0x01C6}, {0x01C7, 0x01C9},
+  {0x01C8, 0x01C9}, {0x01CA, 0x01CC}, {0x01CB, 0x01CC},
+  {0x01CD, 0x01CE}, {0x01CF, 0x01D0}, {0x01D1, 0x01D2},
+  {0x01D3, 0x01D4}, {0x01D5, 0x01D6}, {0x01D7, 0x01D8},
+  {0x01D9, 0x01DA}, {0x01DB, 0x01DC}, {0x01DE, 0x01DF},
+  {0x01E0, 0x01E1}, {0x01E2, 0x01E3}, {0x01E4, 0x01E5},
+  {0x01E6, 0x01E7}, {0x01E8, 0x01E9}, {0x01EA, 0x01EB},
+  {0x01EC, 0x01ED}, {0x01EE, 0x01EF}, {0x01F1, 0x01F3},
+  {0x01F2, 0x01F3}, {0x01F4, 0x01F5}, {0x01F6, 0x0195},
+  {0x01F7, 0x01BF}, {0x01F8, 0x01F9}, {0x01FA, 0x01FB},
+  {0x01FC, 0x01FD}, {0x01FE, 0x01FF}, {0x0200, 0x0201},
+  {0x0202, 0x0203}, {0x0204, 0x0205}, {0x0206, 0x0207},
+  {0x0208, 0x0209}, {0x020A, 0x020B}, {0x020C, 0x020D},
+  {0x020E, 0x020F}, {0x0210, 0x0211}, {0x0212, 0x0213},
+  {0x0214, 0x0215}, {0x0216, 0x0217}, {0x0218, 0x0219},
+  {0x021A, 0x021B}, {0x021C, 0x021D}, {0x021E, 0x021F},
+  {0x0220, 0x019E}, {0x0222, 0x0223}, {0x0224, 0x0225},
+  {0x0226, 0x0227}, {0x0228, 0x0229}, {0x022A, 0x022B},
+  {0x022C, 0x022D}, {0x022E, 0x022F}, {0x0230, 0x0231},
+  {0x0232, 0x0233}, {0x023A, 0x2C65}, {0x023B, 0x023C},
+  {0x023D, 0x019A}, {0x023E, 0x2C66}, {0x0241, 0x0242},
+  {0x0243, 0x0180}, {0x0244, 0x0289}, {0x0245, 0x028C},
+  {0x0246, 0x0247}, {0x0248, 0x0249}, {0x024A, 0x024B},
+  {0x024C, 0x024D}, {0x024E, 0x024F}, {0x0345, 0x03B9},
+  {0x0370, 0x0371}, {0x0372, 0x0373}, {0x0376, 0x0377},
+  {0x037F, 0x03F3}, {0x0386, 0x03AC}, {0x0388, 0x03AD},
+  {0x0389, 0x03AE}, {0x038A, 0x03AF}, {0x038C, 0x03CC},
+  {0x038E, 0x03CD}, {0x038F, 0x03CE}, {0x0391, 0x03B1},
+  {0x0392, 0x03B2}, {0x0393, 0x03B3}, {0x0394, 0x03B4},
+  {0x0395, 0x03B5}, {0x0396, 0x03B6}, {0x0397, 0x03B7},
+  {0x0398, 0x03B8}, {0x0399, 0x03B9}, {0x039A, 0x03BA},
+  {0x039B, 0x03BB}, {0x039C, 0x03BC}, {0x039D, 0x03BD},
+  {0x039E, 0x03BE}, {0x039F, 0x03BF}, {0x03A0, 0x03C0},
+  {0x03A1, 0x03C1}, {0x03A3, 0x03C3}, {0x03A4, 0x03C4},
+  {0x03A5, 0x03C5}, {0x03A6, 0x03C6}, {0x03A7, 0x03C7},
+  {0x03A8, 0x03C8}, {0x03A9, 0x03C9}, {0x03AA, 0x03CA},
+  {0x03AB, 0x03CB}, {0x03C2, 0x03C3}, {0x03CF, 0x03D7},
+  {0x03D0, 0x03B2}, {0x03D1, 0x03B8}, {0x03D5, 0x03C6},
+  {0x03D6, 0x03C0}, {0x03D8, 0x03D9}, {0x03DA, 0x03DB},
+  {0x03DC, 0x03DD}, {0x03DE, 0x03DF}, {0x03E0, 0x03E1},
+  {0x03E2, 0x03E3}, {0x03E4, 0x03E5}, {0x03E6, 0x03E7},
+  {0x03E8, 0x03E9}, {0x03EA, 0x03EB}, {0x03EC, 0x03ED},
+  {0x03EE, 0x03EF}, {0x03F0, 0x03BA}, {0x03F1, 0x03C1},
+  {0x03F4, 0x03B8}, {0x03F5, 0x03B5}, {0x03F7, 0x03F8},
+  {0x03F9, 0x03F2}, {0x03FA, 0x03FB}, {0x03FD, 0x037B},
+  {0x03FE, 0x037C}, {0x03FF, 0x037D}, {0x0400, 0x0450},
+  {0x0401, 0x0451}, {0x0402, 0x0452}, {0x0403, 0x0453},
+  {0x0404, 0x0454}, {0x0405, 0x0455}, {0x0406, 0x0456},
+  {0x0407, 0x0457}, {0x0408, 0x0458}, {0x0409, 0x0459},
+  {0x040A, 0x045A}, {0x040B, 0x045B}, {0x040C, 0x045C},
+  {0x040D, 0x045D}, {0x040E, 0x045E}, {0x040F, 0x045F},
+  {0x0410, 0x0430}, {0x0411, 0x0431}, {0x0412, 0x0432},
+  {0x0413, 0x0433}, {0x0414, 0x0434}, {0x0415, 0x0435},
+  {0x0416, 0x0436}, {0x0417, 0x0437}, {0x0418, 0x0438},
+  {0x0419, 0x0439}, {0x041A, 0x043A}, {0x041B, 0x043B},
+  {0x041C, 0x043C}, {0x041D, 0x043D}, {0x041E, 0x043E},
+  {0x041F, 0x043F}, {0x0420, 0x0440}, {0x0421, 0x0441},
+  {0x0422, 0x0442}, {0x0423, 0x0443}, {0x0424, 0x0444},
+  {0x0425, 0x0445}, {0x0426, 0x0446}, {0x0427, 0x0447},
+  {0x0428, 0x0448}, {0x0429, 0x0449}, {0x042A, 0x044A},
+  {0x042B, 0x044B}, {0x042C, 0x044C}, {0x042D, 0x044D},
+  {0x042E, 0x044E}, {0x042F, 0x044F}, {0x0460, 0x0461},
+  {0x0462, 0x0463}, {0x0464, 0x0465}, {0x0466, 0x0467},
+  {0x0468, 0x0469}, {0x046A, 0x046B}, {0x046C, 0x046D},
+  {0x046E, 0x046F}, {0x0470, 0x0471}, {0x0472, 0x0473},
+  {0x0474, 0x0475}, {0x0476, 0x0477}, {0x0478, 0x0479},
+  {0x047A, 0x047B}, {0x047C, 0x047D}, {0x047E, 0x047F},
+  {0x0480, 0x0481}, {0x048A, 0x048B}, {0x048C, 0x048D},
+  {0x048E, 0x048F}, {0x0490, 0x0491}, {0x0492, 0x0493},
+  {0x0494, 0x0495}, {0x0496, 0x0497}, {0x0498, 0x0499},
+  {0x049A, 0x049B}, {0x049C, 0x049D}, {0x049E, 0x049F},
+  {0x04A0, 0x04A1}, {0x04A2, 0x04A3}, {0x04A4, 0x04A5},
+  {0x04A6, 0x04A7}, {0x04A8, 0x04A9}, {0x04AA, 0x04AB},
+  {0x04AC, 0x04AD}, {0x04AE, 0x04AF}, {0x04B0, 0x04B1},
+  {0x04B2, 0x04B3}, {0x04B4, 0x04B5}, {0x04B6, 0x04B7},
+  {0x04B8, 0x04B9}, {0x04BA, 0x04BB}, {0x04BC, 0x04BD},
+  {0x04BE, 0x04BF}, {0x04C0, 0x04CF}, {0x04C1, 0x04C2},
+  {0x04C3, 0x04C4}, {0x04C5, 0x04C6}, {0x04C7, 0x04C8},
+  {0x04C9, 0x04CA}, {0x04CB, 0x04CC}, {0x04CD, 0x04CE},
+  {0x04D0, 0x04D1}, {0x04D2, 0x04D3}, {0x04D4, 0x04D5},
+  {0x04D6, 0x04D7}, {0x04D8, 0x04D9}, {0x04DA, 0x04DB},
+  {0x04DC, 0x04DD}, {0x04DE, 0x04DF}, {0x04E0, 0x04E1},
+  {0x04E2, 0x04E3}, {0x04E4, 0x04E5}, {0x04E6, 0x04E7},
+  {0x04E8, 0x04E9}, {0x04EA, 0x04EB}, {0x04EC, 0x04ED},
+  {0x04EE, 0x04EF}, {0x04F0, 0x04F1}, {0x04F2, 0x04F3},
+  {0x04F4, 0x04F5}, {0x04F6, 0x04F7}, {0x04F8, 0x04F9},
+  {0x04FA, 0x04FB}, {0x04FC, 0x04FD}, {0x04FE, 0x04FF},
+  {0x0500, 0x0501}, {0x0502, 0x0503}, {0x0504, 0x0505},
+  {0x0506, 0x0507}, {0x0508, 0x0509}, {0x050A, 0x050B},
+  {0x050C, 0x050D}, {0x050E, 0x050F}, {0x0510, 0x0511},
+  {0x0512, 0x0513}, {0x0514, 0x0515}, {0x0516, 0x0517},
+  {0x0518, 0x0519}, {0x051A, 0x051B}, {0x051C, 0x051D},
+  {0x051E, 0x051F}, {0x0520, 0x0521}, {0x0522, 0x0523},
+  {0x0524, 0x0525}, {0x0526, 0x0527}, {0x0528, 0x0529},
+  {0x052A, 0x052B}, {0x052C, 0x052D}, {0x052E, 0x052F},
+  {0x0531, 0x0561}, {0x0532, 0x0562}, {0x0533, 0x0563},
+  {0x0534, 0x0564}, {0x0535, 0x0565}, {0x0536, 0x0566},
+  {0x0537, 0x0567}, {0x0538, 0x0568}, {0x0539, 0x0569},
+  {0x053A, 0x056A}, {0x053B, 0x056B}, {0x053C, 0x056C},
+  {0x053D, 0x056D}, {0x053E, 0x056E}, {0x053F, 0x056F},
+  {0x0540, 0x0570}, {0x0541, 0x0571}, {0x0542, 0x0572},
+  {0x0543, 0x0573}, {0x0544, 0x0574}, {0x0545, 0x0575},
+  {0x0546, 0x0576}, {0x0547, 0x0577}, {0x0548, 0x0578},
+  {0x0549, 0x0579}, {0x054A, 0x057A}, {0x054B, 0x057B},
+  {0x054C, 0x057C}, {0x054D, 0x057D}, {0x054E, 0x057E},
+  {0x054F, 0x057F}, {0x0550, 0x0580}, {0x0551, 0x0581},
+  {0x0552, 0x0582}, {0x0553, 0x0583}, {0x0554, 0x0584},
+  {0x0555, 0x0585}, {0x0556, 0x0586}, {0x10A0, 0x2D00},
+  {0x10A1, 0x2D01}, {0x10A2, 0x2D02}, {0x10A3, 0x2D03},
+  {0x10A4, 0x2D04}, {0x10A5, 0x2D05}, {0x10A6, 0x2D06},
+  {0x10A7, 0x2D07}, {0x10A8, 0x2D08}, {0x10A9, 0x2D09},
+  {0x10AA, 0x2D0A}, {0x10AB, 0x2D0B}, {0x10AC, 0x2D0C},
+  {0x10AD, 0x2D0D}, {0x10AE, 0x2D0E}, {0x10AF, 0x2D0F},
+  {0x10B0, 0x2D10}, {0x10B1, 0x2D11}, {0x10B2, 0x2D12},
+  {0x10B3, 0x2D13}, {0x10B4, 0x2D14}, {0x10B5, 0x2D15},
+  {0x10B6, 0x2D16}, {0x10B7, 0x2D17}, {0x10B8, 0x2D18},
+  {0x10B9, 0x2D19}, {0x10BA, 0x2D1A}, {0x10BB, 0x2D1B},
+  {0x10BC, 0x2D1C}, {0x10BD, 0x2D1D}, {0x10BE, 0x2D1E},
+  {0x10BF, 0x2D1F}, {0x10C0, 0x2D20}, {0x10C1, 0x2D21},
+  {0x10C2, 0x2D22}, {0x10C3, 0x2D23}, {0x10C4, 0x2D24},
+  {0x10C5, 0x2D25}, {0x10C7, 0x2D27}, {0x10CD, 0x2D2D},
+  {0x13F8, 0x13F0}, {0x13F9, 0x13F1}, {0x13FA, 0x13F2},
+  {0x13FB, 0x13F3}, {0x13FC, 0x13F4}, {0x13FD, 0x13F5},
+  {0x1C80, 0x0432}, {0x1C81, 0x0434}, {0x1C82, 0x043E},
+  {0x1C83, 0x0441}, {0x1C84, 0x0442}, {0x1C85, 0x0442},
+  {0x1C86, 0x044A}, {0x1C87, 0x0463}, {0x1C88, 0xA64B},
+  {0x1C90, 0x10D0}, {0x1C91, 0x10D1}, {0x1C92, 0x10D2},
+  {0x1C93, 0x10D3}, {0x1C94, 0x10D4}, {0x1C95, 0x10D5},
+  {0x1C96, 0x10D6}, {0x1C97, 0x10D7}, {0x1C98, 0x10D8},
+  {0x1C99, 0x10D9}, {0x1C9A, 0x10DA}, {0x1C9B, 0x10DB},
+  {0x1C9C, 0x10DC}, {0x1C9D, 0x10DD}, {0x1C9E, 0x10DE},
+  {0x1C9F, 0x10DF}, {0x1CA0, 0x10E0}, {0x1CA1, 0x10E1},
+  {0x1CA2, 0x10E2}, {0x1CA3, 0x10E3}, {0x1CA4, 0x10E4},
+  {0x1CA5, 0x10E5}, {0x1CA6, 0x10E6}, {0x1CA7, 0x10E7},
+  {0x1CA8, 0x10E8}, {0x1CA9, 0x10E9}, {0x1CAA, 0x10EA},
+  {0x1CAB, 0x10EB}, {0x1CAC, 0x10EC}, {0x1CAD, 0x10ED},
+  {0x1CAE, 0x10EE}, {0x1CAF, 0x10EF}, {0x1CB0, 0x10F0},
+  {0x1CB1, 0x10F1}, {0x1CB2, 0x10F2}, {0x1CB3, 0x10F3},
+  {0x1CB4, 0x10F4}, {0x1CB5, 0x10F5}, {0x1CB6, 0x10F6},
+  {0x1CB7, 0x10F7}, {0x1CB8, 0x10F8}, {0x1CB9, 0x10F9},
+  {0x1CBA, 0x10FA}, {0x1CBD, 0x10FD}, {0x1CBE, 0x10FE},
+  {0x1CBF, 0x10FF}, {0x1E00, 0x1E01}, {0x1E02, 0x1E03},
+  {0x1E04, 0x1E05}, {0x1E06, 0x1E07}, {0x1E08, 0x1E09},
+  {0x1E0A, 0x1E0B}, {0x1E0C, 0x1E0D}, {0x1E0E, 0x1E0F},
+  {0x1E10, 0x1E11}, {0x1E12, 0x1E13}, {0x1E14, 0x1E15},
+  {0x1E16, 0x1E17}, {0x1E18, 0x1E19}, {0x1E1A, 0x1E1B},
+  {0x1E1C, 0x1E1D}, {0x1E1E, 0x1E1F}, {0x1E20, 0x1E21},
+  {0x1E22, 0x1E23}, {0x1E24, 0x1E25}, {0x1E26, 0x1E27},
+  {0x1E28, 0x1E29}, {0x1E2A, 0x1E2B}, {0x1E2C, 0x1E2D},
+  {0x1E2E, 0x1E2F}, {0x1E30, 0x1E31}, {0x1E32, 0x1E33},
+  {0x1E34, 0x1E35}, {0x1E36, 0x1E37}, {0x1E38, 0x1E39},
+  {0x1E3A, 0x1E3B}, {0x1E3C, 0x1E3D}, {0x1E3E, 0x1E3F},
+  {0x1E40, 0x1E41}, {0x1E42, 0x1E43}, {0x1E44, 0x1E45},
+  {0x1E46, 0x1E47}, {0x1E48, 0x1E49}, {0x1E4A, 0x1E4B},
+  {0x1E4C, 0x1E4D}, {0x1E4E, 0x1E4F}, {0x1E50, 0x1E51},
+  {0x1E52, 0x1E53}, {0x1E54, 0x1E55}, {0x1E56, 0x1E57},
+  {0x1E58, 0x1E59}, {0x1E5A, 0x1E5B}, {0x1E5C, 0x1E5D},
+  {0x1E5E, 0x1E5F}, {0x1E60, 0x1E61}, {0x1E62, 0x1E63},
+  {0x1E64, 0x1E65}, {0x1E66, 0x1E67}, {0x1E68, 0x1E69},
+  {0x1E6A, 0x1E6B}, {0x1E6C, 0x1E6D}, {0x1E6E, 0x1E6F},
+  {0x1E70, 0x1E71}, {0x1E72, 0x1E73}, {0x1E74, 0x1E75},
+  {0x1E76, 0x1E77}, {0x1E78, 0x1E79}, {0x1E7A, 0x1E7B},
+  {0x1E7C, 0x1E7D}, {0x1E7E, 0x1E7F}, {0x1E80, 0x1E81},
+  {0x1E82, 0x1E83}, {0x1E84, 0x1E85}, {0x1E86, 0x1E87},
+  {0x1E88, 0x1E89}, {0x1E8A, 0x1E8B}, {0x1E8C, 0x1E8D},
+  {0x1E8E, 0x1E8F}, {0x1E90, 0x1E91}, {0x1E92, 0x1E93},
+  {0x1E94, 0x1E95}, {0x1E9B, 0x1E61}, {0x1EA0, 0x1EA1},
+  {0x1EA2, 0x1EA3}, {0x1EA4, 0x1EA5}, {0x1EA6, 0x1EA7},
+  {0x1EA8, 0x1EA9}, {0x1EAA, 0x1EAB}, {0x1EAC, 0x1EAD},
+  {0x1EAE, 0x1EAF}, {0x1EB0, 0x1EB1}, {0x1EB2, 0x1EB3},
+  {0x1EB4, 0x1EB5}, {0x1EB6, 0x1EB7}, {0x1EB8, 0x1EB9},
+  {0x1EBA, 0x1EBB}, {0x1EBC, 0x1EBD}, {0x1EBE, 0x1EBF},
+  {0x1EC0, 0x1EC1}, {0x1EC2, 0x1EC3}, {0x1EC4, 0x1EC5},
+  {0x1EC6, 0x1EC7}, {0x1EC8, 0x1EC9}, {0x1ECA, 0x1ECB},
+  {0x1ECC, 0x1ECD}, {0x1ECE, 0x1ECF}, {0x1ED0, 0x1ED1},
+  {0x1ED2, 0x1ED3}, {0x1ED4, 0x1ED5}, {0x1ED6, 0x1ED7},
+  {0x1ED8, 0x1ED9}, {0x1EDA, 0x1EDB}, {0x1EDC, 0x1EDD},
+  {0x1EDE, 0x1EDF}, {0x1EE0, 0x1EE1}, {0x1EE2, 0x1EE3},
+  {0x1EE4, 0x1EE5}, {0x1EE6, 0x1EE7}, {0x1EE8, 0x1EE9},
+  {0x1EEA, 0x1EEB}, {0x1EEC, 0x1EED}, {0x1EEE, 0x1EEF},
+  {0x1EF0, 0x1EF1}, {0x1EF2, 0x1EF3}, {0x1EF4, 0x1EF5},
+  {0x1EF6, 0x1EF7}, {0x1EF8, 0x1EF9}, {0x1EFA, 0x1EFB},
+  {0x1EFC, 0x1EFD}, {0x1EFE, 0x1EFF}, {0x1F08, 0x1F00},
+  {0x1F09, 0x1F01}, {0x1F0A, 0x1F02}, {0x1F0B, 0x1F03},
+  {0x1F0C, 0x1F04}, {0x1F0D, 0x1F05}, {0x1F0E, 0x1F06},
+  {0x1F0F, 0x1F07}, {0x1F18, 0x1F10}, {0x1F19, 0x1F11},
+  {0x1F1A, 0x1F12}, {0x1F1B, 0x1F13}, {0x1F1C, 0x1F14},
+  {0x1F1D, 0x1F15}, {0x1F28, 0x1F20}, {0x1F29, 0x1F21},
+  {0x1F2A, 0x1F22}, {0x1F2B, 0x1F23}, {0x1F2C, 0x1F24},
+  {0x1F2D, 0x1F25}, {0x1F2E, 0x1F26}, {0x1F2F, 0x1F27},
+  {0x1F38, 0x1F30}, {0x1F39, 0x1F31}, {0x1F3A, 0x1F32},
+  {0x1F3B, 0x1F33}, {0x1F3C, 0x1F34}, {0x1F3D, 0x1F35},
+  {0x1F3E, 0x1F36}, {0x1F3F, 0x1F37}, {0x1F48, 0x1F40},
+  {0x1F49, 0x1F41}, {0x1F4A, 0x1F42}, {0x1F4B, 0x1F43},
+  {0x1F4C, 0x1F44}, {0x1F4D, 0x1F45}, {0x1F59, 0x1F51},
+  {0x1F5B, 0x1F53}, {0x1F5D, 0x1F55}, {0x1F5F, 0x1F57},
+  {0x1F68, 0x1F60}, {0x1F69, 0x1F61}, {0x1F6A, 0x1F62},
+  {0x1F6B, 0x1F63}, {0x1F6C, 0x1F64}, {0x1F6D, 0x1F65},
+  {0x1F6E, 0x1F66}, {0x1F6F, 0x1F67}, {0x1FB8, 0x1FB0},
+  {0x1FB9, 0x1FB1}, {0x1FBA, 0x1F70}, {0x1FBB, 0x1F71},
+  {0x1FBE, 0x03B9}, {0x1FC8, 0x1F72}, {0x1FC9, 0x1F73},
+  {0x1FCA, 0x1F74}, {0x1FCB, 0x1F75}, {0x1FD8, 0x1FD0},
+  {0x1FD9, 0x1FD1}, {0x1FDA, 0x1F76}, {0x1FDB, 0x1F77},
+  {0x1FE8, 0x1FE0}, {0x1FE9, 0x1FE1}, {0x1FEA, 0x1F7A},
+  {0x1FEB, 0x1F7B}, {0x1FEC, 0x1FE5}, {0x1FF8, 0x1F78},
+  {0x1FF9, 0x1F79}, {0x1FFA, 0x1F7C}, {0x1FFB, 0x1F7D},
+  {0x2126, 0x03C9}, {0x212A, 0x006B}, {0x212B, 0x00E5},
+  {0x2132, 0x214E}, {0x2160, 0x2170}, {0x2161, 0x2171},
+  {0x2162, 0x2172}, {0x2163, 0x2173}, {0x2164, 0x2174},
+  {0x2165, 0x2175}, {0x2166, 0x2176}, {0x2167, 0x2177},
+  {0x2168, 0x2178}, {0x2169, 0x2179}, {0x216A, 0x217A},
+  {0x216B, 0x217B}, {0x216C, 0x217C}, {0x216D, 0x217D},
+  {0x216E, 0x217E}, {0x216F, 0x217F}, {0x2183, 0x2184},
+  {0x24B6, 0x24D0}, {0x24B7, 0x24D1}, {0x24B8, 0x24D2},
+  {0x24B9, 0x24D3}, {0x24BA, 0x24D4}, {0x24BB, 0x24D5},
+  {0x24BC, 0x24D6}, {0x24BD, 0x24D7}, {0x24BE, 0x24D8},
+  {0x24BF, 0x24D9}, {0x24C0, 0x24DA}, {0x24C1, 0x24DB},
+  {0x24C2, 0x24DC}, {0x24C3, 0x24DD}, {0x24C4, 0x24DE},
+  {0x24C5, 0x24DF}, {0x24C6, 0x24E0}, {0x24C7, 0x24E1},
+  {0x24C8, 0x24E2}, {0x24C9, 0x24E3}, {0x24CA, 0x24E4},
+  {0x24CB, 0x24E5}, {0x24CC, 0x24E6}, {0x24CD, 0x24E7},
+  {0x24CE, 0x24E8}, {0x24CF, 0x24E9}, {0x2C00, 0x2C30},
+  {0x2C01, 0x2C31}, {0x2C02, 0x2C32}, {0x2C03, 0x2C33},
+  {0x2C04, 0x2C34}, {0x2C05, 0x2C35}, {0x2C06, 0x2C36},
+  {0x2C07, 0x2C37}, {0x2C08, 0x2C38}, {0x2C09, 0x2C39},
+  {0x2C0A, 0x2C3A}, {0x2C0B, 0x2C3B}, {0x2C0C, 0x2C3C},
+  {0x2C0D, 0x2C3D}, {0x2C0E, 0x2C3E}, {0x2C0F, 0x2C3F},
+  {0x2C10, 0x2C40}, {0x2C11, 0x2C41}, {0x2C12, 0x2C42},
+  {0x2C13, 0x2C43}, {0x2C14, 0x2C44}, {0x2C15, 0x2C45},
+  {0x2C16, 0x2C46}, {0x2C17, 0x2C47}, {0x2C18, 0x2C48},
+  {0x2C19, 0x2C49}, {0x2C1A, 0x2C4A}, {0x2C1B, 0x2C4B},
+  {0x2C1C, 0x2C4C}, {0x2C1D, 0x2C4D}, {0x2C1E, 0x2C4E},
+  {0x2C1F, 0x2C4F}, {0x2C20, 0x2C50}, {0x2C21, 0x2C51},
+  {0x2C22, 0x2C52}, {0x2C23, 0x2C53}, {0x2C24, 0x2C54},
+  {0x2C25, 0x2C55}, {0x2C26, 0x2C56}, {0x2C27, 0x2C57},
+  {0x2C28, 0x2C58}, {0x2C29, 0x2C59}, {0x2C2A, 0x2C5A},
+  {0x2C2B, 0x2C5B}, {0x2C2C, 0x2C5C}, {0x2C2D, 0x2C5D},
+  {0x2C2E, 0x2C5E}, {0x2C2F, 0x2C5F}, {0x2C60, 0x2C61},
+  {0x2C62, 0x026B}, {0x2C63, 0x1D7D}, {0x2C64, 0x027D},
+  {0x2C67, 0x2C68}, {0x2C69, 0x2C6A}, {0x2C6B, 0x2C6C},
+  {0x2C6D, 0x0251}, {0x2C6E, 0x0271}, {0x2C6F, 0x0250},
+  {0x2C70, 0x0252}, {0x2C72, 0x2C73}, {0x2C75, 0x2C76},
+  {0x2C7E, 0x023F}, {0x2C7F, 0x0240}, {0x2C80, 0x2C81},
+  {0x2C82, 0x2C83}, {0x2C84, 0x2C85}, {0x2C86, 0x2C87},
+  {0x2C88, 0x2C89}, {0x2C8A, 0x2C8B}, {0x2C8C, 0x2C8D},
+  {0x2C8E, 0x2C8F}, {0x2C90, 0x2C91}, {0x2C92, 0x2C93},
+  {0x2C94, 0x2C95}, {0x2C96, 0x2C97}, {0x2C98, 0x2C99},
+  {0x2C9A, 0x2C9B}, {0x2C9C, 0x2C9D}, {0x2C9E, 0x2C9F},
+  {0x2CA0, 0x2CA1}, {0x2CA2, 0x2CA3}, {0x2CA4, 0x2CA5},
+  {0x2CA6, 0x2CA7}, {0x2CA8, 0x2CA9}, {0x2CAA, 0x2CAB},
+  {0x2CAC, 0x2CAD}, {0x2CAE, 0x2CAF}, {0x2CB0, 0x2CB1},
+  {0x2CB2, 0x2CB3}, {0x2CB4, 0x2CB5}, {0x2CB6, 0x2CB7},
+  {0x2CB8, 0x2CB9}, {0x2CBA, 0x2CBB}, {0x2CBC, 0x2CBD},
+  {0x2CBE, 0x2CBF}, {0x2CC0, 0x2CC1}, {0x2CC2, 0x2CC3},
+  {0x2CC4, 0x2CC5}, {0x2CC6, 0x2CC7}, {0x2CC8, 0x2CC9},
+  {0x2CCA, 0x2CCB}, {0x2CCC, 0x2CCD}, {0x2CCE, 0x2CCF},
+  {0x2CD0, 0x2CD1}, {0x2CD2, 0x2CD3}, {0x2CD4, 0x2CD5},
+  {0x2CD6, 0x2CD7}, {0x2CD8, 0x2CD9}, {0x2CDA, 0x2CDB},
+  {0x2CDC, 0x2CDD}, {0x2CDE, 0x2CDF}, {0x2CE0, 0x2CE1},
+  {0x2CE2, 0x2CE3}, {0x2CEB, 0x2CEC}, {0x2CED, 0x2CEE},
+  {0x2CF2, 0x2CF3}, {0xA640, 0xA641}, {0xA642, 0xA643},
+  {0xA644, 0xA645}, {0xA646, 0xA647}, {0xA648, 0xA649},
+  {0xA64A, 0xA64B}, {0xA64C, 0xA64D}, {0xA64E, 0xA64F},
+  {0xA650, 0xA651}, {0xA652, 0xA653}, {0xA654, 0xA655},
+  {0xA656, 0xA657}, {0xA658, 0xA659}, {0xA65A, 0xA65B},
+  {0xA65C, 0xA65D}, {0xA65E, 0xA65F}, {0xA660, 0xA661},
+  {0xA662, 0xA663}, {0xA664, 0xA665}, {0xA666, 0xA667},
+  {0xA668, 0xA669}, {0xA66A, 0xA66B}, {0xA66C, 0xA66D},
+  {0xA680, 0xA681}, {0xA682, 0xA683}, {0xA684, 0xA685},
+  {0xA686, 0xA687}, {0xA688, 0xA689}, {0xA68A, 0xA68B},
+  {0xA68C, 0xA68D}, {0xA68E, 0xA68F}, {0xA690, 0xA691},
+  {0xA692, 0xA693}, {0xA694, 0xA695}, {0xA696, 0xA697},
+  {0xA698, 0xA699}, {0xA69A, 0xA69B}, {0xA722, 0xA723},
+  {0xA724, 0xA725}, {0xA726, 0xA727}, {0xA728, 0xA729},
+  {0xA72A, 0xA72B}, {0xA72C, 0xA72D}, {0xA72E, 0xA72F},
+  {0xA732, 0xA733}, {0xA734, 0xA735}, {0xA736, 0xA737},
+  {0xA738, 0xA739}, {0xA73A, 0xA73B}, {0xA73C, 0xA73D},
+  {0xA73E, 0xA73F}, {0xA740, 0xA741}, {0xA742, 0xA743},
+  {0xA744, 0xA745}, {0xA746, 0xA747}, {0xA748, 0xA749},
+  {0xA74A, 0xA74B}, {0xA74C, 0xA74D}, {0xA74E, 0xA74F},
+  {0xA750, 0xA751}, {0xA752, 0xA753}, {0xA754, 0xA755},
+  {0xA756, 0xA757}, {0xA758, 0xA759}, {0xA75A, 0xA75B},
+  {0xA75C, 0xA75D}, {0xA75E, 0xA75F}, {0xA760, 0xA761},
+  {0xA762, 0xA763}, {0xA764, 0xA765}, {0xA766, 0xA767},
+  {0xA768, 0xA769}, {0xA76A, 0xA76B}, {0xA76C, 0xA76D},
+  {0xA76E, 0xA76F}, {0xA779, 0xA77A}, {0xA77B, 0xA77C},
+  {0xA77D, 0x1D79}, {0xA77E, 0xA77F}, {0xA780, 0xA781},
+  {0xA782, 0xA783}, {0xA784, 0xA785}, {0xA786, 0xA787},
+  {0xA78B, 0xA78C}, {0xA78D, 0x0265}, {0xA790, 0xA791},
+  {0xA792, 0xA793}, {0xA796, 0xA797}, {0xA798, 0xA799},
+  {0xA79A, 0xA79B}, {0xA79C, 0xA79D}, {0xA79E, 0xA79F},
+  {0xA7A0, 0xA7A1}, {0xA7A2, 0xA7A3}, {0xA7A4, 0xA7A5},
+  {0xA7A6, 0xA7A7}, {0xA7A8, 0xA7A9}, {0xA7AA, 0x0266},
+  {0xA7AB, 0x025C}, {0xA7AC, 0x0261}, {0xA7AD, 0x026C},
+  {0xA7AE, 0x026A}, {0xA7B0, 0x029E}, {0xA7B1, 0x0287},
+  {0xA7B2, 0x029D}, {0xA7B3, 0xAB53}, {0xA7B4, 0xA7B5},
+  {0xA7B6, 0xA7B7}, {0xA7B8, 0xA7B9}, {0xA7BA, 0xA7BB},
+  {0xA7BC, 0xA7BD}, {0xA7BE, 0xA7BF}, {0xA7C0, 0xA7C1},
+  {0xA7C2, 0xA7C3}, {0xA7C4, 0xA794}, {0xA7C5, 0x0282},
+  {0xA7C6, 0x1D8E}, {0xA7C7, 0xA7C8}, {0xA7C9, 0xA7CA},
+  {0xA7D0, 0xA7D1}, {0xA7D6, 0xA7D7}, {0xA7D8, 0xA7D9},
+  {0xA7F5, 0xA7F6}, {0xAB70, 0x13A0}, {0xAB71, 0x13A1},
+  {0xAB72, 0x13A2}, {0xAB73, 0x13A3}, {0xAB74, 0x13A4},
+  {0xAB75, 0x13A5}, {0xAB76, 0x13A6}, {0xAB77, 0x13A7},
+  {0xAB78, 0x13A8}, {0xAB79, 0x13A9}, {0xAB7A, 0x13AA},
+  {0xAB7B, 0x13AB}, {0xAB7C, 0x13AC}, {0xAB7D, 0x13AD},
+  {0xAB7E, 0x13AE}, {0xAB7F, 0x13AF}, {0xAB80, 0x13B0},
+  {0xAB81, 0x13B1}, {0xAB82, 0x13B2}, {0xAB83, 0x13B3},
+  {0xAB84, 0x13B4}, {0xAB85, 0x13B5}, {0xAB86, 0x13B6},
+  {0xAB87, 0x13B7}, {0xAB88, 0x13B8}, {0xAB89, 0x13B9},
+  {0xAB8A, 0x13BA}, {0xAB8B, 0x13BB}, {0xAB8C, 0x13BC},
+  {0xAB8D, 0x13BD}, {0xAB8E, 0x13BE}, {0xAB8F, 0x13BF},
+  {0xAB90, 0x13C0}, {0xAB91, 0x13C1}, {0xAB92, 0x13C2},
+  {0xAB93, 0x13C3}, {0xAB94, 0x13C4}, {0xAB95, 0x13C5},
+  {0xAB96, 0x13C6}, {0xAB97, 0x13C7}, {0xAB98, 0x13C8},
+  {0xAB99, 0x13C9}, {0xAB9A, 0x13CA}, {0xAB9B, 0x13CB},
+  {0xAB9C, 0x13CC}, {0xAB9D, 0x13CD}, {0xAB9E, 0x13CE},
+  {0xAB9F, 0x13CF}, {0xABA0, 0x13D0}, {0xABA1, 0x13D1},
+  {0xABA2, 0x13D2}, {0xABA3, 0x13D3}, {0xABA4, 0x13D4},
+  {0xABA5, 0x13D5}, {0xABA6, 0x13D6}, {0xABA7, 0x13D7},
+  {0xABA8, 0x13D8}, {0xABA9, 0x13D9}, {0xABAA, 0x13DA},
+  {0xABAB, 0x13DB}, {0xABAC, 0x13DC}, {0xABAD, 0x13DD},
+  {0xABAE, 0x13DE}, {0xABAF, 0x13DF}, {0xABB0, 0x13E0},
+  {0xABB1, 0x13E1}, {0xABB2, 0x13E2}, {0xABB3, 0x13E3},
+  {0xABB4, 0x13E4}, {0xABB5, 0x13E5}, {0xABB6, 0x13E6},
+  {0xABB7, 0x13E7}, {0xABB8, 0x13E8}, {0xABB9, 0x13E9},
+  {0xABBA, 0x13EA}, {0xABBB, 0x13EB}, {0xABBC, 0x13EC},
+  {0xABBD, 0x13ED}, {0xABBE, 0x13EE}, {0xABBF, 0x13EF},
+  {0xFF21, 0xFF41}, {0xFF22, 0xFF42}, {0xFF23, 0xFF43},
+  {0xFF24, 0xFF44}, {0xFF25, 0xFF45}, {0xFF26, 0xFF46},
+  {0xFF27, 0xFF47}, {0xFF28, 0xFF48}, {0xFF29, 0xFF49},
+  {0xFF2A, 0xFF4A}, {0xFF2B, 0xFF4B}, {0xFF2C, 0xFF4C},
+  {0xFF2D, 0xFF4D}, {0xFF2E, 0xFF4E}, {0xFF2F, 0xFF4F},
+  {0xFF30, 0xFF50}, {0xFF31, 0xFF51}, {0xFF32, 0xFF52},
+  {0xFF33, 0xFF53}, {0xFF34, 0xFF54}, {0xFF35, 0xFF55},
+  {0xFF36, 0xFF56}, {0xFF37, 0xFF57}, {0xFF38, 0xFF58},
+  {0xFF39, 0xFF59}, {0xFF3A, 0xFF5A}, {0x10400, 0x10428},
+  {0x10401, 0x10429}, {0x10402, 0x1042A}, {0x10403, 0x1042B},
+  {0x10404, 0x1042C}, {0x10405, 0x1042D}, {0x10406, 0x1042E},
+  {0x10407, 0x1042F}, {0x10408, 0x10430}, {0x10409, 0x10431},
+  {0x1040A, 0x10432}, {0x1040B, 0x10433}, {0x1040C, 0x10434},
+  {0x1040D, 0x10435}, {0x1040E, 0x10436}, {0x1040F, 0x10437},
+  {0x10410, 0x10438}, {0x10411, 0x10439}, {0x10412, 0x1043A},
+  {0x10413, 0x1043B}, {0x10414, 0x1043C}, {0x10415, 0x1043D},
+  {0x10416, 0x1043E}, {0x10417, 0x1043F}, {0x10418, 0x10440},
+  {0x10419, 0x10441}, {0x1041A, 0x10442}, {0x1041B, 0x10443},
+  {0x1041C, 0x10444}, {0x1041D, 0x10445}, {0x1041E, 0x10446},
+  {0x1041F, 0x10447}, {0x10420, 0x10448}, {0x10421, 0x10449},
+  {0x10422, 0x1044A}, {0x10423, 0x1044B}, {0x10424, 0x1044C},
+  {0x10425, 0x1044D}, {0x10426, 0x1044E}, {0x10427, 0x1044F},
+  {0x104B0, 0x104D8}, {0x104B1, 0x104D9}, {0x104B2, 0x104DA},
+  {0x104B3, 0x104DB}, {0x104B4, 0x104DC}, {0x104B5, 0x104DD},
+  {0x104B6, 0x104DE}, {0x104B7, 0x104DF}, {0x104B8, 0x104E0},
+  {0x104B9, 0x104E1}, {0x104BA, 0x104E2}, {0x104BB, 0x104E3},
+  {0x104BC, 0x104E4}, {0x104BD, 0x104E5}, {0x104BE, 0x104E6},
+  {0x104BF, 0x104E7}, {0x104C0, 0x104E8}, {0x104C1, 0x104E9},
+  {0x104C2, 0x104EA}, {0x104C3, 0x104EB}, {0x104C4, 0x104EC},
+  {0x104C5, 0x104ED}, {0x104C6, 0x104EE}, {0x104C7, 0x104EF},
+  {0x104C8, 0x104F0}, {0x104C9, 0x104F1}, {0x104CA, 0x104F2},
+  {0x104CB, 0x104F3}, {0x104CC, 0x104F4}, {0x104CD, 0x104F5},
+  {0x104CE, 0x104F6}, {0x104CF, 0x104F7}, {0x104D0, 0x104F8},
+  {0x104D1, 0x104F9}, {0x104D2, 0x104FA}, {0x104D3, 0x104FB},
+  {0x10570, 0x10597}, {0x10571, 0x10598}, {0x10572, 0x10599},
+  {0x10573, 0x1059A}, {0x10574, 0x1059B}, {0x10575, 0x1059C},
+  {0x10576, 0x1059D}, {0x10577, 0x1059E}, {0x10578, 0x1059F},
+  {0x10579, 0x105A0}, {0x1057A, 0x105A1}, {0x1057C, 0x105A3},
+  {0x1057D, 0x105A4}, {0x1057E, 0x105A5}, {0x1057F, 0x105A6},
+  {0x10580, 0x105A7}, {0x10581, 0x105A8}, {0x10582, 0x105A9},
+  {0x10583, 0x105AA}, {0x10584, 0x105AB}, {0x10585, 0x105AC},
+  {0x10586, 0x105AD}, {0x10587, 0x105AE}, {0x10588, 0x105AF},
+  {0x10589, 0x105B0}, {0x1058A, 0x105B1}, {0x1058C, 0x105B3},
+  {0x1058D, 0x105B4}, {0x1058E, 0x105B5}, {0x1058F, 0x105B6},
+  {0x10590, 0x105B7}, {0x10591, 0x105B8}, {0x10592, 0x105B9},
+  {0x10594, 0x105BB}, {0x10595, 0x105BC}, {0x10C80, 0x10CC0},
+  {0x10C81, 0x10CC1}, {0x10C82, 0x10CC2}, {0x10C83, 0x10CC3},
+  {0x10C84, 0x10CC4}, {0x10C85, 0x10CC5}, {0x10C86, 0x10CC6},
+  {0x10C87, 0x10CC7}, {0x10C88, 0x10CC8}, {0x10C89, 0x10CC9},
+  {0x10C8A, 0x10CCA}, {0x10C8B, 0x10CCB}, {0x10C8C, 0x10CCC},
+  {0x10C8D, 0x10CCD}, {0x10C8E, 0x10CCE}, {0x10C8F, 0x10CCF},
+  {0x10C90, 0x10CD0}, {0x10C91, 0x10CD1}, {0x10C92, 0x10CD2},
+  {0x10C93, 0x10CD3}, {0x10C94, 0x10CD4}, {0x10C95, 0x10CD5},
+  {0x10C96, 0x10CD6}, {0x10C97, 0x10CD7}, {0x10C98, 0x10CD8},
+  {0x10C99, 0x10CD9}, {0x10C9A, 0x10CDA}, {0x10C9B, 0x10CDB},
+  {0x10C9C, 0x10CDC}, {0x10C9D, 0x10CDD}, {0x10C9E, 0x10CDE},
+  {0x10C9F, 0x10CDF}, {0x10CA0, 0x10CE0}, {0x10CA1, 0x10CE1},
+  {0x10CA2, 0x10CE2}, {0x10CA3, 0x10CE3}, {0x10CA4, 0x10CE4},
+  {0x10CA5, 0x10CE5}, {0x10CA6, 0x10CE6}, {0x10CA7, 0x10CE7},
+  {0x10CA8, 0x10CE8}, {0x10CA9, 0x10CE9}, {0x10CAA, 0x10CEA},
+  {0x10CAB, 0x10CEB}, {0x10CAC, 0x10CEC}, {0x10CAD, 0x10CED},
+  {0x10CAE, 0x10CEE}, {0x10CAF, 0x10CEF}, {0x10CB0, 0x10CF0},
+  {0x10CB1, 0x10CF1}, {0x10CB2, 0x10CF2}, {0x118A0, 0x118C0},
+  {0x118A1, 0x118C1}, {0x118A2, 0x118C2}, {0x118A3, 0x118C3},
+  {0x118A4, 0x118C4}, {0x118A5, 0x118C5}, {0x118A6, 0x118C6},
+  {0x118A7, 0x118C7}, {0x118A8, 0x118C8}, {0x118A9, 0x118C9},
+  {0x118AA, 0x118CA}, {0x118AB, 0x118CB}, {0x118AC, 0x118CC},
+  {0x118AD, 0x118CD}, {0x118AE, 0x118CE}, {0x118AF, 0x118CF},
+  {0x118B0, 0x118D0}, {0x118B1, 0x118D1}, {0x118B2, 0x118D2},
+  {0x118B3, 0x118D3}, {0x118B4, 0x118D4}, {0x118B5, 0x118D5},
+  {0x118B6, 0x118D6}, {0x118B7, 0x118D7}, {0x118B8, 0x118D8},
+  {0x118B9, 0x118D9}, {0x118BA, 0x118DA}, {0x118BB, 0x118DB},
+  {0x118BC, 0x118DC}, {0x118BD, 0x118DD}, {0x118BE, 0x118DE},
+  {0x118BF, 0x118DF}, {0x16E40, 0x16E60}, {0x16E41, 0x16E61},
+  {0x16E42, 0x16E62}, {0x16E43, 0x16E63}, {0x16E44, 0x16E64},
+  {0x16E45, 0x16E65}, {0x16E46, 0x16E66}, {0x16E47, 0x16E67},
+  {0x16E48, 0x16E68}, {0x16E49, 0x16E69}, {0x16E4A, 0x16E6A},
+  {0x16E4B, 0x16E6B}, {0x16E4C, 0x16E6C}, {0x16E4D, 0x16E6D},
+  {0x16E4E, 0x16E6E}, {0x16E4F, 0x16E6F}, {0x16E50, 0x16E70},
+  {0x16E51, 0x16E71}, {0x16E52, 0x16E72}, {0x16E53, 0x16E73},
+  {0x16E54, 0x16E74}, {0x16E55, 0x16E75}, {0x16E56, 0x16E76},
+  {0x16E57, 0x16E77}, {0x16E58, 0x16E78}, {0x16E59, 0x16E79},
+  {0x16E5A, 0x16E7A}, {0x16E5B, 0x16E7B}, {0x16E5C, 0x16E7C},
+  {0x16E5D, 0x16E7D}, {0x16E5E, 0x16E7E}, {0x16E5F, 0x16E7F},
+  {0x1E900, 0x1E922}, {0x1E901, 0x1E923}, {0x1E902, 0x1E924},
+  {0x1E903, 0x1E925}, {0x1E904, 0x1E926}, {0x1E905, 0x1E927},
+  {0x1E906, 0x1E928}, {0x1E907, 0x1E929}, {0x1E908, 0x1E92A},
+  {0x1E909, 0x1E92B}, {0x1E90A, 0x1E92C}, {0x1E90B, 0x1E92D},
+  {0x1E90C, 0x1E92E}, {0x1E90D, 0x1E92F}, {0x1E90E, 0x1E930},
+  {0x1E90F, 0x1E931}, {0x1E910, 0x1E932}, {0x1E911, 0x1E933},
+  {0x1E912, 0x1E934}, {0x1E913, 0x1E935}, {0x1E914, 0x1E936},
+  {0x1E915, 0x1E937}, {0x1E916, 0x1E938}, {0x1E917, 0x1E939},
+  {0x1E918, 0x1E93A}, {0x1E919, 0x1E93B}, {0x1E91A, 0x1E93C},
+  {0x1E91B, 0x1E93D}, {0x1E91C, 0x1E93E}, {0x1E91D, 0x1E93F},
+  {0x1E91E, 0x1E940}, {0x1E91F, 0x1E941}, {0x1E920, 0x1E942},
+  {0x1E921, 0x1E943}
+};
+
+/* Full case folding (104 entries): code point, folded code points */
+constexpr u32 FoldFull[][4] = {
+  {0x00DF, 0x0073, 0x0073, 0x0000}, {0x0130, 0x0069, 0x0307, 0x0000},
+  {0x0149, 0x02BC, 0x006E, 0x0000}, {0x01F0, 0x006A, 0x030C, 0x0000},
+  {0x0390, 0x03B9, 0x0308, 0x0301}, {0x03B0, 0x03C5, 0x0308, 0x0301},
+  {0x0587, 0x0565, 0x0582, 0x0000}, {0x1E96, 0x0068, 0x0331, 0x0000},
+  {0x1E97, 0x0074, 0x0308, 0x0000}, {0x1E98, 0x0077, 0x030A, 0x0000},
+  {0x1E99, 0x0079, 0x030A, 0x0000}, {0x1E9A, 0x0061, 0x02BE, 0x0000},
+  {0x1E9E, 0x0073, 0x0073, 0x0000}, {0x1F50, 0x03C5, 0x0313, 0x0000},
+  {0x1F52, 0x03C5, 0x0313, 0x0300}, {0x1F54, 0x03C5, 0x0313, 0x0301},
+  {0x1F56, 0x03C5, 0x0313, 0x0342}, {0x1F80, 0x1F00, 0x03B9, 0x0000},
+  {0x1F81, 0x1F01, 0x03B9, 0x0000}, {0x1F82, 0x1F02, 0x03B9, 0x0000},
+  {0x1F83, 0x1F03, 0x03B9, 0x0000}, {0x1F84, 0x1F04, 0x03B9, 0x0000},
+  {0x1F85, 0x1F05, 0x03B9, 0x0000}, {0x1F86, 0x1F06, 0x03B9, 0x0000},
+  {0x1F87, 0x1F07, 0x03B9, 0x0000}, {0x1F88, 0x1F00, 0x03B9, 0x0000},
+  {0x1F89, 0x1F01, 0x03B9, 0x0000}, {0x1F8A, 0x1F02, 0x03B9, 0x0000},
+  {0x1F8B, 0x1F03, 0x03B9, 0x0000}, {0x1F8C, 0x1F04, 0x03B9, 0x0000},
+  {0x1F8D, 0x1F05, 0x03B9, 0x0000}, {0x1F8E, 0x1F06, 0x03B9, 0x0000},
+  {0x1F8F, 0x1F07, 0x03B9, 0x0000}, {0x1F90, 0x1F20, 0x03B9, 0x0000},
+  {0x1F91, 0x1F21, 0x03B9, 0x0000}, {0x1F92, 0x1F22, 0x03B9, 0x0000},
+  {0x1F93, 0x1F23, 0x03B9, 0x0000}, {0x1F94, 0x1F24, 0x03B9, 0x0000},
+  {0x1F95, 0x1F25, 0x03B9, 0x0000}, {0x1F96, 0x1F26, 0x03B9, 0x0000},
+  {0x1F97, 0x1F27, 0x03B9, 0x0000}, {0x1F98, 0x1F20, 0x03B9, 0x0000},
+  {0x1F99, 0x1F21, 0x03B9, 0x0000}, {0x1F9A, 0x1F22, 0x03B9, 0x0000},
+  {0x1F9B, 0x1F23, 0x03B9, 0x0000}, {0x1F9C, 0x1F24, 0x03B9, 0x0000},
+  {0x1F9D, 0x1F25, 0x03B9, 0x0000}, {0x1F9E, 0x1F26, 0x03B9, 0x0000},
+  {0x1F9F, 0x1F27, 0x03B9, 0x0000}, {0x1FA0, 0x1F60, 0x03B9, 0x0000},
+  {0x1FA1, 0x1F61, 0x03B9, 0x0000}, {0x1FA2, 0x1F62, 0x03B9, 0x0000},
+  {0x1FA3, 0x1F63, 0x03B9, 0x0000}, {0x1FA4, 0x1F64, 0x03B9, 0x0000},
+  {0x1FA5, 0x1F65, 0x03B9, 0x0000}, {0x1FA6, 0x1F66, 0x03B9, 0x0000},
+  {0x1FA7, 0x1F67, 0x03B9, 0x0000}, {0x1FA8, 0x1F60, 0x03B9, 0x0000},
+  {0x1FA9, 0x1F61, 0x03B9, 0x0000}, {0x1FAA, 0x1F62, 0x03B9, 0x0000},
+  {0x1FAB, 0x1F63, 0x03B9, 0x0000}, {0x1FAC, 0x1F64, 0x03B9, 0x0000},
+  {0x1FAD, 0x1F65, 0x03B9, 0x0000}, {0x1FAE, 0x1F66, 0x03B9, 0x0000},
+  {0x1FAF, 0x1F67, 0x03B9, 0x0000}, {0x1FB2, 0x1F70, 0x03B9, 0x0000},
+  {0x1FB3, 0x03B1, 0x03B9, 0x0000}, {0x1FB4, 0x03AC, 0x03B9, 0x0000},
+  {0x1FB6, 0x03B1, 0x0342, 0x0000}, {0x1FB7, 0x03B1, 0x0342, 0x03B9},
+  {0x1FBC, 0x03B1, 0x03B9, 0x0000}, {0x1FC2, 0x1F74, 0x03B9, 0x0000},
+  {0x1FC3, 0x03B7, 0x03B9, 0x0000}, {0x1FC4, 0x03AE, 0x03B9, 0x0000},
+  {0x1FC6, 0x03B7, 0x0342, 0x0000}, {0x1FC7, 0x03B7, 0x0342, 0x03B9},
+  {0x1FCC, 0x03B7, 0x03B9, 0x0000}, {0x1FD2, 0x03B9, 0x0308, 0x0300},
+  {0x1FD3, 0x03B9, 0x0308, 0x0301}, {0x1FD6, 0x03B9, 0x0342, 0x0000},
+  {0x1FD7, 0x03B9, 0x0308, 0x0342}, {0x1FE2, 0x03C5, 0x0308, 0x0300},
+  {0x1FE3, 0x03C5, 0x0308, 0x0301}, {0x1FE4, 0x03C1, 0x0313, 0x0000},
+  {0x1FE6, 0x03C5, 0x0342, 0x0000}, {0x1FE7, 0x03C5, 0x0308, 0x0342},
+  {0x1FF2, 0x1F7C, 0x03B9, 0x0000}, {0x1FF3, 0x03C9, 0x03B9, 0x0000},
+  {0x1FF4, 0x03CE, 0x03B9, 0x0000}, {0x1FF6, 0x03C9, 0x0342, 0x0000},
+  {0x1FF7, 0x03C9, 0x0342, 0x03B9}, {0x1FFC, 0x03C9, 0x03B9, 0x0000},
+  {0xFB00, 0x0066, 0x0066, 0x0000}, {0xFB01, 0x0066, 0x0069, 0x0000},
+  {0xFB02, 0x0066, 0x006C, 0x0000}, {0xFB03, 0x0066, 0x0066, 0x0069},
+  {0xFB04, 0x0066, 0x0066, 0x006C}, {0xFB05, 0x0073, 0x0074, 0x0000},
+  {0xFB06, 0x0073, 0x0074, 0x0000}, {0xFB13, 0x0574, 0x0576, 0x0000},
+  {0xFB14, 0x0574, 0x0565, 0x0000}, {0xFB15, 0x0574, 0x056B, 0x0000},
+  {0xFB16, 0x057E, 0x0576, 0x0000}, {0xFB17, 0x0574, 0x056D, 0x0000}
+};
+
+/* Simple case folding (28 entries): code point, folded code point */
+constexpr u32 FoldSimpleOnly[][2] = {
+  {0x1E9E, 0x00DF}, {0x1F88, 0x1F80}, {0x1F89, 0x1F81},
+  {0x1F8A, 0x1F82}, {0x1F8B, 0x1F83}, {0x1F8C, 0x1F84},
+  {0x1F8D, 0x1F85}, {0x1F8E, 0x1F86}, {0x1F8F, 0x1F87},
+  {0x1F98, 0x1F90}, {0x1F99, 0x1F91}, {0x1F9A, 0x1F92},
+  {0x1F9B, 0x1F93}, {0x1F9C, 0x1F94}, {0x1F9D, 0x1F95},
+  {0x1F9E, 0x1F96}, {0x1F9F, 0x1F97}, {0x1FA8, 0x1FA0},
+  {0x1FA9, 0x1FA1}, {0x1FAA, 0x1FA2}, {0x1FAB, 0x1FA3},
+  {0x1FAC, 0x1FA4}, {0x1FAD, 0x1FA5}, {0x1FAE, 0x1FA6},
+  {0x1FAF, 0x1FA7}, {0x1FBC, 0x1FB3}, {0x1FCC, 0x1FC3},
+  {0x1FFC, 0x1FF3}
+};
+
+/* Turkic case folding (2 entries): code point, folded code point */
+constexpr u32 FoldTurkic[][2] = {
+  {0x0049, 0x0131}, {0x0130, 0x0069}
+};
@@ -43,6 +43,14 @@
 */
 #endif /* !NDEBUG */
 
+#pragma warning( disable : 4127 ) /* conditional expression is constant =>
+
+** Most of the string functions are templates with an instantiation for each
+** database encoding, and they test the template arguments like any other
+** flag. The tests are meant to be constant, so the compiler can drop the
+** branches that don't apply to each instantiation.
+*/
+
 #pragma warning( disable : 4820 ) /* struct padding added =>
 
 ** We aren't concerned about struct padding per se, and we've arranged our own
@@ -55,6 +63,9 @@
 #include <string.h>
 #include "sqlite3ext.h"
 #include "utilext.h"
+#ifndef UTILEXT_OMIT_REGEX
+#include "rxengine.h"
+#endif
 
 SQLITE_EXTENSION_INIT1
 
@@ -109,6 +120,23 @@ void util_setText(sqlite3_context *pCtx, DbStr *pResult) {
   free((void*)pResult->pText);
 }
 
+/* Sets a text result from a native buffer of 'cb' bytes that is already in the
+** encoding of the function. The destructor is passed on to SQLite as-is. */
+void util_setTextN(sqlite3_context *pCtx,
+                   const void *pText,
+                   int cb,
+                   bool isWide,
+                   void(*xDel)(void*))
+{
+  assert(pText && cb >= 0);
+  if (isWide) {
+    sqlite3_result_text16(pCtx, pText, cb, xDel);
+  }
+  else {
+    sqlite3_result_text(pCtx, (const char*)pText, cb, xDel);
+  }
+}
+
 /* Sets a function error result based on the error code returned from the
 ** managed function call.
 */
@@ -144,6 +172,70 @@ int util_subCheck64(i64 *lhs, i64 rhs) {
   return util_addCheck64(lhs, -rhs);
 }
 
+/* Adds a signed long integer to a 128-bit value. The value is sign-extended
+** into the high word, and the carry out of the low word is propagated. */
+void util_add128(Int128 *lhs, i64 rhs) {
+  u64 lo = lhs->lo + (u64)rhs;
+  lhs->hi += (rhs < 0 ? -1 : 0) + (lo < lhs->lo ? 1 : 0);
+  lhs->lo = lo;
+}
+
+/* Subtracts a signed long integer from a 128-bit value. */
+void util_sub128(Int128 *lhs, i64 rhs) {
+  u64 lo = lhs->lo - (u64)rhs;
+  lhs->hi -= (rhs < 0 ? -1 : 0) + (lo > lhs->lo ? 1 : 0);
+  lhs->lo = lo;
+}
+
+/* Narrows a 128-bit value to a signed long integer. Returns non-zero if the
+** value is out of range, in which case 'pResult' is not written. */
+int util_get128(const Int128 *value, i64 *pResult) {
+  if ((value->hi == 0 && value->lo <= (u64)LLONG_MAX) ||
+      (value->hi == -1 && value->lo > (u64)LLONG_MAX))
+  {
+    *pResult = (i64)value->lo;
+    return 0;
+  }
+  return 1;
+}
+
+/* Divides a 128-bit sum by a non-zero count, truncating toward zero. The sum is
+** made up of 'cnt' signed long integers, so the quotient always fits in a
+** signed long integer, and the division can be done on the magnitude with a
+** 64-bit remainder.
+*/
+i64 util_avg128(const Int128 *sum, u64 cnt) {
+  bool neg = sum->hi < 0;
+  u64 lo = sum->lo;
+  u64 hi = (u64)sum->hi;
+  u64 q = 0;
+  u64 r;
+
+  assert(cnt > 0);
+  if (neg) {
+    lo = ~lo + 1;
+    hi = ~hi + (lo == 0 ? 1 : 0);
+  }
+  if (hi == 0) {
+    q = lo / cnt;
+  }
+  else {
+    /* Shift-subtract long division; hi < cnt, because the quotient fits in 64
+    ** bits, so we only have to bring down the bits of the low word. */
+    assert(hi < cnt);
+    r = hi;
+    for (int i = 63; i >= 0; i--) {
+      u64 carry = r >> 63;
+      r = (r << 1) | ((lo >> i) & 1);
+      if (carry || r >= cnt) {
+        r -= cnt;
+        q |= (u64)1 << i;
+      }
+    }
+  }
+  return neg ? (i64)(0 - q) : (i64)q;
+}
+
 
 void util_option(sqlite3_context *pCtx, int argc, sqlite3_value** argv) {
 #ifdef UTILEXT_OMIT_STRING
@@ -241,29 +333,14 @@ static int registerFunctions(sqlite3 *db) {
     { "dec_sub",        decSubFunc,     2, 0      },
     { "dec_trunc",      decTruncFunc,   1, 0      },
   #endif
-  #ifndef UTILEXT_OMIT_STRING
-    { "charindex",      charindexFunc,  2, 0      },
-    { "charindex_i",    charindexFunc,  2, NOCASE },
-    { "charindex",      charindexFunc,  3, 0      },
-    { "charindex_i",    charindexFunc,  3, NOCASE },
-    { "exfilter",       exfilterFunc,   2, 0      },
-    { "exfilter_i",     exfilterFunc,   2, NOCASE },
-    { "infilter",       infilterFunc,   2, 0      },
-    { "infilter_i",     infilterFunc,   2, NOCASE },
-    { "leftstr",        leftFunc,       2, 0      },
-    { "lower",          lowerFunc,      1, 0      },
-    { "padcenter",      padcFunc,       2, 0      },
-    { "padleft",        padlFunc,       2, 0      },
-    { "padright",       padrFunc,       2, 0      },
-    { "replicate",      replicateFunc,  2, 0      },
-    { "reverse",        reverseFunc,    1, 0      },
-    { "rightstr",       rightFunc,      2, 0      },
-    { "str_concat",     strcatFunc,    -1, 0      },
-    { "upper",          upperFunc,      1, 0      },
-  #endif
   #ifndef UTILEXT_OMIT_REGEX
     { "regexp",         regexFunc,      2, 0      },
     { "regexp",         regexFunc,      3, 0      },
+    { "regexp_count",   regexCountFunc, 2, 0      },
+    { "regexp_extract", regexExtractFunc, 2, 0    },
+    { "regexp_extract", regexExtractFunc, 3, 0    },
+    { "regexp_extract", regexExtractFunc, 4, 0    },
+    { "regex_unsupported", regexUnsupportedFunc, 1, 0 },
     { "regsub",         regsubFunc,     3, 0      },
     { "regsub",         regsubFunc,     4, 0      },
   #endif
@@ -274,11 +351,14 @@ static int registerFunctions(sqlite3 *db) {
     { "timespan",       timeCtor,       5, 0      },
     { "timespan_add",   timeAddFunc,   -1, 0      },
     { "timespan_addto", timeAddToFunc,  2, 0      },
+    { "timespan_addto", timeAddToFunc,  3, 0      },
     { "timespan_avg",   timeAvgAny,    -1, 0      },
     { "timespan_diff",  timeDiffFunc,   2, 0      },
+    { "timespan_diff",  timeDiffFunc,   3, 0      },
     { "timespan_cmp",   timeCmpFunc,    2, 0      },
     { "timespan_neg",   timeNegFunc,    1, 0      },
     { "timespan_str",   timeStrFunc,    1, 0      },
+    { "timespan_str",   timeStrFunc,    2, 0      },
     { "timespan_sub",   timeSubFunc,    2, 0      },
   #endif
   #ifndef UTILEXT_OMIT_BIGINT
@@ -325,15 +405,75 @@ static int registerFunctions(sqlite3 *db) {
                             sFuncs[i].xFunc, 0, 0);
   }
 
+#ifndef UTILEXT_OMIT_STRING
+  /* The string functions have an entry point for each encoding, so they don't
+  ** need any user data */
+  static const struct {
+    char *zName;
+    void(*xFunc8)(sqlite3_context*, int, sqlite3_value**);
+    void(*xFunc16)(sqlite3_context*, int, sqlite3_value**);
+    i8 nArg;
+  } eFuncs[] = {
+    { "charindex",   charindexFunc<false, false>,
+                     charindexFunc<true, false>,   2 },
+    { "charindex_i", charindexFunc<false, true>,
+                     charindexFunc<true, true>,    2 },
+    { "charindex",   charindexFunc<false, false>,
+                     charindexFunc<true, false>,   3 },
+    { "charindex_i", charindexFunc<false, true>,
+                     charindexFunc<true, true>,    3 },
+    { "exfilter",    exfilterFunc<false, false>,
+                     exfilterFunc<true, false>,    2 },
+    { "exfilter_i",  exfilterFunc<false, true>,
+                     exfilterFunc<true, true>,     2 },
+    { "infilter",    infilterFunc<false, false>,
+                     infilterFunc<true, false>,    2 },
+    { "infilter_i",  infilterFunc<false, true>,
+                     infilterFunc<true, true>,     2 },
+    { "leftstr",     leftFunc<false>,      leftFunc<true>,       2 },
+    { "lower",       lowerFunc<false>,     lowerFunc<true>,      1 },
+    { "padcenter",   padcFunc<false>,      padcFunc<true>,       2 },
+    { "padleft",     padlFunc<false>,      padlFunc<true>,       2 },
+    { "padright",    padrFunc<false>,      padrFunc<true>,       2 },
+    { "replicate",   replicateFunc<false>, replicateFunc<true>,  2 },
+    { "reverse",     reverseFunc<false>,   reverseFunc<true>,    1 },
+    { "rightstr",    rightFunc<false>,     rightFunc<true>,      2 },
+    { "str_concat",  strcatFunc<false>,    strcatFunc<true>,    -1 },
+    { "upper",       upperFunc<false>,     upperFunc<true>,      1 },
+    { "utf_sortkey", sortkeyFunc<false>,   sortkeyFunc<true>,    1 },
+    { "utf_sortkey", sortkeyFunc<false>,   sortkeyFunc<true>,    2 },
+  };
+  for (int i = 0; i < sizeof(eFuncs) / sizeof(eFuncs[0]); i++) {
+    sqlite3_create_function(db, eFuncs[i].zName, eFuncs[i].nArg,
+                            SQLITE_UTF8 | FUNC_FLAGS, 0,
+                            eFuncs[i].xFunc8, 0, 0);
+
+    sqlite3_create_function(db, eFuncs[i].zName, eFuncs[i].nArg,
+                            SQLITE_UTF16 | FUNC_FLAGS, 0,
+                            eFuncs[i].xFunc16, 0, 0);
+  }
+#endif /* !UTILEXT_OMIT_STRING */
+
 #ifndef UTILEXT_OMIT_REGEX
+  /* The compiled regex programs are shared by all connections */
+  if (rx_cacheInit()) return SQLITE_NOMEM;
   sqlite3_create_module(db, "regsplit", &splitvtabModule, 0);
+  sqlite3_create_module(db, "regmatch", &matchvtabModule, 0);
+
+  /* No SQLITE_DETERMINISTIC flag, since the counters change */
+  sqlite3_create_function(db, "regex_cache_stats", 0,
+                          SQLITE_UTF8 | FUNC_DIRECT,
+                          (void*)UTF8_ENC, regexCacheStatsFunc, 0, 0);
+
+  sqlite3_create_function(db, "regex_cache_stats", 0,
+                          SQLITE_UTF16 | FUNC_DIRECT,
+                          (void*)UTF16_ENC, regexCacheStatsFunc, 0, 0);
 #endif
 
   /* We need at least one of these to be undefined, or we have no collation
-  ** sequences.
+  ** sequences, other than the string collations that are registered below.
   */
 #if !defined(UTILEXT_OMIT_DECIMAL) ||\
-    !defined(UTILEXT_OMIT_STRING) ||\
     !defined(UTILEXT_OMIT_BIGINT)
   /* collation sequences */
   static const struct {
@@ -344,10 +484,6 @@ static int registerFunctions(sqlite3 *db) {
 #ifndef UTILEXT_OMIT_DECIMAL
     {"decimal", decCollate,  0      },
 #endif
-#ifndef UTILEXT_OMIT_STRING
-    {"utf",     utfCollate,  0      },
-    {"utf_i",   utfCollate,  NOCASE },
-#endif
 #ifndef UTILEXT_OMIT_BIGINT
     {"bigint",  bintCollate, 0      }
 #endif
@@ -364,12 +500,36 @@ static int registerFunctions(sqlite3 *db) {
                              (void*)(UTF16_ENC | cFuncs[i].userData),
                              cFuncs[i].xComp);
   }
-#endif /* !OMIT_STRING || !OMIT_DECIMAL || !OMIT_BIGINT */
+#endif /* !OMIT_DECIMAL || !OMIT_BIGINT */
+
+#ifndef UTILEXT_OMIT_STRING
+  /* The string collations each have their own cache of sort keys, which is
+  ** released along with the collation. */
+  static const struct {
+    char *zName;
+    int mode;
+    int(*xComp)(void*, int, const void*, int, const void*);
+  } uFuncs[] = {
+    {"utf",   UTF8_ENC,           utfCollate<false, false> },
+    {"utf",   UTF16_ENC,          utfCollate<true, false>  },
+    {"utf_i", UTF8_ENC | NOCASE,  utfCollate<false, true>  },
+    {"utf_i", UTF16_ENC | NOCASE, utfCollate<true, true>   }
+  };
+  for (int i = 0; i < sizeof(uFuncs) / sizeof(uFuncs[0]); i++) {
+    CollateState *pState = allocCollateState(uFuncs[i].mode);
+    if (!pState) return SQLITE_NOMEM;
+    sqlite3_create_collation_v2(db, uFuncs[i].zName,
+                                (uFuncs[i].mode & UTF16_ENC) ? SQLITE_UTF16 :
+                                                               SQLITE_UTF8,
+                                pState, uFuncs[i].xComp, destroyCollateState);
+  }
+#endif /* !UTILEXT_OMIT_STRING */
 
   /* At least one of these has to be not defined, or we have no aggregate
   ** functions.
   */
-#if !defined(UTILEXT_OMIT_DECIMAL) ||\
+#if !defined(UTILEXT_OMIT_STRING) ||\
+    !defined(UTILEXT_OMIT_DECIMAL) ||\
     !defined(UTILEXT_OMIT_TIME) ||\
     !defined(UTILEXT_OMIT_BIGINT)
 
@@ -382,6 +542,9 @@ static int registerFunctions(sqlite3 *db) {
     void(*xInverse)(sqlite3_context*, int, sqlite3_value**);
     void(*xValue)(sqlite3_context*);
   } aFuncs[] = {
+#ifndef UTILEXT_OMIT_STRING
+    {"str_concat",     2, concatStep, concatFinal, concatInv, concatValue },
+#endif
 #ifndef UTILEXT_OMIT_DECIMAL
     {"dec_avg",        1, decAvgStep, decAvgFinal, decAvgInv, decAvgValue },
     {"dec_total",      1, decTotStep, decTotFinal, decTotInv, decTotValue },
@@ -420,7 +583,7 @@ static int registerFunctions(sqlite3 *db) {
     }
   }
 
-#endif /* !OMIT_DECIMAL || !OMIT_TIME || !OMIT_BIGINT */
+#endif /* !OMIT_STRING || !OMIT_DECIMAL || !OMIT_TIME || !OMIT_BIGINT */
 
 #ifndef UTILEXT_OMIT_LIKE
 
@@ -483,14 +646,6 @@ extern "C" {
       return SQLITE_NOMEM;
     }
 #ifndef UTILEXT_OMIT_LIKE
-    Serialized = (sqlite3_db_mutex(db) != nullptr);
-    if (NEED_MUTEX) {
-      LikeMutex = sqlite3_mutex_alloc(SQLITE_MUTEX_FAST);
-      if (!LikeMutex) {
-        *pzErrMsg = sqlite3_mprintf("mutex allocation failed");
-        return SQLITE_NOMEM;
-      }
-    }
     MatchBlobs = sqlite3_compileoption_used("LIKE_DOESNT_MATCH_BLOBS") != 0;
 #endif
     return 0;
@@ -513,16 +668,6 @@ extern "C" {
       *pzErrMsg = sqlite3_mprintf("state allocation failed");
       return SQLITE_NOMEM;
     }
-#ifndef UTILEXT_OMIT_LIKE
-    Serialized = (sqlite3_db_mutex(db) != nullptr);
-    if (NEED_MUTEX) {
-      LikeMutex = sqlite3_mutex_alloc(SQLITE_MUTEX_FAST);
-      if (!LikeMutex) {
-        *pzErrMsg = sqlite3_mprintf("mutex allocation failed");
-        return SQLITE_NOMEM;
-      }
-    }
-#endif
     rc = sqlite3_auto_extension((xBlank)sqlite3_utilext_init);
     if (rc == SQLITE_OK) rc = SQLITE_OK_LOAD_PERMANENTLY;
     return rc;
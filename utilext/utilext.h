@@ -45,14 +45,6 @@
 #define PTR_TO_INT(X) (int)(X)
 #endif
 
-/* Cached mutex used to serialize access to the shared state of the like
-** function case-sensitivity. If the threading mode is single or multi, then
-** this is null */
-extern sqlite3_mutex *LikeMutex;
-extern bool Serialized;
-
-#define NEED_MUTEX LikeMutex == nullptr && Serialized
-
 /* Should the like function match BLOB arguments? */
 extern bool MatchBlobs;
 
@@ -76,12 +68,17 @@ struct DbStrArr {
 
 /* User data for like() and set_case_sensitive_like() functions. The shared
 ** pointer is a per-connection flag for whether or not like() is case-
-** sensitive; the default is true (not case-sensitive). */
+** sensitive; the default is 1 (not case-sensitive). The flag is only accessed
+** with atomic operations, so it needs no mutex. */
 struct LikeState {
-  bool *pNoCase;  /* shared pointer (default true) */
+  int *pNoCase;   /* shared pointer (default 1) */
   bool enc16;     /* true if encoding is UTF16 */
 };
 
+/* User data for the 'utf[_i]' collations; each one keeps a cache of recently
+** used sort keys (see "string.c"). */
+struct CollateState;
+
 /* Native struct that encapsulates a date value from SQLite, either as a Unix
 ** time, a Julian day, or an ISO-8601 string.
 */
@@ -94,11 +91,19 @@ struct DbDate {
   };
 };
 
-/* Aggregate context for the timespan total and avg functions */
+/* Signed 128-bit integer in two's complement form. There is no native 128-bit
+** integer type with MSVC, so we carry the high word ourselves. */
+struct Int128 {
+  u64 lo;  /* low 64 bits                 */
+  i64 hi;  /* high 64 bits, carries sign  */
+};
+
+/* Aggregate context for the timespan total and avg functions; the running sum
+** is wide enough that it cannot overflow, so overflow is only checked when a
+** result is produced. */
 struct SumCtx {
-  i64 sum;
-  u64 cnt;
-  bool overflow;
+  Int128 sum;  /* running sum of the values in the frame  */
+  u64 cnt;     /* count of non-NULL values in the frame   */
 };
 
 
@@ -106,10 +111,18 @@ struct SumCtx {
 int util_addCheck64(i64 *lhs, i64 rhs);
 int util_subCheck64(i64 *lhs, i64 rhs);
 
+/* 128-bit accumulator math for the TimeSpan aggregates */
+void util_add128(Int128 *lhs, i64 rhs);
+void util_sub128(Int128 *lhs, i64 rhs);
+int util_get128(const Int128 *value, i64 *pResult);
+i64 util_avg128(const Int128 *sum, u64 cnt);
+
 /* utilext helper prototypes */
 const char *util_getAscii(sqlite3_value *value, int *pBytes);
 void util_getText(sqlite3_value *value, bool isWide, DbStr *pStr);
 void util_setText(sqlite3_context *pCtx, DbStr *pResult);
+void util_setTextN(sqlite3_context *pCtx, const void *pText, int cb,
+                   bool isWide, void(*xDel)(void*));
 int util_getData(sqlite3_context *pCtx);
 bool util_getEnc16(sqlite3_context *pCtx);
 void util_setError(sqlite3_context *pCtx, int error);
@@ -1136,14 +1149,29 @@ void decTruncFunc(sqlite3_context*, int, sqlite3_value**);
 **
 ** Returns no rows if any argument is NULL.
 **
-** If `T` is not specified, or is less than or equal to zero, the regular
-** expression will run to completion, unless the `REGEX_DEFAULT_MATCH_TIMEOUT`
-** user property is set on the current managed AppDomain.
+** Patterns that the native regex engine supports are matched in time
+** proportional to the length of `S`, so `T` doesn't apply to them. Any other
+** pattern (one that uses backreferences, lookaround, atomic groups,
+** conditionals, balancing groups, `\G`, Unicode block names, or character
+** class subtraction, or that captures inside nested loops that can match the
+** empty string) is handed to the
+** `Regex.Split(string, string, RegexOptions, TimeSpan)` static method
+** instead; the regex_unsupported() function tells which patterns those are.
+**
+** For those patterns, if `T` is not specified, or is less than or equal to
+** zero, the regular expression will run to completion, unless the
+** `REGEX_DEFAULT_MATCH_TIMEOUT` user property is set on the current managed
+** AppDomain.
+**
+** Either way, `P` uses the .NET syntax, with the default options of
+** `RegexOptions.None`, which can be overridden to some extent with inline
+** options. The items that come from capture groups in `P` follow the
+** .NET rules.
 **
-** This function is a wrapper for the 
-** `Regex.Split(string, string, RegexOptions, TimeSpan)` static method. The
-** default options are `RegexOptions.None`, but can be overridden to some extent
-** with inline options.
+** With SQLite 3.38.0 and later, an IN list for `S`, as in
+** `WHERE input IN (SELECT body FROM docs)`, is split in one pass, with `P`
+** compiled once for all of its values; the hidden `input` column tells which
+** value each row came from.
 **
 ** Errors -
 **
@@ -1155,6 +1183,47 @@ void decTruncFunc(sqlite3_context*, int, sqlite3_value**);
 */
 extern struct sqlite3_module splitvtabModule;
 
+/* Implements the regmatch() table-valued SQL function
+** SQL Usage: regmatch(S, P)
+**            regmatch(S, P, T)
+**
+** Parameters -
+**
+**  S - The source string to search
+**  P - The regular expression pattern
+**  T - The timeout in milliseconds for the regular expression
+**
+** Returns one row for each match of `P` in `S`, in the order that
+** `Regex.Matches()` finds them, with these columns:
+**
+**  match - The text of the match
+**  offset - The offset of the match from the start of `S`, in bytes of its
+**         - UTF-8 encoding, counting from 0
+**  length - The length of the match, in bytes of its UTF-8 encoding
+**  groupN - The text of capture group N of `P`, for N from 1 through 9, or
+**         - NULL if the group doesn't exist or didn't take part in the match
+**
+** The rowid is the index of the match, counting from 0. All of the columns
+** of a row come from one search, so a log line can be parsed into several
+** columns without searching it once for each group.
+**
+** Returns no rows if there are no matches in `S`, or if any argument is NULL.
+**
+** `P` and `T` follow the same rules as they do for regsplit(): patterns that
+** the native regex engine supports are matched one row at a time, in time
+** proportional to the length of `S`, and `T` only applies to the patterns
+** that are handed to the `Regex.Matches()` method instead.
+**
+** Errors -
+**
+**  SQLITE_ABORT - The regex operation exceeded an alloted timeout interval
+**  SQLITE_ERROR - There were not enough arguments supplied to the function
+**               - or there was an error parsing the regex pattern. Call
+**               - <i>sqlite3_errmsg()</i> to retrieve the error message
+**  SQLITE_NOMEM - Memory allocation failed
+*/
+extern struct sqlite3_module matchvtabModule;
+
 /* Implements the regexp() SQL function.
 ** SQL Usage: regexp(P, S)  S REGEXP P
 **            regexp(P, S, T)  no equivalent operator
@@ -1169,14 +1238,26 @@ extern struct sqlite3_module splitvtabModule;
 **
 ** Returns NULL if any argument is NULL.
 **
-** If `T` is not specified, or is less than or equal to zero, the regular
-** expression will run to completion, unless the `REGEX_DEFAULT_MATCH_TIMEOUT`
-** user property is set on the current managed AppDomain.
+** Patterns that the native regex engine supports are matched in time
+** proportional to the length of `S`, so `T` doesn't apply to them. Any other
+** pattern (one that uses backreferences, lookaround, atomic groups,
+** conditionals, balancing groups, `\G`, Unicode block names, or character
+** class subtraction, or that captures inside nested loops that can match the
+** empty string) is handed to the
+** `Regex.IsMatch(string, string, RegexOptions, TimeSpan)` static method
+** instead; the regex_unsupported() function tells which patterns those are.
 **
-** This function is a wrapper for the
-** `Regex.IsMatch(string, string, RegexOptions, TimeSpan)` static method. The
-** default options are `RegexOptions.None`, but can be overridden to some extent
-** with inline options.
+** For those patterns, if `T` is not specified, or is less than or equal to
+** zero, the regular expression will run to completion, unless the
+** `REGEX_DEFAULT_MATCH_TIMEOUT` user property is set on the current managed
+** AppDomain.
+**
+** Either way, `P` uses the .NET syntax, with the default options of
+** `RegexOptions.None`, which can be overridden to some extent with inline
+** options. With `(?i)`, the native engine compares characters by their
+** Unicode simple case folding, rather than by the lower case mappings of the
+** current culture; the only culture it follows is Turkish or Azeri, for the
+** dotted and dotless I.
 **
 ** Errors -
 **
@@ -1188,6 +1269,70 @@ extern struct sqlite3_module splitvtabModule;
 */
 void regexFunc(sqlite3_context*, int, sqlite3_value**);
 
+/* Implements the regexp_count() SQL function.
+** SQL Usage: regexp_count(S, P)
+**
+** Parameters -
+**
+**  S - The string to search
+**  P - The regular expression pattern
+**
+** Returns the count of matches of `P` in `S`, as `Regex.Matches()` finds
+** them, without building a string for any of them.
+**
+** Returns NULL if any argument is NULL.
+**
+** Patterns that the native regex engine supports are matched in time
+** proportional to the length of `S`. Any other pattern is handed to the
+** managed Regex class, and runs to completion, unless the
+** `REGEX_DEFAULT_MATCH_TIMEOUT` user property is set on the current managed
+** AppDomain.
+**
+** Errors -
+**
+**  SQLITE_ABORT - The regex operation exceeded an alloted timeout interval
+**  SQLITE_ERROR - There was an error parsing the regex pattern. Call
+**               - <i>sqlite3_errmsg()</i> to retrieve the error message
+**  SQLITE_NOMEM - Memory allocation failed
+*/
+void regexCountFunc(sqlite3_context*, int, sqlite3_value**);
+
+/* Implements the regexp_extract() SQL function.
+** SQL Usage: regexp_extract(S, P)
+**            regexp_extract(S, P, G)
+**            regexp_extract(S, P, G, N)
+**
+** Parameters -
+**
+**  S - The string to search
+**  P - The regular expression pattern
+**  G - The number of the capture group to return, or 0 for the whole match
+**  N - Which match to return the group of, counting from 1
+**
+** Returns the text of group `G` of match `N` of `P` in `S`, as
+** `Regex.Matches()` finds them. If `G` is not specified, the whole match is
+** returned; if `N` is not specified, the first match is used. The text is
+** taken straight from `S`, with nothing else built along the way.
+**
+** Returns NULL if there are fewer than `N` matches, if group `G` didn't take
+** part in the match, or if any argument is NULL.
+**
+** Patterns that the native regex engine supports are matched in time
+** proportional to the length of `S`. Any other pattern is handed to the
+** managed Regex class, and runs to completion, unless the
+** `REGEX_DEFAULT_MATCH_TIMEOUT` user property is set on the current managed
+** AppDomain.
+**
+** Errors -
+**
+**  SQLITE_ABORT - The regex operation exceeded an alloted timeout interval
+**  SQLITE_ERROR - There was an error parsing the regex pattern. Call
+**               - <i>sqlite3_errmsg()</i> to retrieve the error message
+**  SQLITE_NOMEM - Memory allocation failed
+**  SQLITE_RANGE - `P` has no group `G`, or `N` is less than 1
+*/
+void regexExtractFunc(sqlite3_context*, int, sqlite3_value**);
+
 /* Implements the regsub() SQL function
 ** SQL Usage: regsub(S, P, R)
 **            regsub(S, P, R, T)
@@ -1207,14 +1352,24 @@ void regexFunc(sqlite3_context*, int, sqlite3_value**);
 ** For those familiar with the Tcl command `regsub`, this is equivalent to
 ** `regsub -all $P $S $R `.
 **
-** If `T` is not specified, or is less than or equal to zero, the regular
-** expression will run to completion, unless the `REGEX_DEFAULT_MATCH_TIMEOUT`
-** user property is set on the current managed AppDomain.
+** Patterns that the native regex engine supports are matched in time
+** proportional to the length of `S`, so `T` doesn't apply to them. Any other
+** pattern (one that uses backreferences, lookaround, atomic groups,
+** conditionals, balancing groups, `\G`, Unicode block names, or character
+** class subtraction, or that captures inside nested loops that can match the
+** empty string) is handed to the
+** `Regex.Replace(string, string, string, RegexOptions, TimeSpan)` static method
+** instead; the regex_unsupported() function tells which patterns those are.
 **
-** This function is a wrapper for the 
-** `Regex.Replace(string, string, string, RegexOptions, TimeSpan)` static method.
-** The default options are `RegexOptions.None`, but can be overridden to some
-** extent with inline options.
+** For those patterns, if `T` is not specified, or is less than or equal to
+** zero, the regular expression will run to completion, unless the
+** `REGEX_DEFAULT_MATCH_TIMEOUT` user property is set on the current managed
+** AppDomain.
+**
+** Either way, `P` uses the .NET syntax, with the default options of
+** `RegexOptions.None`, which can be overridden to some extent with inline
+** options. The substitutions in `R` (`$1`, `${name}`, `$&`, and so on)
+** follow the .NET rules.
 **
 ** Errors -
 **
@@ -1226,6 +1381,52 @@ void regexFunc(sqlite3_context*, int, sqlite3_value**);
 */
 void regsubFunc(sqlite3_context*, int, sqlite3_value**);
 
+/* Implements the regex_unsupported() SQL function.
+** SQL Usage: regex_unsupported(P)
+**
+** Parameters -
+**
+**  P - The regular expression pattern
+**
+** Returns NULL if the native regex engine runs `P`, so that the regex functions
+** never need a timeout for it. Otherwise, returns a description of the feature
+** in `P` that the native engine doesn't support (such as "backreferences"), or
+** the .NET error message if `P` is not a valid pattern. The regex functions
+** hand such patterns to the managed Regex class.
+**
+** Returns NULL if `P` is NULL.
+**
+** Errors -
+**
+**  SQLITE_NOMEM - Memory allocation failed
+*/
+void regexUnsupportedFunc(sqlite3_context*, int, sqlite3_value**);
+
+/* Implements the regex_cache_stats() SQL function.
+** SQL Usage: regex_cache_stats()
+**
+** Returns the counters of the process-wide cache of compiled regex programs,
+** as a JSON object with these members:
+**
+**   hits      - lookups that found a compiled program
+**   misses    - lookups that had to compile the pattern
+**   evictions - programs evicted to keep the cache within its memory limit
+**   entries   - count of programs in the cache
+**   bytes     - memory held by the programs in the cache
+**   limit     - most memory that the programs in the cache may hold
+**
+** A statement compiles its pattern the first time it sees it, by looking it up
+** in the cache, which is shared by every connection in the process; the limit
+** can be set when the library is built with the `UTILEXT_REGEX_CACHE_SIZE`
+** preprocessor symbol (4 MB by default). Patterns that have to go to the
+** managed Regex class aren't cached.
+**
+** Errors -
+**
+**  SQLITE_NOMEM - Memory allocation failed
+*/
+void regexCacheStatsFunc(sqlite3_context*, int, sqlite3_value**);
+
 #endif /* !UTILEXT_OMIT_REGEX */
 
 #ifndef UTILEXT_OMIT_TIME
@@ -1340,17 +1541,28 @@ void timeSubFunc(sqlite3_context*, int, sqlite3_value**);
 
 /* Implements the timespan_str() SQL function.
 ** SQL Usage: timespan_str(V)
+**            timespan_str(V, F)
 **
 ** Parameters -
 **
 **  V - A 64-bit signed integer timespan value
+**  F - Format specifier for the result
 **
-** Returns a string in the format `[-][d.]hh:mm:ss[.fffffff]`
+** Returns a string in the format specified by `F`:
 **
-** Returns NULL if `V` is NULL.
+**  'c'   - `[-][d.]hh:mm:ss[.fffffff]` (the default)
+**  'g'   - `[-][d:]h:mm:ss[.FFFFFFF]`, with trailing fraction zeros omitted
+**  'iso' - ISO-8601 duration `[-]P[nD][T[nH][nM][n[.F]S]]`, with zero
+**        - components omitted; a zero timespan is `PT0S`
+**
+** The 'c' and 'g' formats match the invariant culture output of the .NET
+** TimeSpan.ToString() method. The 'iso' specifier is not case-sensitive.
+**
+** Returns NULL if `V` is NULL. If `F` is NULL, the 'c' format is used.
 **
 ** Errors -
 **
+**  SQLITE_NOTFOUND - `F` is not a recognized format specifier
 **  SQLITE_NOMEM - Memory allocation failed
 */
 void timeStrFunc(sqlite3_context*, int, sqlite3_value**);
@@ -1397,11 +1609,13 @@ void timeCmpFunc(sqlite3_context*, int, sqlite3_value**);
 
 /* Implements the timespan_addto() SQL function.
 ** SQL Usage: timespan_addto(D, V)
+**            timespan_addto(D, V, Z)
 **
 ** Parameters -
 **
 **  D - A valid date/time value in either TEXT, INTEGER, or REAL format
 **  V - A 64-bit signed integer timespan value
+**  Z - A time zone identifier
 **
 ** Returns a date/time value with the timespan `V` added to `D`, in the same
 ** format as `D`.
@@ -1419,22 +1633,39 @@ void timeCmpFunc(sqlite3_context*, int, sqlite3_value**);
 ** If `D` is in REAL format, it is presumed to be a Julian day value that
 ** represents a valid .NET Framework `DateTime` value.
 **
+** If `Z` is specified, it is the identifier of a time zone on the host machine,
+** like 'Pacific Standard Time', or an empty string for the local time zone of
+** the host. A TEXT value of `D` without offset information is then a local
+** time in that zone, and the result is the local time in that zone with the
+** UTC offset included, like '2021-11-07T01:30:00-08:00'. A local time that is
+** invalid or ambiguous because of a daylight time transition uses the standard
+** time offset. INTEGER and REAL values are always UTC, so `Z` has no effect on
+** them, although it must still be a recognized identifier. If `Z` is NULL, it
+** is ignored.
+**
+** The offset transitions of each time zone are loaded once and cached for the
+** life of the process, so that converting local times does not query the time
+** zone rules for every row.
+**
 ** Errors -
 **
 **  SQLITE_MISMATCH - D is a BLOB value
 **  SQLITE_FORMAT   - D is a TEXT value and is not in the proper format
 **  SQLITE_RANGE    - The result is out of range for a timespan value
 **  SQLITE_ERROR    - D is an invalid Unix time or Julian day value
+**  SQLITE_NOTFOUND - Z is not a recognized time zone identifier
 */
 void timeAddToFunc(sqlite3_context*, int, sqlite3_value**);
 
 /* Implements the timespan_diff() SQL function.
 ** SQL Usage: timespan_diff(D1, D2)
+**            timespan_diff(D1, D2, Z)
 **
 ** Parameters -
 **
 **  D1 - A valid date/time value in either TEXT, INTEGER, or REAL format
 **  D2 - A valid date/time value in either TEXT, INTEGER, or REAL format
+**  Z  - A time zone identifier
 **
 ** Returns a 64-bit signed integer timespan value that is the result of
 ** subtracting `D2` from `D1`.
@@ -1457,11 +1688,19 @@ void timeAddToFunc(sqlite3_context*, int, sqlite3_value**);
 ** If data is in REAL format, it is presumed to be a Julian day value that
 ** represents a valid .NET Framework `DateTime` value.
 **
+** If `Z` is specified, it is the identifier of a time zone on the host machine,
+** like 'Pacific Standard Time', or an empty string for the local time zone of
+** the host. TEXT values without offset information are then local times in
+** that zone, and both values are converted to UTC before subtracting, so the
+** result is the elapsed time across any daylight time transitions. If `Z` is
+** NULL, it is ignored.
+**
 ** Errors -
 **
 **  SQLITE_MISMATCH - D1 or D2 is a BLOB value
 **  SQLITE_FORMAT   - D1 or D2 is a TEXT value and is not in the proper format
 **  SQLITE_ERROR    - D1 or D2 is an invalid Unix time or Julian day value
+**  SQLITE_NOTFOUND - Z is not a recognized time zone identifier
 */
 void timeDiffFunc(sqlite3_context*, int, sqlite3_value ** argv);
 
@@ -1477,11 +1716,16 @@ void timeDiffFunc(sqlite3_context*, int, sqlite3_value ** argv);
 ** This function will return 0 if the group contains only NULL values. This
 ** behavior matches the SQLite `total()` function.
 **
+** The running total is kept as a 128-bit integer, so it is only an error if
+** the total of the group (or of the current window frame) is out of range for
+** a timespan value. Intermediate sums that exceed that range do not raise an
+** error.
+**
 ** [Aggregate]
 **
 ** Errors -
 **
-**  SQLITE_TOOBIG - The operation resulted in signed integer overflow
+**  SQLITE_TOOBIG - The result is out of range for a timespan value
 **  SQLITE_NOMEM  - Memory allocation failed
 */
 void timeTotStep(sqlite3_context*, int, sqlite3_value**);
@@ -1507,11 +1751,14 @@ void timeTotVal(sqlite3_context*);
 ** 100-nanosecond ticks, so integer division will result in a fairly precise
 ** value.
 **
+** The running total is kept as a 128-bit integer, so the average is computed
+** exactly from the true sum (then truncated toward zero), and never results in
+** overflow, no matter how large the values in the group are.
+**
 ** [Aggregate]
 **
 ** Errors -
 **
-**  SQLITE_TOOBIG - The operation resulted in signed integer overflow
 **  SQLITE_NOMEM  - Memory allocation failed
 */
 void timeAvgStep(sqlite3_context*, int, sqlite3_value**);
@@ -1546,6 +1793,11 @@ void destroyLikeState(void *ps);
 ** symbol, so it will return false if the `SQLITE_LIKE_DOESNT_MATCH_BLOBS`
 ** symbol is defined and either argument is a BLOB.
 **
+** When case is ignored, characters are compared by their Unicode case folding,
+** so '' matches '', and '' matches the capital sharp s. The Turkic mappings
+** for dotted and dotless I are used if the current culture is Turkish or
+** Azeri.
+**
 ** Errors -
 **
 **  SQLITE_TOOBIG - The length in bytes of P exceeded the like pattern limit for
@@ -1604,6 +1856,7 @@ void setLikeFunc(sqlite3_context *pCtx, int argc, sqlite3_value **argv);
 **  SQLITE_RANGE - I evaluates to less than 1 or greater than the length of S
 **  SQLITE_NOMEM - Memory allocation failed
 */
+template<bool isWide, bool noCase>
 void charindexFunc(sqlite3_context*, int, sqlite3_value**);
 
 /* Implements the exfilter[_i]() SQL function
@@ -1624,10 +1877,14 @@ void charindexFunc(sqlite3_context*, int, sqlite3_value**);
 **
 ** [comparison] - case sensitive or not, depending on version called
 **
+** With the `_i` version, characters match if they have the same Unicode case
+** folding; the characters that are kept have the same case they had in `S`.
+**
 ** Errors -
 **
 **  SQLITE_NOMEM - Memory allocation failed
 */
+template<bool isWide, bool noCase>
 void exfilterFunc(sqlite3_context*, int, sqlite3_value**);
 
 /* Implements the infilter[_i]() SQL function.
@@ -1648,10 +1905,14 @@ void exfilterFunc(sqlite3_context*, int, sqlite3_value**);
 **
 ** [comparison] - case sensitive or not, depending on version called
 **
+** With the `_i` version, characters match if they have the same Unicode case
+** folding; the characters that are kept have the same case they had in `S`.
+**
 ** Errors -
 **
 **  SQLITE_NOMEM - Memory allocation failed
 */
+template<bool isWide, bool noCase>
 void infilterFunc(sqlite3_context*, int, sqlite3_value**);
 
 /* Implements the leftstr() SQL function.
@@ -1673,6 +1934,7 @@ void infilterFunc(sqlite3_context*, int, sqlite3_value**);
 **  SQLITE_MISUSE - N is less than zero
 **  SQLITE_NOMEM  - Memory allocation failed
 */
+template<bool isWide>
 void leftFunc(sqlite3_context*, int, sqlite3_value**);
 
 /* Implements the lower() SQL function override.
@@ -1691,6 +1953,7 @@ void leftFunc(sqlite3_context*, int, sqlite3_value**);
 **
 **  SQLITE_NOMEM - Memory allocation failed
 */
+template<bool isWide>
 void lowerFunc(sqlite3_context*, int, sqlite3_value**);
 
 /* Implements the padcenter() SQL function.
@@ -1714,8 +1977,10 @@ void lowerFunc(sqlite3_context*, int, sqlite3_value**);
 ** Errors -
 **
 **  SQLITE_MISUSE - N is less than zero
+**  SQLITE_TOOBIG - The result is longer than the length limit
 **  SQLITE_NOMEM  - Memory allocation failed
 */
+template<bool isWide>
 void padcFunc(sqlite3_context*, int, sqlite3_value**);
 
 /* Implements the padleft() SQL function.
@@ -1737,8 +2002,10 @@ void padcFunc(sqlite3_context*, int, sqlite3_value**);
 ** Errors -
 **
 **  SQLITE_MISUSE - N is less than zero
+**  SQLITE_TOOBIG - The result is longer than the length limit
 **  SQLITE_NOMEM  - Memory allocation failed
 */
+template<bool isWide>
 void padlFunc(sqlite3_context*, int, sqlite3_value**);
 
 /* Implements the padright() SQL function.
@@ -1760,8 +2027,10 @@ void padlFunc(sqlite3_context*, int, sqlite3_value**);
 ** Errors -
 **
 **  SQLITE_MISUSE - N is less than zero
+**  SQLITE_TOOBIG - The result is longer than the length limit
 **  SQLITE_NOMEM  - Memory allocation failed
 */
+template<bool isWide>
 void padrFunc(sqlite3_context*, int, sqlite3_value**);
 
 /* Implements the replicate() SQL function.
@@ -1781,8 +2050,10 @@ void padrFunc(sqlite3_context*, int, sqlite3_value**);
 ** Errors -
 **
 **  SQLITE_MISUSE - N is less than zero
+**  SQLITE_TOOBIG - The result is longer than the length limit
 **  SQLITE_NOMEM  - Memory allocation failed
 */
+template<bool isWide>
 void replicateFunc(sqlite3_context*, int, sqlite3_value**);
 
 /* Implements the reverse() SQL function.
@@ -1800,6 +2071,7 @@ void replicateFunc(sqlite3_context*, int, sqlite3_value**);
 **
 **  SQLITE_NOMEM - Memory allocation failed
 */
+template<bool isWide>
 void reverseFunc(sqlite3_context*, int, sqlite3_value**);
 
 /* Implements the rightstr() SQL function.
@@ -1821,6 +2093,7 @@ void reverseFunc(sqlite3_context*, int, sqlite3_value**);
 **  SQLITE_MISUSE - N is less than zero
 **  SQLITE_NOMEM  - Memory allocation failed
 */
+template<bool isWide>
 void rightFunc(sqlite3_context*, int, sqlite3_value**);
 
 /* Implements the set_culture() SQL function. [MISC]
@@ -1852,6 +2125,9 @@ void rightFunc(sqlite3_context*, int, sqlite3_value**);
 ** configuration of the target machine, some trial-and-error will undoubtedly
 ** be required.
 **
+** Setting a Turkish or Azeri culture also selects the Turkic case folding of
+** dotted and dotless I for case-insensitive `like()`.
+**
 ** NOTE: The `set_culture()` function is NOT thread safe. This function is
 ** intended to be called once at application start. If this function is called
 ** on one connection while there are other open connections, the effects on the
@@ -1879,13 +2155,49 @@ void cultureFunc(sqlite3_context*, int, sqlite3_value**);
 **
 ** Returns NULL if all supplied values are NULL.
 **
+** With exactly two arguments, this is the `str_concat()` aggregate function.
+**
 ** Errors -
 **
-**  SQLITE_MISUSE - S is NULL, or less than 3 arguments are supplied
+**  SQLITE_MISUSE - S is NULL, or no values are supplied
+**  SQLITE_TOOBIG - The result is longer than the length limit
 **  SQLITE_NOMEM  - Memory allocation failed
 */
+template<bool isWide>
 void strcatFunc(sqlite3_context*, int, sqlite3_value**);
 
+/* Implements the str_concat() aggregate SQL function.
+** SQL Usage: str_concat(S, sep)
+**
+** Parameters -
+**
+**  S   - A value (interpreted as text) to be concatenated
+**  sep - The separator string to put in front of S
+**
+** Returns a string containing all non-NULL values in the group, each one
+** separated from the one before it by the `sep` value of its own row. If `sep`
+** is NULL, an error is returned. To use an empty string as the separator,
+** specify an empty string.
+**
+** Returns NULL if there are only NULL values in the group.
+**
+** This function works like the SQLite `group_concat()` function, except that
+** the separator must be supplied, and the result is built in the database
+** encoding without any conversion.
+**
+** [Aggregate]
+**
+** Errors -
+**
+**  SQLITE_MISUSE - sep is NULL
+**  SQLITE_TOOBIG - The result is longer than the length limit
+**  SQLITE_NOMEM  - Memory allocation failed
+*/
+void concatStep(sqlite3_context*, int, sqlite3_value**);
+void concatFinal(sqlite3_context*);
+void concatInv(sqlite3_context*, int, sqlite3_value**);
+void concatValue(sqlite3_context*);
+
 /* Implements the upper() SQL function override.
 ** SQL Usage: upper(S)
 **
@@ -1902,14 +2214,48 @@ void strcatFunc(sqlite3_context*, int, sqlite3_value**);
 **
 **  SQLITE_NOMEM - Memory allocation failed
 */
+template<bool isWide>
 void upperFunc(sqlite3_context*, int, sqlite3_value**);
 
+/* Implements the utf_sortkey() SQL function.
+** SQL Usage: utf_sortkey(S)
+**            utf_sortkey(S, N)
+**
+** Parameters -
+**
+**  S - The string to compute a key for
+**  N - Optional boolean; true to ignore case
+**
+** Returns a BLOB that holds the sort key of `S` for the currently defined
+** .NET Framework culture. Sort keys compare byte-wise (as BLOBs do) in the
+** same order as their strings compare with the `UTF` collation, or with the
+** `UTF_I` collation if `N` is true, so an index on `utf_sortkey(S)` can stand
+** in for an index on `S COLLATE UTF`.
+**
+** A sort key is only valid for the culture that produced it; an index of sort
+** keys has to be rebuilt (with REINDEX) if the culture changes.
+**
+** Returns NULL if `S` is NULL.
+**
+** Errors -
+**
+**  SQLITE_NOMEM - Memory allocation failed
+*/
+template<bool isWide>
+void sortkeyFunc(sqlite3_context*, int, sqlite3_value**);
+
 /* Implements the 'utf[_i]' collation sequence
 ** SQL Usage: COLLATE UTF[_I]
 **
 ** Performs a sort-order comparison according to the currently-defined culture.
 **
+** Each connection keeps the sort keys of the strings it has compared most
+** recently, so sorting and grouping compare most strings by their keys.
+**
 ** [comparison] - case sensitive or not, depending on version called
 */
+template<bool isWide, bool noCase>
 int utfCollate(void*, int, const void*, int, const void*);
+CollateState *allocCollateState(int mode);
+void destroyCollateState(void *ps);
 #endif /* !UTILEXT_OMIT_STRING */